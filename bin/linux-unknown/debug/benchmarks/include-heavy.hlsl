@@ -0,0 +1,57 @@
+//BENCH: -profile ps_5_0 -entry main -target hlsl
+
+// Generated by `slang-bench -generate`: HLSL that includes many headers.
+
+#include "include-heavy/common-0.h"
+#include "include-heavy/common-1.h"
+#include "include-heavy/common-2.h"
+#include "include-heavy/common-3.h"
+#include "include-heavy/common-4.h"
+#include "include-heavy/common-5.h"
+#include "include-heavy/common-6.h"
+#include "include-heavy/common-7.h"
+#include "include-heavy/common-8.h"
+#include "include-heavy/common-9.h"
+#include "include-heavy/common-10.h"
+#include "include-heavy/common-11.h"
+#include "include-heavy/common-12.h"
+#include "include-heavy/common-13.h"
+#include "include-heavy/common-14.h"
+#include "include-heavy/common-15.h"
+#include "include-heavy/common-16.h"
+#include "include-heavy/common-17.h"
+#include "include-heavy/common-18.h"
+#include "include-heavy/common-19.h"
+#include "include-heavy/common-20.h"
+#include "include-heavy/common-21.h"
+#include "include-heavy/common-22.h"
+#include "include-heavy/common-23.h"
+#include "include-heavy/common-24.h"
+#include "include-heavy/common-25.h"
+#include "include-heavy/common-26.h"
+#include "include-heavy/common-27.h"
+#include "include-heavy/common-28.h"
+#include "include-heavy/common-29.h"
+#include "include-heavy/common-30.h"
+#include "include-heavy/common-31.h"
+#include "include-heavy/common-32.h"
+#include "include-heavy/common-33.h"
+#include "include-heavy/common-34.h"
+#include "include-heavy/common-35.h"
+#include "include-heavy/common-36.h"
+#include "include-heavy/common-37.h"
+#include "include-heavy/common-38.h"
+#include "include-heavy/common-39.h"
+#include "include-heavy/common-40.h"
+#include "include-heavy/common-41.h"
+#include "include-heavy/common-42.h"
+#include "include-heavy/common-43.h"
+#include "include-heavy/common-44.h"
+#include "include-heavy/common-45.h"
+#include "include-heavy/common-46.h"
+#include "include-heavy/common-47.h"
+
+float4 main(float4 position : SV_Position) : SV_Target
+{
+    return common47(position);
+}
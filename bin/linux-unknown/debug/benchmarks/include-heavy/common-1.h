@@ -0,0 +1,22 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_1_H
+#define COMMON_1_H
+
+#include "common-0.h"
+
+#define SCALE_1(x) ((x) * 2.0 + BIAS_1)
+#define BIAS_1 1.5
+
+#if defined(USE_FAST_PATH) && 1 % 2 == 0
+float4 common1(float4 x) { return SCALE_1(x); }
+#else
+float4 common1(float4 x)
+{
+    float4 y = SCALE_1(x);
+    y += common0(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
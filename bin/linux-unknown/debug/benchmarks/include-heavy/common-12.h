@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_12_H
+#define COMMON_12_H
+
+#include "common-10.h"
+#include "common-11.h"
+
+#define SCALE_12(x) ((x) * 13.0 + BIAS_12)
+#define BIAS_12 12.5
+
+#if defined(USE_FAST_PATH) && 12 % 2 == 0
+float4 common12(float4 x) { return SCALE_12(x); }
+#else
+float4 common12(float4 x)
+{
+    float4 y = SCALE_12(x);
+    y += common11(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
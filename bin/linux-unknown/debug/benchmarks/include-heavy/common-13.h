@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_13_H
+#define COMMON_13_H
+
+#include "common-11.h"
+#include "common-12.h"
+
+#define SCALE_13(x) ((x) * 14.0 + BIAS_13)
+#define BIAS_13 13.5
+
+#if defined(USE_FAST_PATH) && 13 % 2 == 0
+float4 common13(float4 x) { return SCALE_13(x); }
+#else
+float4 common13(float4 x)
+{
+    float4 y = SCALE_13(x);
+    y += common12(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_14_H
+#define COMMON_14_H
+
+#include "common-12.h"
+#include "common-13.h"
+
+#define SCALE_14(x) ((x) * 15.0 + BIAS_14)
+#define BIAS_14 14.5
+
+#if defined(USE_FAST_PATH) && 14 % 2 == 0
+float4 common14(float4 x) { return SCALE_14(x); }
+#else
+float4 common14(float4 x)
+{
+    float4 y = SCALE_14(x);
+    y += common13(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
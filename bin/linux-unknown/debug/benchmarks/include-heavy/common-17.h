@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_17_H
+#define COMMON_17_H
+
+#include "common-15.h"
+#include "common-16.h"
+
+#define SCALE_17(x) ((x) * 18.0 + BIAS_17)
+#define BIAS_17 17.5
+
+#if defined(USE_FAST_PATH) && 17 % 2 == 0
+float4 common17(float4 x) { return SCALE_17(x); }
+#else
+float4 common17(float4 x)
+{
+    float4 y = SCALE_17(x);
+    y += common16(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
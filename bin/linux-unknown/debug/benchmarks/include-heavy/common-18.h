@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_18_H
+#define COMMON_18_H
+
+#include "common-16.h"
+#include "common-17.h"
+
+#define SCALE_18(x) ((x) * 19.0 + BIAS_18)
+#define BIAS_18 18.5
+
+#if defined(USE_FAST_PATH) && 18 % 2 == 0
+float4 common18(float4 x) { return SCALE_18(x); }
+#else
+float4 common18(float4 x)
+{
+    float4 y = SCALE_18(x);
+    y += common17(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
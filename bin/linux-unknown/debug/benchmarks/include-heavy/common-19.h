@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_19_H
+#define COMMON_19_H
+
+#include "common-17.h"
+#include "common-18.h"
+
+#define SCALE_19(x) ((x) * 20.0 + BIAS_19)
+#define BIAS_19 19.5
+
+#if defined(USE_FAST_PATH) && 19 % 2 == 0
+float4 common19(float4 x) { return SCALE_19(x); }
+#else
+float4 common19(float4 x)
+{
+    float4 y = SCALE_19(x);
+    y += common18(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_20_H
+#define COMMON_20_H
+
+#include "common-18.h"
+#include "common-19.h"
+
+#define SCALE_20(x) ((x) * 21.0 + BIAS_20)
+#define BIAS_20 20.5
+
+#if defined(USE_FAST_PATH) && 20 % 2 == 0
+float4 common20(float4 x) { return SCALE_20(x); }
+#else
+float4 common20(float4 x)
+{
+    float4 y = SCALE_20(x);
+    y += common19(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_22_H
+#define COMMON_22_H
+
+#include "common-20.h"
+#include "common-21.h"
+
+#define SCALE_22(x) ((x) * 23.0 + BIAS_22)
+#define BIAS_22 22.5
+
+#if defined(USE_FAST_PATH) && 22 % 2 == 0
+float4 common22(float4 x) { return SCALE_22(x); }
+#else
+float4 common22(float4 x)
+{
+    float4 y = SCALE_22(x);
+    y += common21(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_24_H
+#define COMMON_24_H
+
+#include "common-22.h"
+#include "common-23.h"
+
+#define SCALE_24(x) ((x) * 25.0 + BIAS_24)
+#define BIAS_24 24.5
+
+#if defined(USE_FAST_PATH) && 24 % 2 == 0
+float4 common24(float4 x) { return SCALE_24(x); }
+#else
+float4 common24(float4 x)
+{
+    float4 y = SCALE_24(x);
+    y += common23(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
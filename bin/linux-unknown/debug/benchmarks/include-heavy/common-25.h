@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_25_H
+#define COMMON_25_H
+
+#include "common-23.h"
+#include "common-24.h"
+
+#define SCALE_25(x) ((x) * 26.0 + BIAS_25)
+#define BIAS_25 25.5
+
+#if defined(USE_FAST_PATH) && 25 % 2 == 0
+float4 common25(float4 x) { return SCALE_25(x); }
+#else
+float4 common25(float4 x)
+{
+    float4 y = SCALE_25(x);
+    y += common24(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_26_H
+#define COMMON_26_H
+
+#include "common-24.h"
+#include "common-25.h"
+
+#define SCALE_26(x) ((x) * 27.0 + BIAS_26)
+#define BIAS_26 26.5
+
+#if defined(USE_FAST_PATH) && 26 % 2 == 0
+float4 common26(float4 x) { return SCALE_26(x); }
+#else
+float4 common26(float4 x)
+{
+    float4 y = SCALE_26(x);
+    y += common25(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_27_H
+#define COMMON_27_H
+
+#include "common-25.h"
+#include "common-26.h"
+
+#define SCALE_27(x) ((x) * 28.0 + BIAS_27)
+#define BIAS_27 27.5
+
+#if defined(USE_FAST_PATH) && 27 % 2 == 0
+float4 common27(float4 x) { return SCALE_27(x); }
+#else
+float4 common27(float4 x)
+{
+    float4 y = SCALE_27(x);
+    y += common26(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_30_H
+#define COMMON_30_H
+
+#include "common-28.h"
+#include "common-29.h"
+
+#define SCALE_30(x) ((x) * 31.0 + BIAS_30)
+#define BIAS_30 30.5
+
+#if defined(USE_FAST_PATH) && 30 % 2 == 0
+float4 common30(float4 x) { return SCALE_30(x); }
+#else
+float4 common30(float4 x)
+{
+    float4 y = SCALE_30(x);
+    y += common29(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_31_H
+#define COMMON_31_H
+
+#include "common-29.h"
+#include "common-30.h"
+
+#define SCALE_31(x) ((x) * 32.0 + BIAS_31)
+#define BIAS_31 31.5
+
+#if defined(USE_FAST_PATH) && 31 % 2 == 0
+float4 common31(float4 x) { return SCALE_31(x); }
+#else
+float4 common31(float4 x)
+{
+    float4 y = SCALE_31(x);
+    y += common30(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_33_H
+#define COMMON_33_H
+
+#include "common-31.h"
+#include "common-32.h"
+
+#define SCALE_33(x) ((x) * 34.0 + BIAS_33)
+#define BIAS_33 33.5
+
+#if defined(USE_FAST_PATH) && 33 % 2 == 0
+float4 common33(float4 x) { return SCALE_33(x); }
+#else
+float4 common33(float4 x)
+{
+    float4 y = SCALE_33(x);
+    y += common32(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_34_H
+#define COMMON_34_H
+
+#include "common-32.h"
+#include "common-33.h"
+
+#define SCALE_34(x) ((x) * 35.0 + BIAS_34)
+#define BIAS_34 34.5
+
+#if defined(USE_FAST_PATH) && 34 % 2 == 0
+float4 common34(float4 x) { return SCALE_34(x); }
+#else
+float4 common34(float4 x)
+{
+    float4 y = SCALE_34(x);
+    y += common33(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
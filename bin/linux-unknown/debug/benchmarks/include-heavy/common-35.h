@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_35_H
+#define COMMON_35_H
+
+#include "common-33.h"
+#include "common-34.h"
+
+#define SCALE_35(x) ((x) * 36.0 + BIAS_35)
+#define BIAS_35 35.5
+
+#if defined(USE_FAST_PATH) && 35 % 2 == 0
+float4 common35(float4 x) { return SCALE_35(x); }
+#else
+float4 common35(float4 x)
+{
+    float4 y = SCALE_35(x);
+    y += common34(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_37_H
+#define COMMON_37_H
+
+#include "common-35.h"
+#include "common-36.h"
+
+#define SCALE_37(x) ((x) * 38.0 + BIAS_37)
+#define BIAS_37 37.5
+
+#if defined(USE_FAST_PATH) && 37 % 2 == 0
+float4 common37(float4 x) { return SCALE_37(x); }
+#else
+float4 common37(float4 x)
+{
+    float4 y = SCALE_37(x);
+    y += common36(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_44_H
+#define COMMON_44_H
+
+#include "common-42.h"
+#include "common-43.h"
+
+#define SCALE_44(x) ((x) * 45.0 + BIAS_44)
+#define BIAS_44 44.5
+
+#if defined(USE_FAST_PATH) && 44 % 2 == 0
+float4 common44(float4 x) { return SCALE_44(x); }
+#else
+float4 common44(float4 x)
+{
+    float4 y = SCALE_44(x);
+    y += common43(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_46_H
+#define COMMON_46_H
+
+#include "common-44.h"
+#include "common-45.h"
+
+#define SCALE_46(x) ((x) * 47.0 + BIAS_46)
+#define BIAS_46 46.5
+
+#if defined(USE_FAST_PATH) && 46 % 2 == 0
+float4 common46(float4 x) { return SCALE_46(x); }
+#else
+float4 common46(float4 x)
+{
+    float4 y = SCALE_46(x);
+    y += common45(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_47_H
+#define COMMON_47_H
+
+#include "common-45.h"
+#include "common-46.h"
+
+#define SCALE_47(x) ((x) * 48.0 + BIAS_47)
+#define BIAS_47 47.5
+
+#if defined(USE_FAST_PATH) && 47 % 2 == 0
+float4 common47(float4 x) { return SCALE_47(x); }
+#else
+float4 common47(float4 x)
+{
+    float4 y = SCALE_47(x);
+    y += common46(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
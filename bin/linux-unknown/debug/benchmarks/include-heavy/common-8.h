@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_8_H
+#define COMMON_8_H
+
+#include "common-6.h"
+#include "common-7.h"
+
+#define SCALE_8(x) ((x) * 9.0 + BIAS_8)
+#define BIAS_8 8.5
+
+#if defined(USE_FAST_PATH) && 8 % 2 == 0
+float4 common8(float4 x) { return SCALE_8(x); }
+#else
+float4 common8(float4 x)
+{
+    float4 y = SCALE_8(x);
+    y += common7(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_9_H
+#define COMMON_9_H
+
+#include "common-7.h"
+#include "common-8.h"
+
+#define SCALE_9(x) ((x) * 10.0 + BIAS_9)
+#define BIAS_9 9.5
+
+#if defined(USE_FAST_PATH) && 9 % 2 == 0
+float4 common9(float4 x) { return SCALE_9(x); }
+#else
+float4 common9(float4 x)
+{
+    float4 y = SCALE_9(x);
+    y += common8(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,5825 @@
+//BENCH: -profile cs_5_0 -entry main -target hlsl
+
+// Generated by `slang-bench -generate`: a large amount of HLSL to parse.
+
+cbuffer Constants
+{
+    float4x4 transform;
+    float4 tint;
+    uint count;
+};
+
+RWStructuredBuffer<float4> output;
+Texture2D<float4> source;
+SamplerState sourceSampler;
+
+struct Params0
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process0(in Params0 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 0) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 1.0 / (float) count;
+    return result;
+}
+
+struct Params1
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process1(in Params1 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 1) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 2.0 / (float) count;
+    return result;
+}
+
+struct Params2
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process2(in Params2 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 2) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 3.0 / (float) count;
+    return result;
+}
+
+struct Params3
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process3(in Params3 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 3) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 4.0 / (float) count;
+    return result;
+}
+
+struct Params4
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process4(in Params4 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 4) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 5.0 / (float) count;
+    return result;
+}
+
+struct Params5
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process5(in Params5 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 5) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 6.0 / (float) count;
+    return result;
+}
+
+struct Params6
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process6(in Params6 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 6) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 7.0 / (float) count;
+    return result;
+}
+
+struct Params7
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process7(in Params7 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 7) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 8.0 / (float) count;
+    return result;
+}
+
+struct Params8
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process8(in Params8 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 8) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 9.0 / (float) count;
+    return result;
+}
+
+struct Params9
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process9(in Params9 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 9) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 10.0 / (float) count;
+    return result;
+}
+
+struct Params10
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process10(in Params10 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 10) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 11.0 / (float) count;
+    return result;
+}
+
+struct Params11
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process11(in Params11 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 11) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 12.0 / (float) count;
+    return result;
+}
+
+struct Params12
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process12(in Params12 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 12) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 13.0 / (float) count;
+    return result;
+}
+
+struct Params13
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process13(in Params13 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 13) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 14.0 / (float) count;
+    return result;
+}
+
+struct Params14
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process14(in Params14 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 14) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 15.0 / (float) count;
+    return result;
+}
+
+struct Params15
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process15(in Params15 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 15) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 16.0 / (float) count;
+    return result;
+}
+
+struct Params16
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process16(in Params16 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 16) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 17.0 / (float) count;
+    return result;
+}
+
+struct Params17
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process17(in Params17 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 17) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 18.0 / (float) count;
+    return result;
+}
+
+struct Params18
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process18(in Params18 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 18) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 19.0 / (float) count;
+    return result;
+}
+
+struct Params19
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process19(in Params19 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 19) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 20.0 / (float) count;
+    return result;
+}
+
+struct Params20
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process20(in Params20 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 20) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 21.0 / (float) count;
+    return result;
+}
+
+struct Params21
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process21(in Params21 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 21) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 22.0 / (float) count;
+    return result;
+}
+
+struct Params22
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process22(in Params22 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 22) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 23.0 / (float) count;
+    return result;
+}
+
+struct Params23
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process23(in Params23 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 23) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 24.0 / (float) count;
+    return result;
+}
+
+struct Params24
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process24(in Params24 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 24) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 25.0 / (float) count;
+    return result;
+}
+
+struct Params25
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process25(in Params25 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 25) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 26.0 / (float) count;
+    return result;
+}
+
+struct Params26
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process26(in Params26 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 26) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 27.0 / (float) count;
+    return result;
+}
+
+struct Params27
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process27(in Params27 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 27) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 28.0 / (float) count;
+    return result;
+}
+
+struct Params28
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process28(in Params28 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 28) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 29.0 / (float) count;
+    return result;
+}
+
+struct Params29
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process29(in Params29 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 29) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 30.0 / (float) count;
+    return result;
+}
+
+struct Params30
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process30(in Params30 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 30) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 31.0 / (float) count;
+    return result;
+}
+
+struct Params31
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process31(in Params31 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 31) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 32.0 / (float) count;
+    return result;
+}
+
+struct Params32
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process32(in Params32 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 32) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 33.0 / (float) count;
+    return result;
+}
+
+struct Params33
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process33(in Params33 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 33) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 34.0 / (float) count;
+    return result;
+}
+
+struct Params34
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process34(in Params34 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 34) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 35.0 / (float) count;
+    return result;
+}
+
+struct Params35
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process35(in Params35 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 35) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 36.0 / (float) count;
+    return result;
+}
+
+struct Params36
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process36(in Params36 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 36) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 37.0 / (float) count;
+    return result;
+}
+
+struct Params37
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process37(in Params37 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 37) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 38.0 / (float) count;
+    return result;
+}
+
+struct Params38
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process38(in Params38 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 38) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 39.0 / (float) count;
+    return result;
+}
+
+struct Params39
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process39(in Params39 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 39) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 40.0 / (float) count;
+    return result;
+}
+
+struct Params40
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process40(in Params40 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 40) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 41.0 / (float) count;
+    return result;
+}
+
+struct Params41
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process41(in Params41 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 41) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 42.0 / (float) count;
+    return result;
+}
+
+struct Params42
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process42(in Params42 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 42) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 43.0 / (float) count;
+    return result;
+}
+
+struct Params43
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process43(in Params43 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 43) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 44.0 / (float) count;
+    return result;
+}
+
+struct Params44
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process44(in Params44 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 44) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 45.0 / (float) count;
+    return result;
+}
+
+struct Params45
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process45(in Params45 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 45) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 46.0 / (float) count;
+    return result;
+}
+
+struct Params46
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process46(in Params46 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 46) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 47.0 / (float) count;
+    return result;
+}
+
+struct Params47
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process47(in Params47 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 47) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 48.0 / (float) count;
+    return result;
+}
+
+struct Params48
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process48(in Params48 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 48) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 49.0 / (float) count;
+    return result;
+}
+
+struct Params49
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process49(in Params49 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 49) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 50.0 / (float) count;
+    return result;
+}
+
+struct Params50
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process50(in Params50 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 50) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 51.0 / (float) count;
+    return result;
+}
+
+struct Params51
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process51(in Params51 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 51) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 52.0 / (float) count;
+    return result;
+}
+
+struct Params52
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process52(in Params52 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 52) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 53.0 / (float) count;
+    return result;
+}
+
+struct Params53
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process53(in Params53 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 53) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 54.0 / (float) count;
+    return result;
+}
+
+struct Params54
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process54(in Params54 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 54) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 55.0 / (float) count;
+    return result;
+}
+
+struct Params55
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process55(in Params55 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 55) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 56.0 / (float) count;
+    return result;
+}
+
+struct Params56
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process56(in Params56 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 56) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 57.0 / (float) count;
+    return result;
+}
+
+struct Params57
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process57(in Params57 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 57) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 58.0 / (float) count;
+    return result;
+}
+
+struct Params58
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process58(in Params58 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 58) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 59.0 / (float) count;
+    return result;
+}
+
+struct Params59
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process59(in Params59 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 59) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 60.0 / (float) count;
+    return result;
+}
+
+struct Params60
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process60(in Params60 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 60) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 61.0 / (float) count;
+    return result;
+}
+
+struct Params61
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process61(in Params61 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 61) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 62.0 / (float) count;
+    return result;
+}
+
+struct Params62
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process62(in Params62 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 62) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 63.0 / (float) count;
+    return result;
+}
+
+struct Params63
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process63(in Params63 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 63) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 64.0 / (float) count;
+    return result;
+}
+
+struct Params64
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process64(in Params64 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 64) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 65.0 / (float) count;
+    return result;
+}
+
+struct Params65
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process65(in Params65 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 65) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 66.0 / (float) count;
+    return result;
+}
+
+struct Params66
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process66(in Params66 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 66) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 67.0 / (float) count;
+    return result;
+}
+
+struct Params67
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process67(in Params67 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 67) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 68.0 / (float) count;
+    return result;
+}
+
+struct Params68
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process68(in Params68 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 68) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 69.0 / (float) count;
+    return result;
+}
+
+struct Params69
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process69(in Params69 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 69) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 70.0 / (float) count;
+    return result;
+}
+
+struct Params70
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process70(in Params70 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 70) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 71.0 / (float) count;
+    return result;
+}
+
+struct Params71
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process71(in Params71 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 71) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 72.0 / (float) count;
+    return result;
+}
+
+struct Params72
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process72(in Params72 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 72) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 73.0 / (float) count;
+    return result;
+}
+
+struct Params73
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process73(in Params73 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 73) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 74.0 / (float) count;
+    return result;
+}
+
+struct Params74
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process74(in Params74 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 74) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 75.0 / (float) count;
+    return result;
+}
+
+struct Params75
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process75(in Params75 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 75) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 76.0 / (float) count;
+    return result;
+}
+
+struct Params76
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process76(in Params76 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 76) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 77.0 / (float) count;
+    return result;
+}
+
+struct Params77
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process77(in Params77 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 77) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 78.0 / (float) count;
+    return result;
+}
+
+struct Params78
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process78(in Params78 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 78) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 79.0 / (float) count;
+    return result;
+}
+
+struct Params79
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process79(in Params79 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 79) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 80.0 / (float) count;
+    return result;
+}
+
+struct Params80
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process80(in Params80 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 80) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 81.0 / (float) count;
+    return result;
+}
+
+struct Params81
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process81(in Params81 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 81) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 82.0 / (float) count;
+    return result;
+}
+
+struct Params82
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process82(in Params82 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 82) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 83.0 / (float) count;
+    return result;
+}
+
+struct Params83
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process83(in Params83 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 83) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 84.0 / (float) count;
+    return result;
+}
+
+struct Params84
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process84(in Params84 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 84) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 85.0 / (float) count;
+    return result;
+}
+
+struct Params85
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process85(in Params85 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 85) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 86.0 / (float) count;
+    return result;
+}
+
+struct Params86
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process86(in Params86 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 86) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 87.0 / (float) count;
+    return result;
+}
+
+struct Params87
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process87(in Params87 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 87) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 88.0 / (float) count;
+    return result;
+}
+
+struct Params88
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process88(in Params88 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 88) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 89.0 / (float) count;
+    return result;
+}
+
+struct Params89
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process89(in Params89 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 89) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 90.0 / (float) count;
+    return result;
+}
+
+struct Params90
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process90(in Params90 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 90) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 91.0 / (float) count;
+    return result;
+}
+
+struct Params91
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process91(in Params91 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 91) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 92.0 / (float) count;
+    return result;
+}
+
+struct Params92
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process92(in Params92 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 92) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 93.0 / (float) count;
+    return result;
+}
+
+struct Params93
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process93(in Params93 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 93) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 94.0 / (float) count;
+    return result;
+}
+
+struct Params94
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process94(in Params94 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 94) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 95.0 / (float) count;
+    return result;
+}
+
+struct Params95
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process95(in Params95 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 95) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 96.0 / (float) count;
+    return result;
+}
+
+struct Params96
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process96(in Params96 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 96) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 97.0 / (float) count;
+    return result;
+}
+
+struct Params97
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process97(in Params97 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 97) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 98.0 / (float) count;
+    return result;
+}
+
+struct Params98
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process98(in Params98 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 98) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 99.0 / (float) count;
+    return result;
+}
+
+struct Params99
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process99(in Params99 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 99) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 100.0 / (float) count;
+    return result;
+}
+
+struct Params100
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process100(in Params100 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 100) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 101.0 / (float) count;
+    return result;
+}
+
+struct Params101
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process101(in Params101 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 101) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 102.0 / (float) count;
+    return result;
+}
+
+struct Params102
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process102(in Params102 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 102) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 103.0 / (float) count;
+    return result;
+}
+
+struct Params103
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process103(in Params103 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 103) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 104.0 / (float) count;
+    return result;
+}
+
+struct Params104
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process104(in Params104 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 104) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 105.0 / (float) count;
+    return result;
+}
+
+struct Params105
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process105(in Params105 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 105) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 106.0 / (float) count;
+    return result;
+}
+
+struct Params106
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process106(in Params106 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 106) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 107.0 / (float) count;
+    return result;
+}
+
+struct Params107
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process107(in Params107 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 107) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 108.0 / (float) count;
+    return result;
+}
+
+struct Params108
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process108(in Params108 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 108) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 109.0 / (float) count;
+    return result;
+}
+
+struct Params109
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process109(in Params109 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 109) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 110.0 / (float) count;
+    return result;
+}
+
+struct Params110
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process110(in Params110 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 110) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 111.0 / (float) count;
+    return result;
+}
+
+struct Params111
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process111(in Params111 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 111) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 112.0 / (float) count;
+    return result;
+}
+
+struct Params112
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process112(in Params112 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 112) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 113.0 / (float) count;
+    return result;
+}
+
+struct Params113
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process113(in Params113 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 113) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 114.0 / (float) count;
+    return result;
+}
+
+struct Params114
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process114(in Params114 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 114) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 115.0 / (float) count;
+    return result;
+}
+
+struct Params115
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process115(in Params115 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 115) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 116.0 / (float) count;
+    return result;
+}
+
+struct Params116
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process116(in Params116 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 116) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 117.0 / (float) count;
+    return result;
+}
+
+struct Params117
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process117(in Params117 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 117) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 118.0 / (float) count;
+    return result;
+}
+
+struct Params118
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process118(in Params118 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 118) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 119.0 / (float) count;
+    return result;
+}
+
+struct Params119
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process119(in Params119 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 119) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 120.0 / (float) count;
+    return result;
+}
+
+struct Params120
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process120(in Params120 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 120) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 121.0 / (float) count;
+    return result;
+}
+
+struct Params121
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process121(in Params121 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 121) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 122.0 / (float) count;
+    return result;
+}
+
+struct Params122
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process122(in Params122 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 122) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 123.0 / (float) count;
+    return result;
+}
+
+struct Params123
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process123(in Params123 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 123) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 124.0 / (float) count;
+    return result;
+}
+
+struct Params124
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process124(in Params124 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 124) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 125.0 / (float) count;
+    return result;
+}
+
+struct Params125
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process125(in Params125 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 125) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 126.0 / (float) count;
+    return result;
+}
+
+struct Params126
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process126(in Params126 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 126) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 127.0 / (float) count;
+    return result;
+}
+
+struct Params127
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process127(in Params127 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 127) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 128.0 / (float) count;
+    return result;
+}
+
+struct Params128
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process128(in Params128 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 128) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 129.0 / (float) count;
+    return result;
+}
+
+struct Params129
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process129(in Params129 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 129) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 130.0 / (float) count;
+    return result;
+}
+
+struct Params130
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process130(in Params130 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 130) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 131.0 / (float) count;
+    return result;
+}
+
+struct Params131
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process131(in Params131 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 131) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 132.0 / (float) count;
+    return result;
+}
+
+struct Params132
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process132(in Params132 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 132) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 133.0 / (float) count;
+    return result;
+}
+
+struct Params133
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process133(in Params133 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 133) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 134.0 / (float) count;
+    return result;
+}
+
+struct Params134
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process134(in Params134 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 134) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 135.0 / (float) count;
+    return result;
+}
+
+struct Params135
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process135(in Params135 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 135) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 136.0 / (float) count;
+    return result;
+}
+
+struct Params136
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process136(in Params136 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 136) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 137.0 / (float) count;
+    return result;
+}
+
+struct Params137
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process137(in Params137 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 137) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 138.0 / (float) count;
+    return result;
+}
+
+struct Params138
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process138(in Params138 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 138) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 139.0 / (float) count;
+    return result;
+}
+
+struct Params139
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process139(in Params139 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 139) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 140.0 / (float) count;
+    return result;
+}
+
+struct Params140
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process140(in Params140 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 140) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 141.0 / (float) count;
+    return result;
+}
+
+struct Params141
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process141(in Params141 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 141) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 142.0 / (float) count;
+    return result;
+}
+
+struct Params142
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process142(in Params142 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 142) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 143.0 / (float) count;
+    return result;
+}
+
+struct Params143
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process143(in Params143 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 143) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 144.0 / (float) count;
+    return result;
+}
+
+struct Params144
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process144(in Params144 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 144) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 145.0 / (float) count;
+    return result;
+}
+
+struct Params145
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process145(in Params145 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 145) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 146.0 / (float) count;
+    return result;
+}
+
+struct Params146
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process146(in Params146 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 146) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 147.0 / (float) count;
+    return result;
+}
+
+struct Params147
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process147(in Params147 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 147) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 148.0 / (float) count;
+    return result;
+}
+
+struct Params148
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process148(in Params148 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 148) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 149.0 / (float) count;
+    return result;
+}
+
+struct Params149
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process149(in Params149 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 149) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 150.0 / (float) count;
+    return result;
+}
+
+struct Params150
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process150(in Params150 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 150) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 151.0 / (float) count;
+    return result;
+}
+
+struct Params151
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process151(in Params151 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 151) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 152.0 / (float) count;
+    return result;
+}
+
+struct Params152
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process152(in Params152 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 152) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 153.0 / (float) count;
+    return result;
+}
+
+struct Params153
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process153(in Params153 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 153) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 154.0 / (float) count;
+    return result;
+}
+
+struct Params154
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process154(in Params154 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 154) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 155.0 / (float) count;
+    return result;
+}
+
+struct Params155
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process155(in Params155 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 155) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 156.0 / (float) count;
+    return result;
+}
+
+struct Params156
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process156(in Params156 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 156) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 157.0 / (float) count;
+    return result;
+}
+
+struct Params157
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process157(in Params157 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 157) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 158.0 / (float) count;
+    return result;
+}
+
+struct Params158
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process158(in Params158 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 158) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 159.0 / (float) count;
+    return result;
+}
+
+struct Params159
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process159(in Params159 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 159) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 160.0 / (float) count;
+    return result;
+}
+
+struct Params160
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process160(in Params160 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 160) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 161.0 / (float) count;
+    return result;
+}
+
+struct Params161
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process161(in Params161 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 161) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 162.0 / (float) count;
+    return result;
+}
+
+struct Params162
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process162(in Params162 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 162) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 163.0 / (float) count;
+    return result;
+}
+
+struct Params163
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process163(in Params163 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 163) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 164.0 / (float) count;
+    return result;
+}
+
+struct Params164
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process164(in Params164 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 164) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 165.0 / (float) count;
+    return result;
+}
+
+struct Params165
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process165(in Params165 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 165) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 166.0 / (float) count;
+    return result;
+}
+
+struct Params166
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process166(in Params166 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 166) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 167.0 / (float) count;
+    return result;
+}
+
+struct Params167
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process167(in Params167 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 167) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 168.0 / (float) count;
+    return result;
+}
+
+struct Params168
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process168(in Params168 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 168) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 169.0 / (float) count;
+    return result;
+}
+
+struct Params169
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process169(in Params169 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 169) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 170.0 / (float) count;
+    return result;
+}
+
+struct Params170
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process170(in Params170 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 170) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 171.0 / (float) count;
+    return result;
+}
+
+struct Params171
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process171(in Params171 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 171) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 172.0 / (float) count;
+    return result;
+}
+
+struct Params172
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process172(in Params172 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 172) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 173.0 / (float) count;
+    return result;
+}
+
+struct Params173
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process173(in Params173 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 173) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 174.0 / (float) count;
+    return result;
+}
+
+struct Params174
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process174(in Params174 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 174) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 175.0 / (float) count;
+    return result;
+}
+
+struct Params175
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process175(in Params175 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 175) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 176.0 / (float) count;
+    return result;
+}
+
+struct Params176
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process176(in Params176 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 176) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 177.0 / (float) count;
+    return result;
+}
+
+struct Params177
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process177(in Params177 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 177) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 178.0 / (float) count;
+    return result;
+}
+
+struct Params178
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process178(in Params178 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 178) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 179.0 / (float) count;
+    return result;
+}
+
+struct Params179
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process179(in Params179 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 179) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 180.0 / (float) count;
+    return result;
+}
+
+struct Params180
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process180(in Params180 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 180) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 181.0 / (float) count;
+    return result;
+}
+
+struct Params181
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process181(in Params181 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 181) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 182.0 / (float) count;
+    return result;
+}
+
+struct Params182
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process182(in Params182 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 182) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 183.0 / (float) count;
+    return result;
+}
+
+struct Params183
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process183(in Params183 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 183) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 184.0 / (float) count;
+    return result;
+}
+
+struct Params184
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process184(in Params184 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 184) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 185.0 / (float) count;
+    return result;
+}
+
+struct Params185
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process185(in Params185 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 185) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 186.0 / (float) count;
+    return result;
+}
+
+struct Params186
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process186(in Params186 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 186) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 187.0 / (float) count;
+    return result;
+}
+
+struct Params187
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process187(in Params187 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 187) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 188.0 / (float) count;
+    return result;
+}
+
+struct Params188
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process188(in Params188 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 188) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 189.0 / (float) count;
+    return result;
+}
+
+struct Params189
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process189(in Params189 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 189) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 190.0 / (float) count;
+    return result;
+}
+
+struct Params190
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process190(in Params190 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 190) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 191.0 / (float) count;
+    return result;
+}
+
+struct Params191
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process191(in Params191 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 191) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 192.0 / (float) count;
+    return result;
+}
+
+struct Params192
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process192(in Params192 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 192) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 193.0 / (float) count;
+    return result;
+}
+
+struct Params193
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process193(in Params193 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 193) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 194.0 / (float) count;
+    return result;
+}
+
+struct Params194
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process194(in Params194 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 194) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 195.0 / (float) count;
+    return result;
+}
+
+struct Params195
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process195(in Params195 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 195) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 196.0 / (float) count;
+    return result;
+}
+
+struct Params196
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process196(in Params196 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 196) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 197.0 / (float) count;
+    return result;
+}
+
+struct Params197
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process197(in Params197 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 197) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 198.0 / (float) count;
+    return result;
+}
+
+struct Params198
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process198(in Params198 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 198) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 199.0 / (float) count;
+    return result;
+}
+
+struct Params199
+{
+    float4 a;
+    float3 b[4];
+    int2 c;
+};
+
+float4 process199(in Params199 p, float2 uv, inout float weight)
+{
+    float4 result = (float4) 0;
+    const float scale = (float)(p.c.x + 199) * 0.5f;
+    [unroll] for (int i = 0; i < 4; ++i)
+    {
+        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);
+        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;
+        result.w = max(result.w, dot(v, v) / (1.0f + weight));
+    }
+    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))
+    {
+        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);
+    }
+    else
+    {
+        result.xy = (float2) ((int2) result.xy & p.c) << 1;
+    }
+    weight += (result.x + result.y) * 200.0 / (float) count;
+    return result;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 tid : SV_DispatchThreadID)
+{
+    Params0 p;
+    p.a = output[tid.x];
+    p.b[0] = p.b[1] = p.b[2] = p.b[3] = p.a.xyz;
+    p.c = int2(tid.xy);
+    float weight = 1.0;
+    output[tid.x] = process0(p, float2(tid.xy) / 64.0, weight) * weight;
+}
@@ -0,0 +1,20 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_0_H
+#define COMMON_0_H
+
+
+#define SCALE_0(x) ((x) * 1.0 + BIAS_0)
+#define BIAS_0 0.5
+
+#if defined(USE_FAST_PATH) && 0 % 2 == 0
+float4 common0(float4 x) { return SCALE_0(x); }
+#else
+float4 common0(float4 x)
+{
+    float4 y = SCALE_0(x);
+    return y;
+}
+#endif
+
+#endif
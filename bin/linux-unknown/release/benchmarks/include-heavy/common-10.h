@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_10_H
+#define COMMON_10_H
+
+#include "common-8.h"
+#include "common-9.h"
+
+#define SCALE_10(x) ((x) * 11.0 + BIAS_10)
+#define BIAS_10 10.5
+
+#if defined(USE_FAST_PATH) && 10 % 2 == 0
+float4 common10(float4 x) { return SCALE_10(x); }
+#else
+float4 common10(float4 x)
+{
+    float4 y = SCALE_10(x);
+    y += common9(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_11_H
+#define COMMON_11_H
+
+#include "common-9.h"
+#include "common-10.h"
+
+#define SCALE_11(x) ((x) * 12.0 + BIAS_11)
+#define BIAS_11 11.5
+
+#if defined(USE_FAST_PATH) && 11 % 2 == 0
+float4 common11(float4 x) { return SCALE_11(x); }
+#else
+float4 common11(float4 x)
+{
+    float4 y = SCALE_11(x);
+    y += common10(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_15_H
+#define COMMON_15_H
+
+#include "common-13.h"
+#include "common-14.h"
+
+#define SCALE_15(x) ((x) * 16.0 + BIAS_15)
+#define BIAS_15 15.5
+
+#if defined(USE_FAST_PATH) && 15 % 2 == 0
+float4 common15(float4 x) { return SCALE_15(x); }
+#else
+float4 common15(float4 x)
+{
+    float4 y = SCALE_15(x);
+    y += common14(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_16_H
+#define COMMON_16_H
+
+#include "common-14.h"
+#include "common-15.h"
+
+#define SCALE_16(x) ((x) * 17.0 + BIAS_16)
+#define BIAS_16 16.5
+
+#if defined(USE_FAST_PATH) && 16 % 2 == 0
+float4 common16(float4 x) { return SCALE_16(x); }
+#else
+float4 common16(float4 x)
+{
+    float4 y = SCALE_16(x);
+    y += common15(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
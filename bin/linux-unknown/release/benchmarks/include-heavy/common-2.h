@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_2_H
+#define COMMON_2_H
+
+#include "common-0.h"
+#include "common-1.h"
+
+#define SCALE_2(x) ((x) * 3.0 + BIAS_2)
+#define BIAS_2 2.5
+
+#if defined(USE_FAST_PATH) && 2 % 2 == 0
+float4 common2(float4 x) { return SCALE_2(x); }
+#else
+float4 common2(float4 x)
+{
+    float4 y = SCALE_2(x);
+    y += common1(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
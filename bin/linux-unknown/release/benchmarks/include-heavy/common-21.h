@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_21_H
+#define COMMON_21_H
+
+#include "common-19.h"
+#include "common-20.h"
+
+#define SCALE_21(x) ((x) * 22.0 + BIAS_21)
+#define BIAS_21 21.5
+
+#if defined(USE_FAST_PATH) && 21 % 2 == 0
+float4 common21(float4 x) { return SCALE_21(x); }
+#else
+float4 common21(float4 x)
+{
+    float4 y = SCALE_21(x);
+    y += common20(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_23_H
+#define COMMON_23_H
+
+#include "common-21.h"
+#include "common-22.h"
+
+#define SCALE_23(x) ((x) * 24.0 + BIAS_23)
+#define BIAS_23 23.5
+
+#if defined(USE_FAST_PATH) && 23 % 2 == 0
+float4 common23(float4 x) { return SCALE_23(x); }
+#else
+float4 common23(float4 x)
+{
+    float4 y = SCALE_23(x);
+    y += common22(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_28_H
+#define COMMON_28_H
+
+#include "common-26.h"
+#include "common-27.h"
+
+#define SCALE_28(x) ((x) * 29.0 + BIAS_28)
+#define BIAS_28 28.5
+
+#if defined(USE_FAST_PATH) && 28 % 2 == 0
+float4 common28(float4 x) { return SCALE_28(x); }
+#else
+float4 common28(float4 x)
+{
+    float4 y = SCALE_28(x);
+    y += common27(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
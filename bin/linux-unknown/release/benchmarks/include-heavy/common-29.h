@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_29_H
+#define COMMON_29_H
+
+#include "common-27.h"
+#include "common-28.h"
+
+#define SCALE_29(x) ((x) * 30.0 + BIAS_29)
+#define BIAS_29 29.5
+
+#if defined(USE_FAST_PATH) && 29 % 2 == 0
+float4 common29(float4 x) { return SCALE_29(x); }
+#else
+float4 common29(float4 x)
+{
+    float4 y = SCALE_29(x);
+    y += common28(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
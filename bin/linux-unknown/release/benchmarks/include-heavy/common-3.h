@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_3_H
+#define COMMON_3_H
+
+#include "common-1.h"
+#include "common-2.h"
+
+#define SCALE_3(x) ((x) * 4.0 + BIAS_3)
+#define BIAS_3 3.5
+
+#if defined(USE_FAST_PATH) && 3 % 2 == 0
+float4 common3(float4 x) { return SCALE_3(x); }
+#else
+float4 common3(float4 x)
+{
+    float4 y = SCALE_3(x);
+    y += common2(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_32_H
+#define COMMON_32_H
+
+#include "common-30.h"
+#include "common-31.h"
+
+#define SCALE_32(x) ((x) * 33.0 + BIAS_32)
+#define BIAS_32 32.5
+
+#if defined(USE_FAST_PATH) && 32 % 2 == 0
+float4 common32(float4 x) { return SCALE_32(x); }
+#else
+float4 common32(float4 x)
+{
+    float4 y = SCALE_32(x);
+    y += common31(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_36_H
+#define COMMON_36_H
+
+#include "common-34.h"
+#include "common-35.h"
+
+#define SCALE_36(x) ((x) * 37.0 + BIAS_36)
+#define BIAS_36 36.5
+
+#if defined(USE_FAST_PATH) && 36 % 2 == 0
+float4 common36(float4 x) { return SCALE_36(x); }
+#else
+float4 common36(float4 x)
+{
+    float4 y = SCALE_36(x);
+    y += common35(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
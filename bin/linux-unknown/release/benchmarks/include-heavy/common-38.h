@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_38_H
+#define COMMON_38_H
+
+#include "common-36.h"
+#include "common-37.h"
+
+#define SCALE_38(x) ((x) * 39.0 + BIAS_38)
+#define BIAS_38 38.5
+
+#if defined(USE_FAST_PATH) && 38 % 2 == 0
+float4 common38(float4 x) { return SCALE_38(x); }
+#else
+float4 common38(float4 x)
+{
+    float4 y = SCALE_38(x);
+    y += common37(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_39_H
+#define COMMON_39_H
+
+#include "common-37.h"
+#include "common-38.h"
+
+#define SCALE_39(x) ((x) * 40.0 + BIAS_39)
+#define BIAS_39 39.5
+
+#if defined(USE_FAST_PATH) && 39 % 2 == 0
+float4 common39(float4 x) { return SCALE_39(x); }
+#else
+float4 common39(float4 x)
+{
+    float4 y = SCALE_39(x);
+    y += common38(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_4_H
+#define COMMON_4_H
+
+#include "common-2.h"
+#include "common-3.h"
+
+#define SCALE_4(x) ((x) * 5.0 + BIAS_4)
+#define BIAS_4 4.5
+
+#if defined(USE_FAST_PATH) && 4 % 2 == 0
+float4 common4(float4 x) { return SCALE_4(x); }
+#else
+float4 common4(float4 x)
+{
+    float4 y = SCALE_4(x);
+    y += common3(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
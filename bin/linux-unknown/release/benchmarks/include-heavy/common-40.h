@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_40_H
+#define COMMON_40_H
+
+#include "common-38.h"
+#include "common-39.h"
+
+#define SCALE_40(x) ((x) * 41.0 + BIAS_40)
+#define BIAS_40 40.5
+
+#if defined(USE_FAST_PATH) && 40 % 2 == 0
+float4 common40(float4 x) { return SCALE_40(x); }
+#else
+float4 common40(float4 x)
+{
+    float4 y = SCALE_40(x);
+    y += common39(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
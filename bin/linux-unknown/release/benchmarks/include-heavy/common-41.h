@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_41_H
+#define COMMON_41_H
+
+#include "common-39.h"
+#include "common-40.h"
+
+#define SCALE_41(x) ((x) * 42.0 + BIAS_41)
+#define BIAS_41 41.5
+
+#if defined(USE_FAST_PATH) && 41 % 2 == 0
+float4 common41(float4 x) { return SCALE_41(x); }
+#else
+float4 common41(float4 x)
+{
+    float4 y = SCALE_41(x);
+    y += common40(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_42_H
+#define COMMON_42_H
+
+#include "common-40.h"
+#include "common-41.h"
+
+#define SCALE_42(x) ((x) * 43.0 + BIAS_42)
+#define BIAS_42 42.5
+
+#if defined(USE_FAST_PATH) && 42 % 2 == 0
+float4 common42(float4 x) { return SCALE_42(x); }
+#else
+float4 common42(float4 x)
+{
+    float4 y = SCALE_42(x);
+    y += common41(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_43_H
+#define COMMON_43_H
+
+#include "common-41.h"
+#include "common-42.h"
+
+#define SCALE_43(x) ((x) * 44.0 + BIAS_43)
+#define BIAS_43 43.5
+
+#if defined(USE_FAST_PATH) && 43 % 2 == 0
+float4 common43(float4 x) { return SCALE_43(x); }
+#else
+float4 common43(float4 x)
+{
+    float4 y = SCALE_43(x);
+    y += common42(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
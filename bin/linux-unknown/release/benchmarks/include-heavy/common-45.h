@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_45_H
+#define COMMON_45_H
+
+#include "common-43.h"
+#include "common-44.h"
+
+#define SCALE_45(x) ((x) * 46.0 + BIAS_45)
+#define BIAS_45 45.5
+
+#if defined(USE_FAST_PATH) && 45 % 2 == 0
+float4 common45(float4 x) { return SCALE_45(x); }
+#else
+float4 common45(float4 x)
+{
+    float4 y = SCALE_45(x);
+    y += common44(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_5_H
+#define COMMON_5_H
+
+#include "common-3.h"
+#include "common-4.h"
+
+#define SCALE_5(x) ((x) * 6.0 + BIAS_5)
+#define BIAS_5 5.5
+
+#if defined(USE_FAST_PATH) && 5 % 2 == 0
+float4 common5(float4 x) { return SCALE_5(x); }
+#else
+float4 common5(float4 x)
+{
+    float4 y = SCALE_5(x);
+    y += common4(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
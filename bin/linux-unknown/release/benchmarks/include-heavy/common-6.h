@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_6_H
+#define COMMON_6_H
+
+#include "common-4.h"
+#include "common-5.h"
+
+#define SCALE_6(x) ((x) * 7.0 + BIAS_6)
+#define BIAS_6 6.5
+
+#if defined(USE_FAST_PATH) && 6 % 2 == 0
+float4 common6(float4 x) { return SCALE_6(x); }
+#else
+float4 common6(float4 x)
+{
+    float4 y = SCALE_6(x);
+    y += common5(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
@@ -0,0 +1,23 @@
+// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.
+
+#ifndef COMMON_7_H
+#define COMMON_7_H
+
+#include "common-5.h"
+#include "common-6.h"
+
+#define SCALE_7(x) ((x) * 8.0 + BIAS_7)
+#define BIAS_7 7.5
+
+#if defined(USE_FAST_PATH) && 7 % 2 == 0
+float4 common7(float4 x) { return SCALE_7(x); }
+#else
+float4 common7(float4 x)
+{
+    float4 y = SCALE_7(x);
+    y += common6(x.yzwx);
+    return y;
+}
+#endif
+
+#endif
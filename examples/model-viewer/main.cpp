@@ -869,17 +869,19 @@ RefPtr<EffectVariant> createEffectVaraint(
     }
 
     // Now that we are ready to generate specialized shader code,
-    // we wil invoke the Slang compiler again. This time we leave
-    // full code generation turned on, and we also specify the
-    // entry points that we want explicitly (so that we don't
-    // generate code for any other entry points).
-    //
-    auto slangSession = getSlangSession();
-    SlangCompileRequest* slangRequest = spCreateCompileRequest(slangSession);
-    int targetIndex = spAddCodeGenTarget(slangRequest, SLANG_DXBC);
-    spSetTargetProfile(slangRequest, targetIndex, spFindProfile(slangSession, "sm_4_0"));
-    int translationUnitIndex = spAddTranslationUnit(slangRequest, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
-    spAddTranslationUnitSourceFile(slangRequest, translationUnitIndex, program->shaderModule->inputPath.c_str());
+    // we wil invoke the Slang compiler again. Rather than starting
+    // over from the source file, we create a request that specializes
+    // the module we already loaded (and checked), so that Slang doesn't
+    // parse or check the code again. This request has full code
+    // generation turned on, and we also specify the entry points that
+    // we want explicitly (so that we don't generate code for any
+    // other entry points).
+    //
+    // The specialization uses the same target as the module (DXBC
+    // with `sm_4_0`), and refers to its translation unit by index.
+    //
+    SlangCompileRequest* slangRequest = spCreateSpecializationRequest(shaderModule->slangRequest);
+    int translationUnitIndex = 0;
 
     const int entryPointCont = int(program->entryPoints.size());
     for(int ii = 0; ii < entryPointCont; ++ii)
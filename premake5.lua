@@ -323,13 +323,17 @@ tool "slang-generate"
 --
 -- The `slang-test` test driver also uses the `core` library, and it
 -- currently relies on include paths being set up so that it can find
--- the core headers:
+-- the core headers. It links against `slang` so that it can run the
+-- compiler in-process, shares the JSON output of reflection tests
+-- with `slang-reflection-test`, and runs `slangc` compiles with the
+-- code `slangc` uses (`slangc-driver.cpp`):
 --
 
 tool "slang-test"
     uuid "0C768A18-1D25-4000-9F37-DA5FE99E3B64"
     includedirs { "." }
-    links { "core" }
+    files { "tools/slang-reflection-test/slang-reflection-json.cpp", "source/slangc/slangc-driver.cpp", "source/slangc/slangc-driver.h" }
+    links { "core", "slang" }
 
 --
 -- The reflection test harness `slang-reflection-test` is pretty
@@ -342,6 +346,18 @@ tool "slang-reflection-test"
     includedirs { "." }
     links { "slang" }
 
+--
+-- The benchmark runner `slang-bench` links against `slang` to run the
+-- compiler, and against `core` for the utilities it shares with
+-- `slang-test` (including the directory enumeration in `os.cpp`):
+--
+
+tool "slang-bench"
+    uuid "534B4E48-F6E5-4994-AAE3-51EC4644D753"
+    includedirs { "." }
+    files { "tools/slang-test/os.cpp", "tools/slang-test/os.h" }
+    links { "core", "slang" }
+
 --
 -- `slang-eval-test` is similarly easy to build:
 --
@@ -418,8 +434,27 @@ tool "gfx"
 standardProject "slangc"
     uuid "D56CBCEB-1EB5-4CA8-AEC4-48EA35ED61C7"
     kind "ConsoleApp"
+    files { "source/slangd/slangd-protocol.cpp", "source/slangd/slangd-protocol.h" }
     links { "core", "slang" }
 
+--
+-- The `slangd` compile server is built the same way. `slangc` shares
+-- the code for talking to it (`slangd-protocol.cpp`), so that it can
+-- forward compiles to a running server, and `slangd` shares the code
+-- that runs a compile (`slangc-driver.cpp`).
+--
+-- The server talks over a Unix domain socket, so it isn't built for
+-- Windows (where `slangc` always compiles in-process):
+--
+
+if(os.target() ~= "windows") then
+    standardProject "slangd"
+        uuid "4A3C2D1E-6B7F-4E58-9D0A-1C2B3E4F5A6D"
+        kind "ConsoleApp"
+        files { "source/slangc/slangc-driver.cpp", "source/slangc/slangc-driver.h" }
+        links { "core", "slang" }
+end
+
 --
 -- TODO: Slang's current `Makefile` build does some careful incantations
 -- to make sure that the binaries it generates use a "relative `RPATH`"
@@ -429,6 +429,11 @@ extern "C"
         /* Skip code generation step, just check the code and generate layout */
         SLANG_COMPILE_FLAG_NO_CODEGEN                = 1 << 4,
 
+        /* Allocate the syntax of each module from an arena, which is freed
+        in bulk when the compile request (and any other request sharing
+        the module) is destroyed. */
+        SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST        = 1 << 5,
+
         /* Deprecated flags: kept around to allow existing applications to
         compile. Note that the relevant features will still be left in
         their default state. */
@@ -444,6 +449,24 @@ extern "C"
         /* When compiling for a D3D Shader Model 5.1 or higher target, allocate
            distinct register spaces for parameter blocks. */
         SLANG_TARGET_FLAG_PARAMETER_BLOCKS_USE_REGISTER_SPACES = 1 << 4,
+
+        /* When compiling for a SPIR-V target, emit SPIR-V directly from the IR
+           where possible, rather than generating GLSL and compiling it with
+           glslang. This is experimental: the directly emitted code is not run
+           through a validator yet, and entry points that use anything the
+           direct path doesn't support still go through glslang. */
+        SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY = 1 << 5,
+
+        /* When compiling for an HLSL target, emit the entry points from each
+           translation unit together, as one "library" of code in which the
+           declarations they share only appear once. The result for each of
+           the entry points is the code for its whole translation unit.
+
+           For a DXIL target, the same is done for the entry points that dxc
+           compiles with a `lib` profile (e.g., `lib_6_3` for the ray tracing
+           stages), and the library is compiled once for all of them. Other
+           entry points are still compiled one at a time. */
+        SLANG_TARGET_FLAG_LIBRARY_OUTPUT = 1 << 6,
     };
 
     /*!
@@ -673,6 +696,76 @@ extern "C"
     };
     #define SLANG_UUID_ISlangFileSystem { 0x003A09FC, 0x3A4D, 0x4BA0, 0xAD, 0x60, 0x1F, 0xD8, 0x63, 0xA9, 0x15, 0xAB }
 
+    /** Options for compiling code with a downstream compiler (see `ISlangDownstreamCompiler`).
+    */
+    typedef struct SlangDownstreamCompileDesc
+    {
+        /** The target to generate code for (`SLANG_DXBC`, `SLANG_DXIL` or `SLANG_SPIRV`). */
+        SlangCompileTarget  target;
+
+        /** The stage of the entry point to compile (a `SlangStage`). */
+        SlangUInt32         stage;
+
+        /** The path to use for the source code in diagnostics. */
+        char const*         sourcePath;
+
+        /** The HLSL or GLSL source code to compile (not null-terminated). */
+        void const*         source;
+        size_t              sourceSize;
+
+        /** The name of the entry point, and of the profile to compile it for (e.g., `ps_5_0`). */
+        char const*         entryPointName;
+        char const*         profileName;
+
+        /** Preprocessor definitions to use (only given in pass-through mode). */
+        char const* const*  defineNames;
+        char const* const*  defineValues;
+        int                 defineCount;
+    } SlangDownstreamCompileDesc;
+
+    /** A compiler that Slang passes the code it generates to, in order to produce binary code
+    (e.g., `fxc`, `dxc` or `glslang`).
+
+    A session creates instances of a downstream compiler as needed, and keeps them in a pool
+    to reuse them for later compiles. An instance is only ever used by one thread at a time,
+    but different instances may be used by different threads at the same time. This includes
+    `addRef` and `release`, so the reference count doesn't need to be atomic.
+    */
+    struct ISlangDownstreamCompiler : public ISlangUnknown
+    {
+    public:
+        /** Compile the source code described by `desc`.
+
+        @param outCode Receives the generated code.
+        @param outDiagnostics Receives any diagnostic output (may be left null).
+        @returns A `SlangResult` to indicate whether the code compiled.
+        */
+        virtual SLANG_NO_THROW SlangResult SLANG_MCALL compile(
+            SlangDownstreamCompileDesc const*   desc,
+            ISlangBlob**                        outCode,
+            ISlangBlob**                        outDiagnostics) = 0;
+
+        /** Produce a textual assembly listing of code for `target`.
+        */
+        virtual SLANG_NO_THROW SlangResult SLANG_MCALL disassemble(
+            SlangCompileTarget  target,
+            void const*         code,
+            size_t              codeSize,
+            ISlangBlob**        outAssembly) = 0;
+    };
+    #define SLANG_UUID_ISlangDownstreamCompiler { 0x6A3C4F1E, 0x9B27, 0x4D85, 0x8E, 0x1F, 0x52, 0x0C, 0xA7, 0x3B, 0xD4, 0x96 }
+
+    /** A function that creates an instance of a downstream compiler.
+
+    @param passThrough The downstream compiler to create an instance of.
+    @param userData The user data passed to `spSetDownstreamCompilerFactory`.
+    @param outCompiler Receives the new instance.
+    */
+    typedef SlangResult(*SlangCreateDownstreamCompilerFunc)(
+        SlangPassThrough            passThrough,
+        void*                       userData,
+        ISlangDownstreamCompiler**  outCompiler);
+
     /*!
     @brief An instance of the Slang library.
     */
@@ -703,6 +796,95 @@ extern "C"
         char const*     sourcePath,
         char const*     sourceString);
 
+    /** Set the function used to create instances of a downstream compiler
+
+    Instances of the downstream compiler given by `passThrough` (e.g., `SLANG_PASS_THROUGH_DXC`)
+    will be created by calling `createFunc`, instead of using the compiler built into Slang.
+    This makes it possible to use a compiler that isn't supported on the current platform,
+    or that has been loaded in a different way. Passing a null `createFunc` restores the
+    built-in compiler.
+
+    `identity` names the compiler that `createFunc` creates instances of, including its version
+    (e.g., "my-dxc 1.4.1907"), and should change whenever the compiler's output might. It is part
+    of the key that the compiler's output is kept under (see `spSetDownstreamOutputCacheDirectory`).
+    If `identity` is null, the output is only kept in memory, by this session.
+
+    Any instances of the downstream compiler that the session has pooled are released.
+    */
+    SLANG_API void spSetDownstreamCompilerFactory(
+        SlangSession*                       session,
+        SlangPassThrough                    passThrough,
+        SlangCreateDownstreamCompilerFunc   createFunc,
+        void*                               userData,
+        char const*                         identity = 0);
+
+    /** Set how many threads may invoke downstream compilers at the same time
+
+    The code for all of the entry points and targets in a request is generated first, and
+    then passed to downstream compilers on up to `threadCount` threads at a time (each using
+    its own instance of the downstream compiler). The default of zero uses one thread for
+    each processor.
+    */
+    SLANG_API void spSetDownstreamCompilerThreadCount(
+        SlangSession*   session,
+        int             threadCount);
+
+    /** Set a directory to keep the output of downstream compilers in
+
+    The output that downstream compilers produce (e.g., DXBC from the HLSL we generate) is kept
+    by the session, keyed by a hash of the code passed to the compiler and the options it is
+    invoked with, so that compiling identical code again (such as from two permutations that
+    generate the same HLSL) returns the same output without invoking the compiler. The output
+    is kept in memory, and also in files in `path` (which is created if it doesn't exist), so
+    that it can be reused by later sessions or other processes. Passing a null or empty `path`
+    keeps output in memory only.
+
+    The key also identifies the build of Slang and the downstream compiler (by the path, size
+    and modification time of the library that implements each, or the identity passed to
+    `spSetDownstreamCompilerFactory`), so output from other versions of either is never reused.
+    Output from a compiler that can't be identified isn't kept in the directory. Files for
+    versions that are no longer used aren't removed.
+    */
+    SLANG_API void spSetDownstreamOutputCacheDirectory(
+        SlangSession*   session,
+        char const*     path);
+
+    /** Set how many bytes of downstream compiler output a session keeps in memory
+
+    Once the limit is reached, the oldest output is dropped. The default is 64MB, and
+    a limit of zero means no output is kept in memory.
+    */
+    SLANG_API void spSetDownstreamOutputCacheMemoryLimit(
+        SlangSession*   session,
+        size_t          limit);
+
+    /*!
+    @brief Flags that select which declarations are only checked when they are first used.
+    */
+    typedef unsigned int SlangLazyCheckingFlags;
+    enum
+    {
+        /* Functions in the standard library (the default) */
+        SLANG_LAZY_CHECKING_STDLIB              = 1 << 0,
+
+        /* Functions in modules loaded through `import` */
+        SLANG_LAZY_CHECKING_IMPORTED_MODULES    = 1 << 1,
+    };
+
+    /** Set which declarations are only checked the first time they are used
+
+    Global functions in the selected modules are only checked (and lowered to IR) once lookup
+    or IR generation first reaches them, rather than when the module is loaded. Functions that
+    nothing uses are never checked, so errors in them are not reported.
+
+    Clearing `SLANG_LAZY_CHECKING_STDLIB` checks every standard library function that hasn't
+    been checked yet. Changing `SLANG_LAZY_CHECKING_IMPORTED_MODULES` applies to modules
+    imported after the call.
+    */
+    SLANG_API void spSetLazyCheckingFlags(
+        SlangSession*           session,
+        SlangLazyCheckingFlags  flags);
+
     /*!
     @brief Create a compile request.
     */
@@ -715,6 +897,53 @@ extern "C"
     SLANG_API void spDestroyCompileRequest(
         SlangCompileRequest*    request);
 
+    /** Create a permutation of a compile request.
+
+    @param baseRequest The request to copy. Its source code, entry points and targets should already have been added.
+
+    The new request starts out with the same options, search paths, preprocessor definitions,
+    translation units, entry points and targets as `baseRequest`. More can then be added
+    as usual (for example, with `spAddPreprocessorDefine`, `spAddEntryPointEx` or
+    `spAddCodeGenTarget`) to make the permutation.
+
+    Modules loaded by `import` while compiling a permutation are shared with the other
+    permutations of the same base request, as long as the preprocessor definitions that
+    differ between them are not used by the module (or any module it imports), and the
+    search paths have not been changed. In the same way, the tokens from preprocessing the source
+    files of the base request (and anything they `#include`) are shared, so that each permutation
+    only needs to preprocess the files that use the definitions it changes. A translation unit
+    that comes out the same for two permutations (it uses none of the definitions that differ
+    between them, and neither do the modules it imports) is only parsed, checked and lowered
+    to IR once, as long as doing so didn't produce any diagnostics.
+
+    The base request is kept alive until all of its permutations have been destroyed,
+    and should not have any source added to it once permutations have been created.
+    */
+    SLANG_API SlangCompileRequest* spCreatePermutationRequest(
+        SlangCompileRequest*    baseRequest);
+
+    /** Create a request to specialize entry points of a request that has already been compiled.
+
+    @param compiledRequest A request that has been compiled successfully with `spCompile`
+    (possibly with `SLANG_COMPILE_FLAG_NO_CODEGEN`, so that it was only checked).
+    @returns The new request, or null if `compiledRequest` hasn't been compiled successfully.
+
+    The new request starts out with the same options and targets as `compiledRequest`,
+    and with its translation units, but no entry points. Entry points are added with
+    `spAddEntryPoint` or `spAddEntryPointEx` (using the translation unit indices of
+    `compiledRequest`), usually with the type names to use for global generic type parameters.
+
+    Compiling the request does not parse or check the source again, or lower it to IR:
+    the checked modules and IR of `compiledRequest` are used as they are, so only the
+    entry points and their generic arguments are checked before parameter binding and
+    code generation. This makes it cheap to create many specialized variants of the same
+    shader code. Source and preprocessor definitions can't be added to the request.
+
+    `compiledRequest` is kept alive until all of its specializations have been destroyed.
+    */
+    SLANG_API SlangCompileRequest* spCreateSpecializationRequest(
+        SlangCompileRequest*    compiledRequest);
+
     /** Set the filesystem hook to use for a compile request
 
     The provided `fileSystem` will be used to load any files that
@@ -806,6 +1035,23 @@ extern "C"
         SlangDiagnosticCallback callback,
         void const*             userData);
 
+    typedef void(*SlangOutputCallback)(
+        void const* data,
+        size_t      size,
+        void*       userData);
+
+    /*!
+    @brief Set a callback to receive output that would otherwise be written to `stdout`.
+
+    When compiling in command-line mode, code for entry points without an output
+    path is written to `stdout`. If a callback is set, that output is passed to
+    it instead, and is written as if `stdout` had been redirected to a file.
+    */
+    SLANG_API void spSetStandardOutputCallback(
+        SlangCompileRequest*    request,
+        SlangOutputCallback     callback,
+        void const*             userData);
+
     /*!
     @brief Add a path to use when searching for referenced files.
     This will be used for both `#include` directives and also for explicit `__import` declarations.
@@ -972,6 +1218,24 @@ extern "C"
     SLANG_API SlangResult spCompile(
         SlangCompileRequest*    request);
 
+    /** Execute a number of compile requests together, such as the permutations of a request
+    created with `spCreatePermutationRequest`.
+
+    @param requests The requests to compile
+    @param requestCount The number of requests
+    @returns SLANG_OK if every request succeeded, otherwise the result of a request that failed.
+
+    Each request is checked and has its code generated in turn on the calling thread, after
+    which the downstream compilers (such as `fxc`) that produce the output of all of the requests
+    are run at once, on as many threads as the session allows (see `spSetDownstreamCompilerThreadCount`).
+    The output and diagnostics of each request are then available from it, as after `spCompile`.
+    In the stats of each request (see `spGetCompileStats`), the time spent running the downstream
+    compilers is the time taken for the whole batch.
+    */
+    SLANG_API SlangResult spCompileBatch(
+        SlangCompileRequest* const* requests,
+        int                         requestCount);
+
 
     /** Get any diagnostic messages reported by the compiler.
 
@@ -1059,6 +1323,116 @@ extern "C"
         SlangCompileRequest*    request,
         size_t*                 outSize);
 
+    /*!
+    @brief The phases of compilation that time is attributed to in `SlangCompileStats`.
+
+    Phases do not overlap: when one phase triggers another (e.g., an `import`
+    during semantic checking causes a module to be parsed), the time is
+    attributed to the inner phase.
+    */
+    typedef unsigned int SlangCompilePhase;
+    enum
+    {
+        SLANG_COMPILE_PHASE_PREPROCESS,
+        SLANG_COMPILE_PHASE_PARSE,
+        SLANG_COMPILE_PHASE_CHECK,
+        SLANG_COMPILE_PHASE_LOWER_TO_IR,
+        SLANG_COMPILE_PHASE_PARAMETER_BINDING,
+        SLANG_COMPILE_PHASE_SPECIALIZE,
+        SLANG_COMPILE_PHASE_LEGALIZE,
+        SLANG_COMPILE_PHASE_SSA,
+        SLANG_COMPILE_PHASE_EMIT,
+        SLANG_COMPILE_PHASE_DOWNSTREAM,
+
+        SLANG_COMPILE_PHASE_COUNT_OF,
+
+        /* The number of phases `SlangCompileStats` has room for. Phases can be
+           added up to this count without moving the fields that follow. */
+        SLANG_COMPILE_PHASE_MAX_COUNT = 16,
+    };
+
+    /*!
+    @brief Timing and counters gathered while executing a compile request.
+
+    Fields may be added to the end of this structure in later versions, so
+    callers must set `structSize` to `sizeof(SlangCompileStats)` before
+    passing it to `spGetCompileStats`.
+    */
+    typedef struct SlangCompileStats
+    {
+        /* Size of the structure in bytes, as known to the caller. On return, the
+           number of bytes that were filled in. */
+        size_t structSize;
+
+        /* Wall-clock time, in seconds, spent in each phase (indexed by `SlangCompilePhase`).
+           The entries past `SLANG_COMPILE_PHASE_COUNT_OF` are always zero. */
+        double phaseSeconds[SLANG_COMPILE_PHASE_MAX_COUNT];
+
+        /* Wall-clock time, in seconds, spent in `spCompile` as a whole */
+        double totalSeconds;
+
+        /* Number of tokens produced by the preprocessor */
+        uint64_t tokenCount;
+
+        /* Number of declarations that semantic checking was applied to */
+        uint64_t declCheckCount;
+
+        /* Number of operator overload resolutions answered from the session cache */
+        uint64_t overloadCacheHitCount;
+
+        /* Number of member lookups answered from the session cache */
+        uint64_t memberLookupCacheHitCount;
+
+        /* Number of IR instructions created and removed */
+        uint64_t irInstCreatedCount;
+        uint64_t irInstRemovedCount;
+
+        /* Bytes used (and reserved) by the memory arenas of the IR modules produced */
+        uint64_t irMemoryUsedBytes;
+        uint64_t irMemoryAllocatedBytes;
+
+        /* Number of entry point results reused because their IR (after specialization
+           and legalization) was identical to that of an entry point compiled before */
+        uint64_t outputCacheHitCount;
+
+        /* Number of downstream compiler invocations skipped because the session already
+           had their output (see `spSetDownstreamOutputCacheDirectory`) */
+        uint64_t downstreamCacheHitCount;
+
+        /* Number of allocations made from the memory arenas of the IR modules produced */
+        uint64_t irMemoryAllocationCount;
+    } SlangCompileStats;
+
+    /** Get the name of a compilation phase, e.g., for printing a report.
+    */
+    SLANG_API char const* spGetCompilePhaseName(
+        SlangCompilePhase       phase);
+
+    /** Get timing and counters for the most recent `spCompile` on a request.
+
+    @param request The compile request to get statistics for.
+    @param outStats A structure to be filled in with the statistics. Its `structSize`
+        must be set; only the fields that fit within that size are written.
+    @returns A `SlangResult` indicating success or failure.
+    */
+    SLANG_API SlangResult spGetCompileStats(
+        SlangCompileRequest*    request,
+        SlangCompileStats*      outStats);
+
+    /** Run one of the checks of internal data structures built into the library.
+
+    This is used by `slang-test` to test parts of the compiler that can't be
+    reached through the rest of the API, and isn't meant for other clients.
+
+    @param session The session to run the check in.
+    @param name The name of the check (e.g., `"IRStructuralHash"`).
+    @returns `SLANG_OK` if the check passed, `SLANG_FAIL` if it failed, or
+        `SLANG_E_NOT_FOUND` if there is no check with that name.
+    */
+    SLANG_API SlangResult spRunInternalCheck(
+        SlangSession*           session,
+        char const*             name);
+
 
 
     typedef struct SlangVM          SlangVM;
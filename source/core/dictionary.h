@@ -2,11 +2,25 @@
 #define CORE_LIB_DICTIONARY_H
 #include "list.h"
 #include "common.h"
-#include "int-set.h"
 #include "exception.h"
 #include "slang-math.h"
 #include "hash.h"
 
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define SLANG_DICTIONARY_USE_SSE2 1
+#	include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(_M_ARM64)) && !defined(__ARM_BIG_ENDIAN)
+#	define SLANG_DICTIONARY_USE_NEON 1
+#	include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#	include <intrin.h>
+#endif
+
 namespace Slang
 {
 	template<typename TKey, typename TValue>
@@ -65,152 +79,271 @@ namespace Slang
 		return KeyValuePair<TKey, TValue>(k, v);
 	}
 
-	const float MaxLoadFactor = 0.7f;
+	// Per-slot control bytes for `Dictionary`. A full slot holds the low
+	// 7 bits of its (mixed) hash code, so that control bytes are
+	// non-negative exactly when a slot is full.
+	enum : int8_t
+	{
+		kDictionaryControlEmpty = -128,
+		kDictionaryControlDeleted = -2,
+	};
+
+	// A group of consecutive control bytes that can be matched against
+	// a value in one step, using SSE2 or NEON where available.
+	struct DictionaryControlGroup
+	{
+		enum { kWidth = 16 };
+
+#if SLANG_DICTIONARY_USE_SSE2
+		// One bit per control byte
+		typedef uint32_t Mask;
+		enum { kMaskShift = 0 };
+
+		explicit DictionaryControlGroup(const int8_t* controls)
+			: bytes(_mm_loadu_si128((const __m128i*)controls))
+		{}
+		Mask Match(int8_t value) const
+		{
+			return Mask(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), bytes)));
+		}
+		Mask MatchEmptyOrDeleted() const
+		{
+			return Mask(_mm_movemask_epi8(bytes));
+		}
+
+		__m128i bytes;
+#elif SLANG_DICTIONARY_USE_NEON
+		// One bit per 4-bit nibble, with only the top bit of each nibble used
+		typedef uint64_t Mask;
+		enum { kMaskShift = 2 };
+
+		explicit DictionaryControlGroup(const int8_t* controls)
+			: bytes(vld1q_s8(controls))
+		{}
+		static Mask ToMask(uint8x16_t lanes)
+		{
+			uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4);
+			return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull;
+		}
+		Mask Match(int8_t value) const
+		{
+			return ToMask(vceqq_s8(bytes, vdupq_n_s8(value)));
+		}
+		Mask MatchEmptyOrDeleted() const
+		{
+			return ToMask(vcltq_s8(bytes, vdupq_n_s8(0)));
+		}
+
+		int8x16_t bytes;
+#else
+		typedef uint32_t Mask;
+		enum { kMaskShift = 0 };
+
+		explicit DictionaryControlGroup(const int8_t* controls)
+			: controls(controls)
+		{}
+		Mask Match(int8_t value) const
+		{
+			Mask mask = 0;
+			for (int i = 0; i < kWidth; i++)
+				mask |= Mask(controls[i] == value) << i;
+			return mask;
+		}
+		Mask MatchEmptyOrDeleted() const
+		{
+			Mask mask = 0;
+			for (int i = 0; i < kWidth; i++)
+				mask |= Mask(controls[i] < 0) << i;
+			return mask;
+		}
+
+		const int8_t* controls;
+#endif
+
+		Mask MatchEmpty() const
+		{
+			return Match(kDictionaryControlEmpty);
+		}
+
+		// Index (within the group) of the first match in a non-zero mask
+		static int LowestIndex(Mask mask)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			if (uint32_t(mask))
+				_BitScanForward(&index, (unsigned long)uint32_t(mask));
+			else
+			{
+				_BitScanForward(&index, (unsigned long)uint32_t(uint64_t(mask) >> 32));
+				index += 32;
+			}
+			return int(index) >> kMaskShift;
+#else
+			return __builtin_ctzll((unsigned long long)mask) >> kMaskShift;
+#endif
+		}
+	};
 
+	// An open-addressing hash table. Slots are tracked by an array of
+	// control bytes that is probed a whole `DictionaryControlGroup` at a time,
+	// and the hash code of each entry is stored so that most mismatches are
+	// rejected without comparing keys, and growing never re-hashes a key.
+	//
+	// Lookup operations accept any key type `T` that can be compared with
+	// `TKey` and hashes the same way (e.g., `UnownedStringSlice` for `String`).
 	template<typename TKey, typename TValue>
 	class Dictionary
 	{
 		friend class Iterator;
 		friend class ItemProxy;
 	private:
-		inline int GetProbeOffset(int /*probeId*/) const
-		{
-			// quadratic probing
-			return 1;
-		}
-	private:
-		int bucketSizeMinusOne, shiftBits;
+		typedef DictionaryControlGroup Group;
+
+		// Number of slots (zero, or a power of two no smaller than a group)
+		int capacity;
 		int _count;
-		IntSet marks;
+		// Number of slots marked as deleted, which still count against the load factor
+		int deletedCount;
+		// `capacity + Group::kWidth` control bytes; the extra bytes mirror the
+		// first group, so that a group starting at any slot can be loaded directly
+		int8_t* controls;
+		unsigned int* hashCodes;
 		KeyValuePair<TKey, TValue>* hashMap;
+
 		void Free()
 		{
 			if (hashMap)
 				delete[] hashMap;
+			if (hashCodes)
+				delete[] hashCodes;
+			if (controls)
+				delete[] controls;
 			hashMap = 0;
+			hashCodes = 0;
+			controls = 0;
 		}
-		inline bool IsDeleted(int pos) const
+		template<typename T>
+		static unsigned int GetMixedHashCode(const T & key)
 		{
-			return marks.Contains((pos << 1) + 1);
+			// Hash codes for pointers and small integers have poor low bits,
+			// so mix the bits before splitting the result into a position
+			// and the 7 bits stored in the control byte.
+			uint64_t product = uint64_t((unsigned int)GetHashCode((T&)key)) * 0x9E3779B97F4A7C15ull;
+			return (unsigned int)(product >> 32) ^ (unsigned int)product;
 		}
-		inline bool IsEmpty(int pos) const
+		inline bool IsFull(int pos) const
 		{
-			return !marks.Contains((pos << 1));
+			return controls[pos] >= 0;
 		}
-		inline void SetDeleted(int pos, bool val)
+		inline void SetControl(int pos, int8_t control)
 		{
-			if (val)
-				marks.Add((pos << 1) + 1);
-			else
-				marks.Remove((pos << 1) + 1);
+			controls[pos] = control;
+			if (pos < Group::kWidth)
+				controls[capacity + pos] = control;
 		}
-		inline void SetEmpty(int pos, bool val)
+		template<typename T>
+		int FindPosition(const T & key, unsigned int hashCode) const
+		{
+			if (capacity == 0)
+				return -1;
+			const int8_t control = int8_t(hashCode & 0x7F);
+			const int mask = capacity - 1;
+			int pos = int(hashCode >> 7) & mask;
+			int step = 0;
+			for (;;)
+			{
+				Group group(controls + pos);
+				for (auto matches = group.Match(control); matches; matches &= matches - 1)
+				{
+					int slot = (pos + Group::LowestIndex(matches)) & mask;
+					if (hashCodes[slot] == hashCode && hashMap[slot].Key == key)
+						return slot;
+				}
+				// The probe sequence for a key never extends past an empty slot
+				if (group.MatchEmpty())
+					return -1;
+				step += Group::kWidth;
+				pos = (pos + step) & mask;
+			}
+		}
+		template<typename T>
+		int FindPosition(const T & key) const
 		{
-			if (val)
-				marks.Remove((pos << 1));
-			else
-				marks.Add((pos << 1));
+			return FindPosition(key, GetMixedHashCode(key));
 		}
-		struct FindPositionResult
+		int FindInsertPosition(unsigned int hashCode) const
 		{
-			int ObjectPosition;
-			int InsertionPosition;
-			FindPositionResult()
+			const int mask = capacity - 1;
+			int pos = int(hashCode >> 7) & mask;
+			int step = 0;
+			for (;;)
 			{
-				ObjectPosition = -1;
-				InsertionPosition = -1;
+				Group group(controls + pos);
+				if (auto matches = group.MatchEmptyOrDeleted())
+					return (pos + Group::LowestIndex(matches)) & mask;
+				step += Group::kWidth;
+				pos = (pos + step) & mask;
 			}
-			FindPositionResult(int objPos, int insertPos)
-			{
-				ObjectPosition = objPos;
-				InsertionPosition = insertPos;
-			}
-
-		};
-		template<typename T>
-		inline int GetHashPos(T & key) const
+		}
+		void Allocate(int newCapacity)
 		{
-			return ((unsigned int)(GetHashCode(key) * 2654435761)) >> shiftBits;
+			capacity = newCapacity;
+			controls = new int8_t[newCapacity + Group::kWidth];
+			memset(controls, kDictionaryControlEmpty, newCapacity + Group::kWidth);
+			hashCodes = new unsigned int[newCapacity];
+			hashMap = new KeyValuePair<TKey, TValue>[newCapacity];
 		}
-		template<typename T>
-		FindPositionResult FindPosition(const T & key) const
+		void Rehash(int newCapacity)
 		{
-			int hashPos = GetHashPos((T&)key);
-			int insertPos = -1;
-			int numProbes = 0;
-			while (numProbes <= bucketSizeMinusOne)
+			Dictionary<TKey, TValue> newDict;
+			newDict.Allocate(newCapacity);
+			for (int pos = 0; pos < capacity; pos++)
 			{
-				if (IsEmpty(hashPos))
-				{
-					if (insertPos == -1)
-						return FindPositionResult(-1, hashPos);
-					else
-						return FindPositionResult(-1, insertPos);
-				}
-				else if (IsDeleted(hashPos))
-				{
-					if (insertPos == -1)
-						insertPos = hashPos;
-				}
-				else if (hashMap[hashPos].Key == key)
-				{
-					return FindPositionResult(hashPos, -1);
-				}
-				numProbes++;
-				hashPos = (hashPos + GetProbeOffset(numProbes)) & bucketSizeMinusOne;
+				if (!IsFull(pos))
+					continue;
+				unsigned int hashCode = hashCodes[pos];
+				int newPos = newDict.FindInsertPosition(hashCode);
+				newDict.SetControl(newPos, int8_t(hashCode & 0x7F));
+				newDict.hashCodes[newPos] = hashCode;
+				newDict.hashMap[newPos] = _Move(hashMap[pos]);
 			}
-			if (insertPos != -1)
-				return FindPositionResult(-1, insertPos);
-			throw InvalidOperationException("Hash map is full. This indicates an error in Key::Equal or Key::GetHashCode.");
+			newDict._count = _count;
+			*this = _Move(newDict);
 		}
-		TValue & _Insert(KeyValuePair<TKey, TValue> && kvPair, int pos)
+		// Make sure there is room to insert one more entry
+		void ReserveForInsert()
 		{
-			hashMap[pos] = _Move(kvPair);
-			SetEmpty(pos, false);
-			SetDeleted(pos, false);
-			return hashMap[pos].Value;
+			// Deleted slots still lengthen probe sequences, so they count
+			// against a maximum load factor of 7/8.
+			if ((_count + deletedCount + 1) * 8 <= capacity * 7)
+				return;
+			if (capacity == 0)
+				Rehash(Group::kWidth);
+			else if ((_count + 1) * 2 <= capacity)
+				Rehash(capacity); // mostly deleted slots: clean up in place
+			else
+				Rehash(capacity * 2);
 		}
-		void Rehash()
+		TValue & InsertNew(KeyValuePair<TKey, TValue> && kvPair, unsigned int hashCode)
 		{
-			if (bucketSizeMinusOne == -1 || _count / (float)bucketSizeMinusOne >= MaxLoadFactor)
-			{
-				int newSize = (bucketSizeMinusOne + 1) * 2;
-				int newShiftBits = shiftBits - 1;
-				if (newSize == 0)
-				{
-					newSize = 16;
-					newShiftBits = 28;
-				}
-				Dictionary<TKey, TValue> newDict;
-				newDict.shiftBits = newShiftBits;
-				newDict.bucketSizeMinusOne = newSize - 1;
-				newDict.hashMap = new KeyValuePair<TKey, TValue>[newSize];
-				newDict.marks.SetMax(newSize * 2);
-				if (hashMap)
-				{
-					for (auto & kvPair : *this)
-					{
-						newDict.Add(_Move(kvPair));
-					}
-				}
-				*this = _Move(newDict);
-			}
+			ReserveForInsert();
+			int pos = FindInsertPosition(hashCode);
+			if (controls[pos] == kDictionaryControlDeleted)
+				deletedCount--;
+			SetControl(pos, int8_t(hashCode & 0x7F));
+			hashCodes[pos] = hashCode;
+			hashMap[pos] = _Move(kvPair);
+			_count++;
+			return hashMap[pos].Value;
 		}
 
 		bool AddIfNotExists(KeyValuePair<TKey, TValue> && kvPair)
 		{
-			Rehash();
-			auto pos = FindPosition(kvPair.Key);
-			if (pos.ObjectPosition != -1)
+			unsigned int hashCode = GetMixedHashCode(kvPair.Key);
+			if (FindPosition(kvPair.Key, hashCode) != -1)
 				return false;
-			else if (pos.InsertionPosition != -1)
-			{
-				_count++;
-				_Insert(_Move(kvPair), pos.InsertionPosition);
-				return true;
-			}
-			else
-				throw InvalidOperationException("Inconsistent find result returned. This is a bug in Dictionary implementation.");
+			InsertNew(_Move(kvPair), hashCode);
+			return true;
 		}
 		void Add(KeyValuePair<TKey, TValue> && kvPair)
 		{
@@ -219,17 +352,14 @@ namespace Slang
 		}
 		TValue & Set(KeyValuePair<TKey, TValue> && kvPair)
 		{
-			Rehash();
-			auto pos = FindPosition(kvPair.Key);
-			if (pos.ObjectPosition != -1)
-				return _Insert(_Move(kvPair), pos.ObjectPosition);
-			else if (pos.InsertionPosition != -1)
+			unsigned int hashCode = GetMixedHashCode(kvPair.Key);
+			int pos = FindPosition(kvPair.Key, hashCode);
+			if (pos != -1)
 			{
-				_count++;
-				return _Insert(_Move(kvPair), pos.InsertionPosition);
+				hashMap[pos] = _Move(kvPair);
+				return hashMap[pos].Value;
 			}
-			else
-				throw InvalidOperationException("Inconsistent find result returned. This is a bug in Dictionary implementation.");
+			return InsertNew(_Move(kvPair), hashCode);
 		}
 	public:
 		class Iterator
@@ -248,10 +378,10 @@ namespace Slang
 			}
 			Iterator & operator ++()
 			{
-				if (pos > dict->bucketSizeMinusOne)
+				if (pos >= dict->capacity)
 					return *this;
 				pos++;
-				while (pos <= dict->bucketSizeMinusOne && (dict->IsDeleted(pos) || dict->IsEmpty(pos)))
+				while (pos < dict->capacity && !dict->IsFull(pos))
 				{
 					pos++;
 				}
@@ -286,18 +416,13 @@ namespace Slang
 		Iterator begin() const
 		{
 			int pos = 0;
-			while (pos < bucketSizeMinusOne + 1)
-			{
-				if (IsEmpty(pos) || IsDeleted(pos))
-					pos++;
-				else
-					break;
-			}
+			while (pos < capacity && !IsFull(pos))
+				pos++;
 			return Iterator(this, pos);
 		}
 		Iterator end() const
 		{
-			return Iterator(this, bucketSizeMinusOne + 1);
+			return Iterator(this, capacity);
 		}
 	public:
 		void Add(const TKey & key, const TValue & value)
@@ -320,37 +445,41 @@ namespace Slang
 		{
 			if (_count == 0)
 				return;
-			auto pos = FindPosition(key);
-			if (pos.ObjectPosition != -1)
+			int pos = FindPosition(key);
+			if (pos != -1)
 			{
-				SetDeleted(pos.ObjectPosition, true);
+				// Release whatever the entry was holding onto
+				hashMap[pos] = KeyValuePair<TKey, TValue>();
+				SetControl(pos, kDictionaryControlDeleted);
+				deletedCount++;
 				_count--;
 			}
 		}
 		void Clear()
 		{
+			for (int pos = 0; pos < capacity; pos++)
+			{
+				if (IsFull(pos))
+					hashMap[pos] = KeyValuePair<TKey, TValue>();
+			}
+			if (controls)
+				memset(controls, kDictionaryControlEmpty, capacity + Group::kWidth);
 			_count = 0;
-
-			marks.Clear();
+			deletedCount = 0;
 		}
 
 		template<typename T>
 		bool ContainsKey(const T & key) const
 		{
-			if (bucketSizeMinusOne == -1)
-				return false;
-			auto pos = FindPosition(key);
-			return pos.ObjectPosition != -1;
+			return FindPosition(key) != -1;
 		}
 		template<typename T>
 		bool TryGetValue(const T & key, TValue & value) const
 		{
-			if (bucketSizeMinusOne == -1)
-				return false;
-			auto pos = FindPosition(key);
-			if (pos.ObjectPosition != -1)
+			int pos = FindPosition(key);
+			if (pos != -1)
 			{
-				value = hashMap[pos.ObjectPosition].Value;
+				value = hashMap[pos].Value;
 				return true;
 			}
 			return false;
@@ -358,12 +487,10 @@ namespace Slang
 		template<typename T>
 		TValue * TryGetValue(const T & key) const
 		{
-			if (bucketSizeMinusOne == -1)
-				return nullptr;
-			auto pos = FindPosition(key);
-			if (pos.ObjectPosition != -1)
+			int pos = FindPosition(key);
+			if (pos != -1)
 			{
-				return &hashMap[pos.ObjectPosition].Value;
+				return &hashMap[pos].Value;
 			}
 			return nullptr;
 		}
@@ -385,10 +512,10 @@ namespace Slang
 			}
 			TValue & GetValue() const
 			{
-				auto pos = dict->FindPosition(key);
-				if (pos.ObjectPosition != -1)
+				int pos = dict->FindPosition(key);
+				if (pos != -1)
 				{
-					return dict->hashMap[pos.ObjectPosition].Value;
+					return dict->hashMap[pos].Value;
 				}
 				else
 					throw KeyNotFoundException("The key does not exists in dictionary.");
@@ -429,26 +556,25 @@ namespace Slang
 			Add(kvPair);
 			Init(args...);
 		}
+		void Init()
+		{}
 	public:
 		Dictionary()
-		{
-			bucketSizeMinusOne = -1;
-			shiftBits = 32;
-			_count = 0;
-			hashMap = 0;
-		}
+			: capacity(0), _count(0), deletedCount(0), controls(0), hashCodes(0), hashMap(0)
+		{}
 		template<typename Arg, typename... Args>
 		Dictionary(Arg arg, Args... args)
+			: capacity(0), _count(0), deletedCount(0), controls(0), hashCodes(0), hashMap(0)
 		{
 			Init(arg, args...);
 		}
 		Dictionary(const Dictionary<TKey, TValue> & other)
-			: bucketSizeMinusOne(-1), _count(0), hashMap(0)
+			: capacity(0), _count(0), deletedCount(0), controls(0), hashCodes(0), hashMap(0)
 		{
 			*this = other;
 		}
 		Dictionary(Dictionary<TKey, TValue> && other)
-			: bucketSizeMinusOne(-1), _count(0), hashMap(0)
+			: capacity(0), _count(0), deletedCount(0), controls(0), hashCodes(0), hashMap(0)
 		{
 			*this = (_Move(other));
 		}
@@ -457,13 +583,21 @@ namespace Slang
 			if (this == &other)
 				return *this;
 			Free();
-			bucketSizeMinusOne = other.bucketSizeMinusOne;
+			capacity = 0;
 			_count = other._count;
-			shiftBits = other.shiftBits;
-			hashMap = new KeyValuePair<TKey, TValue>[other.bucketSizeMinusOne + 1];
-			marks = other.marks;
-			for (int i = 0; i <= bucketSizeMinusOne; i++)
-				hashMap[i] = other.hashMap[i];
+			deletedCount = other.deletedCount;
+			if (other.capacity)
+			{
+				Allocate(other.capacity);
+				memcpy(controls, other.controls, capacity + Group::kWidth);
+				for (int i = 0; i < capacity; i++)
+				{
+					if (!IsFull(i))
+						continue;
+					hashCodes[i] = other.hashCodes[i];
+					hashMap[i] = other.hashMap[i];
+				}
+			}
 			return *this;
 		}
 		Dictionary<TKey, TValue> & operator = (Dictionary<TKey, TValue> && other)
@@ -471,14 +605,18 @@ namespace Slang
 			if (this == &other)
 				return *this;
 			Free();
-			bucketSizeMinusOne = other.bucketSizeMinusOne;
+			capacity = other.capacity;
 			_count = other._count;
+			deletedCount = other.deletedCount;
+			controls = other.controls;
+			hashCodes = other.hashCodes;
 			hashMap = other.hashMap;
-			shiftBits = other.shiftBits;
-			marks = _Move(other.marks);
-			other.hashMap = 0;
+			other.capacity = 0;
 			other._count = 0;
-			other.bucketSizeMinusOne = -1;
+			other.deletedCount = 0;
+			other.controls = 0;
+			other.hashCodes = 0;
+			other.hashMap = 0;
 			return *this;
 		}
 		~Dictionary()
@@ -596,7 +734,8 @@ namespace Slang
 		{
 			dict.Remove(obj);
 		}
-		bool Contains(const T & obj) const
+		template<typename U>
+		bool Contains(const U & obj) const
 		{
 			return dict.ContainsKey(obj);
 		}
@@ -8,7 +8,6 @@
 	#undef WIN32_LEAN_AND_MEAN
 	#undef NOMINMAX
 #else
-	#include "slang-string.h"
 	#include <dlfcn.h>
 #endif
 
@@ -84,4 +83,30 @@ namespace Slang
 
 		return funcPtr;
 	}
+
+	String SharedLibrary::getPathContaining(void const* address)
+	{
+#ifdef _WIN32
+		{
+			HMODULE module = nullptr;
+			char path[MAX_PATH];
+			if (!GetModuleHandleExA(
+					GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+					(LPCSTR) address,
+					&module))
+				return String();
+			DWORD length = GetModuleFileNameA(module, path, MAX_PATH);
+			if (length == 0 || length == MAX_PATH)
+				return String();
+			return String(path);
+		}
+#else
+		{
+			Dl_info info;
+			if (!dladdr(address, &info) || !info.dli_fname)
+				return String();
+			return String(info.dli_fname);
+		}
+#endif
+	}
 }
\ No newline at end of file
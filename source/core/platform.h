@@ -2,6 +2,8 @@
 #ifndef SLANG_CORE_PLATFORM_H_INCLUDED
 #define SLANG_CORE_PLATFORM_H_INCLUDED
 
+#include "slang-string.h"
+
 namespace Slang
 {
 	// Interface for working with shared libraries
@@ -23,6 +25,10 @@ namespace Slang
 
 		FuncPtr findFuncByName(char const* name);
 
+		// Get the path of the loaded library (or executable)
+		// that contains `address`, or an empty string if it
+		// can't be determined
+		static String getPathContaining(void const* address);
 
 		operator Handle() { return handle; }
 	};
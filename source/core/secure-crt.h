@@ -39,7 +39,7 @@ inline int sprintf_s(char * buffer, size_t sizeOfBuffer, const char * format, ..
 {
 	va_list argptr;
 	va_start(argptr, format);
-	int rs = snprintf(buffer, sizeOfBuffer, format, argptr);
+	int rs = vsnprintf(buffer, sizeOfBuffer, format, argptr);
 	va_end(argptr);
 	return rs;
 }
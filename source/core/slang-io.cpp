@@ -21,6 +21,22 @@ namespace Slang
 #endif
 	}
 
+	bool File::GetSizeAndModificationTime(const String & fileName, uint64_t & outSize, uint64_t & outModificationTime)
+	{
+#ifdef _WIN32
+		struct _stat64 statVar;
+		if (::_wstat64(((String)fileName).ToWString(), &statVar) != 0)
+			return false;
+#else
+		struct stat statVar;
+		if (::stat(fileName.Buffer(), &statVar) != 0)
+			return false;
+#endif
+		outSize = uint64_t(statVar.st_size);
+		outModificationTime = uint64_t(statVar.st_mtime);
+		return true;
+	}
+
 	String Path::TruncateExt(const String & path)
 	{
 		UInt dotPos = path.LastIndexOf('.');
@@ -103,6 +119,17 @@ namespace Slang
 		sb.Append(path2);
 		return sb.ProduceString();
 	}
+	bool Path::IsAbsolute(const String & path)
+	{
+		if (path.StartsWith("/") || path.StartsWith("\\"))
+			return true;
+#if defined(_WIN32)
+		// A path starting with a drive letter, e.g. `C:`
+		if (path.Length() >= 2 && path[1] == ':')
+			return true;
+#endif
+		return false;
+	}
 	String Path::Combine(const String & path1, const String & path2, const String & path3)
 	{
 		StringBuilder sb(path1.Length()+path2.Length()+path3.Length()+3);
@@ -15,6 +15,10 @@ namespace Slang
 		static Slang::String ReadAllText(const Slang::String & fileName);
 		static Slang::List<unsigned char> ReadAllBytes(const Slang::String & fileName);
 		static void WriteAllText(const Slang::String & fileName, const Slang::String & text);
+
+		// Get the size of a file and the time it was last modified (in seconds),
+		// returning false if the file doesn't exist
+		static bool GetSizeAndModificationTime(const Slang::String & fileName, uint64_t & outSize, uint64_t & outModificationTime);
 	};
 
 	class Path
@@ -30,6 +34,7 @@ namespace Slang
 		static String GetDirectoryName(const String & path);
 		static String Combine(const String & path1, const String & path2);
 		static String Combine(const String & path1, const String & path2, const String & path3);
+		static bool IsAbsolute(const String & path);
 		static bool CreateDir(const String & path);
 	};
 }
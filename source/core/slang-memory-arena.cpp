@@ -68,6 +68,7 @@ void MemoryArena::_resetCurrentBlock()
     m_start = nullptr;
     m_end = nullptr;
     m_current = nullptr;
+    m_allocationCount = 0;
 
     m_usedBlocks = nullptr;
 }
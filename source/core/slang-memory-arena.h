@@ -132,6 +132,8 @@ public:
     size_t calcTotalMemoryUsed() const;
         /// Total memory allocated in bytes
     size_t calcTotalMemoryAllocated() const;
+        /// Number of allocations made since the arena was constructed, or since all of its memory was last deallocated
+    size_t getAllocationCount() const { return m_allocationCount; }
 
         /// Default Ctor
     MemoryArena();
@@ -180,6 +182,7 @@ protected:
     uint8_t* m_start;               ///< The start of the current block (pointed to by m_usedBlocks)
     uint8_t* m_end;                 ///< The end of the current block
     uint8_t* m_current;             ///< The current position in current block
+    size_t m_allocationCount;       ///< The number of allocations made from the current set of blocks
 
     size_t m_blockPayloadSize;      ///< The size of the payload of a block
     size_t m_blockAllocSize;        ///< The size of a block allocation (must be the same size or bigger than m_blockPayloadSize)
@@ -209,6 +212,7 @@ SLANG_FORCE_INLINE bool MemoryArena::isValid(const void* data, size_t size) cons
 SLANG_FORCE_INLINE void* MemoryArena::allocateUnaligned(size_t sizeInBytes)
 {
     assert(sizeInBytes > 0);
+    m_allocationCount++;
     // Align with the minimum alignment
     uint8_t* mem = m_current;
     uint8_t* end = mem + sizeInBytes;
@@ -227,6 +231,7 @@ SLANG_FORCE_INLINE void* MemoryArena::allocateUnaligned(size_t sizeInBytes)
 SLANG_FORCE_INLINE void* MemoryArena::allocate(size_t sizeInBytes)
 {
     assert(sizeInBytes > 0);
+    m_allocationCount++;
     // Align with the minimum alignment
     const size_t alignMask = kMinAlignment - 1;
     uint8_t* mem = (uint8_t*)((size_t(m_current) + alignMask) & ~alignMask);
@@ -247,6 +252,7 @@ SLANG_FORCE_INLINE void* MemoryArena::allocateAndZero(size_t sizeInBytes)
 {
     // Implement without calling ::allocate, because in most common case we don't need to test for null.
     assert(sizeInBytes > 0);
+    m_allocationCount++;
     // Align with the minimum alignment
     const size_t alignMask = kMinAlignment - 1;
     uint8_t* mem = (uint8_t*)((size_t(m_current) + alignMask) & ~alignMask);
@@ -269,6 +275,7 @@ SLANG_FORCE_INLINE void* MemoryArena::allocateAligned(size_t sizeInBytes, size_t
     assert(sizeInBytes > 0);
     // Alignment must be a power of 2
     assert(((alignment - 1) & alignment) == 0);
+    m_allocationCount++;
 
     // Align the pointer
     const size_t alignMask = alignment - 1;
@@ -72,13 +72,13 @@ namespace Slang
     {}
 
     StringSlice::StringSlice(String const& str)
-        : representation(str.buffer)
+        : representation(str.getOrCreateStringRepresentation())
         , beginIndex(0)
         , endIndex(str.Length())
     {}
 
     StringSlice::StringSlice(String const& str, UInt beginIndex, UInt endIndex)
-        : representation(str.buffer)
+        : representation(str.getOrCreateStringRepresentation())
         , beginIndex(beginIndex)
         , endIndex(endIndex)
     {}
@@ -185,7 +185,7 @@ namespace Slang
 
 	OSString String::ToWString(UInt* outLength) const
 	{
-		if (!buffer)
+		if (getLength() == 0)
 		{
             return OSString();
 		}
@@ -224,49 +224,74 @@ namespace Slang
 
     //
 
+    StringRepresentation* String::getOrCreateStringRepresentation() const
+    {
+        if (!isInline())
+            return m_rep;
+
+        const UInt length = getLength();
+        if (length == 0)
+            return nullptr;
+
+        StringRepresentation* rep = StringRepresentation::createWithLength(length);
+        memcpy(rep->getData(), m_inline, length);
+        return rep;
+    }
+
     void String::ensureUniqueStorageWithCapacity(UInt requiredCapacity)
     {
-        if (buffer && buffer->isUniquelyReferenced() && buffer->capacity >= requiredCapacity)
-            return;
+        UInt capacity;
+        if (isInline())
+        {
+            if (requiredCapacity <= kInlineCapacity)
+                return;
+            capacity = kInlineCapacity;
+        }
+        else
+        {
+            if (m_rep->isUniquelyReferenced() && m_rep->capacity >= requiredCapacity)
+                return;
+            capacity = m_rep->capacity;
+        }
 
-        UInt newCapacity = buffer ? 2*buffer->capacity : 16;
+        UInt newCapacity = 2 * capacity;
         if (newCapacity < requiredCapacity)
         {
             newCapacity = requiredCapacity;
         }
 
-        UInt length = getLength();
+        const UInt length = getLength();
         StringRepresentation* newRepresentation = StringRepresentation::createWithCapacityAndLength(newCapacity, length);
+        memcpy(newRepresentation->getData(), getData(), length);
 
-        if (buffer)
-        {
-            memcpy(newRepresentation->getData(), buffer->getData(), length + 1);
-        }
-
-        buffer = newRepresentation;
-    }
-
-    char* String::prepareForAppend(UInt count)
-    {
-        auto oldLength = getLength();
-        auto newLength = oldLength + count;
-        ensureUniqueStorageWithCapacity(newLength);
-        return getData() + oldLength;
+        releaseStorage();
+        newRepresentation->addReference();
+        m_rep = newRepresentation;
+        m_inline[kInlineCapacity] = char(kHeapTag);
     }
 
-
     void String::append(const char* textBegin, char const* textEnd)
     {
-        auto oldLength = getLength();
-        auto textLength = textEnd - textBegin;
-
-        auto newLength = oldLength + textLength;
-
-        ensureUniqueStorageWithCapacity(newLength);
+        const UInt oldLength = getLength();
+        const UInt textLength = textEnd - textBegin;
+        const UInt newLength = oldLength + textLength;
+
+        // The text may be part of this string (e.g. `s.append(s)`), in which case
+        // it has to be located again if the storage moves.
+        const char* oldData = getData();
+        if (textBegin >= oldData && textBegin <= oldData + oldLength)
+        {
+            const UInt offset = textBegin - oldData;
+            ensureUniqueStorageWithCapacity(newLength);
+            textBegin = getData() + offset;
+        }
+        else
+        {
+            ensureUniqueStorageWithCapacity(newLength);
+        }
 
         memcpy(getData() + oldLength, textBegin, textLength);
-        getData()[newLength] = 0;
-        buffer->length = newLength;
+        setLength(newLength);
     }
 
     void String::append(char const* str)
@@ -284,9 +309,9 @@ namespace Slang
 
     void String::append(String const& str)
     {
-        if (!buffer)
+        if (getLength() == 0 && isInline())
         {
-            buffer = str.buffer;
+            *this = str;
             return;
         }
 
@@ -303,55 +328,54 @@ namespace Slang
         append(slice.begin(), slice.end());
     }
 
+    // Numbers are formatted into a local buffer first, so that a short result
+    // doesn't force the string out of its inline storage.
+
     void String::append(int32_t value, int radix)
     {
-        enum { kCount = 33 };
-        char* data = prepareForAppend(kCount);
+        char data[33];
         auto count = IntToAscii(data, value, radix);
         ReverseInternalAscii(data, count);
-        buffer->length += count;
+        append(data, data + count);
     }
 
     void String::append(uint32_t value, int radix)
     {
-        enum { kCount = 33 };
-        char* data = prepareForAppend(kCount);
+        char data[33];
         auto count = IntToAscii(data, value, radix);
         ReverseInternalAscii(data, count);
-        buffer->length += count;
+        append(data, data + count);
     }
 
     void String::append(int64_t value, int radix)
     {
-        enum { kCount = 65 };
-        char* data = prepareForAppend(kCount);
+        char data[65];
         auto count = IntToAscii(data, value, radix);
         ReverseInternalAscii(data, count);
-        buffer->length += count;
+        append(data, data + count);
     }
 
     void String::append(uint64_t value, int radix)
     {
-        enum { kCount = 65 };
-        char* data = prepareForAppend(kCount);
+        char data[65];
         auto count = IntToAscii(data, value, radix);
         ReverseInternalAscii(data, count);
-        buffer->length += count;
+        append(data, data + count);
     }
 
     void String::append(float val, const char * format)
     {
         enum { kCount = 128 };
-        char* data = prepareForAppend(kCount);
+        char data[kCount];
         sprintf_s(data, kCount, format, val);
-        buffer->length += strnlen_s(data, kCount);
+        append(data, data + strnlen_s(data, kCount));
     }
 
     void String::append(double val, const char * format)
     {
         enum { kCount = 128 };
-        char* data = prepareForAppend(kCount);
+        char data[kCount];
         sprintf_s(data, kCount, format, val);
-        buffer->length += strnlen_s(data, kCount);
+        append(data, data + strnlen_s(data, kCount));
     }
 }
@@ -133,6 +133,12 @@ namespace Slang
             return !(*this == other);
         }
 
+            /// Matches `String::GetHashCode`, so that a slice can be used to look up `String` keys
+        int GetHashCode() const
+        {
+            return Slang::GetHashCode(begin(), size());
+        }
+
 
         bool endsWith(UnownedStringSlice const& other) const;
         bool endsWith(char const* str) const;
@@ -206,7 +212,7 @@ namespace Slang
         StringRepresentation* cloneWithCapacity(UInt newCapacity)
         {
             StringRepresentation* newObj = createWithCapacityAndLength(newCapacity, length);
-            memcpy(getData(), newObj->getData(), length + 1);
+            memcpy(newObj->getData(), getData(), length + 1);
             return newObj;
         }
 
@@ -273,12 +279,6 @@ namespace Slang
         UInt endIndex;
 
         friend class String;
-
-        StringSlice(RefPtr<StringRepresentation> const& representation, UInt beginIndex, UInt endIndex)
-            : representation(representation)
-            , beginIndex(beginIndex)
-            , endIndex(endIndex)
-        {}
     };
 
     /// String as expected by underlying platform APIs
@@ -304,6 +304,16 @@ namespace Slang
 
 	/*!
 	@brief Represents a UTF-8 encoded string.
+
+    Strings of up to `kInlineCapacity` characters are stored inline, and longer strings
+    in a reference-counted `StringRepresentation` that is shared between copies and
+    cloned before it is modified (copy-on-write).
+
+    The last byte of the inline storage is a tag: for an inline string it holds
+    `kInlineCapacity - length` (so that a full inline string has its terminating zero
+    there), and `kHeapTag` when the storage holds a `StringRepresentation` instead.
+    The contents never point into the `String` itself, so a `String` can be relocated
+    with `memcpy`.
 	*/
 
 	class String
@@ -311,28 +321,82 @@ namespace Slang
         friend struct StringSlice;
 		friend class StringBuilder;
 	private:
+        enum : UInt { kInlineCapacity = 23 };
+        enum : unsigned char { kHeapTag = 0xFF };
 
+        SLANG_FORCE_INLINE bool isInline() const
+        {
+            return (unsigned char)m_inline[kInlineCapacity] != kHeapTag;
+        }
 
         char* getData() const
         {
-            return buffer ? buffer->getData() : (char*)"";
+            return isInline() ? const_cast<char*>(m_inline) : m_rep->getData();
         }
 
         UInt getLength() const
         {
-            return buffer ? buffer->getLength() : 0;
+            return isInline() ? kInlineCapacity - (unsigned char)m_inline[kInlineCapacity] : m_rep->getLength();
+        }
+
+        /// Set the length, and write the terminating zero. Capacity must already be available.
+        void setLength(UInt length)
+        {
+            if (isInline())
+            {
+                SLANG_ASSERT(length <= kInlineCapacity);
+                m_inline[length] = 0;
+                m_inline[kInlineCapacity] = char(kInlineCapacity - length);
+            }
+            else
+            {
+                SLANG_ASSERT(length <= m_rep->capacity);
+                m_rep->length = length;
+                m_rep->getData()[length] = 0;
+            }
+        }
+
+        void initEmpty()
+        {
+            m_inline[0] = 0;
+            m_inline[kInlineCapacity] = char(kInlineCapacity);
+        }
+
+        /// Take the storage of `other`, which must not be shared with this string
+        void copyStorageFrom(String const& other)
+        {
+            memcpy(m_inline, other.m_inline, sizeof(m_inline));
+        }
+
+        void releaseStorage()
+        {
+            if (!isInline())
+                m_rep->releaseReference();
         }
 
         void ensureUniqueStorageWithCapacity(UInt capacity);
-        char* prepareForAppend(UInt count);
 
-        RefPtr<StringRepresentation> buffer;
+        union
+        {
+            StringRepresentation* m_rep;
+            char m_inline[kInlineCapacity + 1];
+        };
 
     public:
 
-        explicit String(StringRepresentation* buffer)
-            : buffer(buffer)
-        {}
+        explicit String(StringRepresentation* rep)
+        {
+            if (rep)
+            {
+                rep->addReference();
+                m_rep = rep;
+                m_inline[kInlineCapacity] = char(kHeapTag);
+            }
+            else
+            {
+                initEmpty();
+            }
+        }
 
 		static String FromWString(const wchar_t * wstr);
 		static String FromWString(const wchar_t * wstr, const wchar_t * wend);
@@ -340,9 +404,13 @@ namespace Slang
 		static String FromUnicodePoint(unsigned int codePoint);
 		String()
 		{
+            initEmpty();
 		}
 
-        SLANG_FORCE_INLINE StringRepresentation* getStringRepresentation() const { return buffer; }
+        /// Get a representation that holds the contents of this string, or null for an empty inline string.
+        /// A string stored inline has no representation, so a new one is created with no references
+        /// to it; the caller is expected to take one.
+        StringRepresentation* getOrCreateStringRepresentation() const;
 
 		const char * begin() const
 		{
@@ -369,98 +437,94 @@ namespace Slang
 
 		String(int32_t val, int radix = 10)
 		{
+            initEmpty();
             append(val, radix);
 		}
 		String(uint32_t val, int radix = 10)
 		{
+            initEmpty();
             append(val, radix);
 		}
 		String(int64_t val, int radix = 10)
 		{
+            initEmpty();
             append(val, radix);
 		}
 		String(uint64_t val, int radix = 10)
 		{
+            initEmpty();
             append(val, radix);
 		}
 		String(float val, const char * format = "%g")
 		{
+            initEmpty();
             append(val, format);
 		}
 		String(double val, const char * format = "%g")
 		{
+            initEmpty();
             append(val, format);
 		}
 		String(const char * str)
 		{
+            initEmpty();
             append(str);
-#if 0
-			if (str)
-			{
-                buffer = StringRepresentation::createWithLength(strlen(str));
-				memcpy(buffer.Ptr(), str, getLength() + 1);
-			}
-#endif
 		}
         String(const char* textBegin, char const* textEnd)
 		{
+            initEmpty();
             append(textBegin, textEnd);
-#if 0
-			if (textBegin != textEnd)
-			{
-                buffer = StringRepresentation::createWithLength(textEnd - textBegin);
-				memcpy(buffer.Ptr(), textBegin, getLength());
-                buffer->getData()[getLength()] = 0;
-			}
-#endif
 		}
 		String(char chr)
 		{
+            initEmpty();
             append(chr);
-#if 0
-			if (chr)
-			{
-                buffer = StringRepresentation::createWithLength(1);
-                buffer->getData()[0] = chr;
-                buffer->getData()[1] = 0;
-			}
-#endif
 		}
 		String(String const& str)
 		{
-            buffer = str.buffer;
-#if 0
-			this->operator=(str);
-#endif
+            copyStorageFrom(str);
+            if (!isInline())
+                m_rep->addReference();
 		}
 		String(String&& other)
 		{
-            buffer = _Move(other.buffer);
+            copyStorageFrom(other);
+            other.initEmpty();
 		}
 
         String(StringSlice const& slice)
         {
+            initEmpty();
             append(slice);
         }
 
         String(UnownedStringSlice const& slice)
         {
+            initEmpty();
             append(slice);
         }
 
 		~String()
 		{
-            buffer = 0;
+            releaseStorage();
 		}
 
 		String & operator=(const String & str)
 		{
-            buffer = str.buffer;
+            if (!str.isInline())
+                str.m_rep->addReference();
+            releaseStorage();
+            copyStorageFrom(str);
 			return *this;
 		}
 		String & operator=(String&& other)
 		{
-            buffer = _Move(other.buffer);
+            if (this != &other)
+            {
+                releaseStorage();
+                copyStorageFrom(other);
+                other.initEmpty();
+            }
             return *this;
 		}
 		char operator[](UInt id) const
@@ -478,18 +542,18 @@ namespace Slang
 
 		StringSlice TrimStart() const
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return StringSlice();
 			UInt startIndex = 0;
 			while (startIndex < getLength() &&
 				(getData()[startIndex] == ' ' || getData()[startIndex] == '\t' || getData()[startIndex] == '\r' || getData()[startIndex] == '\n'))
 				startIndex++;
-            return StringSlice(buffer, startIndex, getLength());
+            return StringSlice(*this, startIndex, getLength());
 		}
 
 		StringSlice TrimEnd() const
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return StringSlice();
 
 			UInt endIndex = getLength();
@@ -497,12 +561,12 @@ namespace Slang
 				(getData()[endIndex-1] == ' ' || getData()[endIndex-1] == '\t' || getData()[endIndex-1] == '\r' || getData()[endIndex-1] == '\n'))
 				endIndex--;
 
-            return StringSlice(buffer, 0, endIndex);
+            return StringSlice(*this, 0, endIndex);
 		}
 
 		StringSlice Trim() const
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return StringSlice();
 
 			UInt startIndex = 0;
@@ -514,7 +578,7 @@ namespace Slang
 				(getData()[endIndex-1] == ' ' || getData()[endIndex-1] == '\t'))
 				endIndex--;
 
-            return StringSlice(buffer, startIndex, endIndex);
+            return StringSlice(*this, startIndex, endIndex);
 		}
 
 		StringSlice SubString(UInt id, UInt len) const
@@ -530,7 +594,7 @@ namespace Slang
 			if (len < 0)
 				throw "SubString: length less than zero.";
 #endif
-            return StringSlice(buffer, id, id + len);
+            return StringSlice(*this, id, id + len);
 		}
 
 		char const* Buffer() const
@@ -562,6 +626,10 @@ namespace Slang
 		{
 			return (strcmp(begin(), str.begin()) == 0);
 		}
+		bool operator==(const UnownedStringSlice & slice) const
+		{
+			return getUnownedSlice() == slice;
+		}
 		bool operator!=(const char * strbuffer) const
 		{
 			return (strcmp(begin(), strbuffer) != 0);
@@ -644,8 +712,6 @@ namespace Slang
 			if (id < 0 || id >= getLength())
 				throw "SubString: index out of range.";
 #endif
-			if (!buffer)
-				return UInt(-1);
 			for (UInt i = id; i < getLength(); i++)
 				if (getData()[i] == ch)
 					return i;
@@ -667,7 +733,7 @@ namespace Slang
 
 		bool StartsWith(const char * str) const // String str
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return false;
 			UInt strLen = strlen(str);
 			if (strLen > getLength())
@@ -685,7 +751,7 @@ namespace Slang
 
 		bool EndsWith(char const * str)  const // String str
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return false;
 			UInt strLen = strlen(str);
 			if (strLen > getLength())
@@ -703,7 +769,7 @@ namespace Slang
 
 		bool Contains(const char * str) const // String str
 		{
-			if (!buffer)
+			if (getLength() == 0)
 				return false;
 			return (IndexOf(str) != UInt(-1)) ? true : false;
 		}
@@ -720,16 +786,15 @@ namespace Slang
 
         UnownedStringSlice getUnownedSlice() const
         {
-            return StringRepresentation::asSlice(buffer);
+            return UnownedStringSlice(getData(), getLength());
         }
 	};
 
 	class StringBuilder : public String
 	{
-	private:
-        enum { InitialSize = 1024 };
 	public:
-		explicit StringBuilder(UInt bufferSize = InitialSize)
+            /// Short results fit in the inline storage, so nothing is reserved by default
+		explicit StringBuilder(UInt bufferSize = 0)
 		{
             ensureUniqueStorageWithCapacity(bufferSize);
 		}
@@ -873,11 +938,20 @@ namespace Slang
             return *this;
 		}
 
-		String ProduceString()
+            /// Produce a string that shares storage with the builder. Appending to the builder
+            /// afterwards will copy the storage.
+		String ProduceString() &
 		{
             return *this;
 		}
 
+            /// Hand the builder's storage off to the result without any copy or reference
+            /// count traffic, leaving the builder empty (use as `_Move(sb).ProduceString()`).
+		String ProduceString() &&
+		{
+            return String(static_cast<String&&>(*this));
+		}
+
 #if 0
 		String GetSubString(int start, int count)
 		{
@@ -906,9 +980,18 @@ namespace Slang
 		}
 #endif
 
+            /// Clear the contents. Storage that isn't shared is kept, so a builder can be reused.
 		void Clear()
 		{
-            buffer = 0;
+            if (!isInline() && m_rep->isUniquelyReferenced())
+            {
+                setLength(0);
+            }
+            else
+            {
+                releaseStorage();
+                initEmpty();
+            }
 		}
 	};
 
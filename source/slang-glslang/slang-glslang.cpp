@@ -52,6 +52,39 @@ static TBuiltInResource gResources =
     { true, true, true, true, true, true, true, true, true, }
 };
 
+// glslang keeps process-wide state between `InitializeProcess()` and
+// `FinalizeProcess()`, most importantly the symbol tables for the built-in
+// declarations of each stage and profile, which are expensive to build.
+// Initializing and finalizing around every compile threw that state away each
+// time, so instead we initialize once, on first use, and keep it until the
+// library is unloaded.
+struct GlslangProcessState
+{
+    GlslangProcessState()
+    {
+        glslang::InitializeProcess();
+
+        // The SPIR-V opcode tables used by the disassembler are also filled
+        // in lazily, without any locking, so do that here too.
+        spv::Parameterize();
+    }
+
+    ~GlslangProcessState()
+    {
+        glslang::FinalizeProcess();
+    }
+};
+
+static void ensureGlslangProcessInitialized()
+{
+    // Function-local statics are initialized exactly once, even if several
+    // threads get here at the same time. After that, glslang sets up the
+    // per-thread state it needs itself (in `TShader::parse()` and
+    // `TProgram::link()`), and each compile uses its own `TShader` and
+    // `TProgram`, so compiles on different threads can run concurrently.
+    static GlslangProcessState state;
+}
+
 static void dump(
     void const*         data,
     size_t              size,
@@ -190,7 +223,7 @@ __attribute__((__visibility__("default")))
 #endif
 int glslang_compile(glslang_CompileRequest* request)
 {
-    glslang::InitializeProcess();
+    ensureGlslangProcessInitialized();
 
     int result = 0;
     switch(request->action)
@@ -208,7 +241,5 @@ int glslang_compile(glslang_CompileRequest* request)
         break;
     }
 
-    glslang::FinalizeProcess();
-
     return result;
 }
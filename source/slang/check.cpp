@@ -237,6 +237,10 @@ namespace Slang
 
         SourceLanguage getSourceLanguage()
         {
+            // Declarations from lazily-checked modules are checked
+            // outside of any translation unit (see `checkLazyDecl`)
+            if (!translationUnit)
+                return SourceLanguage::Slang;
             return translationUnit->sourceLanguage;
         }
 
@@ -741,7 +745,21 @@ namespace Slang
         // so this may not be the best way to handle things.
         void EnsureDecl(RefPtr<Decl> decl, DeclCheckState state)
         {
+            // A declaration in a lazily-checked module gets fully
+            // checked, in its own context, the first time it is reached.
+            // (Once it has been checked, this only reports its diagnostics
+            // to requests that haven't seen them yet.)
+            if (auto lazyDecl = findLazyDeclRoot(decl))
+            {
+                if (!getModuleDecl(lazyDecl)->lazyDeclsBeingChecked.Contains(lazyDecl))
+                {
+                    checkLazyDecl(sink, request, lazyDecl);
+                    return;
+                }
+            }
+
             if (decl->IsChecked(state)) return;
+
             if (decl->checkState == DeclCheckState::CheckingHeader)
             {
                 // We tried to reference the same declaration while checking it!
@@ -774,6 +792,9 @@ namespace Slang
                 }
             }
 
+            if (request)
+                request->stats.declCheckCount++;
+
             if (DeclCheckState::CheckingHeader > decl->checkState)
             {
                 decl->SetCheckState(DeclCheckState::CheckingHeader);
@@ -788,6 +809,82 @@ namespace Slang
             }
         }
 
+        // Check a declaration from a lazily-checked module, following the
+        // same header-then-body sequence that `visitModuleDecl` applies
+        // to a module as a whole.
+        //
+        // The diagnostics for the declaration are kept with its module, and
+        // reported to every request that reaches it, since the module may be
+        // shared by several requests. Errors in a standard library declaration
+        // are internal errors, just as they are when the standard library is
+        // checked up front.
+        static void checkLazyDecl(
+            DiagnosticSink*     sink,
+            CompileRequest*     request,
+            Decl*               decl)
+        {
+            ModuleDecl* moduleDecl = getModuleDecl(decl);
+            if (!decl->IsChecked(DeclCheckState::Checked))
+            {
+                bool isFromStdLib = decl->HasModifier<FromStdLibModifier>();
+
+                // Like `EnsureDecl`, this doesn't assume that there is a request
+                // to check for (in which case stdlib locations can't be looked up)
+                DiagnosticSink lazySink;
+                lazySink.sourceManager = isFromStdLib && request
+                    ? request->mSession->getBuiltinSourceManager()
+                    : sink->sourceManager;
+
+                SemanticsVisitor visitor(&lazySink, request, nullptr);
+                moduleDecl->lazyDeclsBeingChecked.Add(decl);
+                try
+                {
+                    for (int pass = 0; pass < 2; pass++)
+                    {
+                        visitor.checkingPhase = pass == 0 ? CheckingPhase::Header : CheckingPhase::Body;
+
+                        visitor.checkDecl(decl);
+                        visitor.EnusreAllDeclsRec(decl);
+                        visitor.checkModifiers(decl);
+                    }
+                }
+                catch (AbortCompilationException&)
+                {
+                    moduleDecl->lazyDeclsBeingChecked.Remove(decl);
+                    sink->diagnoseRaw(Severity::Error, lazySink.outputBuffer.Buffer());
+                    throw;
+                }
+                moduleDecl->lazyDeclsBeingChecked.Remove(decl);
+
+                if (isFromStdLib && lazySink.GetErrorCount() != 0)
+                {
+                    fprintf(stderr, "%s", lazySink.outputBuffer.Buffer());
+                    SLANG_UNEXPECTED("error in Slang standard library");
+                }
+                if (!isFromStdLib && lazySink.getDiagnosticCount() != 0)
+                {
+                    LazyDeclDiagnostics diagnostics;
+                    diagnostics.output = lazySink.outputBuffer.ProduceString();
+                    diagnostics.hasErrors = lazySink.GetErrorCount() != 0;
+                    moduleDecl->lazyDeclDiagnostics.Add(decl, diagnostics);
+                }
+
+                // Any IR already generated for the module doesn't include
+                // the declaration (see `generateIRForLoadedModules`)
+                moduleDecl->isIROutOfDate = true;
+            }
+
+            if (moduleDecl->lazyDeclDiagnostics.Count() == 0 || !request)
+                return;
+            auto diagnostics = moduleDecl->lazyDeclDiagnostics.TryGetValue(decl);
+            if (!diagnostics || request->lazyDeclsWithReportedDiagnostics.Contains(decl))
+                return;
+            request->lazyDeclsWithReportedDiagnostics.Add(decl);
+            sink->diagnoseRaw(
+                diagnostics->hasErrors ? Severity::Error : Severity::Warning,
+                diagnostics->output.Buffer());
+        }
+
         void EnusreAllDeclsRec(RefPtr<Decl> decl)
         {
             checkDecl(decl);
@@ -2140,6 +2237,44 @@ namespace Slang
             syntaxNode->modifiers.first = resultModifiers;
         }
 
+        // Is `decl` (a direct member of `moduleDecl`) one that
+        // should only be checked on demand?
+        static bool isLazyDecl(ModuleDecl* moduleDecl, Decl* decl)
+        {
+            if (!moduleDecl->isCheckedLazily)
+                return false;
+
+            if (auto genericDecl = decl->As<GenericDecl>())
+                decl = genericDecl->inner;
+            return decl->As<FuncDecl>() != nullptr;
+        }
+
+        // If `decl` belongs to a declaration that should only be checked
+        // on demand, return that (outer-most) declaration.
+        static Decl* findLazyDeclRoot(Decl* decl)
+        {
+            Decl* root = decl;
+            if (!root->ParentDecl)
+                return nullptr;
+            if (auto genericParent = root->ParentDecl->As<GenericDecl>())
+                root = genericParent;
+
+            if (!root->ParentDecl)
+                return nullptr;
+            auto moduleDecl = root->ParentDecl->As<ModuleDecl>();
+            if (!moduleDecl)
+                return nullptr;
+            if (!isLazyDecl(moduleDecl, root))
+                return nullptr;
+            return root;
+        }
+
+        // The module that a declaration returned by `findLazyDeclRoot` belongs to
+        static ModuleDecl* getModuleDecl(Decl* lazyDeclRoot)
+        {
+            return static_cast<ModuleDecl*>(lazyDeclRoot->ParentDecl);
+        }
+
         void visitModuleDecl(ModuleDecl* programNode)
         {
             // Try to register all the builtin decls
@@ -2194,6 +2329,8 @@ namespace Slang
                 // because otherwise they won't get visited.
                 for (auto & g : programNode->getMembersOfType<GenericDecl>())
                 {
+                    if (isLazyDecl(programNode, g))
+                        continue;
                     checkDecl(g.Ptr());
                 }
 
@@ -2202,16 +2339,21 @@ namespace Slang
                 for (auto & s : programNode->getMembersOfType<ExtensionDecl>())
                     checkDecl(s);
 
-                for (auto & func : programNode->getMembersOfType<FuncDecl>())
+                // Global functions in a lazily-checked module are
+                // left until something references them.
+                if (!programNode->isCheckedLazily)
                 {
-                    if (!func->IsChecked(getCheckedState()))
+                    for (auto & func : programNode->getMembersOfType<FuncDecl>())
                     {
-                        VisitFunctionDeclaration(func.Ptr());
+                        if (!func->IsChecked(getCheckedState()))
+                        {
+                            VisitFunctionDeclaration(func.Ptr());
+                        }
+                    }
+                    for (auto & func : programNode->getMembersOfType<FuncDecl>())
+                    {
+                        checkDecl(func);
                     }
-                }
-                for (auto & func : programNode->getMembersOfType<FuncDecl>())
-                {
-                    checkDecl(func);
                 }
 
                 if (sink->GetErrorCount() != 0)
@@ -2222,12 +2364,16 @@ namespace Slang
                 // because we'd end up recursing into this very code path...
                 for (auto d : programNode->Members)
                 {
+                    if (isLazyDecl(programNode, d))
+                        continue;
                     EnusreAllDeclsRec(d);
                 }
 
                 // Do any semantic checking required on modifiers?
                 for (auto d : programNode->Members)
                 {
+                    if (isLazyDecl(programNode, d))
+                        continue;
                     checkModifiers(d.Ptr());
                 }
 
@@ -4708,6 +4854,11 @@ namespace Slang
                     auto aggTypeDecl = aggTypeDeclRef.getDecl();
                     decl->nextCandidateExtension = aggTypeDecl->candidateExtensions;
                     aggTypeDecl->candidateExtensions = decl;
+                    registerExternalExtension(decl, aggTypeDecl);
+
+                    // Any cached member lookups that went through the
+                    // type may now be missing members from this extension.
+                    getSession()->memberLookupCache.invalidateDependentsOf(aggTypeDecl);
                     return;
                 }
             }
@@ -7259,6 +7410,8 @@ namespace Slang
                     OverloadCandidate candidate;
                     if (typeCheckingCache->resolvedOperatorOverloadCache.TryGetValue(key, candidate))
                     {
+                        if (request)
+                            request->stats.overloadCacheHitCount++;
                         context.bestCandidateStorage = candidate;
                         context.bestCandidate = &context.bestCandidateStorage;
                     }
@@ -7409,7 +7562,9 @@ namespace Slang
                 // applicable in the end.
                 // We will report errors for this one candidate, then, to give
                 // the user the most help we can.
-                if (shouldAddToCache)
+                // The cache is shared by every request in the session, so it can
+                // only hold declarations that live as long as the session does.
+                if (shouldAddToCache && isFromStdLib(context.bestCandidate->item.declRef.getDecl()))
                     typeCheckingCache->resolvedOperatorOverloadCache[key] = *context.bestCandidate;
                 return CompleteOverloadCandidate(context, *context.bestCandidate);
             }
@@ -8150,6 +8305,20 @@ namespace Slang
             // it later during code generation.
             decl->importedModuleDecl = importedModuleDecl;
 
+            // From now on, the syntax of the importing module can refer to
+            // that of the imported one, so if each was allocated from an
+            // arena, the importing one has to keep the other alive.
+            auto importedArena = importedModuleDecl->astArena;
+            if (importedArena)
+            {
+                auto parentDecl = decl->ParentDecl;
+                while (parentDecl && !parentDecl->As<ModuleDecl>())
+                    parentDecl = parentDecl->ParentDecl;
+                auto moduleDecl = parentDecl ? parentDecl->As<ModuleDecl>() : nullptr;
+                if (moduleDecl && moduleDecl->astArena && moduleDecl->astArena != importedArena)
+                    moduleDecl->astArena->importedArenas.Add(importedArena);
+            }
+
             importModuleIntoScope(scope.Ptr(), importedModuleDecl.Ptr());
 
             decl->SetCheckState(getCheckedState());
@@ -8951,4 +9120,42 @@ namespace Slang
     {
         visitor->checkDecl(decl);
     }
+
+    CompileRequest* getCompileRequest(SemanticsVisitor* visitor)
+    {
+        return visitor->request;
+    }
+
+    void ensureDeclIsChecked(CompileRequest* request, Decl* decl)
+    {
+        if (decl->IsChecked(DeclCheckState::Checked))
+            return;
+
+        // Only declarations that are checked on demand can legitimately
+        // still be unchecked by the time something (e.g., IR lowering)
+        // needs them.
+        if (auto lazyDecl = SemanticsVisitor::findLazyDeclRoot(decl))
+        {
+            SemanticsVisitor::checkLazyDecl(&request->mSink, request, lazyDecl);
+        }
+    }
+
+    bool isUncheckedLazyDecl(Decl* decl)
+    {
+        return SemanticsVisitor::findLazyDeclRoot(decl) == decl
+            && !decl->IsChecked(DeclCheckState::Checked);
+    }
+
+    void checkAllLazyDecls(CompileRequest* request, ModuleDecl* moduleDecl)
+    {
+        if (!moduleDecl->isCheckedLazily)
+            return;
+
+        for (auto decl : moduleDecl->Members)
+        {
+            if (SemanticsVisitor::isLazyDecl(moduleDecl, decl))
+                SemanticsVisitor::checkLazyDecl(&request->mSink, request, decl);
+        }
+        moduleDecl->isCheckedLazily = false;
+    }
 }
@@ -5,6 +5,7 @@
 #include "../core/slang-io.h"
 #include "bytecode.h"
 #include "compiler.h"
+#include "downstream-compiler.h"
 #include "lexer.h"
 #include "lower-to-ir.h"
 #include "parameter-binding.h"
@@ -15,40 +16,8 @@
 #include "reflection.h"
 #include "emit.h"
 
-// Enable calling through to `fxc` or `dxc` to
-// generate code on Windows.
-#ifdef _WIN32
-    #define WIN32_LEAN_AND_MEAN
-    #define NOMINMAX
-    #include <Windows.h>
-    #undef WIN32_LEAN_AND_MEAN
-    #undef NOMINMAX
-    #include <d3dcompiler.h>
-    #ifndef SLANG_ENABLE_DXBC_SUPPORT
-        #define SLANG_ENABLE_DXBC_SUPPORT 1
-    #endif
-    #ifndef SLANG_ENABLE_DXIL_SUPPORT
-        #define SLANG_ENABLE_DXIL_SUPPORT 1
-    #endif
-#endif
-//
-// Otherwise, don't enable DXBC/DXIL by default:
-#ifndef SLANG_ENABLE_DXBC_SUPPORT
-    #define SLANG_ENABLE_DXBC_SUPPORT 0
-#endif
-#ifndef SLANG_ENABLE_DXIL_SUPPORT
-    #define SLANG_ENABLE_DXIL_SUPPORT 0
-#endif
-
-// Enable calling through to `glslang` on
-// all platforms.
-#ifndef SLANG_ENABLE_GLSLANG_SUPPORT
-    #define SLANG_ENABLE_GLSLANG_SUPPORT 1
-#endif
-
-#if SLANG_ENABLE_GLSLANG_SUPPORT
-#include "../slang-glslang/slang-glslang.h"
-#endif
+#include <atomic>
+#include <thread>
 
 // Includes to allow us to control console
 // output when writing assembly dumps.
@@ -262,45 +231,67 @@ namespace Slang
         }
     }
 
-#if SLANG_ENABLE_DXBC_SUPPORT
-    HMODULE loadD3DCompilerDLL(CompileRequest* request)
+    // Downstream compilers
+    //
+    // Binary code is produced by passing the HLSL or GLSL we generate to
+    // a downstream compiler (`fxc`, `dxc` or `glslang`). Our own front end
+    // and code generation aren't thread-safe, so code is first generated
+    // for all of the entry points and targets in a request, along with a
+    // `DownstreamJob` for each one that needs more work done on it. The jobs
+    // are then run on several threads at once (see `runDownstreamJobs`),
+    // each of which checks an instance of the compiler it needs out of the
+    // pool that the session keeps (unless the session already has the output
+    // of an identical job in its cache). Finally, the results and diagnostics
+    // of the jobs are reported, in order, on the thread doing the compile.
+    //
+    // When requests are compiled together (see `spCompileBatch`), the jobs
+    // of all of them are run at once (see `runDownstreamJobsForBatch`).
+
+    // Get the downstream compiler that produces code for `target`
+    static PassThroughMode getDownstreamCompilerForTarget(CodeGenTarget target)
     {
-        char const* libraryName = "d3dcompiler_47";
-        HMODULE d3dCompiler =  LoadLibraryA(libraryName);
-        if (!d3dCompiler)
+        switch (target)
         {
-            request->mSink.diagnose(SourceLoc(), Diagnostics::failedToLoadDynamicLibrary, libraryName);
+        case CodeGenTarget::DXBytecode:
+        case CodeGenTarget::DXBytecodeAssembly:
+            return PassThroughMode::fxc;
+
+        case CodeGenTarget::DXIL:
+        case CodeGenTarget::DXILAssembly:
+            return PassThroughMode::dxc;
+
+        case CodeGenTarget::SPIRV:
+        case CodeGenTarget::SPIRVAssembly:
+            return PassThroughMode::glslang;
+
+        default:
+            return PassThroughMode::None;
         }
-        return d3dCompiler;
     }
 
-    HMODULE getD3DCompilerDLL(CompileRequest* request)
+    static String getStringFromBlob(ISlangBlob* blob)
     {
-        // TODO(tfoley): let user specify version of d3dcompiler DLL to use.
-        static HMODULE d3dCompiler = loadD3DCompilerDLL(request);
-        return d3dCompiler;
+        char const* begin = (char const*) blob->getBufferPointer();
+        return String(UnownedStringSlice(begin, begin + blob->getBufferSize()));
     }
 
-    List<uint8_t> EmitDXBytecodeForEntryPoint(
+    // Set up `job` to compile `source` (HLSL or GLSL) for `entryPoint`
+    static void initDownstreamCompileJob(
+        DownstreamJob&      job,
         EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq)
+        TargetRequest*      targetReq,
+        CodeGenTarget       target,
+        String const&       source)
     {
-        static pD3DCompile D3DCompile_ = nullptr;
-        if (!D3DCompile_)
-        {
-            HMODULE d3dCompiler = getD3DCompilerDLL(entryPoint->compileRequest);
-            if (!d3dCompiler)
-                return List<uint8_t>();
-
-            D3DCompile_ = (pD3DCompile)GetProcAddress(d3dCompiler, "D3DCompile");
-            if (!D3DCompile_)
-                return List<uint8_t>();
-        }
-
-        auto hlslCode = emitHLSLForEntryPoint(entryPoint, targetReq);
-        maybeDumpIntermediate(entryPoint->compileRequest, hlslCode.Buffer(), CodeGenTarget::HLSL);
+        auto compileRequest = entryPoint->compileRequest;
 
-        auto profile = getEffectiveProfile(entryPoint, targetReq);
+        job.compilerKind = getDownstreamCompilerForTarget(target);
+        job.target = target;
+        job.shouldCompile = true;
+        job.source = source;
+        job.entryPointName = getText(entryPoint->name);
+        job.profileName = GetHLSLProfileName(getEffectiveProfile(entryPoint, targetReq));
+        job.stage = SlangStage(entryPoint->getStage());
 
         // If we have been invoked in a pass-through mode, then we need to make sure
         // that the downstream compiler sees whatever options were passed to Slang
@@ -308,298 +299,313 @@ namespace Slang
         //
         // TODO: more pieces of information should be added here as needed.
         //
-        List<D3D_SHADER_MACRO> dxMacrosStorage;
-        D3D_SHADER_MACRO const* dxMacros = nullptr;
-        if( entryPoint->compileRequest->passThrough != PassThroughMode::None )
+        if (compileRequest->passThrough != PassThroughMode::None)
         {
-            for( auto& define :  entryPoint->compileRequest->preprocessorDefinitions )
+            for (auto& define : compileRequest->preprocessorDefinitions)
             {
-                D3D_SHADER_MACRO dxMacro;
-                dxMacro.Name = define.Key.Buffer();
-                dxMacro.Definition = define.Value.Buffer();
-                dxMacrosStorage.Add(dxMacro);
+                job.defineNames.Add(define.Key);
+                job.defineValues.Add(define.Value);
             }
-            for( auto& define : entryPoint->getTranslationUnit()->preprocessorDefinitions )
+            for (auto& define : entryPoint->getTranslationUnit()->preprocessorDefinitions)
             {
-                D3D_SHADER_MACRO dxMacro;
-                dxMacro.Name = define.Key.Buffer();
-                dxMacro.Definition = define.Value.Buffer();
-                dxMacrosStorage.Add(dxMacro);
+                job.defineNames.Add(define.Key);
+                job.defineValues.Add(define.Value);
             }
-            D3D_SHADER_MACRO nullTerminator = { 0, 0 };
-            dxMacrosStorage.Add(nullTerminator);
+        }
+    }
 
-            dxMacros = dxMacrosStorage.Buffer();
+    // Keep the code and diagnostics that a downstream compiler produced for
+    // `job`, and return whether it succeeded.
+    static bool takeDownstreamOutput(
+        DownstreamJob&  job,
+        ISlangBlob*     codeBlob,
+        ISlangBlob*     diagnosticsBlob)
+    {
+        if (diagnosticsBlob)
+        {
+            job.diagnostics = getStringFromBlob(diagnosticsBlob);
+        }
+        if (SLANG_FAILED(job.result))
+        {
+            return false;
         }
 
-        ID3DBlob* codeBlob;
-        ID3DBlob* diagnosticsBlob;
-        HRESULT hr = D3DCompile_(
-            hlslCode.begin(),
-            hlslCode.Length(),
-            "slang",
-            dxMacros,
-            nullptr,
-            getText(entryPoint->name).begin(),
-            GetHLSLProfileName(profile),
-            0,
-            0,
-            &codeBlob,
-            &diagnosticsBlob);
-
-        List<uint8_t> data;
+        job.code = List<uint8_t>();
         if (codeBlob)
         {
-            data.AddRange((uint8_t const*)codeBlob->GetBufferPointer(), (int)codeBlob->GetBufferSize());
-            codeBlob->Release();
+            job.code.AddRange((uint8_t const*) codeBlob->getBufferPointer(), codeBlob->getBufferSize());
         }
+        return true;
+    }
 
-        // Note: we will only output diagnostics coming from a downstream
-        // compiler in the event of an error (although in that case we will
-        // end up including any warning diagnostics that are produced as well).
-        //
-        // TODO: some day we should aspire to make Slang's output always compile
-        // cleanly without warnings on downstream compilers (or else suppress those
-        // warnings), but this is difficult to do in practice without a lot of
-        // tailoring for the quirks of each compiler (version).
-        //
-        if (diagnosticsBlob && FAILED(hr))
+    // Get the key for the output of `job` in the session's downstream output cache.
+    // The output can only be kept on disk (where other builds of Slang, and other
+    // compilers, may find it) if both Slang and the compiler can be identified.
+    static DownstreamOutputKey getDownstreamOutputKey(
+        Session*        session,
+        DownstreamJob&  job,
+        bool&           outCanUseDirectory)
+    {
+        DownstreamOutputKey slangIdentity = getSlangIdentity();
+        DownstreamOutputKey compilerIdentity = session->getDownstreamCompilerPool(job.compilerKind)->getIdentity();
+        outCanUseDirectory = !slangIdentity.isEmpty() && !compilerIdentity.isEmpty();
+
+        DownstreamOutputKey key;
+        key.addKey(slangIdentity);
+        key.addKey(compilerIdentity);
+        key.addValue(uint64_t(job.compilerKind));
+        key.addValue(session->getDownstreamCompilerPool(job.compilerKind)->isBuiltin());
+        key.addValue(uint64_t(job.target));
+
+        key.addValue(job.shouldCompile);
+        if (job.shouldCompile)
         {
-            // TODO(tfoley): need a better policy for how we translate diagnostics
-            // back into the Slang world (although we should always try to generate
-            // HLSL that doesn't produce any diagnostics...)
-            entryPoint->compileRequest->mSink.diagnoseRaw(
-                FAILED(hr) ? Severity::Error : Severity::Warning,
-                (char const*) diagnosticsBlob->GetBufferPointer());
-            diagnosticsBlob->Release();
+            key.addText(job.source);
+            key.addText(job.entryPointName);
+            key.addText(job.profileName);
+            key.addValue(uint64_t(job.stage));
+            key.addValue(job.defineNames.Count());
+            for (UInt ii = 0; ii < job.defineNames.Count(); ++ii)
+            {
+                key.addText(job.defineNames[ii]);
+                key.addText(job.defineValues[ii]);
+            }
         }
-        if (FAILED(hr))
+        else
         {
-            return List<uint8_t>();
+            key.addValue(job.code.Count());
+            key.addBytes(job.code.Buffer(), job.code.Count());
         }
-        return data;
+
+        key.addValue(job.shouldDisassemble);
+        return key;
     }
 
-    String dissassembleDXBC(
-        CompileRequest*     compileRequest,
-        void const*         data,
-        size_t              size)
+    // Invoke the downstream compiler to do the work for `job`
+    static void invokeDownstreamCompiler(
+        Session*        session,
+        DownstreamJob&  job)
     {
-        static pD3DDisassemble D3DDisassemble_ = nullptr;
-        if (!D3DDisassemble_)
+        DownstreamCompilerScope compilerScope(session->getDownstreamCompilerPool(job.compilerKind));
+        auto compiler = compilerScope.compiler;
+        if (!compiler)
         {
-            HMODULE d3dCompiler = getD3DCompilerDLL(compileRequest);
-            if (!d3dCompiler)
-                return String();
-
-            D3DDisassemble_ = (pD3DDisassemble)GetProcAddress(d3dCompiler, "D3DDisassemble");
-            if (!D3DDisassemble_)
-                return String();
+            job.result = compilerScope.result;
+            job.isCompilerUnavailable = true;
+            return;
         }
 
-        if (!data || !size)
+        auto target = SlangCompileTarget(job.target);
+        if (job.shouldCompile)
         {
-            return String();
-        }
-
-        ID3DBlob* codeBlob;
-        HRESULT hr = D3DDisassemble_(
-            data,
-            size,
-            0,
-            nullptr,
-            &codeBlob);
+            List<char const*> defineNames;
+            List<char const*> defineValues;
+            for (UInt ii = 0; ii < job.defineNames.Count(); ++ii)
+            {
+                defineNames.Add(job.defineNames[ii].Buffer());
+                defineValues.Add(job.defineValues[ii].Buffer());
+            }
 
-        String result;
-        if (codeBlob)
-        {
-            char const* codeBegin = (char const*)codeBlob->GetBufferPointer();
-            char const* codeEnd = codeBegin + codeBlob->GetBufferSize() - 1;
-            result.append(codeBegin, codeEnd);
-            codeBlob->Release();
+            SlangDownstreamCompileDesc desc = {};
+            desc.target = target;
+            desc.stage = job.stage;
+            desc.sourcePath = "slang";
+            desc.source = job.source.Buffer();
+            desc.sourceSize = job.source.Length();
+            desc.entryPointName = job.entryPointName.Buffer();
+            desc.profileName = job.profileName.Buffer();
+            desc.defineNames = defineNames.Buffer();
+            desc.defineValues = defineValues.Buffer();
+            desc.defineCount = int(defineNames.Count());
+
+            ComPtr<ISlangBlob> codeBlob;
+            ComPtr<ISlangBlob> diagnosticsBlob;
+            job.result = compiler->compile(&desc, codeBlob.writeRef(), diagnosticsBlob.writeRef());
+            if (!takeDownstreamOutput(job, codeBlob, diagnosticsBlob))
+                return;
         }
-        if (FAILED(hr))
+
+        if (job.shouldDisassemble)
         {
-            // TODO(tfoley): need to figure out what to diagnose here...
+            ComPtr<ISlangBlob> assemblyBlob;
+            job.result = compiler->disassemble(
+                target,
+                job.code.Buffer(),
+                job.code.Count(),
+                assemblyBlob.writeRef());
+            if (SLANG_SUCCEEDED(job.result) && assemblyBlob)
+            {
+                job.assembly = getStringFromBlob(assemblyBlob);
+            }
         }
-        return result;
     }
 
-    String EmitDXBytecodeAssemblyForEntryPoint(
-        EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq)
+    // Do the work for `job`, or take its output from the session's cache if
+    // identical work has been done before. This is called from worker threads,
+    // so it can't touch the compile request (including its diagnostic sink).
+    static void runDownstreamJob(
+        Session*        session,
+        DownstreamJob&  job)
     {
+        auto& cache = session->downstreamOutputCache;
+        bool canUseDirectory = false;
+        DownstreamOutputKey key = getDownstreamOutputKey(session, job, canUseDirectory);
 
-        List<uint8_t> dxbc = EmitDXBytecodeForEntryPoint(entryPoint, targetReq);
-        if (!dxbc.Count())
+        List<uint8_t> output;
+        if (cache.tryGetOutput(key, canUseDirectory, output))
         {
-            return String();
+            job.wasOutputCached = true;
+            if (job.shouldDisassemble)
+                job.assembly = String(UnownedStringSlice((char const*) output.begin(), (char const*) output.end()));
+            else
+                job.code = _Move(output);
+            return;
         }
 
-        String result = dissassembleDXBC(entryPoint->compileRequest, dxbc.Buffer(), dxbc.Count());
-
-        return result;
-    }
-#endif
-
-#if SLANG_ENABLE_DXIL_SUPPORT
-
-// Implementations in `dxc-support.cpp`
-
-int emitDXILForEntryPointUsingDXC(
-    EntryPointRequest*  entryPoint,
-    TargetRequest*      targetReq,
-    List<uint8_t>&      outCode);
-
-String dissassembleDXILUsingDXC(
-    CompileRequest*     compileRequest,
-    void const*         data,
-    size_t              size);
-
-#endif
-
-#if SLANG_ENABLE_GLSLANG_SUPPORT
-
-    SharedLibrary loadGLSLCompilerDLL(CompileRequest* request)
-    {
-        char const* libraryName = "slang-glslang";
-        // TODO(tfoley): let user specify version of glslang DLL to use.
+        invokeDownstreamCompiler(session, job);
+        if (SLANG_FAILED(job.result))
+            return;
 
-        SharedLibrary glslCompiler = SharedLibrary::load(libraryName);
-        if (!glslCompiler)
+        if (job.shouldDisassemble)
         {
-            request->mSink.diagnose(SourceLoc(), Diagnostics::failedToLoadDynamicLibrary, libraryName);
+            output.AddRange((uint8_t const*) job.assembly.Buffer(), job.assembly.Length());
+            cache.addOutput(key, canUseDirectory, output);
+        }
+        else
+        {
+            cache.addOutput(key, canUseDirectory, job.code);
         }
-        return glslCompiler;
-    }
-
-    SharedLibrary getGLSLCompilerDLL(CompileRequest* request)
-    {
-        static SharedLibrary glslCompiler =  loadGLSLCompilerDLL(request);
-        return glslCompiler;
     }
 
-
-    int invokeGLSLCompiler(
-        CompileRequest*             slangCompileRequest,
-        glslang_CompileRequest&     request)
+    // Run the work for all of `jobs`, on as many threads at once as `session` allows
+    static void runDownstreamJobs(
+        Session*                        session,
+        List<DownstreamJob*> const&     jobs)
     {
+        UInt threadCount = session->downstreamCompilerThreadCount > 0
+            ? UInt(session->downstreamCompilerThreadCount)
+            : UInt(std::thread::hardware_concurrency());
+        threadCount = Math::Max(Math::Min(threadCount, jobs.Count()), UInt(1));
 
-        static glslang_CompileFunc glslang_compile = nullptr;
-        if (!glslang_compile)
-        {
-            SharedLibrary glslCompiler = getGLSLCompilerDLL(slangCompileRequest);
-            if (!glslCompiler)
-                return 1;
-
-            glslang_compile = (glslang_CompileFunc) glslCompiler.findFuncByName("glslang_compile");
-            if (!glslang_compile)
-                return 1;
-        }
-
-        String diagnosticOutput;
-        auto diagnosticOutputFunc = [](void const* data, size_t size, void* userData)
+        std::atomic<UInt> nextJobIndex(0);
+        auto runJobs = [&]()
         {
-            (*(String*)userData).append((char const*)data, (char const*)data + size);
+            for (;;)
+            {
+                UInt jobIndex = nextJobIndex++;
+                if (jobIndex >= jobs.Count())
+                    break;
+                auto& job = *jobs[jobIndex];
+                runDownstreamJob(job.targetReq->compileRequest->mSession, job);
+            }
         };
 
-        request.diagnosticFunc = diagnosticOutputFunc;
-        request.diagnosticUserData = &diagnosticOutput;
-
-        int err = glslang_compile(&request);
-
-        if (err)
+        // The calling thread runs jobs as well, rather than waiting
+        // for the others to finish
+        List<std::thread> workerThreads;
+        for (UInt ii = 1; ii < threadCount; ++ii)
         {
-            slangCompileRequest->mSink.diagnoseRaw(
-                Severity::Error,
-                diagnosticOutput.begin());
-            return err;
+            workerThreads.Add(std::thread(runJobs));
+        }
+        runJobs();
+        for (auto& thread : workerThreads)
+        {
+            thread.join();
         }
-
-        return 0;
     }
 
-    String dissassembleSPIRV(
-        CompileRequest*     slangRequest,
-        void const*         data,
-        size_t              size)
+    // Report the diagnostics from `job`, and return the result it produced
+    static CompileResult finishDownstreamJob(
+        CompileRequest* compileRequest,
+        DownstreamJob&  job)
     {
-        String output;
-        auto outputFunc = [](void const* data, size_t size, void* userData)
+        if (job.isCompilerUnavailable)
         {
-            (*(String*)userData).append((char const*)data, (char const*)data + size);
-        };
-
-        glslang_CompileRequest request;
-        request.action = GLSLANG_ACTION_DISSASSEMBLE_SPIRV;
-
-        request.inputBegin  = data;
-        request.inputEnd    = (char*)data + size;
-
-        request.outputFunc = outputFunc;
-        request.outputUserData = &output;
+            diagnoseUnavailableDownstreamCompiler(
+                &compileRequest->mSink,
+                compileRequest->mSession->getDownstreamCompilerPool(job.compilerKind),
+                job.result);
+            return CompileResult();
+        }
 
-        int err = invokeGLSLCompiler(slangRequest, request);
+        // Note: we will only output diagnostics coming from a downstream
+        // compiler in the event of an error (although in that case we will
+        // end up including any warning diagnostics that are produced as well).
+        //
+        // TODO: some day we should aspire to make Slang's output always compile
+        // cleanly without warnings on downstream compilers (or else suppress those
+        // warnings), but this is difficult to do in practice without a lot of
+        // tailoring for the quirks of each compiler (version).
+        //
+        if (SLANG_FAILED(job.result))
+        {
+            // TODO(tfoley): need a better policy for how we translate diagnostics
+            // back into the Slang world (although we should always try to generate
+            // HLSL that doesn't produce any diagnostics...)
+            compileRequest->mSink.diagnoseRaw(
+                Severity::Error,
+                job.diagnostics.Buffer());
+            return CompileResult();
+        }
 
-        if (err)
+        if (job.wasOutputCached)
         {
-            String();
+            compileRequest->stats.downstreamCacheHitCount++;
         }
 
-        return output;
+        auto target = job.targetReq->target;
+        if (job.shouldDisassemble)
+        {
+            maybeDumpIntermediate(compileRequest, job.assembly.Buffer(), target);
+            return CompileResult(job.assembly);
+        }
+        else
+        {
+            maybeDumpIntermediate(compileRequest, job.code.Buffer(), job.code.Count(), target);
+            return CompileResult(job.code);
+        }
     }
 
-    List<uint8_t> emitSPIRVForEntryPoint(
-        EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq)
+    // Disassemble `size` bytes of code at `data`, which was generated
+    // for `target`, using the downstream compiler that produces it.
+    static String disassembleWithDownstreamCompiler(
+        CompileRequest* compileRequest,
+        CodeGenTarget   target,
+        void const*     data,
+        size_t          size)
     {
-        String rawGLSL = emitGLSLForEntryPoint(entryPoint, targetReq);
-        maybeDumpIntermediate(entryPoint->compileRequest, rawGLSL.Buffer(), CodeGenTarget::GLSL);
-
-        List<uint8_t> output;
-        auto outputFunc = [](void const* data, size_t size, void* userData)
+        if (!data || !size)
         {
-            ((List<uint8_t>*)userData)->AddRange((uint8_t*)data, size);
-        };
-
-        glslang_CompileRequest request;
-        request.action = GLSLANG_ACTION_COMPILE_GLSL_TO_SPIRV;
-        request.sourcePath = "slang";
-        request.slangStage = (SlangStage)entryPoint->getStage();
-
-        request.inputBegin  = rawGLSL.begin();
-        request.inputEnd    = rawGLSL.end();
-
-        request.outputFunc = outputFunc;
-        request.outputUserData = &output;
-
-        int err = invokeGLSLCompiler(entryPoint->compileRequest, request);
+            return String();
+        }
 
-        if (err)
+        auto pool = compileRequest->mSession->getDownstreamCompilerPool(getDownstreamCompilerForTarget(target));
+        DownstreamCompilerScope compilerScope(pool);
+        if (!compilerScope.compiler)
         {
-            return List<uint8_t>();
+            diagnoseUnavailableDownstreamCompiler(&compileRequest->mSink, pool, compilerScope.result);
+            return String();
         }
 
-        return output;
-    }
-
-    String emitSPIRVAssemblyForEntryPoint(
-        EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq)
-    {
-        List<uint8_t> spirv = emitSPIRVForEntryPoint(entryPoint, targetReq);
-        if (spirv.Count() == 0)
+        ComPtr<ISlangBlob> assemblyBlob;
+        if (SLANG_FAILED(compilerScope.compiler->disassemble(SlangCompileTarget(target), data, size, assemblyBlob.writeRef()))
+            || !assemblyBlob)
+        {
+            // TODO(tfoley): need to figure out what to diagnose here...
             return String();
-
-        String result = dissassembleSPIRV(entryPoint->compileRequest, spirv.begin(), spirv.Count());
-        return result;
+        }
+        return getStringFromBlob(assemblyBlob);
     }
-#endif
 
-    // Do emit logic for a single entry point
+    // Do emit logic for a single entry point.
+    //
+    // For the binary targets, this only generates the source (or code)
+    // to pass to a downstream compiler, and sets up `outJob` to do the
+    // rest of the work later.
     CompileResult emitEntryPoint(
         EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq)
+        TargetRequest*      targetReq,
+        DownstreamJob&      outJob)
     {
         CompileResult result;
 
@@ -624,69 +630,78 @@ String dissassembleDXILUsingDXC(
             }
             break;
 
-#if SLANG_ENABLE_DXBC_SUPPORT
         case CodeGenTarget::DXBytecode:
-            {
-                List<uint8_t> code = EmitDXBytecodeForEntryPoint(entryPoint, targetReq);
-                maybeDumpIntermediate(compileRequest, code.Buffer(), code.Count(), target);
-                result = CompileResult(code);
-            }
-            break;
-
         case CodeGenTarget::DXBytecodeAssembly:
+        case CodeGenTarget::DXIL:
+        case CodeGenTarget::DXILAssembly:
             {
-                String code = EmitDXBytecodeAssemblyForEntryPoint(entryPoint, targetReq);
-                maybeDumpIntermediate(compileRequest, code.Buffer(), target);
-                result = CompileResult(code);
+                String hlslCode = emitHLSLForEntryPoint(entryPoint, targetReq);
+                maybeDumpIntermediate(compileRequest, hlslCode.Buffer(), CodeGenTarget::HLSL);
+
+                auto binaryTarget = (target == CodeGenTarget::DXBytecode || target == CodeGenTarget::DXBytecodeAssembly)
+                    ? CodeGenTarget::DXBytecode
+                    : CodeGenTarget::DXIL;
+                initDownstreamCompileJob(outJob, entryPoint, targetReq, binaryTarget, hlslCode);
+                outJob.shouldDisassemble = (target != binaryTarget);
             }
             break;
-#endif
 
-#if SLANG_ENABLE_DXIL_SUPPORT
-        case CodeGenTarget::DXIL:
+        case CodeGenTarget::SPIRV:
+        case CodeGenTarget::SPIRVAssembly:
             {
-                List<uint8_t> code;
-                int err = emitDXILForEntryPointUsingDXC(entryPoint, targetReq, code);
-                if (!err)
+                // When asked to, try to emit SPIR-V straight from the IR first, and
+                // only go through GLSL and glslang for code the direct path doesn't
+                // handle yet.
+                List<uint8_t> directCode;
+                bool isDirect = false;
+                if (compileRequest->passThrough == PassThroughMode::None
+                    && (targetReq->targetFlags & SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY))
                 {
-                    maybeDumpIntermediate(compileRequest, code.Buffer(), code.Count(), target);
-                    result = CompileResult(code);
+                    auto errorCountBefore = compileRequest->mSink.GetErrorCount();
+
+                    String failure;
+                    isDirect = emitSPIRVForEntryPointDirectly(entryPoint, targetReq->layout.Ptr(), targetReq, directCode, failure);
+
+                    // Preparing the IR can report errors, and there is no point in
+                    // reporting them a second time from the GLSL path
+                    if (!isDirect && compileRequest->mSink.GetErrorCount() != errorCountBefore)
+                        break;
+
+                    if (!isDirect)
+                    {
+                        compileRequest->mSink.diagnose(
+                            entryPoint->decl ? entryPoint->decl->loc : SourceLoc(),
+                            Diagnostics::spirvDirectEmissionFallback,
+                            entryPoint->name,
+                            failure);
+                    }
                 }
-            }
-            break;
 
-        case CodeGenTarget::DXILAssembly:
-            {
-                List<uint8_t> code;
-                int err = emitDXILForEntryPointUsingDXC(entryPoint, targetReq, code);
-                if (!err)
+                if (isDirect)
                 {
-                    String assembly = dissassembleDXILUsingDXC(
-                        compileRequest,
-                        code.Buffer(),
-                        code.Count());
-
-                    maybeDumpIntermediate(compileRequest, assembly.Buffer(), target);
+                    outJob.compilerKind = PassThroughMode::glslang;
+                    outJob.target = CodeGenTarget::SPIRV;
+                    outJob.code = directCode;
+                }
+                else
+                {
+                    String glslCode = emitGLSLForEntryPoint(entryPoint, targetReq);
+                    maybeDumpIntermediate(compileRequest, glslCode.Buffer(), CodeGenTarget::GLSL);
 
-                    result = CompileResult(assembly);
+                    initDownstreamCompileJob(outJob, entryPoint, targetReq, CodeGenTarget::SPIRV, glslCode);
                 }
-            }
-            break;
-#endif
 
-        case CodeGenTarget::SPIRV:
-            {
-                List<uint8_t> code = emitSPIRVForEntryPoint(entryPoint, targetReq);
-                maybeDumpIntermediate(compileRequest, code.Buffer(), code.Count(), target);
-                result = CompileResult(code);
-            }
-            break;
+                outJob.shouldDisassemble = (target == CodeGenTarget::SPIRVAssembly);
 
-        case CodeGenTarget::SPIRVAssembly:
-            {
-                String code = emitSPIRVAssemblyForEntryPoint(entryPoint, targetReq);
-                maybeDumpIntermediate(compileRequest, code.Buffer(), target);
-                result = CompileResult(code);
+                // There is nothing left for a downstream compiler to do
+                // with SPIR-V we emitted directly, unless it is asked for
+                // disassembly.
+                if (isDirect && !outJob.shouldDisassemble)
+                {
+                    outJob.compilerKind = PassThroughMode::None;
+                    maybeDumpIntermediate(compileRequest, directCode.Buffer(), directCode.Count(), target);
+                    result = CompileResult(directCode);
+                }
             }
             break;
 
@@ -737,7 +752,7 @@ String dissassembleDXILUsingDXC(
         OutputFileKind  kind)
     {
         FILE* file = fopen(
-            path.Buffer(),
+            compileRequest->resolvePath(path).Buffer(),
             kind == OutputFileKind::Binary ? "wb" : "w");
         if (!file)
         {
@@ -792,9 +807,15 @@ String dissassembleDXILUsingDXC(
     }
 
     static void writeOutputToConsole(
-        CompileRequest*,
+        CompileRequest* compileRequest,
         String const&   text)
     {
+        if (auto callback = compileRequest->standardOutputCallback)
+        {
+            callback(text.begin(), text.end() - text.begin(), compileRequest->standardOutputUserData);
+            return;
+        }
+
         fwrite(
             text.begin(),
             text.end() - text.begin(),
@@ -819,6 +840,14 @@ String dissassembleDXILUsingDXC(
         case ResultFormat::Binary:
             {
                 auto& data = result.outputBinary;
+                if (auto callback = compileRequest->standardOutputCallback)
+                {
+                    // Output is being captured, which we treat like
+                    // redirecting stdout to a file
+                    callback(data.begin(), data.end() - data.begin(), compileRequest->standardOutputUserData);
+                    break;
+                }
+
                 int stdoutFileDesc = _fileno(stdout);
                 if (_isatty(stdoutFileDesc))
                 {
@@ -826,31 +855,12 @@ String dissassembleDXILUsingDXC(
 
                     switch (targetReq->target)
                     {
-                #if SLANG_ENABLE_DXBC_SUPPORT
                     case CodeGenTarget::DXBytecode:
-                        {
-                            String assembly = dissassembleDXBC(compileRequest,
-                                data.begin(),
-                                data.end() - data.begin());
-                            writeOutputToConsole(compileRequest, assembly);
-                        }
-                        break;
-                #endif
-
-                #if SLANG_ENABLE_DXIL_SUPPORT
                     case CodeGenTarget::DXIL:
-                        {
-                            String assembly = dissassembleDXILUsingDXC(compileRequest,
-                                data.begin(),
-                                data.end() - data.begin());
-                            writeOutputToConsole(compileRequest, assembly);
-                        }
-                        break;
-                #endif
-
                     case CodeGenTarget::SPIRV:
                         {
-                            String assembly = dissassembleSPIRV(compileRequest,
+                            String assembly = disassembleWithDownstreamCompiler(compileRequest,
+                                targetReq->target,
                                 data.begin(),
                                 data.end() - data.begin());
                             writeOutputToConsole(compileRequest, assembly);
@@ -906,36 +916,416 @@ String dissassembleDXILUsingDXC(
         }
     }
 
+    // Should the entry points for `targetReq` be emitted together, one
+    // translation unit at a time (see `SLANG_TARGET_FLAG_LIBRARY_OUTPUT`)?
+    static bool shouldEmitEntryPointsTogether(
+        TargetRequest*          targetReq)
+    {
+        if (!(targetReq->targetFlags & SLANG_TARGET_FLAG_LIBRARY_OUTPUT))
+            return false;
+
+        // Only HLSL output, and DXIL compiled by dxc for a `lib` profile, can
+        // hold more than one entry point: GLSL needs each of them to be called
+        // `main`, and the other downstream compilers (and profiles) only compile
+        // one entry point at a time.
+        switch (targetReq->target)
+        {
+        case CodeGenTarget::HLSL:
+        case CodeGenTarget::DXIL:
+        case CodeGenTarget::DXILAssembly:
+            break;
+
+        default:
+            return false;
+        }
+
+        return targetReq->compileRequest->passThrough == PassThroughMode::None;
+    }
+
+    // Is `profile` one that dxc compiles as a library (e.g., `lib_6_3`),
+    // with any number of entry points in it?
+    static bool isDXLibraryProfile(
+        Profile                 profile)
+    {
+        return profile.getFamily() == ProfileFamily::DX
+            && profile.GetStage() == Stage::Unknown
+            && profile.GetVersion() >= ProfileVersion::DX_6_1;
+    }
+
+    // Can `entryPoint` be emitted together with others for `targetReq`, and if
+    // so, what profile do the others need to have? Entry points are emitted
+    // together if they come from the same translation unit and have the same
+    // shared profile (which doesn't matter for HLSL output).
+    static bool getSharedProfileForEntryPoint(
+        EntryPointRequest*      entryPoint,
+        TargetRequest*          targetReq,
+        Profile&                outProfile)
+    {
+        // Arguments for global generic parameters can specialize the
+        // same (mangled) function differently for each entry point,
+        // so entry points that have them are emitted on their own.
+        if (entryPoint->globalGenericSubst)
+            return false;
+
+        if (targetReq->target == CodeGenTarget::HLSL)
+        {
+            outProfile = Profile();
+            return true;
+        }
+
+        // For DXIL, the result is compiled by dxc as a library
+        outProfile = getEffectiveProfile(entryPoint, targetReq);
+        return isDXLibraryProfile(outProfile);
+    }
+
+    // Emit the entry points from each translation unit together, so that
+    // the code they share is only output once, and use that code (or the
+    // DXIL library that dxc compiles it to) as the result for each of them.
     void emitEntryPoints(
-        TargetRequest*          /*targetReq*/)
+        TargetRequest*          targetReq,
+        List<DownstreamJob>&    ioJobs)
     {
+        CompileRequest* compileReq = targetReq->compileRequest;
+
+        UInt entryPointCount = compileReq->entryPoints.Count();
+        targetReq->entryPointResults.SetSize(entryPointCount);
+
+        List<bool> isEntryPointEmitted;
+        isEntryPointEmitted.SetSize(entryPointCount);
+        for (UInt ee = 0; ee < entryPointCount; ++ee)
+            isEntryPointEmitted[ee] = false;
+
+        for (UInt ee = 0; ee < entryPointCount; ++ee)
+        {
+            if (isEntryPointEmitted[ee])
+                continue;
 
+            auto entryPoint = compileReq->entryPoints[ee];
+            Profile sharedProfile;
+            if (!getSharedProfileForEntryPoint(entryPoint, targetReq, sharedProfile))
+            {
+                DownstreamJob job;
+                targetReq->entryPointResults[ee] = emitEntryPoint(entryPoint, targetReq, job);
+                if (job.compilerKind != PassThroughMode::None)
+                {
+                    job.targetReq = targetReq;
+                    job.entryPointIndex = ee;
+                    ioJobs.Add(_Move(job));
+                }
+                continue;
+            }
+
+            // Gather the later entry points that go with this one
+            List<EntryPointRequest*> entryPoints;
+            List<UInt> entryPointIndices;
+            for (UInt ff = ee; ff < entryPointCount; ++ff)
+            {
+                auto otherEntryPoint = compileReq->entryPoints[ff];
+                Profile otherProfile;
+                if (isEntryPointEmitted[ff]
+                    || otherEntryPoint->translationUnitIndex != entryPoint->translationUnitIndex
+                    || !getSharedProfileForEntryPoint(otherEntryPoint, targetReq, otherProfile)
+                    || otherProfile != sharedProfile)
+                {
+                    continue;
+                }
+                isEntryPointEmitted[ff] = true;
+                entryPoints.Add(otherEntryPoint);
+                entryPointIndices.Add(ff);
+            }
+
+            String code = emitEntryPoints(
+                entryPoints,
+                targetReq->layout.Ptr(),
+                CodeGenTarget::HLSL,
+                targetReq);
+            maybeDumpIntermediate(compileReq, code.Buffer(), CodeGenTarget::HLSL);
+
+            if (targetReq->target == CodeGenTarget::HLSL)
+            {
+                for (auto index : entryPointIndices)
+                {
+                    targetReq->entryPointResults[index] = CompileResult(code);
+                }
+                continue;
+            }
+
+            // dxc compiles the whole library once, and every entry point in it
+            // gets the result (once the job has run)
+            DownstreamJob job;
+            initDownstreamCompileJob(job, entryPoint, targetReq, CodeGenTarget::DXIL, code);
+            job.profileName = GetHLSLProfileName(sharedProfile);
+            job.stage = SLANG_STAGE_NONE;
+            job.shouldDisassemble = (targetReq->target == CodeGenTarget::DXILAssembly);
+            job.targetReq = targetReq;
+            job.entryPointIndex = ee;
+            for (UInt ii = 1; ii < entryPointIndices.Count(); ++ii)
+            {
+                job.sharedEntryPointIndices.Add(entryPointIndices[ii]);
+            }
+            ioJobs.Add(_Move(job));
+        }
+    }
+
+    // Can the results of compiling entry points for `targetReq`
+    // be kept in (and reused from) the request's output cache?
+    static bool canCacheEntryPointOutput(
+        TargetRequest*          targetReq)
+    {
+        auto compileRequest = targetReq->compileRequest;
+
+        // There is no IR to hash for a pass-through compile
+        if (compileRequest->passThrough != PassThroughMode::None)
+            return false;
+
+        // Intermediates are dumped while generating code,
+        // which reusing a result would skip
+        if (compileRequest->shouldDumpIntermediates)
+            return false;
+
+        switch (targetReq->target)
+        {
+        case CodeGenTarget::None:
+        case CodeGenTarget::Unknown:
+            return false;
+
+        default:
+            return true;
+        }
+    }
+
+    // Get the language that code for `target` is emitted in (and
+    // so, that the IR is prepared for).
+    static CodeGenTarget getEmitLanguageForTarget(
+        CodeGenTarget           target)
+    {
+        switch (target)
+        {
+        case CodeGenTarget::GLSL:
+        case CodeGenTarget::SPIRV:
+        case CodeGenTarget::SPIRVAssembly:
+            return CodeGenTarget::GLSL;
+
+        default:
+            return CodeGenTarget::HLSL;
+        }
+    }
+
+    // Get the key for the result of compiling `entryPoint` for `targetReq`
+    // in the request's output cache.
+    static IRStructuralHash getEntryPointOutputKey(
+        EntryPointRequest*      entryPoint,
+        TargetRequest*          targetReq)
+    {
+        auto compileRequest = targetReq->compileRequest;
+
+        IRStructuralHash key = getPreparedIRHashForEntryPoint(
+            entryPoint,
+            targetReq->layout.Ptr(),
+            getEmitLanguageForTarget(targetReq->target),
+            targetReq);
+
+        // Besides the IR, the output depends on the options for the target and
+        // the request, and on the translation unit (whose modifiers can be output
+        // as GLSL preprocessor directives).
+        key = combineStructuralHash(key, uint64_t(targetReq->target));
+        key = combineStructuralHash(key, targetReq->targetFlags);
+        key = combineStructuralHash(key, uint64_t(getEffectiveProfile(entryPoint, targetReq).raw));
+        key = combineStructuralHash(key, uint64_t(targetReq->defaultMatrixLayoutMode));
+        key = combineStructuralHash(key, uint64_t(compileRequest->lineDirectiveMode));
+        key = combineStructuralHash(key, compileRequest->compileFlags);
+        key = combineStructuralHash(key, uint64_t(PtrInt(entryPoint->getTranslationUnit()->SyntaxNode.Ptr())));
+        return key;
     }
 
     void generateOutputForTarget(
-        TargetRequest*  targetReq)
+        TargetRequest*          targetReq,
+        List<DownstreamJob>&    ioJobs)
     {
         CompileRequest* compileReq = targetReq->compileRequest;
 
+        if (shouldEmitEntryPointsTogether(targetReq))
+        {
+            emitEntryPoints(targetReq, ioJobs);
+            return;
+        }
+
+        auto& outputCache = compileReq->getEntryPointOutputCache();
+        bool canCacheOutput = canCacheEntryPointOutput(targetReq);
+
         // Generate target code any entry points that
         // have been requested for compilation.
-        for (auto& entryPoint : compileReq->entryPoints)
+        UInt entryPointCount = compileReq->entryPoints.Count();
+        for (UInt ee = 0; ee < entryPointCount; ++ee)
         {
-            CompileResult entryPointResult = emitEntryPoint(entryPoint, targetReq);
+            auto entryPoint = compileReq->entryPoints[ee];
+
+            // If the same IR has been compiled before, with the same
+            // options, its result can be used again as it is.
+            IRStructuralHash outputKey = 0;
+            if (canCacheOutput)
+            {
+                outputKey = getEntryPointOutputKey(entryPoint, targetReq);
+
+                CompileResult cachedResult;
+                if (outputCache.TryGetValue(outputKey, cachedResult))
+                {
+                    compileReq->stats.outputCacheHitCount++;
+                    targetReq->entryPointResults.Add(cachedResult);
+                    continue;
+                }
+            }
+
+            auto errorCountBefore = compileReq->mSink.GetErrorCount();
+
+            DownstreamJob job;
+            CompileResult entryPointResult = emitEntryPoint(entryPoint, targetReq, job);
             targetReq->entryPointResults.Add(entryPointResult);
+
+            bool shouldCacheOutput = canCacheOutput
+                && compileReq->mSink.GetErrorCount() == errorCountBefore;
+
+            // Any work left for a downstream compiler is done later,
+            // once code has been generated for all of the targets.
+            if (job.compilerKind != PassThroughMode::None)
+            {
+                job.targetReq = targetReq;
+                job.entryPointIndex = ee;
+                job.shouldCacheOutput = shouldCacheOutput;
+                job.outputKey = outputKey;
+                ioJobs.Add(_Move(job));
+            }
+            else if (shouldCacheOutput && entryPointResult.format != ResultFormat::None)
+            {
+                outputCache[outputKey] = entryPointResult;
+            }
         }
     }
 
+    // When entry points are emitted together, they all have the same
+    // result, which only needs to be written once for each output path.
+    static bool isSharedResultAlreadyWritten(
+        TargetRequest*  targetReq,
+        UInt            entryPointIndex)
+    {
+        if (!shouldEmitEntryPointsTogether(targetReq))
+            return false;
+
+        auto& entryPoints = targetReq->compileRequest->entryPoints;
+        auto entryPoint = entryPoints[entryPointIndex];
+        Profile sharedProfile;
+        if (!getSharedProfileForEntryPoint(entryPoint, targetReq, sharedProfile))
+            return false;
+
+        for (UInt ee = 0; ee < entryPointIndex; ++ee)
+        {
+            auto otherEntryPoint = entryPoints[ee];
+            Profile otherProfile;
+            if (!getSharedProfileForEntryPoint(otherEntryPoint, targetReq, otherProfile))
+                continue;
+            if (otherEntryPoint->translationUnitIndex == entryPoint->translationUnitIndex
+                && otherProfile == sharedProfile
+                && otherEntryPoint->outputPath == entryPoint->outputPath)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void generateOutput(
         CompileRequest* compileRequest)
     {
         // Go through the code-generation targets that the user
         // has specified, and generate code for each of them.
         //
+        auto& downstreamJobs = compileRequest->pendingDownstreamJobs;
         for (auto targetReq : compileRequest->targets)
         {
-            generateOutputForTarget(targetReq);
+            generateOutputForTarget(targetReq, downstreamJobs);
+        }
+
+        // The IR prepared for each entry point is shared between targets,
+        // and isn't needed once all of them have been generated.
+        for (auto entryPoint : compileRequest->entryPoints)
+        {
+            entryPoint->preparedIR = List<RefPtr<PreparedEntryPointIR>>();
+        }
+
+        // The jobs of a request in a batch are run along with those
+        // of the other requests (see `runDownstreamJobsForBatch`).
+        if (compileRequest->isInBatch)
+        {
+            compileRequest->hasPendingOutput = true;
+            return;
+        }
+
+        // Now that the code to pass to downstream compilers has been
+        // generated, they can all be invoked at once.
+        if (downstreamJobs.Count())
+        {
+            List<DownstreamJob*> jobs;
+            for (auto& job : downstreamJobs)
+            {
+                jobs.Add(&job);
+            }
+
+            CompilePhaseScope phaseScope(compileRequest, SLANG_COMPILE_PHASE_DOWNSTREAM);
+            runDownstreamJobs(compileRequest->mSession, jobs);
+        }
+
+        finishOutput(compileRequest);
+    }
+
+    void runDownstreamJobsForBatch(
+        List<CompileRequest*> const& requests)
+    {
+        List<DownstreamJob*> jobs;
+        for (auto compileRequest : requests)
+        {
+            for (auto& job : compileRequest->pendingDownstreamJobs)
+            {
+                jobs.Add(&job);
+            }
+        }
+        if (jobs.Count() == 0)
+            return;
+
+        // The requests could be from different sessions, in which case
+        // the session of the first one decides how many threads to use.
+        auto startTime = std::chrono::steady_clock::now();
+        runDownstreamJobs(jobs[0]->targetReq->compileRequest->mSession, jobs);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+        // We can't tell how much of the time went to each request,
+        // so each of them has it all added to its stats.
+        for (auto compileRequest : requests)
+        {
+            if (compileRequest->pendingDownstreamJobs.Count() == 0)
+                continue;
+            compileRequest->stats.phaseSeconds[SLANG_COMPILE_PHASE_DOWNSTREAM] += elapsed.count();
+            compileRequest->stats.totalSeconds += elapsed.count();
         }
+    }
+
+    void finishOutput(
+        CompileRequest* compileRequest)
+    {
+        auto& outputCache = compileRequest->getEntryPointOutputCache();
+        for (auto& job : compileRequest->pendingDownstreamJobs)
+        {
+            CompileResult result = finishDownstreamJob(compileRequest, job);
+            if (job.shouldCacheOutput && result.format != ResultFormat::None)
+            {
+                outputCache[job.outputKey] = result;
+            }
+            job.targetReq->entryPointResults[job.entryPointIndex] = result;
+            for (auto index : job.sharedEntryPointIndices)
+            {
+                job.targetReq->entryPointResults[index] = result;
+            }
+        }
+        compileRequest->pendingDownstreamJobs = List<DownstreamJob>();
 
         // If we are being asked to generate code in a container
         // format, then we are now in a position to do so.
@@ -959,6 +1349,9 @@ String dissassembleDXILUsingDXC(
                 UInt entryPointCount = compileRequest->entryPoints.Count();
                 for (UInt ee = 0; ee < entryPointCount; ++ee)
                 {
+                    if (isSharedResultAlreadyWritten(targetReq, ee))
+                        continue;
+
                     writeEntryPointResult(
                         compileRequest->entryPoints[ee],
                         targetReq,
@@ -996,13 +1389,8 @@ String dissassembleDXILUsingDXC(
         // This is primarily a debugging aid, so we don't
         // really need/want to do anything too elaborate
 
-        static uint32_t counter = 0;
-#ifdef WIN32
-        uint32_t id = InterlockedIncrement(&counter);
-#else
-        // TODO: actually implement the case for other platforms
+        static std::atomic<uint32_t> counter(0);
         uint32_t id = counter++;
-#endif
 
         String path;
         path.append("slang-dump-");
@@ -1069,12 +1457,11 @@ String dissassembleDXILUsingDXC(
         case CodeGenTarget::SPIRV:
             dumpIntermediateBinary(compileRequest, data, size, ".spv");
             {
-                String spirvAssembly = dissassembleSPIRV(compileRequest, data, size);
+                String spirvAssembly = disassembleWithDownstreamCompiler(compileRequest, target, data, size);
                 dumpIntermediateText(compileRequest, spirvAssembly.begin(), spirvAssembly.Length(), ".spv.asm");
             }
             break;
 
-    #if SLANG_ENABLE_DXBC_SUPPORT
         case CodeGenTarget::DXBytecodeAssembly:
             dumpIntermediateText(compileRequest, data, size, ".dxbc.asm");
             break;
@@ -1082,13 +1469,11 @@ String dissassembleDXILUsingDXC(
         case CodeGenTarget::DXBytecode:
             dumpIntermediateBinary(compileRequest, data, size, ".dxbc");
             {
-                String dxbcAssembly = dissassembleDXBC(compileRequest, data, size);
+                String dxbcAssembly = disassembleWithDownstreamCompiler(compileRequest, target, data, size);
                 dumpIntermediateText(compileRequest, dxbcAssembly.begin(), dxbcAssembly.Length(), ".dxbc.asm");
             }
             break;
-    #endif
 
-    #if SLANG_ENABLE_DXIL_SUPPORT
         case CodeGenTarget::DXILAssembly:
             dumpIntermediateText(compileRequest, data, size, ".dxil.asm");
             break;
@@ -1096,11 +1481,10 @@ String dissassembleDXILUsingDXC(
         case CodeGenTarget::DXIL:
             dumpIntermediateBinary(compileRequest, data, size, ".dxil");
             {
-                String dxilAssembly = dissassembleDXILUsingDXC(compileRequest, data, size);
+                String dxilAssembly = disassembleWithDownstreamCompiler(compileRequest, target, data, size);
                 dumpIntermediateText(compileRequest, dxilAssembly.begin(), dxilAssembly.Length(), ".dxil.asm");
             }
             break;
-    #endif
         }
     }
 
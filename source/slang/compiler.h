@@ -5,14 +5,19 @@
 #include "../../slang-com-ptr.h"
 
 #include "diagnostics.h"
+#include "downstream-compiler.h"
+#include "ir-hash.h"
 #include "name.h"
 #include "profile.h"
 #include "syntax.h"
 
 #include "../../slang.h"
 
+#include <chrono>
+
 namespace Slang
 {
+    struct ExtensionUsageTracker;
     struct IncludeHandler;
     class CompileRequest;
     class ProgramLayout;
@@ -109,6 +114,40 @@ namespace Slang
         ComPtr<ISlangBlob> blob;
     };
 
+    class TargetRequest;
+
+    // The IR for an entry point once it has been specialized, legalized and
+    // cleaned up for emitting code in one target language (HLSL or GLSL).
+    //
+    // Only the code-generation targets that lower to a different language,
+    // or that lay out parameters differently, need IR of their own: the others
+    // (e.g., DXBC and DXIL, or GLSL and SPIR-V) share it, and only run the
+    // final emit step for themselves (see `getPreparedIRForEntryPoint`).
+    class PreparedEntryPointIR : public RefObject
+    {
+    public:
+        ~PreparedEntryPointIR();
+
+        // The language the IR was prepared for
+        CodeGenTarget target;
+
+        // The target whose layout was used to prepare the IR
+        TargetRequest* targetReq = nullptr;
+
+        RefPtr<IRModule> irModule;
+
+        // The layout (specialized for any global generic arguments)
+        // that the layout decorations in `irModule` refer to
+        RefPtr<ProgramLayout> layout;
+
+        // The GLSL extensions and version that preparing the IR required
+        ExtensionUsageTracker* extensionUsageTracker = nullptr;
+
+        // The structural hash of `irModule` (see `getStructuralHash`),
+        // along with the extensions and version it requires
+        IRStructuralHash structuralHash = 0;
+    };
+
     // Describes an entry point that we've been requested to compile
     class EntryPointRequest : public RefObject
     {
@@ -170,6 +209,17 @@ namespace Slang
         RefPtr<FuncDecl> decl;
 
         RefPtr<Substitutions> globalGenericSubst;
+
+        // IR that binds the global generic parameters to the arguments
+        // in `globalGenericSubst`. This is kept apart from the IR for the
+        // translation unit, which is shared by entry points with different
+        // arguments (including those of specialization requests; see
+        // `spCreateSpecializationRequest`).
+        RefPtr<IRModule> genericArgsIRModule;
+
+        // The IR prepared for each target language while generating output
+        // (see `PreparedEntryPointIR`)
+        List<RefPtr<PreparedEntryPointIR>> preparedIR;
     };
 
     enum class PassThroughMode : SlangPassThrough
@@ -184,12 +234,19 @@ namespace Slang
 
     // A single translation unit requested to be compiled.
     //
+    class SharedTranslationUnit;
+
     class TranslationUnitRequest : public RefObject
     {
     public:
         // The parent compile request
         CompileRequest* compileRequest = nullptr;
 
+        // The arena the syntax was allocated from, if any
+        // (see `SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST`).
+        // This comes first, so that it is released last.
+        RefPtr<ASTArena> astArena;
+
         // The language in which the source file(s)
         // are assumed to be written
         SourceLanguage sourceLanguage = SourceLanguage::Unknown;
@@ -209,6 +266,22 @@ namespace Slang
         // Compile flags for this translation unit
         SlangCompileFlags compileFlags = 0;
 
+        // Should the names of all the macros that the preprocessor looks up
+        // (whether or not they are defined) be recorded in `macroNamesLookedUp`?
+        // This tells us which preprocessor definitions the code depends on.
+        bool shouldRecordMacroLookups = false;
+        HashSet<Name*> macroNamesLookedUp;
+
+        // The files that preprocessing the translation unit included, and whether
+        // parsing, checking or lowering it produced any diagnostics. These tell us
+        // if it can be shared with other permutations (see `SharedTranslationUnit`).
+        List<String> dependencyFilePaths;
+        bool producedDiagnostics = false;
+
+        // The version of the translation unit compiled by another permutation,
+        // if this request uses that instead of compiling it again
+        RefPtr<SharedTranslationUnit> sharedTranslationUnit;
+
         // The parsed syntax for the translation unit
         RefPtr<ModuleDecl>   SyntaxNode;
 
@@ -277,6 +350,11 @@ namespace Slang
     class LoadedModule : public RefObject
     {
     public:
+        // The arena the AST was allocated from, if any
+        // (see `SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST`).
+        // This comes first, so that it is released last.
+        RefPtr<ASTArena> astArena;
+
         // The AST for the module
         RefPtr<ModuleDecl>  moduleDecl;
 
@@ -284,6 +362,119 @@ namespace Slang
         RefPtr<IRModule> irModule = nullptr;
     };
 
+    // A module that was loaded by one permutation of a compile request
+    // (see `spCreatePermutationRequest`), which the other permutations
+    // can use instead of loading it again, as long as it doesn't depend
+    // on anything that is different between them.
+    //
+    class SharedLoadedModule : public RefObject
+    {
+    public:
+        // The name and path the module was loaded under
+        Name*   name = nullptr;
+        String  path;
+
+        RefPtr<LoadedModule> loadedModule;
+
+        // The preprocessor definitions it was loaded with, and the names
+        // of the macros that preprocessing the module looked up. A definition
+        // that wasn't looked up can't have made any difference to the module.
+        Dictionary<String, String>  preprocessorDefinitions;
+        HashSet<Name*>              macroNamesLookedUp;
+
+        // The modules that this module imports
+        List<RefPtr<SharedLoadedModule>> importedModules;
+
+        // The files that loading the module depended on
+        List<String> dependencyFilePaths;
+    };
+
+    // The tokens that one permutation of a compile request got from preprocessing
+    // one of the source files of its translation units (including anything it
+    // `#include`s), which the other permutations can use as long as they define
+    // all of the macros that were looked up in the same way.
+    //
+    class SharedTokenList : public RefObject
+    {
+    public:
+        Dictionary<String, String>  preprocessorDefinitions;
+        HashSet<Name*>              macroNamesLookedUp;
+
+        TokenList tokens;
+
+        // The files that were included
+        List<String> dependencyFilePaths;
+    };
+
+    // A translation unit of a compile request, as parsed, checked and lowered to
+    // IR by one of its permutations, which the other permutations can use instead
+    // of compiling it again, as long as they define all of the macros that were
+    // looked up in the same way and can use the modules it imports.
+    //
+    class SharedTranslationUnit : public RefObject
+    {
+    public:
+        // The arena the syntax was allocated from, if any.
+        // This comes first, so that it is released last.
+        RefPtr<ASTArena> astArena;
+
+        RefPtr<ModuleDecl>  syntax;
+        RefPtr<IRModule>    irModule;
+
+        SlangCompileFlags           compileFlags = 0;
+        Dictionary<String, String>  preprocessorDefinitions;
+        HashSet<Name*>              macroNamesLookedUp;
+
+        // The modules that the translation unit imports
+        List<RefPtr<SharedLoadedModule>> importedModules;
+
+        // The files that were included
+        List<String> dependencyFilePaths;
+    };
+
+    // Work for a downstream compiler (e.g., `fxc`) to do on the code generated
+    // for an entry point (see "Downstream compilers" in `compiler.cpp`)
+    //
+    struct DownstreamJob
+    {
+        // Where the result of the job goes
+        TargetRequest*      targetReq = nullptr;
+        UInt                entryPointIndex = 0;
+
+        // Other entry points that the result also goes to, when they
+        // were compiled together (see `SLANG_TARGET_FLAG_LIBRARY_OUTPUT`)
+        List<UInt>          sharedEntryPointIndices;
+
+        // The downstream compiler to use, and the binary target (e.g.,
+        // `DXBytecode` rather than `DXBytecodeAssembly`) it produces code for
+        PassThroughMode     compilerKind = PassThroughMode::None;
+        CodeGenTarget       target = CodeGenTarget::Unknown;
+
+        // Should `source` be compiled? If not, we start from the code in `code`.
+        bool                shouldCompile = false;
+        String              source;
+        String              entryPointName;
+        String              profileName;
+        SlangStage          stage = SLANG_STAGE_NONE;
+        List<String>        defineNames;
+        List<String>        defineValues;
+
+        // Should the code then be disassembled?
+        bool                shouldDisassemble = false;
+
+        // Should the result be added to the request's output cache, and with what key?
+        bool                shouldCacheOutput = false;
+        IRStructuralHash    outputKey = 0;
+
+        // The results of the job
+        SlangResult         result = SLANG_OK;
+        bool                isCompilerUnavailable = false;
+        bool                wasOutputCached = false;
+        String              diagnostics;
+        List<uint8_t>       code;
+        String              assembly;
+    };
+
     class Session;
 
     /// Create a blob that will retain a string for its lifetime.
@@ -300,6 +491,12 @@ namespace Slang
         // Pointer to parent session
         Session* mSession;
 
+        // The arenas that the AST of the translation units and modules used
+        // by this request were allocated from (see `ASTArena`). Everything
+        // else in the request may refer to those nodes, so this comes first,
+        // to be destroyed last.
+        List<RefPtr<ASTArena>> astArenas;
+
         // Information on the targets we are being asked to
         // generate code for.
         List<RefPtr<TargetRequest>> targets;
@@ -348,6 +545,60 @@ namespace Slang
         // Are we being driven by the command-line `slangc`, and should act accordingly?
         bool isCommandLineCompile = false;
 
+        // The directory that relative paths given to the request (for input
+        // files, search paths and output files) are relative to. When empty,
+        // they are relative to the working directory of the process.
+        String workingDirectory;
+
+        // Where output for the command line that would otherwise be written to
+        // `stdout` is sent instead, if set (see `spSetStandardOutputCallback`)
+        SlangOutputCallback standardOutputCallback = nullptr;
+        void* standardOutputUserData = nullptr;
+
+        // Should global functions in the modules we parse be checked
+        // lazily, on first use? (See `ModuleDecl::isCheckedLazily`)
+        bool shouldCheckModulesLazily = false;
+
+        // Declarations checked on demand whose diagnostics have been
+        // reported to this request (see `checkLazyDecl`)
+        HashSet<Decl*> lazyDeclsWithReportedDiagnostics;
+
+        // Should a report of `stats` be added to the diagnostic output?
+        bool shouldReportCompileStats = false;
+
+        // Timing and counters for the most recent compile. The IR-related
+        // counters are only filled in by `getCompileStats`.
+        SlangCompileStats stats = {};
+
+        // Results of compiling entry points, keyed by the structural hash of
+        // the IR they were generated from, combined with the options that
+        // affect the output (see `getEntryPointOutputKey`). An entry point whose
+        // key matches one compiled before skips emitting and compiling code.
+        //
+        // Specialization requests use the cache of the request they specialize,
+        // which also keeps alive the declarations that the keys refer to.
+        Dictionary<IRStructuralHash, CompileResult> entryPointOutputCache;
+        Dictionary<IRStructuralHash, CompileResult>& getEntryPointOutputCache()
+        {
+            return specializationBase ? specializationBase->getEntryPointOutputCache() : entryPointOutputCache;
+        }
+
+        // The linkage of each translation unit's IR module (see `IRLinkage`),
+        // built the first time code is generated for one of its entry points.
+        //
+        // Specialization requests use the linkages of the request they specialize,
+        // whose IR modules they share.
+        Dictionary<IRModule*, RefPtr<IRLinkage>> irLinkages;
+        Dictionary<IRModule*, RefPtr<IRLinkage>>& getIRLinkages()
+        {
+            return specializationBase ? specializationBase->getIRLinkages() : irLinkages;
+        }
+
+        // The phase that time is currently being attributed to
+        // (or `-1` when not compiling), and when that started.
+        int currentCompilePhase = -1;
+        std::chrono::steady_clock::time_point compilePhaseStartTime;
+
         // Source manager to help track files loaded
         SourceManager sourceManagerStorage;
         SourceManager* sourceManager;
@@ -384,6 +635,40 @@ namespace Slang
         // The resulting specialized IR module for each entry point request
         List<RefPtr<IRModule>> compiledModules;
 
+        // If this is a permutation of another request (see `spCreatePermutationRequest`),
+        // the request it was created from. Source locations are shared with it, so
+        // that any modules it holds in `sharedLoadedModules` can be used here.
+        RefPtr<CompileRequest> permutationBase;
+
+        // Modules loaded by permutations of this request, by path. There can be
+        // more than one version of a module, if it depends on definitions that
+        // are different between permutations.
+        Dictionary<String, List<RefPtr<SharedLoadedModule>>> sharedLoadedModules;
+
+        // The shared modules in use by this request (if it is a permutation)
+        List<RefPtr<SharedLoadedModule>> sharedModulesInUse;
+
+        // If this request specializes the entry points of another request
+        // (see `spCreateSpecializationRequest`), the request it was created from.
+        // Its checked syntax and IR are used instead of parsing the source again.
+        RefPtr<CompileRequest> specializationBase;
+
+        // Tokens from preprocessing the source files of this request, for its permutations
+        // to share. As with modules, there can be more than one version for a file.
+        Dictionary<SourceFile*, List<RefPtr<SharedTokenList>>> sharedTokenLists;
+
+        // The versions of each of the translation units of this request compiled by
+        // its permutations, for the others to share (indexing matches `translationUnits`)
+        List<List<RefPtr<SharedTranslationUnit>>> sharedTranslationUnits;
+
+        // Is this request being compiled along with others (see `spCompileBatch`)?
+        // If so, `generateOutput` leaves the downstream compiler jobs for it in
+        // `pendingDownstreamJobs`, to be run along with those of the other
+        // requests, and sets `hasPendingOutput`.
+        bool isInBatch = false;
+        bool hasPendingOutput = false;
+        List<DownstreamJob> pendingDownstreamJobs;
+
         /// File system implementation to use when loading files from disk.
         ///
         /// If this member is `null`, a default implementation that tries
@@ -399,16 +684,36 @@ namespace Slang
         ///
         SlangResult loadFile(String const& path, ISlangBlob** outBlob);
 
+        /// Get the path that `path` refers to, taking `workingDirectory` into account.
+        String resolvePath(String const& path);
+
         CompileRequest(Session* session);
 
+            /// Create a request with the same options, sources, entry points and targets as `base`
+            /// (see `spCreatePermutationRequest`)
+        CompileRequest(CompileRequest* base);
+
         ~CompileRequest();
 
+            /// Copy the options and targets of `base`, and share its source locations
+        void copyOptionsAndTargets(CompileRequest* base);
+
+            /// Set up a new request to specialize entry points of `base`, which has already
+            /// been compiled (see `spCreateSpecializationRequest`)
+        void initializeSpecialization(CompileRequest* base);
+
+            /// Find and check the entry points of a specialization request
+        void checkSpecializedEntryPoints();
+
         RefPtr<Expr> parseTypeString(TranslationUnitRequest * translationUnit, String typeStr, RefPtr<Scope> scope);
 
         Type* getTypeFromString(String typeStr);
 
+            /// Parse `translationUnit`, which is one of `translationUnits` (rather than a loaded module)
+            /// if `isRequestTranslationUnit` is set
         void parseTranslationUnit(
-            TranslationUnitRequest* translationUnit);
+            TranslationUnitRequest* translationUnit,
+            bool                    isRequestTranslationUnit);
 
         // Perform primary semantic checking on all
         // of the translation units in the program
@@ -416,9 +721,22 @@ namespace Slang
 
         void generateIR();
 
+            /// Lower the arguments for global generic parameters of each entry point to IR
+        void generateGenericArgsIR();
+
+            /// (Re)generate IR for the imported modules that have had functions checked lazily
+        void generateIRForLoadedModules();
+
         SlangResult executeActionsInner();
         SlangResult executeActions();
 
+            /// Finish the output of a request in a batch, once the downstream
+            /// compiler jobs of the batch have been run (see `spCompileBatch`)
+        SlangResult finishPendingOutput();
+
+            /// Report the stats and diagnostics for a compile that has finished with `result`
+        SlangResult finishActions(SlangResult result);
+
         int addTranslationUnit(SourceLanguage language, String const& name);
 
         void addTranslationUnitSourceFile(
@@ -463,6 +781,46 @@ namespace Slang
             Name*               name,
             SourceLoc const&    loc);
 
+            /// Should modules and tokens be shared with other permutations of the base of this request?
+        bool shouldShareWithPermutations();
+
+            /// Preprocess `sourceFile`, or get the tokens from another permutation if it has already done so
+        TokenList preprocessSourceFile(
+            TranslationUnitRequest*             translationUnit,
+            bool                                isRequestTranslationUnit,
+            SourceFile*                         sourceFile,
+            Dictionary<String, String> const&   definitions,
+            IncludeHandler*                     includeHandler);
+
+            /// Can this request use a module loaded by another permutation of the same base?
+        bool canUseSharedModule(SharedLoadedModule* sharedModule);
+
+            /// Use `sharedModule` (and the modules it imports) as if this request had loaded it
+        void useSharedModule(SharedLoadedModule* sharedModule);
+
+            /// Get the preprocessor definitions of this request, along with those of `translationUnit`
+        Dictionary<String, String> getCombinedPreprocessorDefinitions(TranslationUnitRequest* translationUnit);
+
+            /// Use the version of one of our translation units compiled by another permutation of the
+            /// same base, if there is one that would come out the same as compiling it here
+        bool tryUseSharedTranslationUnit(UInt translationUnitIndex);
+
+            /// Record the translation units that this request has just compiled, so other permutations can use them
+        void addSharedTranslationUnits();
+
+            /// Find the shared modules in use by this request for everything that `moduleDecl` imports,
+            /// returning false if any of them isn't shared
+        bool findSharedModulesImportedBy(
+            ModuleDecl*                         moduleDecl,
+            List<RefPtr<SharedLoadedModule>>&   outImportedModules);
+
+            /// Record a module that this request has just loaded, so other permutations can use it
+        void addSharedModule(
+            Name*                   name,
+            String const&           path,
+            TranslationUnitRequest* translationUnit,
+            UInt                    dependencyFilePathStart);
+
         Decl* lookupGlobalDecl(Name* name);
 
         SourceManager* getSourceManager()
@@ -481,11 +839,47 @@ namespace Slang
         void noteInternalErrorLoc(SourceLoc const& loc);
 
         int internalErrorLocsNoted = 0;
+
+            /// Start attributing time to `phase` (which may be `-1`)
+        void switchCompilePhase(int phase);
+
+            /// Get `stats`, along with counters gathered from the IR modules
+        void getCompileStats(SlangCompileStats* outStats);
+    };
+
+        /// Attribute time to a phase of compilation for the duration of a scope,
+        /// then go back to whatever phase was active before.
+    struct CompilePhaseScope
+    {
+        CompilePhaseScope(CompileRequest* request, SlangCompilePhase phase)
+            : request(request)
+            , savedPhase(request->currentCompilePhase)
+        {
+            request->switchCompilePhase(int(phase));
+        }
+
+        ~CompilePhaseScope()
+        {
+            request->switchCompilePhase(savedPhase);
+        }
+
+        CompileRequest* request;
+        int             savedPhase;
     };
 
     void generateOutput(
         CompileRequest* compileRequest);
 
+        /// Run the downstream compiler jobs that `generateOutput` left pending for
+        /// `requests` (see `CompileRequest::isInBatch`), all at once
+    void runDownstreamJobsForBatch(
+        List<CompileRequest*> const& requests);
+
+        /// Report the results of the downstream compiler jobs of `compileRequest`,
+        /// once they have been run, and write its output
+    void finishOutput(
+        CompileRequest* compileRequest);
+
     // Helper to dump intermediate output when debugging
     void maybeDumpIntermediate(
         CompileRequest* compileRequest,
@@ -503,6 +897,11 @@ namespace Slang
     class Session
     {
     public:
+        // The arenas that the standard library AST was allocated from.
+        // This comes first, so that it is destroyed after everything
+        // that might refer to the AST.
+        List<RefPtr<ASTArena>> builtinASTArenas;
+
         //
 
         RefPtr<Scope>   baseLanguageScope;
@@ -602,6 +1001,28 @@ namespace Slang
         void destroyTypeCheckingCache();
         //
 
+        // Which declarations are only checked the first time they are used
+        // (see `spSetLazyCheckingFlags`)
+        SlangLazyCheckingFlags lazyCheckingFlags = SLANG_LAZY_CHECKING_STDLIB;
+        void setLazyCheckingFlags(SlangLazyCheckingFlags flags);
+
+        // Cache of member lookup results (see `MemberLookupCache`)
+        MemberLookupCache memberLookupCache;
+
+        // Instances of each downstream compiler, indexed by `PassThroughMode`.
+        // They are kept for reuse by later compiles, and are shared by all of
+        // the threads that invoke downstream compilers for a compile.
+        DownstreamCompilerPool downstreamCompilerPools[SLANG_PASS_THROUGH_GLSLANG + 1];
+        DownstreamCompilerPool* getDownstreamCompilerPool(PassThroughMode kind) { return &downstreamCompilerPools[int(kind)]; }
+
+        // How many threads may invoke downstream compilers at once
+        // (see `spSetDownstreamCompilerThreadCount`)
+        int downstreamCompilerThreadCount = 0;
+
+        // Output produced by downstream compilers, kept for reuse
+        // (see `spSetDownstreamOutputCacheDirectory`)
+        DownstreamOutputCache downstreamOutputCache;
+
         Session();
 
         void addBuiltinSource(
@@ -68,6 +68,12 @@ SYNTAX_CLASS(ExtensionDecl, AggTypeDeclBase)
 
     // next extension attached to the same nominal type
     DECL_FIELD(ExtensionDecl*, nextCandidateExtension RAW(= nullptr))
+
+    RAW(
+    // The type this extension is attached to, if it is declared in
+    // another module (and that module hasn't been destroyed yet).
+    AggTypeDecl* externalTargetDecl = nullptr;
+    )
 END_SYNTAX_CLASS()
 
 // Declaration of a type that represents some sort of aggregate
@@ -211,6 +217,44 @@ SIMPLE_SYNTAX_CLASS(Variable, VarDeclBase);
 // that provides a scope for some number of declarations.
 SYNTAX_CLASS(ModuleDecl, ContainerDecl)
     FIELD(RefPtr<Scope>, scope)
+
+    // If set, global functions in this module are only checked
+    // on demand (when lookup or IR lowering first reaches them),
+    // rather than all up front when the module is checked.
+    FIELD_INIT(bool, isCheckedLazily, false)
+
+    // Set when a declaration that is checked on demand has been checked
+    // since IR was generated for the module, so that the IR doesn't
+    // include it yet.
+    FIELD_INIT(bool, isIROutOfDate, false)
+
+    RAW(
+    // The diagnostics produced by checking declarations on demand, for
+    // those declarations that produced any (see `checkLazyDecl`).
+    Dictionary<Decl*, LazyDeclDiagnostics> lazyDeclDiagnostics;
+
+    // Declarations that are checked on demand and are being checked now.
+    List<Decl*> lazyDeclsBeingChecked;
+
+    // The member lookup cache that holds results depending on
+    // declarations in this module, if any. Those results are
+    // discarded when the module is destroyed.
+    MemberLookupCache* memberLookupCache = nullptr;
+
+    // Extensions declared in this module that are attached to types in
+    // other modules, and extensions declared in other modules that are
+    // attached to types in this one. Whichever module is destroyed first
+    // detaches the extensions, so that a long-lived module (such as the
+    // standard library) never refers to the extensions of a dead one.
+    List<ExtensionDecl*> outgoingExtensions;
+    List<ExtensionDecl*> incomingExtensions;
+
+    // The arena the syntax of this module was allocated from, if any
+    // (see `SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST`)
+    ASTArena* astArena = nullptr;
+
+    ~ModuleDecl();
+    )
 END_SYNTAX_CLASS()
 
 SYNTAX_CLASS(ImportDecl, Decl)
@@ -74,6 +74,7 @@ DIAGNOSTIC(    18, Error, noProfileSpecified, "no profile specified; use the '-p
 DIAGNOSTIC(    19, Error, multipleEntryPointsNeedMulitpleProfiles, "when multiple entry points are specified, each must have a profile given (with '-profile') before the '-entry' option");
 DIAGNOSTIC(    20, Error, multipleTranslationUnitsNeedEntryPoints, "when using multiple translation units, entry points must be specified after their translation unit file(s)");
 DIAGNOSTIC(    21, Error, expectedArgumentForOption, "expected an argument for command-line option '$0'");
+DIAGNOSTIC(    22, Error, downstreamCompilerNotAvailable, "the downstream compiler '$0' is not available");
 
 //
 // 1xxxx - Lexical anaylsis
@@ -396,6 +397,7 @@ DIAGNOSTIC(51091, Error, typeCannotBePlacedInATexture, "type '$0' cannot be plac
 DIAGNOSTIC(51092, Error, stageDoesntHaveInputWorld, "'$0' doesn't appear to have any input world");
 
 DIAGNOSTIC(52000, Error, multiLevelBreakUnsupported, "control flow appears to require multi-level `break`, which Slang does not yet support");
+DIAGNOSTIC(52001, Note, spirvDirectEmissionFallback, "generating SPIR-V for entry point '$0' through GLSL, because direct SPIR-V emission doesn't support a $1 it uses yet");
 
 
 // 99999 - Internal compiler errors, and not-yet-classified diagnostics.
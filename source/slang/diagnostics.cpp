@@ -200,6 +200,7 @@ void DiagnosticSink::diagnoseImpl(SourceLoc const& pos, DiagnosticInfo const& in
     diagnostic.loc = pos;
     diagnostic.severity = info.severity;
 
+    diagnosticCount++;
     if (diagnostic.severity >= Severity::Error)
     {
         errorCount++;
@@ -232,6 +233,7 @@ void DiagnosticSink::diagnoseRaw(
     Severity    severity,
     char const* message)
 {
+    diagnosticCount++;
     if (severity >= Severity::Error)
     {
         errorCount++;
@@ -135,6 +135,7 @@ namespace Slang
         StringBuilder outputBuffer;
 //            List<Diagnostic> diagnostics;
         int errorCount = 0;
+        int diagnosticCount = 0;
 
         SlangDiagnosticCallback callback            = nullptr;
         void*                   callbackUserData    = nullptr;
@@ -152,6 +153,7 @@ namespace Slang
         }
 */
         int GetErrorCount() { return errorCount; }
+        int getDiagnosticCount() { return diagnosticCount; }
 
         void diagnoseDispatch(SourceLoc const& pos, DiagnosticInfo const& info)
         {
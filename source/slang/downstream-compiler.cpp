@@ -0,0 +1,670 @@
+// downstream-compiler.cpp
+#include "downstream-compiler.h"
+
+#include "../core/platform.h"
+#include "../core/slang-io.h"
+#include "compiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// Enable calling through to `fxc` on Windows.
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+    #undef WIN32_LEAN_AND_MEAN
+    #undef NOMINMAX
+    #include <d3dcompiler.h>
+    #ifndef SLANG_ENABLE_DXBC_SUPPORT
+        #define SLANG_ENABLE_DXBC_SUPPORT 1
+    #endif
+#endif
+//
+#ifndef SLANG_ENABLE_DXBC_SUPPORT
+    #define SLANG_ENABLE_DXBC_SUPPORT 0
+#endif
+
+// Enable calling through to `glslang` on
+// all platforms.
+#ifndef SLANG_ENABLE_GLSLANG_SUPPORT
+    #define SLANG_ENABLE_GLSLANG_SUPPORT 1
+#endif
+
+#if SLANG_ENABLE_GLSLANG_SUPPORT
+#include "../slang-glslang/slang-glslang.h"
+#endif
+
+namespace Slang
+{
+    static const Guid IID_ISlangUnknown             = SLANG_UUID_ISlangUnknown;
+    static const Guid IID_ISlangDownstreamCompiler  = SLANG_UUID_ISlangDownstreamCompiler;
+
+    char const* getDownstreamCompilerName(PassThroughMode kind)
+    {
+        switch (kind)
+        {
+        case PassThroughMode::fxc:      return "fxc";
+        case PassThroughMode::dxc:      return "dxc";
+        case PassThroughMode::glslang:  return "glslang";
+        default:                        return "unknown";
+        }
+    }
+
+    char const* getDownstreamCompilerLibraryName(PassThroughMode kind)
+    {
+        switch (kind)
+        {
+        case PassThroughMode::fxc:      return "d3dcompiler_47";
+        case PassThroughMode::dxc:      return "dxcompiler";
+        case PassThroughMode::glslang:  return "slang-glslang";
+        default:                        return nullptr;
+        }
+    }
+
+    void diagnoseUnavailableDownstreamCompiler(
+        DiagnosticSink*         sink,
+        DownstreamCompilerPool* pool,
+        SlangResult             result)
+    {
+        if (pool->isBuiltin() && result == SlangResult(SLANG_E_CANNOT_OPEN))
+        {
+            sink->diagnose(SourceLoc(), Diagnostics::failedToLoadDynamicLibrary, getDownstreamCompilerLibraryName(pool->kind));
+        }
+        else
+        {
+            sink->diagnose(SourceLoc(), Diagnostics::downstreamCompilerNotAvailable, getDownstreamCompilerName(pool->kind));
+        }
+    }
+
+    SlangResult createBuiltinDownstreamCompiler(
+        PassThroughMode             kind,
+        ISlangDownstreamCompiler**  outCompiler)
+    {
+        switch (kind)
+        {
+        case PassThroughMode::fxc:      return createFXCDownstreamCompiler(outCompiler);
+        case PassThroughMode::dxc:      return createDXCDownstreamCompiler(outCompiler);
+        case PassThroughMode::glslang:  return createGlslangDownstreamCompiler(outCompiler);
+        default:                        return SLANG_E_NOT_IMPLEMENTED;
+        }
+    }
+
+    DownstreamOutputKey getLibraryIdentity(void const* address)
+    {
+        DownstreamOutputKey identity;
+        String path = SharedLibrary::getPathContaining(address);
+        uint64_t size = 0;
+        uint64_t modificationTime = 0;
+        if (path.Length() == 0 || !File::GetSizeAndModificationTime(path, size, modificationTime))
+            return identity;
+
+        identity.addText(path);
+        identity.addValue(size);
+        identity.addValue(modificationTime);
+        return identity;
+    }
+
+    DownstreamOutputKey getSlangIdentity()
+    {
+        // The identities are only worked out once per process (and keys, unlike
+        // strings, can be copied on several threads at once)
+        static const DownstreamOutputKey identity = getLibraryIdentity((void const*) &getSlangIdentity);
+        return identity;
+    }
+
+    DownstreamOutputKey getBuiltinDownstreamCompilerIdentity(PassThroughMode kind)
+    {
+        switch (kind)
+        {
+        case PassThroughMode::fxc:      return getFXCDownstreamCompilerIdentity();
+        case PassThroughMode::dxc:      return getDXCDownstreamCompilerIdentity();
+        case PassThroughMode::glslang:  return getGlslangDownstreamCompilerIdentity();
+        default:                        return DownstreamOutputKey();
+        }
+    }
+
+    // DownstreamCompilerPool
+
+    SlangResult DownstreamCompilerPool::checkOut(ComPtr<ISlangDownstreamCompiler>& outCompiler)
+    {
+        SlangCreateDownstreamCompilerFunc func;
+        void* userData;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto idleCount = idleCompilers.Count();
+            if (idleCount)
+            {
+                outCompiler = _Move(idleCompilers[idleCount - 1]);
+                idleCompilers.RemoveAt(idleCount - 1);
+                return SLANG_OK;
+            }
+
+            func = createFunc;
+            userData = createUserData;
+        }
+
+        // Creating an instance may take a while (e.g., to load a library),
+        // so other threads are free to use the pool in the meantime.
+        SlangResult result = func
+            ? func(SlangPassThrough(kind), userData, outCompiler.writeRef())
+            : createBuiltinDownstreamCompiler(kind, outCompiler.writeRef());
+        if (SLANG_SUCCEEDED(result) && !outCompiler)
+            result = SLANG_FAIL;
+        return result;
+    }
+
+    void DownstreamCompilerPool::checkIn(ComPtr<ISlangDownstreamCompiler>& compiler)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        idleCompilers.Add(_Move(compiler));
+    }
+
+    void DownstreamCompilerPool::setFactory(
+        SlangCreateDownstreamCompilerFunc   func,
+        void*                               userData,
+        char const*                         identity)
+    {
+        DownstreamOutputKey identityKey;
+        if (func && identity)
+        {
+            // Keep a factory's identity apart from that of any built-in compiler
+            identityKey.addText("factory");
+            identityKey.addText(identity);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        createFunc = func;
+        createUserData = userData;
+        createIdentity = identityKey;
+        idleCompilers = List<ComPtr<ISlangDownstreamCompiler>>();
+    }
+
+    DownstreamOutputKey DownstreamCompilerPool::getIdentity()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (createFunc)
+                return createIdentity;
+        }
+        return getBuiltinDownstreamCompilerIdentity(kind);
+    }
+
+    // DownstreamOutputKey
+
+    void DownstreamOutputKey::addBytes(void const* data, size_t size)
+    {
+        // The first hash is FNV-1a, and the second multiplies by
+        // the 64-bit golden ratio, with a rotation between bytes
+        uint64_t hash0 = hashes[0] ? hashes[0] : 14695981039346656037ULL;
+        uint64_t hash1 = hashes[1] ? hashes[1] : 0x2545F4914F6CDD1DULL;
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            uint8_t byte = ((uint8_t const*) data)[ii];
+            hash0 = (hash0 ^ byte) * 1099511628211ULL;
+            hash1 = (((hash1 << 5) | (hash1 >> 59)) ^ byte) * 0x9E3779B97F4A7C15ULL;
+        }
+        hashes[0] = hash0;
+        hashes[1] = hash1;
+    }
+
+    void DownstreamOutputKey::addValue(uint64_t value)
+    {
+        uint8_t bytes[sizeof(value)];
+        for (size_t ii = 0; ii < sizeof(value); ++ii)
+        {
+            bytes[ii] = uint8_t(value >> (ii * 8));
+        }
+        addBytes(bytes, sizeof(bytes));
+    }
+
+    void DownstreamOutputKey::addText(String const& text)
+    {
+        // The length goes first, so that the boundary between
+        // texts added one after another is part of the key
+        addValue(text.Length());
+        addBytes(text.Buffer(), text.Length());
+    }
+
+    void DownstreamOutputKey::addKey(DownstreamOutputKey const& key)
+    {
+        addValue(key.hashes[0]);
+        addValue(key.hashes[1]);
+    }
+
+    String DownstreamOutputKey::toString() const
+    {
+        static const char kHexDigits[] = "0123456789abcdef";
+
+        StringBuilder sb;
+        for (auto hash : hashes)
+        {
+            for (int shift = 60; shift >= 0; shift -= 4)
+            {
+                sb.Append(kHexDigits[(hash >> shift) & 0xF]);
+            }
+        }
+        return sb.ProduceString();
+    }
+
+    // DownstreamOutputCache
+
+    // The header of a file holding a cached output, which is followed by the output
+    struct DownstreamOutputFileHeader
+    {
+        enum : uint32_t
+        {
+            kMagic = 0x43444C53,    // "SLDC"
+            kVersion = 1,
+        };
+
+        uint32_t magic;
+        uint32_t version;
+        uint64_t hashes[2];
+        uint64_t outputSize;
+    };
+
+    bool DownstreamOutputCache::tryGetOutput(DownstreamOutputKey const& key, bool canUseDirectory, List<uint8_t>& outOutput)
+    {
+        String path;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (auto output = memoryOutputs.TryGetValue(key))
+            {
+                outOutput = *output;
+                return true;
+            }
+            if (!canUseDirectory || directory.Length() == 0)
+                return false;
+            path = getPathForKey(key);
+        }
+
+        FILE* file = fopen(path.Buffer(), "rb");
+        if (!file)
+            return false;
+
+        // A file that is incomplete, or was written by another version
+        // of Slang, is treated as missing (and is replaced once the
+        // output has been produced again).
+        DownstreamOutputFileHeader header;
+        bool isValid = fread(&header, sizeof(header), 1, file) == 1
+            && header.magic == DownstreamOutputFileHeader::kMagic
+            && header.version == DownstreamOutputFileHeader::kVersion
+            && header.hashes[0] == key.hashes[0]
+            && header.hashes[1] == key.hashes[1];
+        if (isValid)
+        {
+            List<uint8_t> output;
+            output.SetSize(UInt(header.outputSize));
+            isValid = header.outputSize == 0
+                || fread(output.Buffer(), size_t(header.outputSize), 1, file) == 1;
+            if (isValid)
+            {
+                outOutput = _Move(output);
+            }
+        }
+        fclose(file);
+
+        if (isValid)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            addOutputToMemory(key, outOutput);
+        }
+        return isValid;
+    }
+
+    void DownstreamOutputCache::addOutput(DownstreamOutputKey const& key, bool canUseDirectory, List<uint8_t> const& output)
+    {
+        String path;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            addOutputToMemory(key, output);
+            if (!canUseDirectory || directory.Length() == 0)
+                return;
+            path = getPathForKey(key);
+        }
+
+        // The output is written to a file of its own and then moved into place,
+        // so that other threads and processes never see part of a file. If another
+        // one got there first, its output is the same as ours, and is kept.
+        static std::atomic<uint32_t> counter(0);
+        StringBuilder tempPathBuilder;
+        tempPathBuilder << path << "." << UInt(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        tempPathBuilder << "." << UInt(std::chrono::steady_clock::now().time_since_epoch().count());
+        tempPathBuilder << "." << UInt(counter++) << ".tmp";
+        String tempPath = tempPathBuilder.ProduceString();
+
+        FILE* file = fopen(tempPath.Buffer(), "wb");
+        if (!file)
+            return;
+
+        DownstreamOutputFileHeader header;
+        header.magic = DownstreamOutputFileHeader::kMagic;
+        header.version = DownstreamOutputFileHeader::kVersion;
+        header.hashes[0] = key.hashes[0];
+        header.hashes[1] = key.hashes[1];
+        header.outputSize = output.Count();
+        bool wasWritten = fwrite(&header, sizeof(header), 1, file) == 1
+            && (output.Count() == 0 || fwrite(output.Buffer(), output.Count(), 1, file) == 1);
+        wasWritten = (fclose(file) == 0) && wasWritten;
+
+        if (!wasWritten || rename(tempPath.Buffer(), path.Buffer()) != 0)
+        {
+            remove(tempPath.Buffer());
+        }
+    }
+
+    void DownstreamOutputCache::setDirectory(String const& path)
+    {
+        // The directory is created if need be (although not its parents)
+        if (path.Length())
+            Path::CreateDir(path);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        directory = path;
+    }
+
+    void DownstreamOutputCache::setMemoryLimit(size_t limit)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        memoryLimit = limit;
+        dropOldestOutputs(0);
+    }
+
+    void DownstreamOutputCache::clearMemory()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        memoryOutputs.Clear();
+        memoryKeys.Clear();
+        oldestKeyIndex = 0;
+        memoryUsed = 0;
+    }
+
+    String DownstreamOutputCache::getPathForKey(DownstreamOutputKey const& key)
+    {
+        return Path::Combine(directory, key.toString() + ".bin");
+    }
+
+    void DownstreamOutputCache::addOutputToMemory(DownstreamOutputKey const& key, List<uint8_t> const& output)
+    {
+        if (output.Count() > memoryLimit || memoryOutputs.ContainsKey(key))
+            return;
+
+        dropOldestOutputs(output.Count());
+
+        memoryOutputs[key] = output;
+        memoryKeys.Add(key);
+        memoryUsed += output.Count();
+    }
+
+    void DownstreamOutputCache::dropOldestOutputs(size_t sizeNeeded)
+    {
+        while (memoryUsed + sizeNeeded > memoryLimit)
+        {
+            auto oldestKey = memoryKeys[oldestKeyIndex++];
+            memoryUsed -= memoryOutputs[oldestKey].GetValue().Count();
+            memoryOutputs.Remove(oldestKey);
+        }
+
+        // Only compact the list of keys once most of it has been dropped
+        if (oldestKeyIndex > memoryKeys.Count() / 2)
+        {
+            memoryKeys.RemoveRange(0, oldestKeyIndex);
+            oldestKeyIndex = 0;
+        }
+    }
+
+    // DownstreamCompilerBase
+
+    ISlangUnknown* DownstreamCompilerBase::getInterface(const Guid& guid)
+    {
+        return (guid == IID_ISlangUnknown || guid == IID_ISlangDownstreamCompiler) ? static_cast<ISlangDownstreamCompiler*>(this) : nullptr;
+    }
+
+#if SLANG_ENABLE_DXBC_SUPPORT
+
+    // The `ISlangBlob` interface is compatible with `ID3DBlob`, so the
+    // blobs that `fxc` creates can be handed back as they are.
+
+    class FXCDownstreamCompiler : public DownstreamCompilerBase
+    {
+    public:
+        pD3DCompile     m_compile = nullptr;
+        pD3DDisassemble m_disassemble = nullptr;
+
+        SLANG_NO_THROW SlangResult SLANG_MCALL compile(
+            SlangDownstreamCompileDesc const*   desc,
+            ISlangBlob**                        outCode,
+            ISlangBlob**                        outDiagnostics) SLANG_OVERRIDE
+        {
+            List<D3D_SHADER_MACRO> dxMacrosStorage;
+            D3D_SHADER_MACRO const* dxMacros = nullptr;
+            if (desc->defineCount)
+            {
+                for (int ii = 0; ii < desc->defineCount; ++ii)
+                {
+                    D3D_SHADER_MACRO dxMacro;
+                    dxMacro.Name = desc->defineNames[ii];
+                    dxMacro.Definition = desc->defineValues[ii];
+                    dxMacrosStorage.Add(dxMacro);
+                }
+                D3D_SHADER_MACRO nullTerminator = { 0, 0 };
+                dxMacrosStorage.Add(nullTerminator);
+
+                dxMacros = dxMacrosStorage.Buffer();
+            }
+
+            ID3DBlob* codeBlob = nullptr;
+            ID3DBlob* diagnosticsBlob = nullptr;
+            HRESULT hr = m_compile(
+                desc->source,
+                desc->sourceSize,
+                desc->sourcePath,
+                dxMacros,
+                nullptr,
+                desc->entryPointName,
+                desc->profileName,
+                0,
+                0,
+                &codeBlob,
+                &diagnosticsBlob);
+
+            *outCode = (ISlangBlob*) codeBlob;
+            if (outDiagnostics)
+                *outDiagnostics = (ISlangBlob*) diagnosticsBlob;
+            else if (diagnosticsBlob)
+                diagnosticsBlob->Release();
+            return hr;
+        }
+
+        SLANG_NO_THROW SlangResult SLANG_MCALL disassemble(
+            SlangCompileTarget,
+            void const*         code,
+            size_t              codeSize,
+            ISlangBlob**        outAssembly) SLANG_OVERRIDE
+        {
+            ID3DBlob* codeBlob = nullptr;
+            HRESULT hr = m_disassemble(code, codeSize, 0, nullptr, &codeBlob);
+            if (codeBlob)
+            {
+                // The disassembly is null-terminated, which we don't want to include
+                char const* codeBegin = (char const*)codeBlob->GetBufferPointer();
+                char const* codeEnd = codeBegin + codeBlob->GetBufferSize() - 1;
+                *outAssembly = createStringBlob(UnownedStringSlice(codeBegin, codeEnd)).detach();
+                codeBlob->Release();
+            }
+            return hr;
+        }
+    };
+
+    // The library is loaded once per process
+    static HMODULE getD3DCompilerLibrary()
+    {
+        // TODO(tfoley): let user specify version of d3dcompiler DLL to use.
+        static HMODULE d3dCompiler = LoadLibraryA(getDownstreamCompilerLibraryName(PassThroughMode::fxc));
+        return d3dCompiler;
+    }
+
+    DownstreamOutputKey getFXCDownstreamCompilerIdentity()
+    {
+        static const DownstreamOutputKey identity = getD3DCompilerLibrary()
+            ? getLibraryIdentity((void const*) GetProcAddress(getD3DCompilerLibrary(), "D3DCompile"))
+            : DownstreamOutputKey();
+        return identity;
+    }
+
+    SlangResult createFXCDownstreamCompiler(ISlangDownstreamCompiler** outCompiler)
+    {
+        HMODULE d3dCompiler = getD3DCompilerLibrary();
+        if (!d3dCompiler)
+            return SLANG_E_CANNOT_OPEN;
+
+        static const pD3DCompile D3DCompile_ = (pD3DCompile)GetProcAddress(d3dCompiler, "D3DCompile");
+        static const pD3DDisassemble D3DDisassemble_ = (pD3DDisassemble)GetProcAddress(d3dCompiler, "D3DDisassemble");
+        if (!D3DCompile_ || !D3DDisassemble_)
+            return SLANG_FAIL;
+
+        FXCDownstreamCompiler* compiler = new FXCDownstreamCompiler();
+        compiler->m_compile = D3DCompile_;
+        compiler->m_disassemble = D3DDisassemble_;
+        compiler->addRef();
+
+        *outCompiler = compiler;
+        return SLANG_OK;
+    }
+
+#else
+
+    SlangResult createFXCDownstreamCompiler(ISlangDownstreamCompiler**)
+    {
+        return SLANG_E_NOT_IMPLEMENTED;
+    }
+
+    DownstreamOutputKey getFXCDownstreamCompilerIdentity()
+    {
+        return DownstreamOutputKey();
+    }
+
+#endif
+
+#if SLANG_ENABLE_GLSLANG_SUPPORT
+
+    class GlslangDownstreamCompiler : public DownstreamCompilerBase
+    {
+    public:
+        glslang_CompileFunc m_compile = nullptr;
+
+        SLANG_NO_THROW SlangResult SLANG_MCALL compile(
+            SlangDownstreamCompileDesc const*   desc,
+            ISlangBlob**                        outCode,
+            ISlangBlob**                        outDiagnostics) SLANG_OVERRIDE
+        {
+            glslang_CompileRequest request;
+            request.action = GLSLANG_ACTION_COMPILE_GLSL_TO_SPIRV;
+            request.sourcePath = desc->sourcePath;
+            request.slangStage = desc->stage;
+
+            request.inputBegin  = desc->source;
+            request.inputEnd    = (char const*)desc->source + desc->sourceSize;
+
+            return invoke(request, outCode, outDiagnostics);
+        }
+
+        SLANG_NO_THROW SlangResult SLANG_MCALL disassemble(
+            SlangCompileTarget,
+            void const*         code,
+            size_t              codeSize,
+            ISlangBlob**        outAssembly) SLANG_OVERRIDE
+        {
+            glslang_CompileRequest request;
+            request.action = GLSLANG_ACTION_DISSASSEMBLE_SPIRV;
+            request.sourcePath = nullptr;
+
+            request.inputBegin  = code;
+            request.inputEnd    = (char const*)code + codeSize;
+
+            return invoke(request, outAssembly, nullptr);
+        }
+
+        SlangResult invoke(
+            glslang_CompileRequest& request,
+            ISlangBlob**            outOutput,
+            ISlangBlob**            outDiagnostics)
+        {
+            List<uint8_t> output;
+            request.outputFunc = [](void const* data, size_t size, void* userData)
+            {
+                ((List<uint8_t>*)userData)->AddRange((uint8_t*)data, size);
+            };
+            request.outputUserData = &output;
+
+            String diagnosticOutput;
+            request.diagnosticFunc = [](void const* data, size_t size, void* userData)
+            {
+                (*(String*)userData).append((char const*)data, (char const*)data + size);
+            };
+            request.diagnosticUserData = &diagnosticOutput;
+
+            int err = m_compile(&request);
+
+            *outOutput = createRawBlob(output.Buffer(), output.Count()).detach();
+            if (outDiagnostics)
+                *outDiagnostics = createStringBlob(diagnosticOutput).detach();
+            return err ? SLANG_FAIL : SLANG_OK;
+        }
+    };
+
+    // The library is loaded once per process. Function-local statics are
+    // initialized thread-safely, so instances being created on several
+    // threads don't race to set them.
+    static SharedLibrary& getGlslangLibrary()
+    {
+        // TODO(tfoley): let user specify version of glslang DLL to use.
+        static SharedLibrary glslCompiler = SharedLibrary::load(getDownstreamCompilerLibraryName(PassThroughMode::glslang));
+        return glslCompiler;
+    }
+
+    DownstreamOutputKey getGlslangDownstreamCompilerIdentity()
+    {
+        static const DownstreamOutputKey identity = getGlslangLibrary()
+            ? getLibraryIdentity((void const*) getGlslangLibrary().findFuncByName("glslang_compile"))
+            : DownstreamOutputKey();
+        return identity;
+    }
+
+    SlangResult createGlslangDownstreamCompiler(ISlangDownstreamCompiler** outCompiler)
+    {
+        // The entry point is looked up once per process, too
+        SharedLibrary& glslCompiler = getGlslangLibrary();
+        if (!glslCompiler)
+            return SLANG_E_CANNOT_OPEN;
+
+        static const glslang_CompileFunc glslang_compile =
+            (glslang_CompileFunc) glslCompiler.findFuncByName("glslang_compile");
+        if (!glslang_compile)
+            return SLANG_FAIL;
+
+        GlslangDownstreamCompiler* compiler = new GlslangDownstreamCompiler();
+        compiler->m_compile = glslang_compile;
+        compiler->addRef();
+
+        *outCompiler = compiler;
+        return SLANG_OK;
+    }
+
+#else
+
+    SlangResult createGlslangDownstreamCompiler(ISlangDownstreamCompiler**)
+    {
+        return SLANG_E_NOT_IMPLEMENTED;
+    }
+
+    DownstreamOutputKey getGlslangDownstreamCompilerIdentity()
+    {
+        return DownstreamOutputKey();
+    }
+
+#endif
+}
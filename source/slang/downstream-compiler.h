@@ -0,0 +1,247 @@
+// downstream-compiler.h
+#pragma once
+
+#include "../core/basic.h"
+#include "../../slang-com-helper.h"
+#include "../../slang-com-ptr.h"
+#include "../../slang.h"
+
+#include <mutex>
+
+namespace Slang
+{
+    class DiagnosticSink;
+    class DownstreamCompilerPool;
+    enum class PassThroughMode : SlangPassThrough;
+
+    /// Identifies the output of a downstream compiler: a hash of everything
+    /// the output depends on (the source or code passed to the compiler, the
+    /// compiler and the options it was invoked with).
+    ///
+    /// The hash is 128 bits, made up of two independent 64-bit hashes, so that
+    /// (unlike the hashes used for `Dictionary` keys) a collision is not
+    /// something that can happen in practice.
+    ///
+    struct DownstreamOutputKey
+    {
+        uint64_t hashes[2] = { 0, 0 };
+
+        /// Mix `size` bytes at `data` into the key.
+        void addBytes(void const* data, size_t size);
+
+        /// Mix `value` (or `text`, including its length, or another key) into the key.
+        void addValue(uint64_t value);
+        void addText(String const& text);
+        void addKey(DownstreamOutputKey const& key);
+
+        /// Is this the empty key, which nothing has been mixed into?
+        bool isEmpty() const { return hashes[0] == 0 && hashes[1] == 0; }
+
+        /// Get the key as text, e.g., to name a file after it.
+        String toString() const;
+
+        int GetHashCode() const { return int(hashes[0] ^ (hashes[0] >> 32)); }
+        bool operator==(DownstreamOutputKey const& other) const
+        {
+            return hashes[0] == other.hashes[0] && hashes[1] == other.hashes[1];
+        }
+    };
+
+    /// Get the name of a downstream compiler, for use in diagnostics.
+    char const* getDownstreamCompilerName(PassThroughMode kind);
+
+    /// Get the name of the library that implements a built-in downstream compiler.
+    char const* getDownstreamCompilerLibraryName(PassThroughMode kind);
+
+    /// Report that an instance of the compiler in `pool` couldn't be created,
+    /// where `result` is what creating it returned.
+    void diagnoseUnavailableDownstreamCompiler(
+        DiagnosticSink*         sink,
+        DownstreamCompilerPool* pool,
+        SlangResult             result);
+
+    /// Create an instance of one of the downstream compilers built into Slang.
+    ///
+    /// Returns `SLANG_E_NOT_IMPLEMENTED` if support for the compiler isn't
+    /// available on this platform, and `SLANG_E_CANNOT_OPEN` if the library
+    /// that implements it couldn't be loaded.
+    ///
+    SlangResult createBuiltinDownstreamCompiler(
+        PassThroughMode             kind,
+        ISlangDownstreamCompiler**  outCompiler);
+
+    // Implementations of the built-in compilers, which return
+    // `SLANG_E_NOT_IMPLEMENTED` when support for them is compiled out.
+    SlangResult createFXCDownstreamCompiler(ISlangDownstreamCompiler** outCompiler);
+    SlangResult createDXCDownstreamCompiler(ISlangDownstreamCompiler** outCompiler);
+    SlangResult createGlslangDownstreamCompiler(ISlangDownstreamCompiler** outCompiler);
+
+    /// Get a key that identifies the library (or executable) containing `address`,
+    /// made from its path, size and modification time, so that it changes when the
+    /// library is replaced. The key is empty if the library's file can't be found.
+    DownstreamOutputKey getLibraryIdentity(void const* address);
+
+    /// Get a key that identifies this build of Slang (see `getLibraryIdentity`).
+    DownstreamOutputKey getSlangIdentity();
+
+    /// Get a key that identifies the library that implements a built-in downstream
+    /// compiler (see `getLibraryIdentity`), loading it if need be. The key is empty if
+    /// the compiler isn't available.
+    DownstreamOutputKey getBuiltinDownstreamCompilerIdentity(PassThroughMode kind);
+
+    // The identities of the built-in compilers, which are empty when support
+    // for them is compiled out.
+    DownstreamOutputKey getFXCDownstreamCompilerIdentity();
+    DownstreamOutputKey getDXCDownstreamCompilerIdentity();
+    DownstreamOutputKey getGlslangDownstreamCompilerIdentity();
+
+    /// The instances of a downstream compiler that a `Session` has created.
+    ///
+    /// A thread that needs to invoke the compiler checks an instance out
+    /// of the pool, and checks it back in once it is done with it, so that
+    /// each instance is used by one thread at a time, and any state it has
+    /// set up (e.g., the COM objects `dxc` needs) is reused across compiles.
+    /// Checking instances in and out is thread-safe.
+    ///
+    class DownstreamCompilerPool
+    {
+    public:
+        /// Take an idle instance out of the pool, or create a new one if there
+        /// are none. On failure, returns the result of creating the instance.
+        SlangResult checkOut(ComPtr<ISlangDownstreamCompiler>& outCompiler);
+
+        /// Return an instance to the pool, once the caller is done with it.
+        /// The caller's reference is moved into the pool (leaving `compiler` null),
+        /// so the instance's reference count only changes with the pool locked.
+        void checkIn(ComPtr<ISlangDownstreamCompiler>& compiler);
+
+        /// Use `createFunc` to create instances (or the built-in compiler, if it
+        /// is null), and release any instances that have already been created.
+        /// `identity` identifies the compiler that `createFunc` creates instances
+        /// of (see `getIdentity`), and may be null.
+        void setFactory(
+            SlangCreateDownstreamCompilerFunc   createFunc,
+            void*                               userData,
+            char const*                         identity);
+
+        /// Is the pool creating instances of the compiler built into Slang?
+        bool isBuiltin() { return createFunc == nullptr; }
+
+        /// Get a key that identifies the compiler this pool creates instances of,
+        /// which is part of the key for each of its outputs. The key is empty if
+        /// the compiler can't be identified (the built-in compiler isn't available,
+        /// or a factory was set without an identity), in which case its outputs
+        /// can't be told apart from those of another compiler, and mustn't be kept
+        /// beyond the session.
+        DownstreamOutputKey getIdentity();
+
+        /// The downstream compiler this pool holds instances of.
+        PassThroughMode kind;
+
+    private:
+        SlangCreateDownstreamCompilerFunc   createFunc = nullptr;
+        void*                               createUserData = nullptr;
+        DownstreamOutputKey                 createIdentity;
+
+        // Instances that aren't checked out by any thread.
+        //
+        // Instances aren't required to count references atomically (the ones
+        // built into Slang don't), so references are only ever moved in and
+        // out of this list, and never added or released by a thread that
+        // doesn't hold `mutex` while another thread might be using them.
+        List<ComPtr<ISlangDownstreamCompiler>> idleCompilers;
+
+        // Protects `idleCompilers`, and the factory
+        std::mutex mutex;
+    };
+
+    /// An instance of a downstream compiler, checked out of a pool for the
+    /// lifetime of this object.
+    struct DownstreamCompilerScope
+    {
+        DownstreamCompilerScope(DownstreamCompilerPool* pool)
+            : pool(pool)
+        {
+            result = pool->checkOut(compiler);
+        }
+
+        ~DownstreamCompilerScope()
+        {
+            if (compiler)
+                pool->checkIn(compiler);
+        }
+
+        DownstreamCompilerPool*             pool;
+        ComPtr<ISlangDownstreamCompiler>    compiler;
+        SlangResult                         result;
+    };
+
+    /// The outputs of downstream compilers that a `Session` has kept for reuse,
+    /// so that compiling identical code with identical options again doesn't
+    /// invoke the downstream compiler.
+    ///
+    /// Outputs are kept in memory (up to a limit, after which the oldest are
+    /// dropped), and also in files in a directory, if one has been set.
+    /// The directory can be shared between sessions and processes. Only
+    /// successful outputs are kept. All of the operations are thread-safe.
+    ///
+    class DownstreamOutputCache
+    {
+    public:
+        /// Look up the output for `key`, in memory and then (if `canUseDirectory`
+        /// is true) on disk.
+        bool tryGetOutput(DownstreamOutputKey const& key, bool canUseDirectory, List<uint8_t>& outOutput);
+
+        /// Keep `output` as the output for `key`, in memory and (if `canUseDirectory`
+        /// is true) on disk.
+        void addOutput(DownstreamOutputKey const& key, bool canUseDirectory, List<uint8_t> const& output);
+
+        /// Set the directory that outputs are kept in. An empty path
+        /// means outputs are only kept in memory.
+        void setDirectory(String const& path);
+
+        /// Set the number of bytes of output kept in memory. Zero means
+        /// outputs are not kept in memory.
+        void setMemoryLimit(size_t limit);
+
+        /// Drop the outputs kept in memory (e.g., because the compiler
+        /// that produced them has been replaced).
+        void clearMemory();
+
+    private:
+        String getPathForKey(DownstreamOutputKey const& key);
+        void addOutputToMemory(DownstreamOutputKey const& key, List<uint8_t> const& output);
+
+        // Drop the oldest outputs in memory until `sizeNeeded` more bytes fit
+        void dropOldestOutputs(size_t sizeNeeded);
+
+        Dictionary<DownstreamOutputKey, List<uint8_t>> memoryOutputs;
+
+        // The keys of `memoryOutputs`, oldest first, starting at `oldestKeyIndex`
+        List<DownstreamOutputKey> memoryKeys;
+        UInt oldestKeyIndex = 0;
+
+        size_t memoryUsed = 0;
+        size_t memoryLimit = 64 * 1024 * 1024;
+
+        String directory;
+
+        // Protects all of the above
+        std::mutex mutex;
+    };
+
+    /// Base class for the implementations of `ISlangDownstreamCompiler` built into Slang.
+    class DownstreamCompilerBase : public ISlangDownstreamCompiler
+    {
+    public:
+        uint32_t m_refCount = 0;
+
+        // ISlangUnknown
+        SLANG_IUNKNOWN_ALL
+
+        virtual ~DownstreamCompilerBase() {}
+
+    protected:
+        ISlangUnknown* getInterface(const Guid& guid);
+    };
+}
@@ -1,8 +1,15 @@
 // dxc-support.cpp
+#include "downstream-compiler.h"
+
 #include "compiler.h"
 
 // This file implements support for invoking the `dxcompiler`
 // library to translate HLSL to DXIL.
+//
+// On Windows we use the copy of `dxcapi.h` in `external/dxc`. Other
+// platforms can load `dxcompiler` as a shared library too, by building
+// with `SLANG_ENABLE_DXIL_SUPPORT=1` and the include path of the DXC SDK,
+// whose `dxcapi.h` declares the COM types it needs (via `WinAdapter.h`).
 
 #if defined(_WIN32)
 #  if !defined(SLANG_ENABLE_DXIL_SUPPORT)
@@ -16,6 +23,7 @@
 
 #if SLANG_ENABLE_DXIL_SUPPORT
 
+#if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <Windows.h>
@@ -23,273 +31,277 @@
 #include "../../external/dxc/dxcapi.h"
 #undef WIN32_LEAN_AND_MEAN
 #undef NOMINMAX
+#else
+#include <dxc/dxcapi.h>
+#endif
 
 #include "../core/platform.h"
 
+#include <stdio.h>
+
 namespace Slang
 {
-    char const* GetHLSLProfileName(Profile profile);
-    String emitHLSLForEntryPoint(
-        EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq);
-
-    SharedLibrary loadDXCSharedLibrary(CompileRequest* request)
+    // Append `text` to `ioStorage` as a null-terminated wide string,
+    // and return the index it starts at.
+    static UInt appendWideString(List<wchar_t>& ioStorage, char const* text)
     {
-        // TODO(tfoley): Let user specify name/path of library to use.
-        char const* libraryName = "dxcompiler";
-
-        SharedLibrary library = SharedLibrary::load(libraryName);
-        if (!library)
-        {
-            request->mSink.diagnose(SourceLoc(), Diagnostics::failedToLoadDynamicLibrary, libraryName);
-        }
-        return library;
+        UInt index = ioStorage.Count();
+        OSString wideText = String(text).ToWString();
+        ioStorage.AddRange(wideText.begin(), wideText.end() - wideText.begin());
+        ioStorage.Add(0);
+        return index;
     }
 
-    SharedLibrary getDXCSharedLibrary(CompileRequest* request)
+    // Copy the contents of a blob created by `dxc`. (`IDxcBlob` only has
+    // the same layout as `ISlangBlob` on Windows, so it can't be handed
+    // back as it is.)
+    static ISlangBlob* copyDXCBlob(IDxcBlob* dxcBlob)
     {
-        static SharedLibrary library =  loadDXCSharedLibrary(request);
-        return library;
+        return createRawBlob(dxcBlob->GetBufferPointer(), dxcBlob->GetBufferSize()).detach();
     }
 
-    int emitDXILForEntryPointUsingDXC(
-        EntryPointRequest*  entryPoint,
-        TargetRequest*      targetReq,
-        List<uint8_t>&      outCode)
+    // Is `profileName` (e.g., `ps_6_2`) for Shader Model 6.2 or later?
+    static bool isShaderModel6_2OrLater(char const* profileName)
     {
-        auto compileRequest = entryPoint->compileRequest;
+        int major = 0;
+        int minor = 0;
+        char const* version = strchr(profileName, '_');
+        if (!version || sscanf(version, "_%d_%d", &major, &minor) != 2)
+            return false;
+        return major > 6 || (major == 6 && minor >= 2);
+    }
 
-        // First deal with all the rigamarole of loading
-        // the `dxcompiler` library, and creating the
-        // top-level COM objects that will be used to
-        // compile things.
+    class DXCDownstreamCompiler : public DownstreamCompilerBase
+    {
+    public:
+        // The top-level COM objects are created once for each instance,
+        // and reused for every compile that it is checked out for.
+        IDxcCompiler*   m_compiler = nullptr;
+        IDxcLibrary*    m_library = nullptr;
 
-        static DxcCreateInstanceProc dxcCreateInstance = nullptr;
-        if (!dxcCreateInstance)
+        ~DXCDownstreamCompiler()
         {
-            auto dxcSharedLibrary = getDXCSharedLibrary(compileRequest);
-            if (!dxcSharedLibrary)
-                return 1;
-
-            dxcCreateInstance = (DxcCreateInstanceProc) dxcSharedLibrary.findFuncByName("DxcCreateInstance");
-            if (!dxcCreateInstance)
-                return 1;
+            if(m_library)   m_library   ->Release();
+            if(m_compiler)  m_compiler  ->Release();
         }
 
-        IDxcCompiler* dxcCompiler = nullptr;
-        if (FAILED(dxcCreateInstance(
-            CLSID_DxcCompiler,
-            __uuidof(dxcCompiler),
-            (LPVOID*) &dxcCompiler)))
+        SLANG_NO_THROW SlangResult SLANG_MCALL compile(
+            SlangDownstreamCompileDesc const*   desc,
+            ISlangBlob**                        outCode,
+            ISlangBlob**                        outDiagnostics) SLANG_OVERRIDE
         {
-            return 1;
-        }
+            // Create blob from the string
+            IDxcBlobEncoding* dxcSourceBlob = nullptr;
+            HRESULT hr = m_library->CreateBlobWithEncodingFromPinned(
+                (LPBYTE)desc->source,
+                (UINT32)desc->sourceSize,
+                0,
+                &dxcSourceBlob);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
 
-        IDxcLibrary* dxcLibrary = nullptr;
-        if (FAILED(dxcCreateInstance(
-            CLSID_DxcLibrary,
-            __uuidof(dxcLibrary),
-            (LPVOID*) &dxcLibrary)))
-        {
-            return 1;
-        }
+            WCHAR const* args[16];
+            UINT32 argCount = 0;
 
-        // Now let's go ahead and generate HLSL for the entry
-        // point, since we'll need that to feed into dxc.
-        auto hlslCode = emitHLSLForEntryPoint(entryPoint, targetReq);
-        maybeDumpIntermediate(entryPoint->compileRequest, hlslCode.Buffer(), CodeGenTarget::HLSL);
+            // TODO: deal with
+            bool treatWarningsAsErrors = false;
+            if (treatWarningsAsErrors)
+            {
+                args[argCount++] = L"-WX";
+            }
 
-        // Wrap the 
+            // We will enable the flag to generate proper code for 16-bit types
+            // by default, as long as the user is requesting a sufficiently
+            // high shader model.
+            //
+            // TODO: Need to check that this is safe to enable in all cases,
+            // or if it will make a shader demand hardware features that
+            // aren't always present.
+            //
+            // TODO: Ideally the dxc back-end should be passed some information
+            // on the "capabilities" that were used and/or requested in the code.
+            //
+            if (isShaderModel6_2OrLater(desc->profileName))
+            {
+                args[argCount++] = L"-enable-16bit-types";
+            }
 
-        // Create blob from the string
-        IDxcBlobEncoding* dxcSourceBlob = nullptr;
-        if (FAILED(dxcLibrary->CreateBlobWithEncodingFromPinned(
-            (LPBYTE)hlslCode.Buffer(),
-            (UINT32)hlslCode.Length(),
-            0,
-            &dxcSourceBlob)))
-        {
-            return 1;
-        }
+            // All of the strings that `dxc` needs are converted into one buffer,
+            // and only pointed into once it won't grow any more.
+            List<wchar_t> wideStrings;
+            UInt sourcePathIndex = appendWideString(wideStrings, desc->sourcePath);
+            UInt entryPointNameIndex = appendWideString(wideStrings, desc->stage == SLANG_STAGE_NONE ? "" : desc->entryPointName);
+            UInt profileNameIndex = appendWideString(wideStrings, desc->profileName);
 
-        WCHAR const* args[16];
-        UINT32 argCount = 0;
+            List<UInt> defineIndices;
+            for (int ii = 0; ii < desc->defineCount; ++ii)
+            {
+                defineIndices.Add(appendWideString(wideStrings, desc->defineNames[ii]));
+                defineIndices.Add(appendWideString(wideStrings, desc->defineValues[ii]));
+            }
 
-        // TODO: deal with
-        bool treatWarningsAsErrors = false;
-        if (treatWarningsAsErrors)
-        {
-            args[argCount++] = L"-WX";
-        }
+            List<DxcDefine> dxcDefines;
+            for (int ii = 0; ii < desc->defineCount; ++ii)
+            {
+                DxcDefine dxcDefine;
+                dxcDefine.Name = wideStrings.Buffer() + defineIndices[ii * 2];
+                dxcDefine.Value = wideStrings.Buffer() + defineIndices[ii * 2 + 1];
+                dxcDefines.Add(dxcDefine);
+            }
 
-        String entryPointName = getText(entryPoint->name);
-        OSString wideEntryPointName = entryPointName.ToWString();
-
-        auto profile = getEffectiveProfile(entryPoint, targetReq);
-        String profileName = GetHLSLProfileName(profile);
-        OSString wideProfileName = profileName.ToWString();
-
-        // We will enable the flag to generate proper code for 16-bit types
-        // by default, as long as the user is requesting a sufficiently
-        // high shader model.
-        //
-        // TODO: Need to check that this is safe to enable in all cases,
-        // or if it will make a shader demand hardware features that
-        // aren't always present.
-        //
-        // TODO: Ideally the dxc back-end should be passed some information
-        // on the "capabilities" that were used and/or requested in the code.
-        //
-        if( profile.GetVersion() >= ProfileVersion::DX_6_2 )
-        {
-            args[argCount++] = L"-enable-16bit-types";
-        }
+            IDxcOperationResult* dxcResult = nullptr;
+            hr = m_compiler->Compile(dxcSourceBlob,
+                wideStrings.Buffer() + sourcePathIndex,
+                wideStrings.Buffer() + entryPointNameIndex,
+                wideStrings.Buffer() + profileNameIndex,
+                args,
+                argCount,
+                dxcDefines.Buffer(),
+                (UINT32) dxcDefines.Count(),
+                nullptr,        // `#include` handler
+                &dxcResult);
+            dxcSourceBlob->Release();
+            if (FAILED(hr))
+            {
+                return hr;
+            }
 
-        IDxcOperationResult* dxcResult = nullptr;
-        if (FAILED(dxcCompiler->Compile(dxcSourceBlob,
-            L"slang",
-            profile.GetStage() == Stage::Unknown ? L"" : wideEntryPointName.begin(),
-            wideProfileName.begin(),
-            args,
-            argCount,
-            nullptr,        // `#define`s
-            0,              // `#define` count
-            nullptr,        // `#include` handler
-            &dxcResult)))
-        {
-            return 1;
-        }
+            // Retrieve result.
+            HRESULT resultCode = S_OK;
+            hr = dxcResult->GetStatus(&resultCode);
+            if (SUCCEEDED(hr) && FAILED(resultCode))
+            {
+                // Compilation failed.
+                hr = resultCode;
+
+                // Note: it seems like the dxcompiler interface
+                // doesn't support querying diagnostic output
+                // *unless* the compile failed (no way to get
+                // warnings out!?).
+                IDxcBlobEncoding* dxcErrorBlob = nullptr;
+                if (outDiagnostics && SUCCEEDED(dxcResult->GetErrorBuffer(&dxcErrorBlob)) && dxcErrorBlob)
+                {
+                    *outDiagnostics = copyDXCBlob(dxcErrorBlob);
+                    dxcErrorBlob->Release();
+                }
+            }
+            else if (SUCCEEDED(hr))
+            {
+                // Okay, the compile supposedly succeeded, so we
+                // just need to grab the buffer with the output DXIL.
+                IDxcBlob* dxcResultBlob = nullptr;
+                hr = dxcResult->GetResult(&dxcResultBlob);
+                if (SUCCEEDED(hr) && dxcResultBlob)
+                {
+                    *outCode = copyDXCBlob(dxcResultBlob);
+                    dxcResultBlob->Release();
+                }
+            }
 
-        // Retrieve result.
-        HRESULT resultCode = S_OK;
-        if (FAILED(dxcResult->GetStatus(&resultCode)))
-        {
-            // This indicates that we failed to retrieve the reuslt...
-            return 1;
+            dxcResult->Release();
+            return hr;
         }
 
-        // Note: it seems like the dxcompiler interface
-        // doesn't support querying diagnostic output
-        // *unless* the compile failed (no way to get
-        // warnings out!?).
-
-        // Verify compile result
-        if (FAILED(resultCode))
+        SLANG_NO_THROW SlangResult SLANG_MCALL disassemble(
+            SlangCompileTarget,
+            void const*         code,
+            size_t              codeSize,
+            ISlangBlob**        outAssembly) SLANG_OVERRIDE
         {
-            // Compilation failed.
-
+            // Create blob from the input data
+            IDxcBlobEncoding* dxcSourceBlob = nullptr;
+            HRESULT hr = m_library->CreateBlobWithEncodingFromPinned(
+                (LPBYTE) code,
+                (UINT32) codeSize,
+                0,
+                &dxcSourceBlob);
+            if (FAILED(hr))
+            {
+                return hr;
+            }
 
-            // Try to read any diagnostic output.
-            IDxcBlobEncoding* dxcErrorBlob = nullptr;
-            if (!FAILED(dxcResult->GetErrorBuffer(&dxcErrorBlob)))
+            IDxcBlobEncoding* dxcResultBlob = nullptr;
+            hr = m_compiler->Disassemble(
+                dxcSourceBlob,
+                &dxcResultBlob);
+            dxcSourceBlob->Release();
+            if (FAILED(hr))
             {
-                compileRequest->mSink.diagnoseRaw(
-                    FAILED(resultCode) ? Severity::Error : Severity::Warning,
-                    (char const*)dxcErrorBlob->GetBufferPointer());
-                dxcErrorBlob->Release();
+                return hr;
             }
 
+            // The disassembly is null-terminated, which we don't want to include
+            char const* codeBegin = (char const*)dxcResultBlob->GetBufferPointer();
+            char const* codeEnd = codeBegin + dxcResultBlob->GetBufferSize() - 1;
+            *outAssembly = createStringBlob(UnownedStringSlice(codeBegin, codeEnd)).detach();
+            dxcResultBlob->Release();
 
-            return 1;
-        }
-
-        // Okay, the compile supposedly succeeded, so we
-        // just need to grab the buffer with the output DXIL.
-        IDxcBlob* dxcResultBlob = nullptr;
-        if (FAILED(dxcResult->GetResult(&dxcResultBlob)))
-        {
-            return 1;
+            return SLANG_OK;
         }
+    };
 
-        outCode.AddRange(
-            (uint8_t const*)dxcResultBlob->GetBufferPointer(),
-            (int)           dxcResultBlob->GetBufferSize());
-
-        // Clean up after ourselves.
-
-        if(dxcResultBlob)   dxcResultBlob   ->Release();
-        if(dxcResult)       dxcResult       ->Release();
-        if(dxcLibrary)      dxcLibrary      ->Release();
-        if(dxcCompiler)     dxcCompiler     ->Release();
+    // The library is loaded once per process
+    static SharedLibrary& getDXCLibrary()
+    {
+        // TODO(tfoley): Let user specify name/path of library to use.
+        static SharedLibrary library = SharedLibrary::load(getDownstreamCompilerLibraryName(PassThroughMode::dxc));
+        return library;
+    }
 
-        return 0;
+    DownstreamOutputKey getDXCDownstreamCompilerIdentity()
+    {
+        static const DownstreamOutputKey identity = getDXCLibrary()
+            ? getLibraryIdentity((void const*) getDXCLibrary().findFuncByName("DxcCreateInstance"))
+            : DownstreamOutputKey();
+        return identity;
     }
 
-    String dissassembleDXILUsingDXC(
-        CompileRequest*     compileRequest,
-        void const*         data,
-        size_t              size)
+    SlangResult createDXCDownstreamCompiler(ISlangDownstreamCompiler** outCompiler)
     {
-        // First deal with all the rigamarole of loading
-        // the `dxcompiler` library, and creating the
-        // top-level COM objects that will be used to
-        // compile things.
+        // The entry point is looked up once per process, too
+        SharedLibrary& library = getDXCLibrary();
+        if (!library)
+            return SLANG_E_CANNOT_OPEN;
 
-        static DxcCreateInstanceProc dxcCreateInstance = nullptr;
+        static const DxcCreateInstanceProc dxcCreateInstance =
+            (DxcCreateInstanceProc) library.findFuncByName("DxcCreateInstance");
         if (!dxcCreateInstance)
-        {
-            auto dxcSharedLibrary = getDXCSharedLibrary(compileRequest);
-            if (!dxcSharedLibrary)
-                return 1;
+            return SLANG_FAIL;
 
-            dxcCreateInstance = (DxcCreateInstanceProc) dxcSharedLibrary.findFuncByName("DxcCreateInstance");
-            if (!dxcCreateInstance)
-                return 1;
-        }
+        ComPtr<ISlangDownstreamCompiler> result(new DXCDownstreamCompiler());
+        auto compiler = static_cast<DXCDownstreamCompiler*>(result.get());
 
-        IDxcCompiler* dxcCompiler = nullptr;
-        if (FAILED(dxcCreateInstance(
+        SLANG_RETURN_ON_FAIL(dxcCreateInstance(
             CLSID_DxcCompiler,
-            __uuidof(dxcCompiler),
-            (LPVOID*) &dxcCompiler)))
-        {
-            return 1;
-        }
+            __uuidof(IDxcCompiler),
+            (LPVOID*) &compiler->m_compiler));
 
-        IDxcLibrary* dxcLibrary = nullptr;
-        if (FAILED(dxcCreateInstance(
+        SLANG_RETURN_ON_FAIL(dxcCreateInstance(
             CLSID_DxcLibrary,
-            __uuidof(dxcLibrary),
-            (LPVOID*) &dxcLibrary)))
-        {
-            return 1;
-        }
-
-        // Create blob from the input data
-        IDxcBlobEncoding* dxcSourceBlob = nullptr;
-        if (FAILED(dxcLibrary->CreateBlobWithEncodingFromPinned(
-            (LPBYTE) data,
-            (UINT32) size,
-            0,
-            &dxcSourceBlob)))
-        {
-            return 1;
-        }
-
-        IDxcBlobEncoding* dxcResultBlob = nullptr;
-        if(FAILED(dxcCompiler->Disassemble(
-            dxcSourceBlob,
-            &dxcResultBlob)))
-        {
-            return 1;
-        }
-
-        String result;
-        char const* codeBegin = (char const*)dxcResultBlob->GetBufferPointer();
-        char const* codeEnd = codeBegin + dxcResultBlob->GetBufferSize() - 1;
-        result.append(codeBegin, codeEnd);
+            __uuidof(IDxcLibrary),
+            (LPVOID*) &compiler->m_library));
 
-        if(dxcResultBlob)   dxcResultBlob   ->Release();
-        if(dxcLibrary)      dxcLibrary      ->Release();
-        if(dxcCompiler)     dxcCompiler     ->Release();
-
-        return result;
+        *outCompiler = result.detach();
+        return SLANG_OK;
     }
 
-
 } // namespace Slang
 
-#endif
+#else
 
+namespace Slang
+{
+    SlangResult createDXCDownstreamCompiler(ISlangDownstreamCompiler**)
+    {
+        return SLANG_E_NOT_IMPLEMENTED;
+    }
 
+    DownstreamOutputKey getDXCDownstreamCompilerIdentity()
+    {
+        return DownstreamOutputKey();
+    }
+}
 
+#endif
@@ -0,0 +1,3108 @@
+// emit-spirv.cpp
+#include "emit.h"
+
+#include "ir.h"
+#include "ir-insts.h"
+#include "mangle.h"
+#include "name.h"
+#include "type-layout.h"
+
+#include <initializer_list>
+#include <string.h>
+
+// This file generates a SPIR-V module directly from the IR for an entry point.
+//
+// The IR is prepared exactly as it is for GLSL output (so that, e.g., entry
+// point parameters have already been turned into global varyings), and then
+// translated instruction by instruction. Compared to emitting GLSL and handing
+// it to glslang, this skips producing text that only gets parsed, checked and
+// lowered all over again.
+//
+// Only a subset of what the GLSL path handles is supported so far: scalars,
+// vectors, arrays and structures; structured and constant buffers; the compute,
+// vertex and fragment stages; and the common intrinsics that map directly to
+// SPIR-V or `GLSL.std.450` instructions. Anything else makes the translation
+// fail (without a diagnostic), and the caller falls back to glslang.
+//
+// The main structural difference between the IR and SPIR-V is how loops are
+// represented. SPIR-V requires the header block of a loop to hold its
+// `OpLoopMerge`, and to be the target of the loop's back edges, while the IR
+// puts the loop test in the header block itself and allows a loop to
+// `continue` directly to its header. So each IR loop header becomes two
+// SPIR-V blocks: one holding the phis and the merge instruction, and one
+// holding the instructions of the IR block. When the IR loop continues at its
+// header, we also add a continue block that the back edges branch to.
+
+namespace Slang
+{
+
+// The SPIR-V enumerants we use. The names match those in the `spirv.h` and
+// `GLSL.std.450.h` headers that come with the SPIR-V specification.
+typedef uint32_t SpvWord;
+
+enum : SpvWord
+{
+    SpvMagicNumber  = 0x07230203,
+    SpvVersion      = 0x00010000,
+};
+
+enum SpvOp : SpvWord
+{
+    SpvOpUndef                      = 1,
+    SpvOpName                       = 5,
+    SpvOpExtInstImport              = 11,
+    SpvOpExtInst                    = 12,
+    SpvOpMemoryModel                = 14,
+    SpvOpEntryPoint                 = 15,
+    SpvOpExecutionMode              = 16,
+    SpvOpCapability                 = 17,
+    SpvOpTypeVoid                   = 19,
+    SpvOpTypeBool                   = 20,
+    SpvOpTypeInt                    = 21,
+    SpvOpTypeFloat                  = 22,
+    SpvOpTypeVector                 = 23,
+    SpvOpTypeArray                  = 28,
+    SpvOpTypeRuntimeArray           = 29,
+    SpvOpTypeStruct                 = 30,
+    SpvOpTypePointer                = 32,
+    SpvOpTypeFunction               = 33,
+    SpvOpConstantTrue               = 41,
+    SpvOpConstantFalse              = 42,
+    SpvOpConstant                   = 43,
+    SpvOpConstantComposite          = 44,
+    SpvOpConstantNull               = 46,
+    SpvOpFunction                   = 54,
+    SpvOpFunctionParameter          = 55,
+    SpvOpFunctionEnd                = 56,
+    SpvOpFunctionCall               = 57,
+    SpvOpVariable                   = 59,
+    SpvOpLoad                       = 61,
+    SpvOpStore                      = 62,
+    SpvOpAccessChain                = 65,
+    SpvOpArrayLength                = 68,
+    SpvOpDecorate                   = 71,
+    SpvOpMemberDecorate             = 72,
+    SpvOpVectorExtractDynamic       = 77,
+    SpvOpVectorShuffle              = 79,
+    SpvOpCompositeConstruct         = 80,
+    SpvOpCompositeExtract           = 81,
+    SpvOpCompositeInsert            = 82,
+    SpvOpCopyObject                 = 83,
+    SpvOpConvertFToU                = 109,
+    SpvOpConvertFToS                = 110,
+    SpvOpConvertSToF                = 111,
+    SpvOpConvertUToF                = 112,
+    SpvOpBitcast                    = 124,
+    SpvOpSNegate                    = 126,
+    SpvOpFNegate                    = 127,
+    SpvOpIAdd                       = 128,
+    SpvOpFAdd                       = 129,
+    SpvOpISub                       = 130,
+    SpvOpFSub                       = 131,
+    SpvOpIMul                       = 132,
+    SpvOpFMul                       = 133,
+    SpvOpUDiv                       = 134,
+    SpvOpSDiv                       = 135,
+    SpvOpFDiv                       = 136,
+    SpvOpUMod                       = 137,
+    SpvOpSRem                       = 138,
+    SpvOpFRem                       = 140,
+    SpvOpDot                        = 148,
+    SpvOpAny                        = 154,
+    SpvOpAll                        = 155,
+    SpvOpIsNan                      = 156,
+    SpvOpIsInf                      = 157,
+    SpvOpLogicalEqual               = 164,
+    SpvOpLogicalNotEqual            = 165,
+    SpvOpLogicalOr                  = 166,
+    SpvOpLogicalAnd                 = 167,
+    SpvOpLogicalNot                 = 168,
+    SpvOpSelect                     = 169,
+    SpvOpIEqual                     = 170,
+    SpvOpINotEqual                  = 171,
+    SpvOpUGreaterThan               = 172,
+    SpvOpSGreaterThan               = 173,
+    SpvOpUGreaterThanEqual          = 174,
+    SpvOpSGreaterThanEqual          = 175,
+    SpvOpULessThan                  = 176,
+    SpvOpSLessThan                  = 177,
+    SpvOpULessThanEqual             = 178,
+    SpvOpSLessThanEqual             = 179,
+    SpvOpFOrdEqual                  = 180,
+    SpvOpFUnordNotEqual             = 183,
+    SpvOpFOrdLessThan               = 184,
+    SpvOpFOrdGreaterThan            = 186,
+    SpvOpFOrdLessThanEqual          = 188,
+    SpvOpFOrdGreaterThanEqual       = 190,
+    SpvOpShiftRightLogical          = 194,
+    SpvOpShiftRightArithmetic       = 195,
+    SpvOpShiftLeftLogical           = 196,
+    SpvOpBitwiseOr                  = 197,
+    SpvOpBitwiseXor                 = 198,
+    SpvOpBitwiseAnd                 = 199,
+    SpvOpNot                        = 200,
+    SpvOpControlBarrier             = 224,
+    SpvOpMemoryBarrier              = 225,
+    SpvOpAtomicExchange             = 229,
+    SpvOpAtomicCompareExchange      = 230,
+    SpvOpAtomicIAdd                 = 234,
+    SpvOpAtomicSMin                 = 236,
+    SpvOpAtomicUMin                 = 237,
+    SpvOpAtomicSMax                 = 238,
+    SpvOpAtomicUMax                 = 239,
+    SpvOpAtomicAnd                  = 240,
+    SpvOpAtomicOr                   = 241,
+    SpvOpAtomicXor                  = 242,
+    SpvOpPhi                        = 245,
+    SpvOpLoopMerge                  = 246,
+    SpvOpSelectionMerge             = 247,
+    SpvOpLabel                      = 248,
+    SpvOpBranch                     = 249,
+    SpvOpBranchConditional          = 250,
+    SpvOpSwitch                     = 251,
+    SpvOpKill                       = 252,
+    SpvOpReturn                     = 253,
+    SpvOpReturnValue                = 254,
+    SpvOpUnreachable                = 255,
+};
+
+enum SpvCapability : SpvWord
+{
+    SpvCapabilityShader             = 1,
+};
+
+enum : SpvWord
+{
+    SpvAddressingModelLogical       = 0,
+    SpvMemoryModelGLSL450           = 1,
+};
+
+enum SpvExecutionModel : SpvWord
+{
+    SpvExecutionModelVertex         = 0,
+    SpvExecutionModelFragment       = 4,
+    SpvExecutionModelGLCompute      = 5,
+};
+
+enum SpvExecutionMode : SpvWord
+{
+    SpvExecutionModeOriginUpperLeft = 7,
+    SpvExecutionModeDepthReplacing  = 12,
+    SpvExecutionModeLocalSize       = 17,
+};
+
+enum SpvStorageClass : SpvWord
+{
+    SpvStorageClassInput            = 1,
+    SpvStorageClassUniform          = 2,
+    SpvStorageClassOutput           = 3,
+    SpvStorageClassWorkgroup        = 4,
+    SpvStorageClassPrivate          = 6,
+    SpvStorageClassFunction         = 7,
+    SpvStorageClassPushConstant     = 9,
+};
+
+enum SpvDecoration : SpvWord
+{
+    SpvDecorationBlock              = 2,
+    SpvDecorationBufferBlock        = 3,
+    SpvDecorationArrayStride        = 6,
+    SpvDecorationBuiltIn            = 11,
+    SpvDecorationNoPerspective      = 13,
+    SpvDecorationFlat               = 14,
+    SpvDecorationCentroid           = 16,
+    SpvDecorationNonWritable        = 24,
+    SpvDecorationLocation           = 30,
+    SpvDecorationBinding            = 33,
+    SpvDecorationDescriptorSet      = 34,
+    SpvDecorationOffset             = 35,
+};
+
+enum SpvBuiltIn : SpvWord
+{
+    SpvBuiltInPosition              = 0,
+    SpvBuiltInFragCoord             = 15,
+    SpvBuiltInFrontFacing           = 17,
+    SpvBuiltInFragDepth             = 22,
+    SpvBuiltInWorkgroupId           = 26,
+    SpvBuiltInLocalInvocationId     = 27,
+    SpvBuiltInGlobalInvocationId    = 28,
+    SpvBuiltInLocalInvocationIndex  = 29,
+    SpvBuiltInVertexIndex           = 42,
+    SpvBuiltInInstanceIndex         = 43,
+};
+
+enum : SpvWord
+{
+    SpvScopeDevice                              = 1,
+    SpvScopeWorkgroup                           = 2,
+
+    SpvMemorySemanticsAcquireReleaseMask        = 0x8,
+    SpvMemorySemanticsUniformMemoryMask         = 0x40,
+    SpvMemorySemanticsWorkgroupMemoryMask       = 0x100,
+    SpvMemorySemanticsImageMemoryMask           = 0x800,
+
+    SpvLoopControlUnrollMask                    = 0x1,
+};
+
+enum GLSLstd450 : SpvWord
+{
+    GLSLstd450Bad           = 0,
+    GLSLstd450Round         = 1,
+    GLSLstd450Trunc         = 3,
+    GLSLstd450FAbs          = 4,
+    GLSLstd450SAbs          = 5,
+    GLSLstd450Floor         = 8,
+    GLSLstd450Ceil          = 9,
+    GLSLstd450Fract         = 10,
+    GLSLstd450Radians       = 11,
+    GLSLstd450Degrees       = 12,
+    GLSLstd450Sin           = 13,
+    GLSLstd450Cos           = 14,
+    GLSLstd450Tan           = 15,
+    GLSLstd450Asin          = 16,
+    GLSLstd450Acos          = 17,
+    GLSLstd450Atan          = 18,
+    GLSLstd450Sinh          = 19,
+    GLSLstd450Cosh          = 20,
+    GLSLstd450Tanh          = 21,
+    GLSLstd450Atan2         = 25,
+    GLSLstd450Pow           = 26,
+    GLSLstd450Exp           = 27,
+    GLSLstd450Log           = 28,
+    GLSLstd450Exp2          = 29,
+    GLSLstd450Log2          = 30,
+    GLSLstd450Sqrt          = 31,
+    GLSLstd450InverseSqrt   = 32,
+    GLSLstd450FMin          = 37,
+    GLSLstd450UMin          = 38,
+    GLSLstd450SMin          = 39,
+    GLSLstd450FMax          = 40,
+    GLSLstd450UMax          = 41,
+    GLSLstd450SMax          = 42,
+    GLSLstd450FClamp        = 43,
+    GLSLstd450UClamp        = 44,
+    GLSLstd450SClamp        = 45,
+    GLSLstd450FMix          = 46,
+    GLSLstd450Step          = 48,
+    GLSLstd450SmoothStep    = 49,
+    GLSLstd450Fma           = 50,
+    GLSLstd450Length        = 66,
+    GLSLstd450Distance      = 67,
+    GLSLstd450Cross         = 68,
+    GLSLstd450Normalize     = 69,
+    GLSLstd450Reflect       = 71,
+};
+
+// The kind of scalar (or vector element) a value holds, which decides
+// which flavor of an arithmetic or conversion instruction to use.
+enum class ScalarKind
+{
+    None,
+    Bool,
+    SInt,
+    UInt,
+    Float,
+};
+
+// The "shape" of a scalar or vector value: its element kind, and its
+// element count (which is 1 for a scalar, and 0 for anything that is
+// neither a scalar nor a vector).
+struct ValueShape
+{
+    ScalarKind  kind = ScalarKind::None;
+    UInt        count = 0;
+
+    ValueShape() {}
+    ValueShape(ScalarKind kind, UInt count)
+        : kind(kind), count(count)
+    {}
+
+    bool isValid() const { return kind != ScalarKind::None && count != 0; }
+};
+
+static ScalarKind getScalarKind(IRType* type)
+{
+    switch (type->op)
+    {
+    case kIROp_BoolType:    return ScalarKind::Bool;
+    case kIROp_IntType:     return ScalarKind::SInt;
+    case kIROp_UIntType:    return ScalarKind::UInt;
+    case kIROp_FloatType:   return ScalarKind::Float;
+    default:                return ScalarKind::None;
+    }
+}
+
+static ValueShape getValueShape(IRType* type)
+{
+    if (!type)
+        return ValueShape();
+
+    if (auto vectorType = as<IRVectorType>(type))
+    {
+        return ValueShape(
+            getScalarKind(vectorType->getElementType()),
+            UInt(GetIntVal(vectorType->getElementCount())));
+    }
+    return ValueShape(getScalarKind(type), 1);
+}
+
+static UInt roundUpToMultiple(UInt value, UInt alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Append a literal string operand: nul-terminated, and padded with zeros to a whole word
+static void appendStringOperand(List<SpvWord>& words, char const* text)
+{
+    size_t length = strlen(text);
+    for (size_t ii = 0; ii <= length; ii += 4)
+    {
+        SpvWord word = 0;
+        for (size_t jj = 0; jj < 4 && ii + jj < length; ++jj)
+        {
+            word |= SpvWord((unsigned char) text[ii + jj]) << (8 * jj);
+        }
+        words.Add(word);
+    }
+}
+
+// If `value` is the specialization of a generic, find the value the generic returns
+static IRInst* getSpecializedValue(IRInst* value)
+{
+    while (auto specialize = as<IRSpecialize>(value))
+    {
+        auto generic = as<IRGeneric>(specialize->getBase());
+        if (!generic)
+            return specialize->getBase();
+
+        auto lastBlock = generic->getLastBlock();
+        auto returnInst = lastBlock ? as<IRReturnVal>(lastBlock->getTerminator()) : nullptr;
+        if (!returnInst)
+            return specialize->getBase();
+
+        value = returnInst->getVal();
+    }
+    return value;
+}
+
+// Get the name of the declaration that an intrinsic function was declared
+// with (e.g., `max`), by unmangling the name of the outer-most generic it is
+// nested in (or of the function itself, if it isn't generic).
+static String getIntrinsicName(IRFunc* func, UInt& outParamCount)
+{
+    IRGlobalValue* valueForName = func;
+    for (;;)
+    {
+        auto parentBlock = as<IRBlock>(valueForName->parent);
+        if (!parentBlock)
+            break;
+
+        auto parentGeneric = as<IRGeneric>(parentBlock->parent);
+        if (!parentGeneric)
+            break;
+
+        valueForName = parentGeneric;
+    }
+
+    UnmangleContext um(getText(valueForName->mangledName));
+    um.startUnmangling();
+    String name = um.readSimpleName();
+    outParamCount = um.readParamCount();
+    return name;
+}
+
+static VarLayout* getVarLayout(IRInst* inst)
+{
+    auto decoration = inst->findDecoration<IRLayoutDecoration>();
+    if (!decoration)
+        return nullptr;
+    return decoration->layout->dynamicCast<VarLayout>();
+}
+
+struct SPIRVEmitContext
+{
+    IRModule*   module = nullptr;
+    Stage       stage = Stage::Unknown;
+
+    // A description of the first thing we ran into that we can't translate.
+    // Once this is set, the rest of the translation is skipped.
+    char const* failure = nullptr;
+
+    // The sections of the module, in the order they are written out
+    List<SpvWord> capabilities;
+    List<SpvWord> extInstImports;
+    List<SpvWord> executionModes;
+    List<SpvWord> debugNames;
+    List<SpvWord> annotations;
+    List<SpvWord> globals;
+    List<SpvWord> functions;
+
+    SpvWord nextID = 1;
+    SpvWord glslStd450ID = 0;
+
+    // The ID that represents each IR value (including functions and global variables)
+    Dictionary<IRInst*, SpvWord> values;
+
+    // The storage class of each pointer-valued IR instruction
+    Dictionary<IRInst*, SpvWord> storageClasses;
+
+    // A structured or constant buffer is represented by a variable whose
+    // type is a block `struct` with the buffer's contents as its only member.
+    // This maps the IR global for the buffer (and the values loaded from it)
+    // to that variable.
+    Dictionary<IRInst*, SpvWord> bufferVars;
+
+    // Types and constants, so that each is declared only once
+    Dictionary<String, SpvWord> types;
+    Dictionary<IRInst*, SpvWord> typesByInst;
+    Dictionary<String, SpvWord> constants;
+
+    // The buffer layout rules that have been applied to (aggregate) types, along
+    // with the size and alignment that resulted.
+    enum class BufferLayoutRules { Std140, Std430 };
+    struct BufferLayoutInfo
+    {
+        BufferLayoutRules   rules;
+        UInt                size;
+        UInt                alignment;
+    };
+    Dictionary<SpvWord, BufferLayoutInfo> bufferLayouts;
+
+    // The `Input` and `Output` variables the entry point uses
+    List<SpvWord> interfaceVars;
+    bool usesFragDepth = false;
+
+    // Functions that are called, but which haven't been emitted yet
+    List<IRFunc*> pendingFuncs;
+
+    // State for the function being emitted
+
+    struct LoopInfo
+    {
+        // The IR block that the loop continues at
+        IRBlock*    continueBlock = nullptr;
+
+        // The IR block the loop breaks to
+        IRBlock*    breakBlock = nullptr;
+
+        // The block that holds the instructions of the IR loop header, after
+        // the SPIR-V loop header that holds its phis and `OpLoopMerge`
+        SpvWord     bodyLabel = 0;
+
+        // The continue block we add, when the IR loop continues at its header
+        SpvWord     continueLabel = 0;
+
+        // Phis for the continue block we add (one per parameter of the header)
+        List<SpvWord> continuePhis;
+
+        // The branch that enters the loop
+        IRLoop*     loopInst = nullptr;
+    };
+
+    // Loop information for each IR loop header
+    Dictionary<IRBlock*, LoopInfo> loops;
+
+    // For each block that has parameters, the branches that pass it arguments
+    Dictionary<IRBlock*, List<IRInst*>> incomingBranches;
+
+    // For each loop break block, the loop headers whose added continue blocks
+    // are emitted right before it
+    Dictionary<IRBlock*, List<IRBlock*>> continueBlocksBefore;
+
+    // Blocks that are already the merge block of a loop or selection
+    HashSet<IRBlock*> mergeBlocks;
+
+    List<SpvWord> localVars;
+    List<SpvWord> body;
+
+    bool unsupported(char const* what)
+    {
+        if (!failure)
+            failure = what;
+        return false;
+    }
+
+    SpvWord allocateID()
+    {
+        return nextID++;
+    }
+
+    // Writing instructions
+
+    void emitInst(List<SpvWord>& stream, SpvOp op, SpvWord const* operands, UInt operandCount)
+    {
+        stream.Add(SpvWord((operandCount + 1) << 16) | op);
+        stream.AddRange(operands, operandCount);
+    }
+
+    void emitInst(List<SpvWord>& stream, SpvOp op, std::initializer_list<SpvWord> operands)
+    {
+        emitInst(stream, op, operands.begin(), operands.size());
+    }
+
+    void emitInst(List<SpvWord>& stream, SpvOp op, List<SpvWord> const& operands)
+    {
+        emitInst(stream, op, operands.Buffer(), operands.Count());
+    }
+
+    // Emit an instruction into the current function that produces a value,
+    // and return the ID of its result
+    SpvWord emitValueInst(SpvOp op, SpvWord typeID, std::initializer_list<SpvWord> operands)
+    {
+        SpvWord id = allocateID();
+
+        List<SpvWord> words;
+        words.Add(typeID);
+        words.Add(id);
+        words.AddRange(operands.begin(), operands.size());
+        emitInst(body, op, words);
+        return id;
+    }
+
+    SpvWord emitExtInst(SpvWord typeID, GLSLstd450 op, List<SpvWord> const& args)
+    {
+        SpvWord id = allocateID();
+
+        List<SpvWord> words;
+        words.Add(typeID);
+        words.Add(id);
+        words.Add(glslStd450ID);
+        words.Add(op);
+        words.AddRange(args);
+        emitInst(body, SpvOpExtInst, words);
+        return id;
+    }
+
+    // Types
+
+    // Get the type for `op` with the given operands, declaring it if this is its first use
+    SpvWord getTypeID(char const* keyPrefix, SpvOp op, std::initializer_list<SpvWord> operands)
+    {
+        String key(keyPrefix);
+        for (auto operand : operands)
+        {
+            key.append(' ');
+            key.append(uint32_t(operand));
+        }
+
+        SpvWord id;
+        if (types.TryGetValue(key, id))
+            return id;
+
+        id = allocateID();
+        List<SpvWord> words;
+        words.Add(id);
+        words.AddRange(operands.begin(), operands.size());
+        emitInst(globals, op, words);
+
+        types.Add(key, id);
+        return id;
+    }
+
+    SpvWord getScalarTypeID(ScalarKind kind)
+    {
+        switch (kind)
+        {
+        case ScalarKind::Bool:  return getTypeID("bool", SpvOpTypeBool, {});
+        case ScalarKind::SInt:  return getTypeID("int", SpvOpTypeInt, { 32, 1 });
+        case ScalarKind::UInt:  return getTypeID("int", SpvOpTypeInt, { 32, 0 });
+        case ScalarKind::Float: return getTypeID("float", SpvOpTypeFloat, { 32 });
+        default:
+            unsupported("scalar type");
+            return 0;
+        }
+    }
+
+    SpvWord getShapeTypeID(ValueShape shape)
+    {
+        SpvWord scalarTypeID = getScalarTypeID(shape.kind);
+        if (shape.count == 1)
+            return scalarTypeID;
+        return getTypeID("vector", SpvOpTypeVector, { scalarTypeID, SpvWord(shape.count) });
+    }
+
+    SpvWord getPointerTypeID(SpvWord storageClass, SpvWord valueTypeID)
+    {
+        return getTypeID("pointer", SpvOpTypePointer, { storageClass, valueTypeID });
+    }
+
+    SpvWord getType(IRType* type)
+    {
+        if (!type)
+            return getTypeID("void", SpvOpTypeVoid, {});
+
+        SpvWord id;
+        if (typesByInst.TryGetValue(type, id))
+            return id;
+
+        id = getTypeImpl(type);
+        if (id)
+            typesByInst.Add(type, id);
+        return id;
+    }
+
+    SpvWord getTypeImpl(IRType* type)
+    {
+        switch (type->op)
+        {
+        case kIROp_VoidType:
+            return getTypeID("void", SpvOpTypeVoid, {});
+
+        case kIROp_BoolType:
+        case kIROp_IntType:
+        case kIROp_UIntType:
+        case kIROp_FloatType:
+            return getScalarTypeID(getScalarKind(type));
+
+        case kIROp_VectorType:
+            {
+                auto vectorType = cast<IRVectorType>(type);
+                return getTypeID("vector", SpvOpTypeVector, {
+                    getType(vectorType->getElementType()),
+                    SpvWord(GetIntVal(vectorType->getElementCount())) });
+            }
+
+        case kIROp_ArrayType:
+            {
+                auto arrayType = cast<IRArrayType>(type);
+                SpvWord elementTypeID = getType(arrayType->getElementType());
+                SpvWord countID = getUIntConstant(SpvWord(GetIntVal(arrayType->getElementCount())));
+                return getTypeID("array", SpvOpTypeArray, { elementTypeID, countID });
+            }
+
+        case kIROp_StructType:
+            {
+                // Structures are declared once for each IR `struct`, rather than
+                // being shared by structure, because they are decorated with
+                // offsets (and the field offsets for a `struct` might not be
+                // consistent with those of another with the same fields)
+                List<SpvWord> fieldTypeIDs;
+                for (auto field : cast<IRStructType>(type)->getFields())
+                {
+                    auto fieldType = field->getFieldType();
+                    if (as<IRVoidType>(fieldType))
+                        continue;
+                    fieldTypeIDs.Add(getType(fieldType));
+                }
+
+                SpvWord id = allocateID();
+                List<SpvWord> words;
+                words.Add(id);
+                words.AddRange(fieldTypeIDs);
+                emitInst(globals, SpvOpTypeStruct, words);
+                return id;
+            }
+
+        case kIROp_FuncType:
+            {
+                auto funcType = cast<IRFuncType>(type);
+
+                String key("function ");
+                key.append(uint32_t(getType(funcType->getResultType())));
+                List<SpvWord> words;
+                words.Add(0);
+                words.Add(getType(funcType->getResultType()));
+                for (UInt pp = 0; pp < funcType->getParamCount(); ++pp)
+                {
+                    SpvWord paramTypeID = getType(funcType->getParamType(pp));
+                    key.append(' ');
+                    key.append(uint32_t(paramTypeID));
+                    words.Add(paramTypeID);
+                }
+
+                SpvWord id;
+                if (types.TryGetValue(key, id))
+                    return id;
+
+                id = allocateID();
+                words[0] = id;
+                emitInst(globals, SpvOpTypeFunction, words);
+                types.Add(key, id);
+                return id;
+            }
+
+        case kIROp_PtrType:
+        case kIROp_RefType:
+        case kIROp_OutType:
+        case kIROp_InOutType:
+            // The only pointers that are used as types of their own (rather
+            // than just for the results of instructions) are those of
+            // `out` and `inout` parameters, which always point at local variables.
+            return getPointerTypeID(
+                SpvStorageClassFunction,
+                getType(cast<IRPtrTypeBase>(type)->getValueType()));
+
+        default:
+            unsupported("type");
+            return 0;
+        }
+    }
+
+    // The type of a pointer to a value of `valueType` in `storageClass`
+    SpvWord getPointerType(SpvWord storageClass, IRType* valueType)
+    {
+        return getPointerTypeID(storageClass, getType(valueType));
+    }
+
+    // The index of the member of the SPIR-V `struct` that holds the field with `key`
+    // (which skips any fields of `void` type)
+    bool getFieldIndex(IRStructType* structType, IRInst* key, SpvWord& outIndex)
+    {
+        SpvWord index = 0;
+        for (auto field : structType->getFields())
+        {
+            if (as<IRVoidType>(field->getFieldType()))
+                continue;
+            if (field->getKey() == key)
+            {
+                outIndex = index;
+                return true;
+            }
+            index++;
+        }
+        return unsupported("field reference");
+    }
+
+    // Buffer layout
+
+    // Compute the size and alignment of `type` when it is stored in a buffer
+    // with the given layout rules, and decorate it with the offsets and
+    // strides that go with them.
+    bool applyBufferLayout(IRType* type, BufferLayoutRules rules, UInt& outSize, UInt& outAlignment)
+    {
+        switch (type->op)
+        {
+        case kIROp_IntType:
+        case kIROp_UIntType:
+        case kIROp_FloatType:
+            outSize = 4;
+            outAlignment = 4;
+            return true;
+
+        case kIROp_VectorType:
+            {
+                auto vectorType = cast<IRVectorType>(type);
+                UInt elementSize;
+                UInt elementAlignment;
+                if (!applyBufferLayout(vectorType->getElementType(), rules, elementSize, elementAlignment))
+                    return false;
+
+                UInt count = UInt(GetIntVal(vectorType->getElementCount()));
+                outSize = elementSize * count;
+                outAlignment = elementSize * (count == 3 ? 4 : count);
+                return true;
+            }
+
+        case kIROp_ArrayType:
+        case kIROp_StructType:
+            break;
+
+        default:
+            return unsupported("type in a buffer");
+        }
+
+        SpvWord typeID = getType(type);
+        if (failure)
+            return false;
+
+        BufferLayoutInfo info;
+        if (bufferLayouts.TryGetValue(typeID, info))
+        {
+            if (info.rules != rules)
+                return unsupported("type used with different buffer layouts");
+
+            outSize = info.size;
+            outAlignment = info.alignment;
+            return true;
+        }
+
+        info.rules = rules;
+        if (auto arrayType = as<IRArrayType>(type))
+        {
+            UInt elementSize;
+            UInt elementAlignment;
+            if (!applyBufferLayout(arrayType->getElementType(), rules, elementSize, elementAlignment))
+                return false;
+
+            // The `std140` rules round the alignment of arrays up to that of a `vec4`
+            if (rules == BufferLayoutRules::Std140)
+                elementAlignment = roundUpToMultiple(elementAlignment, 16);
+
+            UInt stride = roundUpToMultiple(elementSize, elementAlignment);
+            emitInst(annotations, SpvOpDecorate, { typeID, SpvDecorationArrayStride, SpvWord(stride) });
+
+            info.size = stride * UInt(GetIntVal(arrayType->getElementCount()));
+            info.alignment = elementAlignment;
+        }
+        else
+        {
+            UInt offset = 0;
+            UInt alignment = rules == BufferLayoutRules::Std140 ? 16 : 1;
+            SpvWord memberIndex = 0;
+            for (auto field : cast<IRStructType>(type)->getFields())
+            {
+                auto fieldType = field->getFieldType();
+                if (as<IRVoidType>(fieldType))
+                    continue;
+
+                UInt fieldSize;
+                UInt fieldAlignment;
+                if (!applyBufferLayout(fieldType, rules, fieldSize, fieldAlignment))
+                    return false;
+
+                offset = roundUpToMultiple(offset, fieldAlignment);
+                emitInst(annotations, SpvOpMemberDecorate, { typeID, memberIndex, SpvDecorationOffset, SpvWord(offset) });
+                offset += fieldSize;
+
+                if (fieldAlignment > alignment)
+                    alignment = fieldAlignment;
+                memberIndex++;
+            }
+            info.size = roundUpToMultiple(offset, alignment);
+            info.alignment = alignment;
+        }
+
+        bufferLayouts.Add(typeID, info);
+        outSize = info.size;
+        outAlignment = info.alignment;
+        return true;
+    }
+
+    // Constants
+
+    SpvWord getConstant(SpvWord typeID, SpvOp op, std::initializer_list<SpvWord> literals)
+    {
+        String key("constant ");
+        key.append(uint32_t(op));
+        key.append(' ');
+        key.append(uint32_t(typeID));
+        for (auto literal : literals)
+        {
+            key.append(' ');
+            key.append(uint32_t(literal));
+        }
+
+        SpvWord id;
+        if (constants.TryGetValue(key, id))
+            return id;
+
+        id = allocateID();
+        List<SpvWord> words;
+        words.Add(typeID);
+        words.Add(id);
+        words.AddRange(literals.begin(), literals.size());
+        emitInst(globals, op, words);
+
+        constants.Add(key, id);
+        return id;
+    }
+
+    SpvWord getUIntConstant(SpvWord value)
+    {
+        return getConstant(getScalarTypeID(ScalarKind::UInt), SpvOpConstant, { value });
+    }
+
+    SpvWord getIntConstant(SpvWord value)
+    {
+        return getConstant(getScalarTypeID(ScalarKind::SInt), SpvOpConstant, { value });
+    }
+
+    SpvWord getNullConstant(SpvWord typeID)
+    {
+        return getConstant(typeID, SpvOpConstantNull, {});
+    }
+
+    // A scalar constant of the given kind, from its bit pattern (or `0`/`1` for `bool`)
+    SpvWord getScalarConstant(ScalarKind kind, SpvWord bits)
+    {
+        SpvWord typeID = getScalarTypeID(kind);
+        if (kind == ScalarKind::Bool)
+            return getConstant(typeID, bits ? SpvOpConstantTrue : SpvOpConstantFalse, {});
+        return getConstant(typeID, SpvOpConstant, { bits });
+    }
+
+    // A constant with the given shape, with `bits` in every element
+    SpvWord getShapeConstant(ValueShape shape, SpvWord bits)
+    {
+        SpvWord scalarID = getScalarConstant(shape.kind, bits);
+        if (shape.count == 1)
+            return scalarID;
+
+        SpvWord typeID = getShapeTypeID(shape);
+        switch (shape.count)
+        {
+        case 2: return getConstant(typeID, SpvOpConstantComposite, { scalarID, scalarID });
+        case 3: return getConstant(typeID, SpvOpConstantComposite, { scalarID, scalarID, scalarID });
+        default: return getConstant(typeID, SpvOpConstantComposite, { scalarID, scalarID, scalarID, scalarID });
+        }
+    }
+
+    static SpvWord getOneBits(ScalarKind kind)
+    {
+        if (kind == ScalarKind::Float)
+        {
+            float one = 1.0f;
+            SpvWord bits;
+            memcpy(&bits, &one, sizeof(bits));
+            return bits;
+        }
+        return 1;
+    }
+
+    SpvWord emitIRConstant(IRConstant* inst)
+    {
+        auto kind = getScalarKind(inst->getDataType());
+        switch (inst->op)
+        {
+        case kIROp_boolConst:
+            return getScalarConstant(ScalarKind::Bool, inst->value.intVal ? 1 : 0);
+
+        case kIROp_IntLit:
+            switch (kind)
+            {
+            case ScalarKind::Bool:
+            case ScalarKind::SInt:
+            case ScalarKind::UInt:
+                return getScalarConstant(kind, SpvWord(inst->value.intVal));
+
+            case ScalarKind::Float:
+                {
+                    float value = float(inst->value.intVal);
+                    SpvWord bits;
+                    memcpy(&bits, &value, sizeof(bits));
+                    return getScalarConstant(kind, bits);
+                }
+
+            default:
+                break;
+            }
+            break;
+
+        case kIROp_FloatLit:
+            if (kind == ScalarKind::Float)
+            {
+                float value = float(inst->value.floatVal);
+                SpvWord bits;
+                memcpy(&bits, &value, sizeof(bits));
+                return getScalarConstant(kind, bits);
+            }
+            break;
+
+        default:
+            break;
+        }
+        unsupported("constant");
+        return 0;
+    }
+
+    // Values
+
+    // The ID for the result of `inst`, allocating it on first use
+    SpvWord getID(IRInst* inst)
+    {
+        SpvWord id;
+        if (values.TryGetValue(inst, id))
+            return id;
+
+        id = allocateID();
+        values.Add(inst, id);
+        return id;
+    }
+
+    // Record that `inst` produces the existing value `id` (rather than a
+    // value produced by an instruction of its own)
+    void setValue(IRInst* inst, SpvWord id)
+    {
+        SpvWord existingID;
+        if (values.TryGetValue(inst, existingID))
+        {
+            // `inst` has already been referred to (e.g., by a phi), and so has
+            // been given an ID that we now need to define
+            emitInst(body, SpvOpCopyObject, { getType(inst->getDataType()), existingID, id });
+            return;
+        }
+        values.Add(inst, id);
+    }
+
+    SpvWord getValue(IRInst* inst)
+    {
+        SpvWord id;
+        if (values.TryGetValue(inst, id))
+            return id;
+
+        switch (inst->op)
+        {
+        case kIROp_boolConst:
+        case kIROp_IntLit:
+        case kIROp_FloatLit:
+            id = emitIRConstant(cast<IRConstant>(inst));
+            break;
+
+        case kIROp_GlobalVar:
+            id = emitGlobalVar(cast<IRGlobalVar>(inst));
+            break;
+
+        case kIROp_Func:
+            id = allocateID();
+            pendingFuncs.Add(cast<IRFunc>(inst));
+            break;
+
+        case kIROp_undefined:
+            id = allocateID();
+            emitInst(globals, SpvOpUndef, { getType(inst->getDataType()), id });
+            break;
+
+        default:
+            // Any other value must be the result of an instruction in the
+            // current function, which we haven't got to yet
+            if (!as<IRBlock>(inst->getParent()))
+            {
+                unsupported("global value");
+                return 0;
+            }
+            return getID(inst);
+        }
+
+        values.Add(inst, id);
+        return id;
+    }
+
+    SpvWord getStorageClass(IRInst* inst)
+    {
+        SpvWord storageClass;
+        if (storageClasses.TryGetValue(inst, storageClass))
+            return storageClass;
+
+        // Make sure a global variable has been declared
+        if (as<IRGlobalVar>(inst))
+        {
+            getValue(inst);
+            if (storageClasses.TryGetValue(inst, storageClass))
+                return storageClass;
+        }
+
+        unsupported("pointer");
+        return SpvStorageClassFunction;
+    }
+
+    // Convert `value` from one shape to another, with the same conversions
+    // as HLSL: numeric conversions between element kinds, splatting of
+    // scalars, and truncation of vectors.
+    SpvWord convertValue(SpvWord value, ValueShape from, ValueShape to)
+    {
+        if (!from.isValid() || !to.isValid())
+        {
+            unsupported("conversion");
+            return value;
+        }
+
+        // Truncate first, while the elements are still of the source kind
+        if (from.count > to.count)
+        {
+            ValueShape truncated(from.kind, to.count);
+            SpvWord typeID = getShapeTypeID(truncated);
+            if (to.count == 1)
+            {
+                value = emitValueInst(SpvOpCompositeExtract, typeID, { value, 0 });
+            }
+            else
+            {
+                List<SpvWord> operands;
+                operands.Add(typeID);
+                SpvWord id = allocateID();
+                operands.Add(id);
+                operands.Add(value);
+                operands.Add(value);
+                for (UInt ii = 0; ii < to.count; ++ii)
+                    operands.Add(SpvWord(ii));
+                emitInst(body, SpvOpVectorShuffle, operands);
+                value = id;
+            }
+            from = truncated;
+        }
+        else if (from.count < to.count && from.count != 1)
+        {
+            unsupported("vector conversion");
+            return value;
+        }
+
+        // Then convert each element
+        ValueShape converted(to.kind, from.count);
+        if (from.kind != to.kind)
+        {
+            SpvWord typeID = getShapeTypeID(converted);
+            switch (from.kind)
+            {
+            case ScalarKind::Bool:
+                value = emitValueInst(SpvOpSelect, typeID, {
+                    value,
+                    getShapeConstant(converted, getOneBits(to.kind)),
+                    getShapeConstant(converted, 0) });
+                break;
+
+            case ScalarKind::SInt:
+            case ScalarKind::UInt:
+                switch (to.kind)
+                {
+                case ScalarKind::Bool:
+                    value = emitValueInst(SpvOpINotEqual, typeID, { value, getShapeConstant(from, 0) });
+                    break;
+                case ScalarKind::Float:
+                    value = emitValueInst(from.kind == ScalarKind::SInt ? SpvOpConvertSToF : SpvOpConvertUToF, typeID, { value });
+                    break;
+                default:
+                    value = emitValueInst(SpvOpBitcast, typeID, { value });
+                    break;
+                }
+                break;
+
+            case ScalarKind::Float:
+                switch (to.kind)
+                {
+                case ScalarKind::Bool:
+                    value = emitValueInst(SpvOpFUnordNotEqual, typeID, { value, getShapeConstant(from, 0) });
+                    break;
+                case ScalarKind::SInt:
+                    value = emitValueInst(SpvOpConvertFToS, typeID, { value });
+                    break;
+                default:
+                    value = emitValueInst(SpvOpConvertFToU, typeID, { value });
+                    break;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        // Finally splat a scalar out to a vector
+        if (converted.count == 1 && to.count > 1)
+            value = splat(value, to);
+
+        return value;
+    }
+
+    SpvWord splat(SpvWord scalar, ValueShape shape)
+    {
+        List<SpvWord> operands;
+        operands.Add(getShapeTypeID(shape));
+        SpvWord id = allocateID();
+        operands.Add(id);
+        for (UInt ii = 0; ii < shape.count; ++ii)
+            operands.Add(scalar);
+        emitInst(body, SpvOpCompositeConstruct, operands);
+        return id;
+    }
+
+    // Get the value of `inst`, converted to `type`
+    SpvWord getValueAs(IRInst* inst, IRType* type)
+    {
+        auto fromType = inst->getDataType();
+        if (fromType == type || getType(fromType) == getType(type))
+            return getValue(inst);
+        return getValueAs(inst, getValueShape(type));
+    }
+
+    SpvWord getValueAs(IRInst* inst, ValueShape shape)
+    {
+        // Literals are converted up front, rather than with instructions
+        if (auto constant = as<IRConstant>(inst))
+        {
+            if (SpvWord id = getConvertedConstant(constant, shape))
+                return id;
+        }
+        return convertValue(getValue(inst), getValueShape(inst->getDataType()), shape);
+    }
+
+    // Get the literal `constant` converted to `shape`, or zero if it can't be
+    SpvWord getConvertedConstant(IRConstant* constant, ValueShape shape)
+    {
+        if (!shape.isValid())
+            return 0;
+
+        bool isFloat = false;
+        IRIntegerValue intValue = 0;
+        IRFloatingPointValue floatValue = 0;
+        switch (constant->op)
+        {
+        case kIROp_boolConst:
+            intValue = constant->value.intVal ? 1 : 0;
+            break;
+        case kIROp_IntLit:
+            intValue = constant->value.intVal;
+            break;
+        case kIROp_FloatLit:
+            isFloat = true;
+            floatValue = constant->value.floatVal;
+            break;
+        default:
+            return 0;
+        }
+
+        SpvWord bits = 0;
+        switch (shape.kind)
+        {
+        case ScalarKind::Bool:
+            bits = (isFloat ? floatValue != 0 : intValue != 0) ? 1 : 0;
+            break;
+
+        case ScalarKind::SInt:
+        case ScalarKind::UInt:
+            if (isFloat)
+            {
+                // Leave anything that doesn't convert exactly to an instruction
+                if (floatValue != IRFloatingPointValue(IRIntegerValue(floatValue)))
+                    return 0;
+                intValue = IRIntegerValue(floatValue);
+            }
+            bits = SpvWord(intValue);
+            break;
+
+        case ScalarKind::Float:
+            {
+                float value = isFloat ? float(floatValue) : float(intValue);
+                memcpy(&bits, &value, sizeof(bits));
+            }
+            break;
+
+        default:
+            return 0;
+        }
+        return getShapeConstant(shape, bits);
+    }
+
+    // Global variables
+
+    SpvWord emitVariable(List<SpvWord>& stream, SpvWord storageClass, IRType* valueType)
+    {
+        SpvWord id = allocateID();
+        emitInst(stream, SpvOpVariable, { getPointerType(storageClass, valueType), id, storageClass });
+        return id;
+    }
+
+    // Decorate a buffer variable with its descriptor set and binding
+    void decorateBinding(SpvWord id, VarLayout* const* layouts, UInt layoutCount)
+    {
+        bool found = false;
+        UInt binding = 0;
+        UInt set = 0;
+        for (UInt ii = 0; ii < layoutCount; ++ii)
+        {
+            auto layout = layouts[ii];
+            if (!layout)
+                continue;
+            if (auto resInfo = layout->FindResourceInfo(LayoutResourceKind::DescriptorTableSlot))
+            {
+                found = true;
+                binding += resInfo->index;
+                set += resInfo->space;
+            }
+            if (auto resInfo = layout->FindResourceInfo(LayoutResourceKind::RegisterSpace))
+            {
+                set += resInfo->index;
+            }
+        }
+        if (!found)
+        {
+            unsupported("buffer without a binding");
+            return;
+        }
+
+        emitInst(annotations, SpvOpDecorate, { id, SpvDecorationDescriptorSet, SpvWord(set) });
+        emitInst(annotations, SpvOpDecorate, { id, SpvDecorationBinding, SpvWord(binding) });
+    }
+
+    // Declare the block `struct` for a buffer, with `contentTypeID` as its only member
+    SpvWord emitBufferBlockType(SpvWord contentTypeID, SpvDecoration blockDecoration, bool readOnly)
+    {
+        SpvWord id = allocateID();
+        emitInst(globals, SpvOpTypeStruct, { id, contentTypeID });
+        emitInst(annotations, SpvOpDecorate, { id, blockDecoration });
+        emitInst(annotations, SpvOpMemberDecorate, { id, 0, SpvDecorationOffset, 0 });
+        if (readOnly)
+            emitInst(annotations, SpvOpMemberDecorate, { id, 0, SpvDecorationNonWritable });
+        return id;
+    }
+
+    SpvWord emitStructuredBufferVar(IRGlobalVar* var, IRHLSLStructuredBufferTypeBase* type, VarLayout* layout)
+    {
+        switch (type->op)
+        {
+        case kIROp_HLSLStructuredBufferType:
+        case kIROp_HLSLRWStructuredBufferType:
+            break;
+        default:
+            unsupported("structured buffer type");
+            return 0;
+        }
+
+        auto elementType = type->getElementType();
+        UInt elementSize;
+        UInt elementAlignment;
+        if (!applyBufferLayout(elementType, BufferLayoutRules::Std430, elementSize, elementAlignment))
+            return 0;
+        UInt stride = roundUpToMultiple(elementSize, elementAlignment);
+
+        // Runtime arrays are declared for each buffer, since their stride is
+        // a decoration
+        SpvWord arrayTypeID = allocateID();
+        emitInst(globals, SpvOpTypeRuntimeArray, { arrayTypeID, getType(elementType) });
+        emitInst(annotations, SpvOpDecorate, { arrayTypeID, SpvDecorationArrayStride, SpvWord(stride) });
+
+        SpvWord blockTypeID = emitBufferBlockType(
+            arrayTypeID,
+            SpvDecorationBufferBlock,
+            type->op == kIROp_HLSLStructuredBufferType);
+
+        SpvWord id = allocateID();
+        emitInst(globals, SpvOpVariable, {
+            getPointerTypeID(SpvStorageClassUniform, blockTypeID),
+            id,
+            SpvStorageClassUniform });
+
+        VarLayout* layouts[] = { layout };
+        decorateBinding(id, layouts, 1);
+
+        storageClasses.Add(var, SpvStorageClassUniform);
+        bufferVars.Add(var, id);
+        return id;
+    }
+
+    SpvWord emitConstantBufferVar(IRGlobalVar* var, IRConstantBufferType* type, VarLayout* layout)
+    {
+        auto elementType = type->getElementType();
+        UInt elementSize;
+        UInt elementAlignment;
+        if (!applyBufferLayout(elementType, BufferLayoutRules::Std140, elementSize, elementAlignment))
+            return 0;
+
+        VarLayout* containerLayout = nullptr;
+        if (layout)
+        {
+            if (auto groupTypeLayout = layout->typeLayout.As<ParameterGroupTypeLayout>())
+                containerLayout = groupTypeLayout->containerVarLayout;
+        }
+
+        SpvWord storageClass = SpvStorageClassUniform;
+        if (containerLayout && containerLayout->FindResourceInfo(LayoutResourceKind::PushConstantBuffer))
+            storageClass = SpvStorageClassPushConstant;
+
+        SpvWord blockTypeID = emitBufferBlockType(getType(elementType), SpvDecorationBlock, false);
+
+        SpvWord id = allocateID();
+        emitInst(globals, SpvOpVariable, {
+            getPointerTypeID(storageClass, blockTypeID),
+            id,
+            storageClass });
+
+        if (storageClass != SpvStorageClassPushConstant)
+        {
+            VarLayout* layouts[] = { layout, containerLayout };
+            decorateBinding(id, layouts, 2);
+        }
+
+        storageClasses.Add(var, storageClass);
+        bufferVars.Add(var, id);
+        return id;
+    }
+
+    bool decorateVarying(IRGlobalVar* var, SpvWord id, VarLayout* layout, LayoutResourceKind kind, IRType* valueType)
+    {
+        if (var->findDecoration<IRGLSLOuterArrayDecoration>())
+            return unsupported("arrayed system value");
+
+        auto& name = getText(var->mangledName);
+        if (name.StartsWith("gl_"))
+        {
+            struct BuiltInInfo
+            {
+                char const* name;
+                SpvBuiltIn  builtIn;
+            };
+            static const BuiltInInfo kBuiltIns[] =
+            {
+                { "gl_Position",                SpvBuiltInPosition },
+                { "gl_FragCoord",               SpvBuiltInFragCoord },
+                { "gl_FrontFacing",             SpvBuiltInFrontFacing },
+                { "gl_FragDepth",               SpvBuiltInFragDepth },
+                { "gl_WorkGroupID",             SpvBuiltInWorkgroupId },
+                { "gl_LocalInvocationID",       SpvBuiltInLocalInvocationId },
+                { "gl_GlobalInvocationID",      SpvBuiltInGlobalInvocationId },
+                { "gl_LocalInvocationIndex",    SpvBuiltInLocalInvocationIndex },
+                { "gl_VertexIndex",             SpvBuiltInVertexIndex },
+                { "gl_InstanceIndex",           SpvBuiltInInstanceIndex },
+            };
+            for (auto const& info : kBuiltIns)
+            {
+                if (name == info.name)
+                {
+                    emitInst(annotations, SpvOpDecorate, { id, SpvDecorationBuiltIn, info.builtIn });
+                    if (info.builtIn == SpvBuiltInFragDepth)
+                        usesFragDepth = true;
+                    return true;
+                }
+            }
+            return unsupported("system value");
+        }
+
+        auto resInfo = layout->FindResourceInfo(kind);
+        emitInst(annotations, SpvOpDecorate, { id, SpvDecorationLocation, SpvWord(resInfo->index) });
+
+        // Fragment shader inputs need their interpolation modes, and must be
+        // `flat` if they hold integers
+        if (stage == Stage::Fragment && kind == LayoutResourceKind::VaryingInput)
+        {
+            bool anyModes = false;
+            for (auto dd = var->firstDecoration; dd; dd = dd->next)
+            {
+                if (dd->op != kIRDecorationOp_InterpolationMode)
+                    continue;
+
+                anyModes = true;
+                switch (((IRInterpolationModeDecoration*) dd)->mode)
+                {
+                case IRInterpolationMode::NoInterpolation:
+                    emitInst(annotations, SpvOpDecorate, { id, SpvDecorationFlat });
+                    break;
+                case IRInterpolationMode::NoPerspective:
+                    emitInst(annotations, SpvOpDecorate, { id, SpvDecorationNoPerspective });
+                    break;
+                case IRInterpolationMode::Centroid:
+                    emitInst(annotations, SpvOpDecorate, { id, SpvDecorationCentroid });
+                    break;
+                case IRInterpolationMode::Linear:
+                    break;
+                default:
+                    return unsupported("interpolation mode");
+                }
+            }
+
+            auto shape = getValueShape(valueType);
+            if (!anyModes && (shape.kind == ScalarKind::SInt || shape.kind == ScalarKind::UInt))
+                emitInst(annotations, SpvOpDecorate, { id, SpvDecorationFlat });
+        }
+        return true;
+    }
+
+    SpvWord emitGlobalVar(IRGlobalVar* var)
+    {
+        if (var->getFirstBlock())
+        {
+            unsupported("global variable initializer");
+            return 0;
+        }
+
+        auto valueType = var->getDataType()->getValueType();
+        auto layout = getVarLayout(var);
+
+        if (auto structuredBufferType = as<IRHLSLStructuredBufferTypeBase>(valueType))
+            return emitStructuredBufferVar(var, structuredBufferType, layout);
+        if (auto constantBufferType = as<IRConstantBufferType>(valueType))
+            return emitConstantBufferVar(var, constantBufferType, layout);
+
+        SpvWord storageClass = SpvStorageClassPrivate;
+        LayoutResourceKind varyingKind = LayoutResourceKind::None;
+        if (as<IRGroupSharedRate>(var->getRate()))
+        {
+            storageClass = SpvStorageClassWorkgroup;
+        }
+        else if (layout)
+        {
+            if (layout->FindResourceInfo(LayoutResourceKind::VaryingInput))
+            {
+                storageClass = SpvStorageClassInput;
+                varyingKind = LayoutResourceKind::VaryingInput;
+            }
+            else if (layout->FindResourceInfo(LayoutResourceKind::VaryingOutput))
+            {
+                storageClass = SpvStorageClassOutput;
+                varyingKind = LayoutResourceKind::VaryingOutput;
+            }
+            else
+            {
+                unsupported("shader parameter");
+                return 0;
+            }
+        }
+
+        SpvWord id = emitVariable(globals, storageClass, valueType);
+        storageClasses.Add(var, storageClass);
+
+        if (varyingKind != LayoutResourceKind::None)
+        {
+            interfaceVars.Add(id);
+            decorateVarying(var, id, layout, varyingKind, valueType);
+        }
+        return id;
+    }
+
+    // Functions
+
+    bool isLoopHeader(IRBlock* block)
+    {
+        return loops.TryGetValue(block) != nullptr;
+    }
+
+    // Is `block` where some loop breaks or continues to?
+    bool isLoopExit(IRBlock* block)
+    {
+        for (auto& entry : loops)
+        {
+            if (entry.Value.breakBlock == block || entry.Value.continueBlock == block)
+                return true;
+        }
+        return false;
+    }
+
+    // The label of the SPIR-V block that the instructions of `block` end up in
+    // (which is different from its own label for a loop header)
+    SpvWord getExitLabel(IRBlock* block)
+    {
+        if (auto loopInfo = loops.TryGetValue(block))
+            return loopInfo->bodyLabel;
+        return getID(block);
+    }
+
+    // The label that a branch from `branch` to `target` should use, which
+    // is our added continue block for a back edge to a loop that continues at
+    // its header
+    SpvWord getBranchTargetLabel(IRInst* branch, IRBlock* target)
+    {
+        if (auto loopInfo = loops.TryGetValue(target))
+        {
+            if (loopInfo->continueLabel && branch != loopInfo->loopInst)
+                return loopInfo->continueLabel;
+        }
+        return getID(target);
+    }
+
+    static UInt getFirstBranchArg(IRInst* branch)
+    {
+        return branch->op == kIROp_loop ? 3 : 1;
+    }
+
+    // Work out the loops in `func`, and the arguments passed to each block
+    bool analyzeFunc(IRFunc* func)
+    {
+        loops = Dictionary<IRBlock*, LoopInfo>();
+        incomingBranches = Dictionary<IRBlock*, List<IRInst*>>();
+        continueBlocksBefore = Dictionary<IRBlock*, List<IRBlock*>>();
+        mergeBlocks = HashSet<IRBlock*>();
+
+        // Count the edges into each block, to make sure that every edge into
+        // a block with parameters passes arguments for them
+        Dictionary<IRBlock*, UInt> edgeCounts;
+        auto addEdge = [&](IRBlock* target)
+        {
+            if (auto count = edgeCounts.TryGetValue(target))
+                (*count)++;
+            else
+                edgeCounts.Add(target, 1);
+        };
+
+        for (auto block = func->getFirstBlock(); block; block = block->getNextBlock())
+        {
+            auto terminator = block->getTerminator();
+            if (!terminator)
+                return unsupported("block without a terminator");
+
+            switch (terminator->op)
+            {
+            case kIROp_loop:
+                {
+                    auto loopInst = cast<IRLoop>(terminator);
+                    auto header = loopInst->getTargetBlock();
+                    if (loops.TryGetValue(header))
+                        return unsupported("loop header shared by loops");
+
+                    LoopInfo info;
+                    info.loopInst = loopInst;
+                    info.breakBlock = loopInst->getBreakBlock();
+                    info.continueBlock = loopInst->getContinueBlock();
+                    info.bodyLabel = allocateID();
+                    if (info.continueBlock == header)
+                    {
+                        info.continueLabel = allocateID();
+                        if (auto list = continueBlocksBefore.TryGetValue(info.breakBlock))
+                            list->Add(header);
+                        else
+                        {
+                            List<IRBlock*> headers;
+                            headers.Add(header);
+                            continueBlocksBefore.Add(info.breakBlock, headers);
+                        }
+                    }
+                    loops.Add(header, info);
+                }
+                // fall through
+            case kIROp_unconditionalBranch:
+                {
+                    auto target = cast<IRUnconditionalBranch>(terminator)->getTargetBlock();
+                    addEdge(target);
+
+                    if (terminator->getOperandCount() > getFirstBranchArg(terminator))
+                    {
+                        if (auto list = incomingBranches.TryGetValue(target))
+                            list->Add(terminator);
+                        else
+                        {
+                            List<IRInst*> branches;
+                            branches.Add(terminator);
+                            incomingBranches.Add(target, branches);
+                        }
+                    }
+                }
+                break;
+
+            case kIROp_ifElse:
+                {
+                    auto ifElse = cast<IRIfElse>(terminator);
+                    addEdge(ifElse->getTrueBlock());
+                    addEdge(ifElse->getFalseBlock());
+                }
+                break;
+
+            case kIROp_switch:
+                {
+                    auto switchInst = cast<IRSwitch>(terminator);
+                    addEdge(switchInst->getDefaultLabel());
+                    for (UInt cc = 0; cc < switchInst->getCaseCount(); ++cc)
+                        addEdge(switchInst->getCaseLabel(cc));
+                }
+                break;
+
+            case kIROp_ReturnVal:
+            case kIROp_ReturnVoid:
+            case kIROp_discard:
+            case kIROp_unreachable:
+                break;
+
+            default:
+                return unsupported("terminator");
+            }
+        }
+
+        // The entry block can't be branched to
+        if (edgeCounts.TryGetValue(func->getFirstBlock()))
+            return unsupported("branch to entry block");
+
+        for (auto block = func->getFirstBlock()->getNextBlock(); block; block = block->getNextBlock())
+        {
+            if (!block->getFirstParam())
+                continue;
+
+            UInt edgeCount = 0;
+            edgeCounts.TryGetValue(block, edgeCount);
+            auto branches = incomingBranches.TryGetValue(block);
+            if (!branches || branches->Count() != edgeCount)
+                return unsupported("block parameter without arguments");
+        }
+        return true;
+    }
+
+    // Emit the phis for the parameters of `block`, for the branches in `branches`
+    void emitPhis(IRBlock* block, List<IRInst*> const& branches, SpvWord extraLabel, List<SpvWord> const* extraValues)
+    {
+        UInt paramIndex = 0;
+        for (auto param = block->getFirstParam(); param; param = param->getNextParam(), ++paramIndex)
+        {
+            List<SpvWord> operands;
+            operands.Add(getType(param->getDataType()));
+            operands.Add(getID(param));
+            for (auto branch : branches)
+            {
+                operands.Add(getValue(branch->getOperand(getFirstBranchArg(branch) + paramIndex)));
+                operands.Add(getExitLabel(as<IRBlock>(branch->getParent())));
+            }
+            if (extraValues)
+            {
+                operands.Add((*extraValues)[paramIndex]);
+                operands.Add(extraLabel);
+            }
+            emitInst(body, SpvOpPhi, operands);
+        }
+    }
+
+    // Emit the continue block we add for the loop with header `header`
+    void emitAddedContinueBlock(IRBlock* header, LoopInfo& loopInfo)
+    {
+        emitInst(body, SpvOpLabel, { loopInfo.continueLabel });
+
+        // Its phis take the values from every back edge, and it passes them
+        // on to those of the header
+        List<IRInst*> backEdges;
+        if (auto branches = incomingBranches.TryGetValue(header))
+        {
+            for (auto branch : *branches)
+            {
+                if (branch != loopInfo.loopInst)
+                    backEdges.Add(branch);
+            }
+        }
+
+        UInt paramIndex = 0;
+        for (auto param = header->getFirstParam(); param; param = param->getNextParam(), ++paramIndex)
+        {
+            List<SpvWord> operands;
+            operands.Add(getType(param->getDataType()));
+            operands.Add(loopInfo.continuePhis[paramIndex]);
+            for (auto branch : backEdges)
+            {
+                operands.Add(getValue(branch->getOperand(getFirstBranchArg(branch) + paramIndex)));
+                operands.Add(getExitLabel(as<IRBlock>(branch->getParent())));
+            }
+            emitInst(body, SpvOpPhi, operands);
+        }
+        emitInst(body, SpvOpBranch, { getID(header) });
+    }
+
+    void emitBlockStart(IRBlock* block, bool isEntryBlock)
+    {
+        if (!isEntryBlock)
+            emitInst(body, SpvOpLabel, { getID(block) });
+
+        auto loopInfo = loops.TryGetValue(block);
+        if (!isEntryBlock && block->getFirstParam())
+        {
+            List<IRInst*> branches;
+            if (auto list = incomingBranches.TryGetValue(block))
+            {
+                for (auto branch : *list)
+                {
+                    if (!loopInfo || !loopInfo->continueLabel || branch == loopInfo->loopInst)
+                        branches.Add(branch);
+                }
+            }
+
+            if (loopInfo && loopInfo->continueLabel)
+            {
+                for (auto param = block->getFirstParam(); param; param = param->getNextParam())
+                    loopInfo->continuePhis.Add(allocateID());
+                emitPhis(block, branches, loopInfo->continueLabel, &loopInfo->continuePhis);
+            }
+            else
+            {
+                emitPhis(block, branches, 0, nullptr);
+            }
+        }
+
+        if (loopInfo)
+        {
+            if (!mergeBlocks.Add(loopInfo->breakBlock))
+            {
+                unsupported("shared merge block");
+                return;
+            }
+
+            SpvWord continueLabel = loopInfo->continueLabel ? loopInfo->continueLabel : getID(loopInfo->continueBlock);
+            SpvWord loopControl = 0;
+            if (auto decoration = loopInfo->loopInst->findDecoration<IRLoopControlDecoration>())
+            {
+                if (decoration->mode == kIRLoopControl_Unroll)
+                    loopControl = SpvLoopControlUnrollMask;
+            }
+
+            emitInst(body, SpvOpLoopMerge, { getID(loopInfo->breakBlock), continueLabel, loopControl });
+            emitInst(body, SpvOpBranch, { loopInfo->bodyLabel });
+            emitInst(body, SpvOpLabel, { loopInfo->bodyLabel });
+        }
+    }
+
+    void emitTerminator(IRInst* inst)
+    {
+        switch (inst->op)
+        {
+        case kIROp_ReturnVoid:
+            emitInst(body, SpvOpReturn, {});
+            break;
+
+        case kIROp_ReturnVal:
+            {
+                auto func = as<IRFunc>(inst->getParent()->getParent());
+                emitInst(body, SpvOpReturnValue, { getValueAs(cast<IRReturnVal>(inst)->getVal(), func->getResultType()) });
+            }
+            break;
+
+        case kIROp_loop:
+            emitInst(body, SpvOpBranch, { getID(cast<IRLoop>(inst)->getTargetBlock()) });
+            break;
+
+        case kIROp_unconditionalBranch:
+            emitInst(body, SpvOpBranch, { getBranchTargetLabel(inst, cast<IRUnconditionalBranch>(inst)->getTargetBlock()) });
+            break;
+
+        case kIROp_ifElse:
+            {
+                auto ifElse = cast<IRIfElse>(inst);
+                auto afterBlock = ifElse->getAfterBlock();
+
+                // A conditional branch back to a loop header (the test of a
+                // `do`/`while` loop) isn't a selection, and so mustn't have a
+                // merge instruction. Nor does a branch that either carries on
+                // or leaves the loop (such as the test of a `for` loop).
+                bool isSelection = !isLoopHeader(afterBlock);
+                if (ifElse->getTrueBlock() == afterBlock && isLoopExit(ifElse->getFalseBlock()))
+                    isSelection = false;
+                if (ifElse->getFalseBlock() == afterBlock && isLoopExit(ifElse->getTrueBlock()))
+                    isSelection = false;
+
+                if (isSelection)
+                {
+                    if (!mergeBlocks.Add(afterBlock))
+                    {
+                        unsupported("shared merge block");
+                        return;
+                    }
+                    emitInst(body, SpvOpSelectionMerge, { getID(afterBlock), 0 });
+                }
+
+                SpvWord condition = getValueAs(ifElse->getCondition(), ValueShape(ScalarKind::Bool, 1));
+                emitInst(body, SpvOpBranchConditional, {
+                    condition,
+                    getBranchTargetLabel(inst, ifElse->getTrueBlock()),
+                    getBranchTargetLabel(inst, ifElse->getFalseBlock()) });
+            }
+            break;
+
+        case kIROp_switch:
+            {
+                auto switchInst = cast<IRSwitch>(inst);
+                auto shape = getValueShape(switchInst->getCondition()->getDataType());
+                if (shape.count != 1 || (shape.kind != ScalarKind::SInt && shape.kind != ScalarKind::UInt))
+                {
+                    unsupported("switch value");
+                    return;
+                }
+
+                if (!mergeBlocks.Add(switchInst->getBreakLabel()))
+                {
+                    unsupported("shared merge block");
+                    return;
+                }
+                emitInst(body, SpvOpSelectionMerge, { getID(switchInst->getBreakLabel()), 0 });
+
+                List<SpvWord> operands;
+                operands.Add(getValue(switchInst->getCondition()));
+                operands.Add(getBranchTargetLabel(inst, switchInst->getDefaultLabel()));
+                for (UInt cc = 0; cc < switchInst->getCaseCount(); ++cc)
+                {
+                    operands.Add(SpvWord(GetIntVal(switchInst->getCaseValue(cc))));
+                    operands.Add(getBranchTargetLabel(inst, switchInst->getCaseLabel(cc)));
+                }
+                emitInst(body, SpvOpSwitch, operands);
+            }
+            break;
+
+        case kIROp_discard:
+            emitInst(body, SpvOpKill, {});
+            break;
+
+        case kIROp_unreachable:
+            emitInst(body, SpvOpUnreachable, {});
+            break;
+
+        default:
+            unsupported("terminator");
+            break;
+        }
+    }
+
+    bool emitFunc(IRFunc* func, SpvWord funcID)
+    {
+        auto entryBlock = func->getFirstBlock();
+        if (!entryBlock)
+            return unsupported("function declaration");
+
+        if (!analyzeFunc(func))
+            return false;
+
+        localVars = List<SpvWord>();
+        body = List<SpvWord>();
+
+        List<SpvWord> header;
+        emitInst(header, SpvOpFunction, {
+            getType(func->getResultType()),
+            funcID,
+            0,
+            getType(func->getDataType()) });
+        for (auto param = entryBlock->getFirstParam(); param; param = param->getNextParam())
+        {
+            auto paramType = param->getDataType();
+            emitInst(header, SpvOpFunctionParameter, { getType(paramType), getID(param) });
+            if (as<IRPtrTypeBase>(paramType))
+                storageClasses.Add(param, SpvStorageClassFunction);
+        }
+        emitInst(header, SpvOpLabel, { getID(entryBlock) });
+
+        for (auto block = entryBlock; block; block = block->getNextBlock())
+        {
+            if (auto headers = continueBlocksBefore.TryGetValue(block))
+            {
+                for (auto loopHeader : *headers)
+                    emitAddedContinueBlock(loopHeader, *loops.TryGetValue(loopHeader));
+            }
+
+            emitBlockStart(block, block == entryBlock);
+
+            for (auto inst = block->getFirstInst(); inst; inst = inst->getNextInst())
+            {
+                if (failure)
+                    return false;
+
+                if (as<IRTerminatorInst>(inst))
+                    emitTerminator(inst);
+                else if (inst->op != kIROp_Param)
+                    emitLocalInst(inst);
+            }
+        }
+        if (failure)
+            return false;
+
+        // Local variables have to come first in the entry block
+        functions.AddRange(header);
+        functions.AddRange(localVars);
+        functions.AddRange(body);
+        emitInst(functions, SpvOpFunctionEnd, {});
+        return true;
+    }
+
+    // Instructions
+
+    void emitBinaryArithmetic(IRInst* inst, SpvOp floatOp, SpvOp sintOp, SpvOp uintOp)
+    {
+        auto type = inst->getDataType();
+        auto shape = getValueShape(type);
+
+        SpvOp op;
+        switch (shape.kind)
+        {
+        case ScalarKind::Float: op = floatOp; break;
+        case ScalarKind::SInt:  op = sintOp; break;
+        case ScalarKind::UInt:  op = uintOp; break;
+        default:
+            unsupported("arithmetic operand");
+            return;
+        }
+
+        SpvWord left = getValueAs(inst->getOperand(0), type);
+        SpvWord right = getValueAs(inst->getOperand(1), type);
+        emitInst(body, op, { getType(type), getID(inst), left, right });
+    }
+
+    void emitBitwise(IRInst* inst, SpvOp logicalOp, SpvOp bitwiseOp)
+    {
+        auto type = inst->getDataType();
+        auto shape = getValueShape(type);
+        if (!shape.isValid() || shape.kind == ScalarKind::Float)
+        {
+            unsupported("bitwise operand");
+            return;
+        }
+
+        SpvWord left = getValueAs(inst->getOperand(0), type);
+        SpvWord right = getValueAs(inst->getOperand(1), type);
+        emitInst(body, shape.kind == ScalarKind::Bool ? logicalOp : bitwiseOp, { getType(type), getID(inst), left, right });
+    }
+
+    void emitShift(IRInst* inst, SpvOp sintOp, SpvOp uintOp)
+    {
+        auto type = inst->getDataType();
+        auto shape = getValueShape(type);
+        auto amountShape = getValueShape(inst->getOperand(1)->getDataType());
+        if ((shape.kind != ScalarKind::SInt && shape.kind != ScalarKind::UInt)
+            || (amountShape.kind != ScalarKind::SInt && amountShape.kind != ScalarKind::UInt))
+        {
+            unsupported("shift operand");
+            return;
+        }
+
+        // The shift amount can have a different type, but must have the same
+        // number of elements
+        SpvWord value = getValueAs(inst->getOperand(0), type);
+        SpvWord amount = getValueAs(inst->getOperand(1), ValueShape(amountShape.kind, shape.count));
+        emitInst(body, shape.kind == ScalarKind::SInt ? sintOp : uintOp, { getType(type), getID(inst), value, amount });
+    }
+
+    void emitComparison(IRInst* inst, SpvOp floatOp, SpvOp sintOp, SpvOp uintOp, SpvOp boolOp)
+    {
+        auto left = inst->getOperand(0);
+        auto right = inst->getOperand(1);
+        auto leftShape = getValueShape(left->getDataType());
+        auto rightShape = getValueShape(right->getDataType());
+
+        // Compare as the type of the left operand, unless it is a scalar that
+        // is being compared with a vector
+        ValueShape shape(leftShape.kind, leftShape.count > rightShape.count ? leftShape.count : rightShape.count);
+        if (!leftShape.isValid() || !rightShape.isValid())
+        {
+            unsupported("comparison operand");
+            return;
+        }
+
+        SpvOp op;
+        switch (shape.kind)
+        {
+        case ScalarKind::Float: op = floatOp; break;
+        case ScalarKind::SInt:  op = sintOp; break;
+        case ScalarKind::UInt:  op = uintOp; break;
+        default:                op = boolOp; break;
+        }
+        if (!op)
+        {
+            unsupported("comparison operand");
+            return;
+        }
+
+        SpvWord leftID = getValueAs(left, shape);
+        SpvWord rightID = getValueAs(right, shape);
+        emitInst(body, op, { getShapeTypeID(ValueShape(ScalarKind::Bool, shape.count)), getID(inst), leftID, rightID });
+    }
+
+    void emitConstruct(IRInst* inst)
+    {
+        auto type = inst->getDataType();
+        auto shape = getValueShape(type);
+        UInt argCount = inst->getOperandCount();
+
+        if (argCount == 0)
+        {
+            setValue(inst, getNullConstant(getType(type)));
+            return;
+        }
+
+        if (shape.isValid())
+        {
+            if (argCount == 1)
+            {
+                setValue(inst, getValueAs(inst->getOperand(0), type));
+                return;
+            }
+
+            // Build a vector from the elements of its arguments
+            List<SpvWord> operands;
+            operands.Add(getType(type));
+            operands.Add(getID(inst));
+
+            UInt elementCount = 0;
+            for (UInt aa = 0; aa < argCount; ++aa)
+            {
+                auto arg = inst->getOperand(aa);
+                auto argShape = getValueShape(arg->getDataType());
+                if (!argShape.isValid())
+                {
+                    unsupported("constructor argument");
+                    return;
+                }
+                operands.Add(getValueAs(arg, ValueShape(shape.kind, argShape.count)));
+                elementCount += argShape.count;
+            }
+            if (elementCount != shape.count)
+            {
+                unsupported("constructor arguments");
+                return;
+            }
+            emitInst(body, SpvOpCompositeConstruct, operands);
+            return;
+        }
+
+        // Arrays and structures are built from one value per element
+        List<IRType*> elementTypes;
+        if (auto arrayType = as<IRArrayType>(type))
+        {
+            UInt count = UInt(GetIntVal(arrayType->getElementCount()));
+            for (UInt ii = 0; ii < count; ++ii)
+                elementTypes.Add(arrayType->getElementType());
+        }
+        else if (auto structType = as<IRStructType>(type))
+        {
+            for (auto field : structType->getFields())
+            {
+                if (as<IRVoidType>(field->getFieldType()))
+                {
+                    unsupported("constructor with void field");
+                    return;
+                }
+                elementTypes.Add(field->getFieldType());
+            }
+        }
+        if (elementTypes.Count() != argCount)
+        {
+            unsupported("constructor");
+            return;
+        }
+
+        List<SpvWord> operands;
+        operands.Add(getType(type));
+        operands.Add(getID(inst));
+        for (UInt aa = 0; aa < argCount; ++aa)
+            operands.Add(getValueAs(inst->getOperand(aa), elementTypes[aa]));
+        emitInst(body, SpvOpCompositeConstruct, operands);
+    }
+
+    // Emit an access chain into a buffer variable's block, for the buffer
+    // contents followed by `indices`
+    SpvWord emitBufferAccessChain(IRInst* buffer, SpvWord resultTypeID, std::initializer_list<SpvWord> indices)
+    {
+        SpvWord bufferVar;
+        if (!bufferVars.TryGetValue(buffer, bufferVar))
+        {
+            unsupported("buffer reference");
+            return 0;
+        }
+
+        List<SpvWord> operands;
+        operands.Add(resultTypeID);
+        SpvWord id = allocateID();
+        operands.Add(id);
+        operands.Add(bufferVar);
+        operands.Add(getUIntConstant(0));
+        operands.AddRange(indices.begin(), indices.size());
+        emitInst(body, SpvOpAccessChain, operands);
+        return id;
+    }
+
+    void emitLocalInst(IRInst* inst)
+    {
+        // Types that ended up in a function (e.g., from specializing a generic)
+        // are declared when they are used
+        if (as<IRType>(inst))
+            return;
+
+        switch (inst->op)
+        {
+        // Values that are only used as the operands of other instructions
+        case kIROp_Specialize:
+        case kIROp_undefined:
+            break;
+
+        case kIROp_Var:
+            {
+                SpvWord id = allocateID();
+                emitInst(localVars, SpvOpVariable, {
+                    getPointerType(SpvStorageClassFunction, cast<IRVar>(inst)->getDataType()->getValueType()),
+                    id,
+                    SpvStorageClassFunction });
+                setValue(inst, id);
+                storageClasses.Add(inst, SpvStorageClassFunction);
+            }
+            break;
+
+        case kIROp_Load:
+            {
+                auto ptr = inst->getOperand(0);
+                auto ptrType = as<IRPtrTypeBase>(ptr->getDataType());
+                auto valueType = ptrType ? ptrType->getValueType() : nullptr;
+
+                // Loading a buffer just gives a reference to it
+                if (as<IRHLSLStructuredBufferTypeBase>(valueType) || as<IRConstantBufferType>(valueType))
+                {
+                    getValue(ptr);
+                    SpvWord bufferVar;
+                    if (!bufferVars.TryGetValue(ptr, bufferVar))
+                    {
+                        unsupported("buffer reference");
+                        return;
+                    }
+                    bufferVars.Add(inst, bufferVar);
+                    storageClasses.Add(inst, getStorageClass(ptr));
+                    return;
+                }
+
+                // Loading the contents of a constant buffer
+                if (auto constantBufferType = as<IRConstantBufferType>(ptr->getDataType()))
+                {
+                    auto elementType = constantBufferType->getElementType();
+                    SpvWord address = emitBufferAccessChain(ptr, getPointerType(getStorageClass(ptr), elementType), {});
+                    emitInst(body, SpvOpLoad, { getType(elementType), getID(inst), address });
+                    return;
+                }
+
+                if (!ptrType)
+                {
+                    unsupported("load");
+                    return;
+                }
+                emitInst(body, SpvOpLoad, { getType(inst->getDataType()), getID(inst), getValue(ptr) });
+            }
+            break;
+
+        case kIROp_Store:
+            {
+                auto ptr = inst->getOperand(0);
+                auto ptrType = as<IRPtrTypeBase>(ptr->getDataType());
+                if (!ptrType)
+                {
+                    unsupported("store");
+                    return;
+                }
+                SpvWord address = getValue(ptr);
+                emitInst(body, SpvOpStore, { address, getValueAs(inst->getOperand(1), ptrType->getValueType()) });
+            }
+            break;
+
+        case kIROp_FieldExtract:
+            {
+                auto base = inst->getOperand(0);
+                auto structType = as<IRStructType>(base->getDataType());
+                SpvWord index;
+                if (!structType || !getFieldIndex(structType, inst->getOperand(1), index))
+                {
+                    unsupported("field extract");
+                    return;
+                }
+                emitInst(body, SpvOpCompositeExtract, { getType(inst->getDataType()), getID(inst), getValue(base), index });
+            }
+            break;
+
+        case kIROp_FieldAddress:
+            {
+                auto base = inst->getOperand(0);
+                auto resultType = as<IRPtrTypeBase>(inst->getDataType());
+
+                // A field of a constant buffer is a member of the buffer's contents
+                if (auto constantBufferType = as<IRConstantBufferType>(base->getDataType()))
+                {
+                    auto structType = as<IRStructType>(constantBufferType->getElementType());
+                    SpvWord index;
+                    if (!structType || !resultType || !getFieldIndex(structType, inst->getOperand(1), index))
+                    {
+                        unsupported("field address");
+                        return;
+                    }
+                    SpvWord storageClass = getStorageClass(base);
+                    setValue(inst, emitBufferAccessChain(
+                        base,
+                        getPointerType(storageClass, resultType->getValueType()),
+                        { getUIntConstant(index) }));
+                    storageClasses.Add(inst, storageClass);
+                    return;
+                }
+
+                auto basePtrType = as<IRPtrTypeBase>(base->getDataType());
+                auto structType = basePtrType ? as<IRStructType>(basePtrType->getValueType()) : nullptr;
+                SpvWord index;
+                if (!structType || !resultType || !getFieldIndex(structType, inst->getOperand(1), index))
+                {
+                    unsupported("field address");
+                    return;
+                }
+                SpvWord storageClass = getStorageClass(base);
+                emitInst(body, SpvOpAccessChain, {
+                    getPointerType(storageClass, resultType->getValueType()),
+                    getID(inst),
+                    getValue(base),
+                    getUIntConstant(index) });
+                storageClasses.Add(inst, storageClass);
+            }
+            break;
+
+        case kIROp_getElementPtr:
+            {
+                auto base = inst->getOperand(0);
+                auto resultType = as<IRPtrTypeBase>(inst->getDataType());
+                if (!resultType)
+                {
+                    unsupported("element address");
+                    return;
+                }
+                SpvWord storageClass = getStorageClass(base);
+                emitInst(body, SpvOpAccessChain, {
+                    getPointerType(storageClass, resultType->getValueType()),
+                    getID(inst),
+                    getValue(base),
+                    getValue(inst->getOperand(1)) });
+                storageClasses.Add(inst, storageClass);
+            }
+            break;
+
+        case kIROp_getElement:
+            {
+                auto base = inst->getOperand(0);
+                auto index = inst->getOperand(1);
+                auto baseType = base->getDataType();
+                SpvWord typeID = getType(inst->getDataType());
+
+                if (auto indexConst = as<IRIntLit>(index))
+                {
+                    emitInst(body, SpvOpCompositeExtract, { typeID, getID(inst), getValue(base), SpvWord(indexConst->getValue()) });
+                }
+                else if (as<IRVectorType>(baseType))
+                {
+                    emitInst(body, SpvOpVectorExtractDynamic, { typeID, getID(inst), getValue(base), getValue(index) });
+                }
+                else if (as<IRArrayType>(baseType))
+                {
+                    // Arrays can only be indexed dynamically through a pointer,
+                    // so copy the array into a temporary
+                    SpvWord temp = emitVariable(localVars, SpvStorageClassFunction, baseType);
+                    emitInst(body, SpvOpStore, { temp, getValue(base) });
+                    SpvWord address = emitValueInst(
+                        SpvOpAccessChain,
+                        getPointerType(SpvStorageClassFunction, inst->getDataType()),
+                        { temp, getValue(index) });
+                    emitInst(body, SpvOpLoad, { typeID, getID(inst), address });
+                }
+                else
+                {
+                    unsupported("element extract");
+                }
+            }
+            break;
+
+        case kIROp_BufferElementRef:
+        case kIROp_BufferLoad:
+        case kIROp_BufferStore:
+            {
+                auto buffer = inst->getOperand(0);
+                auto bufferType = as<IRHLSLStructuredBufferTypeBase>(buffer->getDataType());
+                if (!bufferType)
+                {
+                    unsupported("buffer access");
+                    return;
+                }
+
+                auto elementType = bufferType->getElementType();
+                SpvWord storageClass = getStorageClass(buffer);
+                SpvWord address = emitBufferAccessChain(
+                    buffer,
+                    getPointerType(storageClass, elementType),
+                    { getValue(inst->getOperand(1)) });
+
+                switch (inst->op)
+                {
+                case kIROp_BufferElementRef:
+                    setValue(inst, address);
+                    storageClasses.Add(inst, storageClass);
+                    break;
+                case kIROp_BufferLoad:
+                    emitInst(body, SpvOpLoad, { getType(elementType), getID(inst), address });
+                    break;
+                default:
+                    emitInst(body, SpvOpStore, { address, getValueAs(inst->getOperand(2), elementType) });
+                    break;
+                }
+            }
+            break;
+
+        case kIROp_swizzle:
+            {
+                auto swizzle = cast<IRSwizzle>(inst);
+                auto base = swizzle->getBase();
+                auto baseShape = getValueShape(base->getDataType());
+                UInt elementCount = swizzle->getElementCount();
+                SpvWord typeID = getType(inst->getDataType());
+                if (!baseShape.isValid())
+                {
+                    unsupported("swizzle");
+                    return;
+                }
+
+                if (baseShape.count == 1)
+                {
+                    // A swizzle of a scalar (e.g. `x.xxx`) repeats it
+                    setValue(inst, getValueAs(base, inst->getDataType()));
+                }
+                else if (elementCount == 1)
+                {
+                    emitInst(body, SpvOpCompositeExtract, {
+                        typeID,
+                        getID(inst),
+                        getValue(base),
+                        SpvWord(GetIntVal(swizzle->getElementIndex(0))) });
+                }
+                else
+                {
+                    List<SpvWord> operands;
+                    operands.Add(typeID);
+                    operands.Add(getID(inst));
+                    operands.Add(getValue(base));
+                    operands.Add(getValue(base));
+                    for (UInt ii = 0; ii < elementCount; ++ii)
+                        operands.Add(SpvWord(GetIntVal(swizzle->getElementIndex(ii))));
+                    emitInst(body, SpvOpVectorShuffle, operands);
+                }
+            }
+            break;
+
+        case kIROp_swizzleSet:
+            {
+                // `base` with the elements at the swizzle indices replaced by
+                // the elements of `source`
+                auto swizzleSet = cast<IRSwizzleSet>(inst);
+                auto type = inst->getDataType();
+                auto shape = getValueShape(type);
+                UInt elementCount = swizzleSet->getElementCount();
+                if (!shape.isValid() || shape.count == 1)
+                {
+                    unsupported("swizzle assignment");
+                    return;
+                }
+
+                SpvWord base = getValueAs(swizzleSet->getBase(), type);
+                if (elementCount == 1)
+                {
+                    SpvWord source = getValueAs(swizzleSet->getSource(), ValueShape(shape.kind, 1));
+                    emitInst(body, SpvOpCompositeInsert, {
+                        getType(type),
+                        getID(inst),
+                        source,
+                        base,
+                        SpvWord(GetIntVal(swizzleSet->getElementIndex(0))) });
+                    return;
+                }
+
+                SpvWord source = getValueAs(swizzleSet->getSource(), ValueShape(shape.kind, elementCount));
+                List<SpvWord> operands;
+                operands.Add(getType(type));
+                operands.Add(getID(inst));
+                operands.Add(base);
+                operands.Add(source);
+                for (UInt ee = 0; ee < shape.count; ++ee)
+                {
+                    SpvWord component = SpvWord(ee);
+                    for (UInt ii = 0; ii < elementCount; ++ii)
+                    {
+                        if (UInt(GetIntVal(swizzleSet->getElementIndex(ii))) == ee)
+                            component = SpvWord(shape.count + ii);
+                    }
+                    operands.Add(component);
+                }
+                emitInst(body, SpvOpVectorShuffle, operands);
+            }
+            break;
+
+        case kIROp_SwizzledStore:
+            {
+                // Store each element through its own pointer
+                auto swizzledStore = cast<IRSwizzledStore>(inst);
+                auto dest = swizzledStore->getDest();
+                auto destType = as<IRPtrTypeBase>(dest->getDataType());
+                auto destShape = destType ? getValueShape(destType->getValueType()) : ValueShape();
+                UInt elementCount = swizzledStore->getElementCount();
+                if (!destShape.isValid())
+                {
+                    unsupported("swizzled store");
+                    return;
+                }
+
+                SpvWord storageClass = getStorageClass(dest);
+                ValueShape elementShape(destShape.kind, 1);
+                SpvWord elementPtrTypeID = getPointerTypeID(storageClass, getShapeTypeID(elementShape));
+                SpvWord source = getValueAs(swizzledStore->getSource(), ValueShape(destShape.kind, elementCount));
+                SpvWord destID = getValue(dest);
+                for (UInt ii = 0; ii < elementCount; ++ii)
+                {
+                    SpvWord address = emitValueInst(SpvOpAccessChain, elementPtrTypeID, {
+                        destID,
+                        getUIntConstant(SpvWord(GetIntVal(swizzledStore->getElementIndex(ii)))) });
+                    SpvWord element = source;
+                    if (elementCount != 1)
+                        element = emitValueInst(SpvOpCompositeExtract, getShapeTypeID(elementShape), { source, SpvWord(ii) });
+                    emitInst(body, SpvOpStore, { address, element });
+                }
+            }
+            break;
+
+        case kIROp_Construct:
+        case kIROp_makeVector:
+        case kIROp_makeArray:
+        case kIROp_makeStruct:
+            emitConstruct(inst);
+            break;
+
+        case kIROp_constructVectorFromScalar:
+            setValue(inst, getValueAs(inst->getOperand(0), inst->getDataType()));
+            break;
+
+        case kIROp_Add: emitBinaryArithmetic(inst, SpvOpFAdd, SpvOpIAdd, SpvOpIAdd); break;
+        case kIROp_Sub: emitBinaryArithmetic(inst, SpvOpFSub, SpvOpISub, SpvOpISub); break;
+        case kIROp_Mul: emitBinaryArithmetic(inst, SpvOpFMul, SpvOpIMul, SpvOpIMul); break;
+        case kIROp_Div: emitBinaryArithmetic(inst, SpvOpFDiv, SpvOpSDiv, SpvOpUDiv); break;
+        case kIROp_Mod: emitBinaryArithmetic(inst, SpvOpFRem, SpvOpSRem, SpvOpUMod); break;
+
+        case kIROp_Lsh: emitShift(inst, SpvOpShiftLeftLogical, SpvOpShiftLeftLogical); break;
+        case kIROp_Rsh: emitShift(inst, SpvOpShiftRightArithmetic, SpvOpShiftRightLogical); break;
+
+        case kIROp_BitAnd: emitBitwise(inst, SpvOpLogicalAnd, SpvOpBitwiseAnd); break;
+        case kIROp_BitOr:  emitBitwise(inst, SpvOpLogicalOr, SpvOpBitwiseOr); break;
+        case kIROp_BitXor: emitBitwise(inst, SpvOpLogicalNotEqual, SpvOpBitwiseXor); break;
+
+        case kIROp_Eql: emitComparison(inst, SpvOpFOrdEqual, SpvOpIEqual, SpvOpIEqual, SpvOpLogicalEqual); break;
+        case kIROp_Neq: emitComparison(inst, SpvOpFUnordNotEqual, SpvOpINotEqual, SpvOpINotEqual, SpvOpLogicalNotEqual); break;
+        case kIROp_Less: emitComparison(inst, SpvOpFOrdLessThan, SpvOpSLessThan, SpvOpULessThan, SpvOp(0)); break;
+        case kIROp_Leq: emitComparison(inst, SpvOpFOrdLessThanEqual, SpvOpSLessThanEqual, SpvOpULessThanEqual, SpvOp(0)); break;
+        case kIROp_Greater: emitComparison(inst, SpvOpFOrdGreaterThan, SpvOpSGreaterThan, SpvOpUGreaterThan, SpvOp(0)); break;
+        case kIROp_Geq: emitComparison(inst, SpvOpFOrdGreaterThanEqual, SpvOpSGreaterThanEqual, SpvOpUGreaterThanEqual, SpvOp(0)); break;
+
+        case kIROp_And:
+        case kIROp_Or:
+            {
+                auto type = inst->getDataType();
+                auto shape = getValueShape(type);
+                if (shape.kind != ScalarKind::Bool)
+                {
+                    unsupported("logical operand");
+                    return;
+                }
+                SpvWord left = getValueAs(inst->getOperand(0), type);
+                SpvWord right = getValueAs(inst->getOperand(1), type);
+                emitInst(body, inst->op == kIROp_And ? SpvOpLogicalAnd : SpvOpLogicalOr, { getType(type), getID(inst), left, right });
+            }
+            break;
+
+        case kIROp_Neg:
+            {
+                auto type = inst->getDataType();
+                auto shape = getValueShape(type);
+                if (!shape.isValid() || shape.kind == ScalarKind::Bool)
+                {
+                    unsupported("negation operand");
+                    return;
+                }
+                emitInst(body, shape.kind == ScalarKind::Float ? SpvOpFNegate : SpvOpSNegate, {
+                    getType(type),
+                    getID(inst),
+                    getValueAs(inst->getOperand(0), type) });
+            }
+            break;
+
+        case kIROp_Not:
+        case kIROp_BitNot:
+            {
+                auto type = inst->getDataType();
+                auto shape = getValueShape(type);
+                if (!shape.isValid() || shape.kind == ScalarKind::Float)
+                {
+                    unsupported("not operand");
+                    return;
+                }
+                emitInst(body, shape.kind == ScalarKind::Bool ? SpvOpLogicalNot : SpvOpNot, {
+                    getType(type),
+                    getID(inst),
+                    getValueAs(inst->getOperand(0), type) });
+            }
+            break;
+
+        case kIROp_Select:
+            {
+                auto type = inst->getDataType();
+                auto shape = getValueShape(type);
+
+                // The condition must have as many elements as the result
+                UInt conditionCount = shape.isValid() ? shape.count : 1;
+                SpvWord condition = getValueAs(inst->getOperand(0), ValueShape(ScalarKind::Bool, conditionCount));
+                SpvWord trueValue = getValueAs(inst->getOperand(1), type);
+                SpvWord falseValue = getValueAs(inst->getOperand(2), type);
+                emitInst(body, SpvOpSelect, { getType(type), getID(inst), condition, trueValue, falseValue });
+            }
+            break;
+
+        case kIROp_Dot:
+            emitDot(inst, inst->getOperand(0), inst->getOperand(1));
+            break;
+
+        case kIROp_GroupMemoryBarrierWithGroupSync:
+            emitControlBarrier(SpvScopeWorkgroup, SpvMemorySemanticsAcquireReleaseMask | SpvMemorySemanticsWorkgroupMemoryMask);
+            break;
+
+        case kIROp_Call:
+            emitCall(inst);
+            break;
+
+        default:
+            unsupported("instruction");
+            break;
+        }
+    }
+
+    void emitDot(IRInst* inst, IRInst* left, IRInst* right)
+    {
+        auto leftShape = getValueShape(left->getDataType());
+        auto type = inst->getDataType();
+        if (leftShape.kind != ScalarKind::Float || getValueShape(type).kind != ScalarKind::Float)
+        {
+            unsupported("dot product operand");
+            return;
+        }
+
+        SpvWord leftID = getValue(left);
+        SpvWord rightID = getValueAs(right, leftShape);
+        emitInst(body, leftShape.count == 1 ? SpvOpFMul : SpvOpDot, { getType(type), getID(inst), leftID, rightID });
+    }
+
+    void emitControlBarrier(SpvWord memoryScope, SpvWord semantics)
+    {
+        emitInst(body, SpvOpControlBarrier, {
+            getUIntConstant(SpvScopeWorkgroup),
+            getUIntConstant(memoryScope),
+            getUIntConstant(semantics) });
+    }
+
+    void emitCall(IRInst* inst)
+    {
+        auto callee = getSpecializedValue(inst->getOperand(0));
+        auto func = as<IRFunc>(callee);
+        if (!func)
+        {
+            unsupported("call");
+            return;
+        }
+
+        if (!isDefinition(func))
+        {
+            emitIntrinsicCall(inst, func);
+            return;
+        }
+
+        // Logical addressing only allows variables to be passed by reference
+        List<SpvWord> operands;
+        operands.Add(getType(inst->getDataType()));
+        operands.Add(getID(inst));
+        operands.Add(getValue(func));
+        UInt argCount = inst->getOperandCount() - 1;
+        for (UInt aa = 0; aa < argCount; ++aa)
+        {
+            auto arg = inst->getOperand(aa + 1);
+            if (as<IRPtrTypeBase>(arg->getDataType()))
+            {
+                if (arg->op != kIROp_Var && arg->op != kIROp_Param)
+                {
+                    unsupported("pointer argument");
+                    return;
+                }
+                operands.Add(getValue(arg));
+            }
+            else
+            {
+                operands.Add(getValueAs(arg, func->getParamType(aa)));
+            }
+        }
+        emitInst(body, SpvOpFunctionCall, operands);
+    }
+
+    // Emit a call to a function from the standard library that has no definition
+    void emitIntrinsicCall(IRInst* inst, IRFunc* func)
+    {
+        UInt paramCount = 0;
+        String name = getIntrinsicName(func, paramCount);
+        UInt argCount = inst->getOperandCount() - 1;
+        auto type = inst->getDataType();
+        auto shape = getValueShape(type);
+        auto arg = [&](UInt index) { return inst->getOperand(index + 1); };
+
+        // Functions that map directly to `GLSL.std.450` instructions
+        struct ExtInstInfo
+        {
+            char const* name;
+            GLSLstd450  floatOp;
+            GLSLstd450  sintOp;
+            GLSLstd450  uintOp;
+
+            // True if the arguments have a different type from the result
+            // (e.g., `length`), so that they are converted to the type of the
+            // first argument rather than to the result type
+            bool        reduces;
+        };
+        static const ExtInstInfo kExtInsts[] =
+        {
+            { "abs",        GLSLstd450FAbs,         GLSLstd450SAbs,     GLSLstd450Bad,  false },
+            { "acos",       GLSLstd450Acos,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "asin",       GLSLstd450Asin,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "atan",       GLSLstd450Atan,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "atan2",      GLSLstd450Atan2,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "ceil",       GLSLstd450Ceil,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "clamp",      GLSLstd450FClamp,       GLSLstd450SClamp,   GLSLstd450UClamp, false },
+            { "cos",        GLSLstd450Cos,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "cosh",       GLSLstd450Cosh,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "cross",      GLSLstd450Cross,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "degrees",    GLSLstd450Degrees,      GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "distance",   GLSLstd450Distance,     GLSLstd450Bad,      GLSLstd450Bad,  true },
+            { "exp",        GLSLstd450Exp,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "exp2",       GLSLstd450Exp2,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "floor",      GLSLstd450Floor,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "frac",       GLSLstd450Fract,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "length",     GLSLstd450Length,       GLSLstd450Bad,      GLSLstd450Bad,  true },
+            { "lerp",       GLSLstd450FMix,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "log",        GLSLstd450Log,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "log2",       GLSLstd450Log2,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "mad",        GLSLstd450Fma,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "max",        GLSLstd450FMax,         GLSLstd450SMax,     GLSLstd450UMax, false },
+            { "min",        GLSLstd450FMin,         GLSLstd450SMin,     GLSLstd450UMin, false },
+            { "normalize",  GLSLstd450Normalize,    GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "pow",        GLSLstd450Pow,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "radians",    GLSLstd450Radians,      GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "reflect",    GLSLstd450Reflect,      GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "round",      GLSLstd450Round,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "rsqrt",      GLSLstd450InverseSqrt,  GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "sin",        GLSLstd450Sin,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "sinh",       GLSLstd450Sinh,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "smoothstep", GLSLstd450SmoothStep,   GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "sqrt",       GLSLstd450Sqrt,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "step",       GLSLstd450Step,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "tan",        GLSLstd450Tan,          GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "tanh",       GLSLstd450Tanh,         GLSLstd450Bad,      GLSLstd450Bad,  false },
+            { "trunc",      GLSLstd450Trunc,        GLSLstd450Bad,      GLSLstd450Bad,  false },
+        };
+        for (auto const& info : kExtInsts)
+        {
+            if (name != info.name)
+                continue;
+
+            if (argCount == 0 || argCount != paramCount)
+                break;
+
+            auto argType = info.reduces ? arg(0)->getDataType() : type;
+            auto argShape = getValueShape(argType);
+
+            // `abs` of an unsigned value is a no-op
+            if (argShape.kind == ScalarKind::UInt && info.floatOp == GLSLstd450FAbs)
+            {
+                setValue(inst, getValueAs(arg(0), type));
+                return;
+            }
+
+            GLSLstd450 op = GLSLstd450Bad;
+            switch (argShape.kind)
+            {
+            case ScalarKind::Float: op = info.floatOp; break;
+            case ScalarKind::SInt:  op = info.sintOp; break;
+            case ScalarKind::UInt:  op = info.uintOp; break;
+            default: break;
+            }
+            if (op == GLSLstd450Bad)
+                break;
+
+            List<SpvWord> args;
+            for (UInt aa = 0; aa < argCount; ++aa)
+                args.Add(getValueAs(arg(aa), argType));
+            setValue(inst, emitExtInst(getType(type), op, args));
+            return;
+        }
+
+        if (name == "saturate" && argCount == 1 && shape.kind == ScalarKind::Float)
+        {
+            List<SpvWord> args;
+            args.Add(getValueAs(arg(0), type));
+            args.Add(getShapeConstant(shape, 0));
+            args.Add(getShapeConstant(shape, getOneBits(ScalarKind::Float)));
+            setValue(inst, emitExtInst(getType(type), GLSLstd450FClamp, args));
+            return;
+        }
+        if (name == "rcp" && argCount == 1 && shape.kind == ScalarKind::Float)
+        {
+            emitInst(body, SpvOpFDiv, {
+                getType(type),
+                getID(inst),
+                getShapeConstant(shape, getOneBits(ScalarKind::Float)),
+                getValueAs(arg(0), type) });
+            return;
+        }
+        if (name == "dot" && argCount == 2)
+        {
+            emitDot(inst, arg(0), arg(1));
+            return;
+        }
+        if ((name == "all" || name == "any") && argCount == 1)
+        {
+            auto argShape = getValueShape(arg(0)->getDataType());
+            if (!argShape.isValid())
+                return (void) unsupported("all/any operand");
+
+            SpvWord value = getValueAs(arg(0), ValueShape(ScalarKind::Bool, argShape.count));
+            if (argShape.count == 1)
+                setValue(inst, value);
+            else
+                emitInst(body, name == "all" ? SpvOpAll : SpvOpAny, { getType(type), getID(inst), value });
+            return;
+        }
+        if ((name == "isnan" || name == "isinf") && argCount == 1)
+        {
+            emitInst(body, name == "isnan" ? SpvOpIsNan : SpvOpIsInf, { getType(type), getID(inst), getValue(arg(0)) });
+            return;
+        }
+        if ((name == "asfloat" || name == "asint" || name == "asuint") && argCount == 1)
+        {
+            auto argShape = getValueShape(arg(0)->getDataType());
+            if (!argShape.isValid() || argShape.count != shape.count || argShape.kind == ScalarKind::Bool)
+                return (void) unsupported("bit cast operand");
+
+            if (argShape.kind == shape.kind)
+                setValue(inst, getValue(arg(0)));
+            else
+                emitInst(body, SpvOpBitcast, { getType(type), getID(inst), getValue(arg(0)) });
+            return;
+        }
+
+        // Barriers
+        if (argCount == 0)
+        {
+            SpvWord workgroupSemantics = SpvMemorySemanticsAcquireReleaseMask | SpvMemorySemanticsWorkgroupMemoryMask;
+            SpvWord deviceSemantics = SpvMemorySemanticsAcquireReleaseMask | SpvMemorySemanticsUniformMemoryMask | SpvMemorySemanticsImageMemoryMask;
+            SpvWord allSemantics = deviceSemantics | SpvMemorySemanticsWorkgroupMemoryMask;
+
+            if (name == "GroupMemoryBarrierWithGroupSync")
+                return emitControlBarrier(SpvScopeWorkgroup, workgroupSemantics);
+            if (name == "DeviceMemoryBarrierWithGroupSync")
+                return emitControlBarrier(SpvScopeDevice, deviceSemantics);
+            if (name == "AllMemoryBarrierWithGroupSync")
+                return emitControlBarrier(SpvScopeDevice, allSemantics);
+
+            SpvWord scope = 0;
+            SpvWord semantics = 0;
+            if (name == "GroupMemoryBarrier")
+            {
+                scope = SpvScopeWorkgroup;
+                semantics = workgroupSemantics;
+            }
+            else if (name == "DeviceMemoryBarrier")
+            {
+                scope = SpvScopeDevice;
+                semantics = deviceSemantics;
+            }
+            else if (name == "AllMemoryBarrier")
+            {
+                scope = SpvScopeDevice;
+                semantics = allSemantics;
+            }
+            if (scope)
+            {
+                emitInst(body, SpvOpMemoryBarrier, { getUIntConstant(scope), getUIntConstant(semantics) });
+                return;
+            }
+        }
+
+        if (name.StartsWith("Interlocked"))
+        {
+            emitAtomic(inst, name, argCount);
+            return;
+        }
+
+        // `GetDimensions` on a structured buffer
+        if (name == "GetDimensions" && argCount == 3 && argCount == paramCount + 1)
+        {
+            auto buffer = arg(0);
+            auto bufferType = as<IRHLSLStructuredBufferTypeBase>(buffer->getDataType());
+            SpvWord bufferVar;
+            if (!bufferType || !bufferVars.TryGetValue(buffer, bufferVar))
+                return (void) unsupported("GetDimensions");
+
+            UInt elementSize;
+            UInt elementAlignment;
+            if (!applyBufferLayout(bufferType->getElementType(), BufferLayoutRules::Std430, elementSize, elementAlignment))
+                return;
+
+            SpvWord uintTypeID = getScalarTypeID(ScalarKind::UInt);
+            SpvWord count = emitValueInst(SpvOpArrayLength, uintTypeID, { bufferVar, 0 });
+            emitInst(body, SpvOpStore, { getValue(arg(1)), count });
+            emitInst(body, SpvOpStore, { getValue(arg(2)), getUIntConstant(SpvWord(roundUpToMultiple(elementSize, elementAlignment))) });
+            return;
+        }
+
+        unsupported("intrinsic function");
+    }
+
+    // Emit one of the `Interlocked*` functions, which take a reference to the
+    // destination, one or two values, and optionally an `out` parameter for
+    // the original value
+    void emitAtomic(IRInst* inst, String const& name, UInt argCount)
+    {
+        auto dest = inst->getOperand(1);
+        auto destType = as<IRPtrTypeBase>(dest->getDataType());
+        auto valueType = destType ? destType->getValueType() : nullptr;
+        auto shape = getValueShape(valueType);
+        if (!valueType || shape.count != 1 || (shape.kind != ScalarKind::SInt && shape.kind != ScalarKind::UInt))
+            return (void) unsupported("atomic destination");
+
+        SpvWord storageClass = getStorageClass(dest);
+        SpvWord scope = getUIntConstant(storageClass == SpvStorageClassWorkgroup ? SpvScopeWorkgroup : SpvScopeDevice);
+        SpvWord semantics = getUIntConstant(0);
+        SpvWord typeID = getType(valueType);
+        SpvWord destID = getValue(dest);
+        bool isSigned = shape.kind == ScalarKind::SInt;
+
+        UInt valueCount = 1;
+        SpvWord result = 0;
+        if (name == "InterlockedCompareExchange" || name == "InterlockedCompareStore")
+        {
+            if (argCount < 3)
+                return (void) unsupported("atomic");
+
+            valueCount = 2;
+            result = emitValueInst(SpvOpAtomicCompareExchange, typeID, {
+                destID,
+                scope,
+                semantics,
+                semantics,
+                getValueAs(inst->getOperand(3), valueType),
+                getValueAs(inst->getOperand(2), valueType) });
+        }
+        else
+        {
+            SpvOp op;
+            if (name == "InterlockedAdd")               op = SpvOpAtomicIAdd;
+            else if (name == "InterlockedAnd")          op = SpvOpAtomicAnd;
+            else if (name == "InterlockedOr")           op = SpvOpAtomicOr;
+            else if (name == "InterlockedXor")          op = SpvOpAtomicXor;
+            else if (name == "InterlockedMin")          op = isSigned ? SpvOpAtomicSMin : SpvOpAtomicUMin;
+            else if (name == "InterlockedMax")          op = isSigned ? SpvOpAtomicSMax : SpvOpAtomicUMax;
+            else if (name == "InterlockedExchange")     op = SpvOpAtomicExchange;
+            else
+                return (void) unsupported("atomic");
+
+            if (argCount < 2)
+                return (void) unsupported("atomic");
+
+            result = emitValueInst(op, typeID, {
+                destID,
+                scope,
+                semantics,
+                getValueAs(inst->getOperand(2), valueType) });
+        }
+
+        // Store the original value, if it was asked for
+        if (argCount > 1 + valueCount)
+            emitInst(body, SpvOpStore, { getValue(inst->getOperand(2 + valueCount)), result });
+    }
+
+    // The module
+
+    IRFunc* findEntryPoint(EntryPointLayout*& outLayout)
+    {
+        for (auto inst : module->getGlobalInsts())
+        {
+            auto func = as<IRFunc>(inst);
+            if (!func)
+                continue;
+            auto decoration = func->findDecoration<IRLayoutDecoration>();
+            if (!decoration)
+                continue;
+            if (auto entryPointLayout = decoration->layout->dynamicCast<EntryPointLayout>())
+            {
+                outLayout = entryPointLayout;
+                return func;
+            }
+        }
+        return nullptr;
+    }
+
+    bool emitModule(List<uint8_t>& outCode)
+    {
+        EntryPointLayout* entryPointLayout = nullptr;
+        IRFunc* entryPointFunc = findEntryPoint(entryPointLayout);
+        if (!entryPointFunc)
+            return unsupported("missing entry point");
+
+        stage = entryPointLayout->profile.GetStage();
+        SpvWord executionModel;
+        switch (stage)
+        {
+        case Stage::Compute:    executionModel = SpvExecutionModelGLCompute; break;
+        case Stage::Vertex:     executionModel = SpvExecutionModelVertex; break;
+        case Stage::Fragment:   executionModel = SpvExecutionModelFragment; break;
+        default:
+            return unsupported("stage");
+        }
+
+        emitInst(capabilities, SpvOpCapability, { SpvCapabilityShader });
+
+        glslStd450ID = allocateID();
+        {
+            List<SpvWord> words;
+            words.Add(glslStd450ID);
+            appendStringOperand(words, "GLSL.std.450");
+            emitInst(extInstImports, SpvOpExtInstImport, words);
+        }
+
+        // Emit the entry point, and then every function it calls
+        SpvWord entryPointID = getValue(entryPointFunc);
+        for (UInt ff = 0; ff < pendingFuncs.Count(); ++ff)
+        {
+            auto func = pendingFuncs[ff];
+            if (!emitFunc(func, getValue(func)))
+                return false;
+        }
+        if (failure)
+            return false;
+
+        switch (stage)
+        {
+        case Stage::Compute:
+            {
+                static const UInt kAxisCount = 3;
+                SlangUInt sizeAlongAxis[kAxisCount];
+                spReflectionEntryPoint_getComputeThreadGroupSize(
+                    (SlangReflectionEntryPoint*) entryPointLayout,
+                    kAxisCount,
+                    &sizeAlongAxis[0]);
+                emitInst(executionModes, SpvOpExecutionMode, {
+                    entryPointID,
+                    SpvExecutionModeLocalSize,
+                    SpvWord(sizeAlongAxis[0]),
+                    SpvWord(sizeAlongAxis[1]),
+                    SpvWord(sizeAlongAxis[2]) });
+            }
+            break;
+
+        case Stage::Fragment:
+            emitInst(executionModes, SpvOpExecutionMode, { entryPointID, SpvExecutionModeOriginUpperLeft });
+            if (usesFragDepth)
+                emitInst(executionModes, SpvOpExecutionMode, { entryPointID, SpvExecutionModeDepthReplacing });
+            break;
+
+        default:
+            break;
+        }
+
+        List<SpvWord> entryPointWords;
+        entryPointWords.Add(executionModel);
+        entryPointWords.Add(entryPointID);
+        appendStringOperand(entryPointWords, "main");
+        entryPointWords.AddRange(interfaceVars);
+
+        List<SpvWord> nameWords;
+        nameWords.Add(entryPointID);
+        appendStringOperand(nameWords, "main");
+        emitInst(debugNames, SpvOpName, nameWords);
+
+        List<SpvWord> words;
+        words.Add(SpvMagicNumber);
+        words.Add(SpvVersion);
+        words.Add(0); // generator
+        words.Add(nextID); // bound
+        words.Add(0); // reserved
+
+        words.AddRange(capabilities);
+        words.AddRange(extInstImports);
+        emitInst(words, SpvOpMemoryModel, { SpvAddressingModelLogical, SpvMemoryModelGLSL450 });
+        emitInst(words, SpvOpEntryPoint, entryPointWords);
+        words.AddRange(executionModes);
+        words.AddRange(debugNames);
+        words.AddRange(annotations);
+        words.AddRange(globals);
+        words.AddRange(functions);
+
+        outCode.AddRange((uint8_t const*) words.Buffer(), words.Count() * sizeof(SpvWord));
+        return true;
+    }
+};
+
+bool emitSPIRVForIRModule(
+    IRModule*       module,
+    List<uint8_t>&  outCode,
+    String&         outFailure)
+{
+    SPIRVEmitContext context;
+    context.module = module;
+
+    if (!context.emitModule(outCode))
+    {
+        outFailure = context.failure ? context.failure : "construct";
+        outCode.Clear();
+        return false;
+    }
+    return true;
+}
+
+} // namespace Slang
@@ -121,7 +121,14 @@ struct SharedEmitContext
     Dictionary<IRInst*, UInt> mapIRValueToID;
     Dictionary<Decl*, UInt> mapDeclToID;
 
+    // When the code for several entry points is emitted together (see
+    // `emitEntryPoints`), each of them has its own IR module, but the
+    // global declarations they share should only be output once. Such
+    // declarations are identified by their mangled names: we track the
+    // ones that have been emitted, and the name each one was emitted with.
+    bool shareGlobalDecls = false;
     HashSet<String> irDeclsVisited;
+    Dictionary<String, String> mapMangledNameToName;
 
     HashSet<String> irTupleTypes;
 
@@ -2139,7 +2146,7 @@ struct EmitVisitor
             prevChar = c;
         }
 
-        return sb.ProduceString();
+        return _Move(sb).ProduceString();
     }
 
     String generateIRName(
@@ -2199,7 +2206,7 @@ struct EmitVisitor
             context->shared->uniqueNameCounters[key] = count+1;
 
             sb.append(count);
-            return sb.ProduceString();
+            return _Move(sb).ProduceString();
         }
 
 
@@ -2226,7 +2233,33 @@ struct EmitVisitor
         sb << getID(inst);
 
 
-        return sb.ProduceString();
+        return _Move(sb).ProduceString();
+    }
+
+    // Get the mangled name that identifies `inst` between the IR modules
+    // of entry points that are emitted together, or an empty string if it
+    // shouldn't be shared with the other modules.
+    String getSharedMangledName(
+        IRInst*        inst)
+    {
+        if (!context->shared->shareGlobalDecls)
+            return String();
+
+        auto globalValue = as<IRGlobalValue>(inst);
+        if (!globalValue || !globalValue->mangledName)
+            return String();
+        if (!as<IRModuleInst>(inst->getParent()))
+            return String();
+
+        // Every entry point gets emitted with its own name and attributes,
+        // even if another module uses the same function as an ordinary one.
+        if (auto func = as<IRFunc>(inst))
+        {
+            if (asEntryPoint(func))
+                return String();
+        }
+
+        return getText(globalValue->mangledName);
     }
 
     String getIRName(
@@ -2235,7 +2268,14 @@ struct EmitVisitor
         String name;
         if(!context->shared->mapInstToName.TryGetValue(inst, name))
         {
-            name = generateIRName(inst);
+            String mangledName = getSharedMangledName(inst);
+            if (mangledName.Length() == 0
+                || !context->shared->mapMangledNameToName.TryGetValue(mangledName, name))
+            {
+                name = generateIRName(inst);
+                if (mangledName.Length() != 0)
+                    context->shared->mapMangledNameToName.Add(mangledName, name);
+            }
             context->shared->mapInstToName.Add(inst, name);
         }
         return name;
@@ -2645,272 +2685,6 @@ struct EmitVisitor
         emit(" = ");
     }
 
-    class UnmangleContext
-    {
-    private:
-        char const* cursor_  = nullptr;
-        char const* begin_   = nullptr;
-        char const* end_     = nullptr;
-
-        bool isDigit(char c)
-        {
-            return (c >= '0') && (c <= '9');
-        }
-
-        char peek()
-        {
-            return *cursor_;
-        }
-
-        char get()
-        {
-            return *cursor_++;
-        }
-
-        void expect(char c)
-        {
-            if(peek() == c)
-            {
-                get();
-            }
-            else
-            {
-                // ERROR!
-                SLANG_UNEXPECTED("mangled name error");
-            }
-        }
-
-        void expect(char const* str)
-        {
-            while(char c = *str++)
-                expect(c);
-        }
-
-    public:
-        UnmangleContext()
-        {}
-
-        UnmangleContext(String const& str)
-            : cursor_(str.begin())
-            , begin_(str.begin())
-            , end_(str.end())
-        {}
-
-        // Call at the beginning of a mangled name,
-        // to strip off the main prefix
-        void startUnmangling()
-        {
-            expect("_S");
-        }
-
-        UInt readCount()
-        {
-            int c = peek();
-            if(!isDigit((char)c))
-            {
-                SLANG_UNEXPECTED("bad name mangling");
-                UNREACHABLE_RETURN(0);
-            }
-            get();
-
-            if(c == '0')
-                return 0;
-
-            UInt count = 0;
-            for(;;)
-            {
-                count = count*10 + c - '0';
-                c = peek();
-                if(!isDigit((char)c))
-                    return count;
-
-                get();
-            }
-        }
-
-        void readGenericParam()
-        {
-            switch(peek())
-            {
-            case 'T':
-            case 'C':
-                get();
-                break;
-
-            case 'v':
-                get();
-                readType();
-                break;
-
-            default:
-                SLANG_UNEXPECTED("bad name mangling");
-                break;
-            }
-        }
-
-        void readGenericParams()
-        {
-            expect("g");
-            UInt paramCount = readCount();
-            for(UInt pp = 0; pp < paramCount; pp++)
-            {
-                readGenericParam();
-            }
-        }
-
-        void readSimpleIntVal()
-        {
-            int c = peek();
-            if(isDigit((char)c))
-            {
-                get();
-            }
-            else
-            {
-                readVal();
-            }
-        }
-
-
-        UnownedStringSlice readRawStringSegment()
-        {
-            // Read the length part
-            UInt count = readCount();
-            if(count > UInt(end_ - cursor_))
-            {
-                SLANG_UNEXPECTED("bad name mangling");
-                UNREACHABLE_RETURN(UnownedStringSlice());
-            }
-
-            auto result = UnownedStringSlice(cursor_, cursor_ + count);
-            cursor_ += count;
-            return result;
-        }
-
-        void readNamedType()
-        {
-            // TODO: handle types with more complicated names
-            readRawStringSegment();
-        }
-
-        void readType()
-        {
-            int c = peek();
-            switch(c)
-            {
-            case 'V':
-            case 'b':
-            case 'i':
-            case 'u':
-            case 'U':
-            case 'h':
-            case 'f':
-            case 'd':
-                get();
-                break;
-
-            case 'v':
-                get();
-                readSimpleIntVal();
-                readType();
-                break;
-
-            default:
-                readNamedType();
-                break;
-            }
-        }
-
-        void readVal()
-        {
-            switch(peek())
-            {
-            case 'k':
-                get();
-                readCount();
-                break;
-
-            case 'K':
-                get();
-                readRawStringSegment();
-                break;
-
-            default:
-                readType();
-                break;
-            }
-
-        }
-
-        void readGenericArg()
-        {
-            readVal();
-        }
-
-        void readGenericArgs()
-        {
-            expect("G");
-            UInt argCount = readCount();
-            for(UInt aa = 0; aa < argCount; aa++)
-            {
-                readGenericArg();
-            }
-        }
-
-        void readExtensionSpec()
-        {
-            expect("X");
-            readType();
-        }
-
-        UnownedStringSlice readSimpleName()
-        {
-            UnownedStringSlice result;
-            for(;;)
-            {
-                int c = peek();
-
-                if(c == 'g')
-                {
-                    readGenericParams();
-                    continue;
-                }
-                else if(c == 'G')
-                {
-                    readGenericArgs();
-                    continue;
-                }
-                else if(c == 'X')
-                {
-                    readExtensionSpec();
-                    continue;
-                }
-
-                if(!isDigit((char)c))
-                    return result;
-
-                // Read the length part
-                UInt count = readCount();
-                if(count > UInt(end_ - cursor_))
-                {
-                    SLANG_UNEXPECTED("bad name mangling");
-                    UNREACHABLE_RETURN(result);
-                }
-
-                result = UnownedStringSlice(cursor_, cursor_ + count);
-                cursor_ += count;
-            }
-        }
-
-        UInt readParamCount()
-        {
-            expect("p");
-            UInt count = readCount();
-            expect("p");
-            return count;
-        }
-    };
-
     IRTargetIntrinsicDecoration* findTargetIntrinsicDecoration(
         EmitContext*    /* ctx */,
         IRInst*         inst)
@@ -5974,6 +5748,17 @@ struct EmitVisitor
     {
         for(auto action : actions)
         {
+            // A declaration that was already emitted for another
+            // entry point doesn't need to be emitted again.
+            String mangledName = getSharedMangledName(action.inst);
+            if (mangledName.Length() != 0)
+            {
+                if (ctx->shared->irDeclsVisited.Contains(mangledName))
+                    continue;
+                if (action.level == EmitAction::Level::Definition)
+                    ctx->shared->irDeclsVisited.Add(mangledName);
+            }
+
             switch(action.level)
             {
             case EmitAction::Level::ForwardDeclaration:
@@ -6090,26 +5875,187 @@ void legalizeTypes(
     TypeLegalizationContext*    context,
     IRModule*                   module);
 
+// Specialize, legalize, and clean up the IR that was cloned for `entryPoint`,
+// so that it only uses operations and types that are legal for `target`.
+static void prepareIRForEmit(
+    IRSpecializationState*  irSpecializationState,
+    EntryPointRequest*      entryPoint,
+    CodeGenTarget           target,
+    ExtensionUsageTracker*  extensionUsageTracker)
+{
+    IRModule* irModule = getIRModule(irSpecializationState);
+    auto compileRequest = entryPoint->compileRequest;
+    auto session = compileRequest->mSession;
+
+    TypeLegalizationContext typeLegalizationContext;
+    initialize(&typeLegalizationContext,
+        session,
+        irModule);
+
+    {
+        CompilePhaseScope phaseScope(compileRequest, SLANG_COMPILE_PHASE_SPECIALIZE);
+        specializeIRForEntryPoint(
+            irSpecializationState,
+            entryPoint,
+            extensionUsageTracker);
+    }
+
+#if 0
+    fprintf(stderr, "### CLONED:\n");
+    dumpIR(irModule);
+    fprintf(stderr, "###\n");
+#endif
+
+    validateIRModuleIfEnabled(compileRequest, irModule);
+
+    // If the user specified the flag that they want us to dump
+    // IR, then do it here, for the target-specific, but
+    // un-specialized IR.
+    if (compileRequest->shouldDumpIR)
+    {
+        dumpIR(irModule);
+    }
+
+    // Next, we need to ensure that the code we emit for
+    // the target doesn't contain any operations that would
+    // be illegal on the target platform. For example,
+    // none of our target supports generics, or interfaces,
+    // so we need to specialize those away.
+    //
+    {
+        CompilePhaseScope phaseScope(compileRequest, SLANG_COMPILE_PHASE_SPECIALIZE);
+        specializeGenerics(irModule, target);
+    }
+
+    // Debugging code for IR transformations...
+#if 0
+    fprintf(stderr, "### SPECIALIZED:\n");
+    dumpIR(irModule);
+    fprintf(stderr, "###\n");
+#endif
+    validateIRModuleIfEnabled(compileRequest, irModule);
+
+    // After we've fully specialized all generics, and
+    // "devirtualized" all the calls through interfaces,
+    // we need to ensure that the code only uses types
+    // that are legal on the chosen target.
+    //
+    {
+        CompilePhaseScope phaseScope(compileRequest, SLANG_COMPILE_PHASE_LEGALIZE);
+        legalizeTypes(
+            &typeLegalizationContext,
+            irModule);
+    }
+
+    //  Debugging output of legalization
+#if 0
+    fprintf(stderr, "### LEGALIZED:\n");
+    dumpIR(irModule);
+    fprintf(stderr, "###\n");
+#endif
+    validateIRModuleIfEnabled(compileRequest, irModule);
+
+    // Once specialization and type legalization have been performed,
+    // we should perform some of our basic optimization steps again,
+    // to see if we can clean up any temporaries created by legalization.
+    // (e.g., things that used to be aggregated might now be split up,
+    // so that we can work with the individual fields).
+    {
+        CompilePhaseScope phaseScope(compileRequest, SLANG_COMPILE_PHASE_SSA);
+        constructSSA(irModule);
+    }
+
+#if 0
+    fprintf(stderr, "### AFTER SSA:\n");
+    dumpIR(irModule);
+    fprintf(stderr, "###\n");
+#endif
+    validateIRModuleIfEnabled(compileRequest, irModule);
+}
+
+PreparedEntryPointIR::~PreparedEntryPointIR()
+{
+    delete extensionUsageTracker;
+}
+
+// Get the IR for `entryPoint`, prepared for emitting code in `target` using
+// the layout of `targetRequest`. The IR is only prepared again if no other
+// target has needed it for the same language and layout.
+static PreparedEntryPointIR* getPreparedIRForEntryPoint(
+    EntryPointRequest*  entryPoint,
+    ProgramLayout*      programLayout,
+    CodeGenTarget       target,
+    TargetRequest*      targetRequest)
+{
+    for (auto prepared : entryPoint->preparedIR)
+    {
+        if (prepared->target == target && isLayoutSameForTargets(prepared->targetReq, targetRequest))
+            return prepared;
+    }
+
+    RefPtr<PreparedEntryPointIR> prepared = new PreparedEntryPointIR();
+    prepared->target = target;
+    prepared->targetReq = targetRequest;
+    prepared->extensionUsageTracker = new ExtensionUsageTracker();
+
+    // We are going to create a fresh IR module that we will use to
+    // clone any code needed by the user's entry point.
+    IRSpecializationState* irSpecializationState = createIRSpecializationState(
+        entryPoint,
+        programLayout,
+        target,
+        targetRequest);
+
+    prepareIRForEmit(
+        irSpecializationState,
+        entryPoint,
+        target,
+        prepared->extensionUsageTracker);
+
+    prepared->irModule = getIRModule(irSpecializationState);
+    prepared->layout = getSpecializedProgramLayout(irSpecializationState);
+
+    auto preparedTracker = prepared->extensionUsageTracker;
+    prepared->structuralHash = combineStructuralHashWithText(
+        getStructuralHash(prepared->irModule),
+        preparedTracker->glslExtensionRequireLines.getUnownedSlice());
+    prepared->structuralHash = combineStructuralHash(
+        prepared->structuralHash,
+        uint64_t(preparedTracker->profileVersion));
+
+    // retain the specialized ir module, because the current
+    // GlobalGenericParamSubstitution implementation may reference ir objects
+    targetRequest->compileRequest->compiledModules.Add(prepared->irModule);
+    destroyIRSpecializationState(irSpecializationState);
+
+    entryPoint->preparedIR.Add(prepared);
+    return prepared;
+}
+
 String emitEntryPoint(
     EntryPointRequest*  entryPoint,
     ProgramLayout*      programLayout,
     CodeGenTarget       target,
     TargetRequest*      targetRequest)
 {
-    auto translationUnit = entryPoint->getTranslationUnit();
+    List<EntryPointRequest*> entryPoints;
+    entryPoints.Add(entryPoint);
+    return emitEntryPoints(entryPoints, programLayout, target, targetRequest);
+}
+
+String emitEntryPoints(
+    List<EntryPointRequest*> const& entryPoints,
+    ProgramLayout*                  programLayout,
+    CodeGenTarget                   target,
+    TargetRequest*                  targetRequest)
+{
+    SLANG_ASSERT(entryPoints.Count() != 0);
+    auto translationUnit = entryPoints[0]->getTranslationUnit();
 
     SharedEmitContext sharedContext;
     sharedContext.target = target;
     sharedContext.finalTarget = targetRequest->target;
-    sharedContext.entryPoint = entryPoint;
-    sharedContext.effectiveProfile = getEffectiveProfile(entryPoint, targetRequest);
-
-    if (entryPoint)
-    {
-        sharedContext.entryPointLayout = findEntryPointLayout(
-            programLayout,
-            entryPoint);
-    }
+    sharedContext.shareGlobalDecls = entryPoints.Count() > 1;
 
     sharedContext.programLayout = programLayout;
 
@@ -6126,90 +6072,35 @@ String emitEntryPoint(
 
     EmitVisitor visitor(&context);
 
-    // We are going to create a fresh IR module that we will use to
-    // clone any code needed by the user's entry point.
-    IRSpecializationState* irSpecializationState = createIRSpecializationState(
-        entryPoint,
-        programLayout,
-        target,
-        targetRequest);
+    for (auto entryPoint : entryPoints)
     {
-        IRModule* irModule = getIRModule(irSpecializationState);
-        auto compileRequest = translationUnit->compileRequest;
-        auto session = compileRequest->mSession;
-
-        TypeLegalizationContext typeLegalizationContext;
-        initialize(&typeLegalizationContext,
-            session,
-            irModule);
+        sharedContext.entryPoint = entryPoint;
+        sharedContext.effectiveProfile = getEffectiveProfile(entryPoint, targetRequest);
+        sharedContext.entryPointLayout = findEntryPointLayout(
+            programLayout,
+            entryPoint);
 
-        specializeIRForEntryPoint(
-            irSpecializationState,
+        PreparedEntryPointIR* prepared = getPreparedIRForEntryPoint(
             entryPoint,
-            &sharedContext.extensionUsageTracker);
-
-#if 0
-        fprintf(stderr, "### CLONED:\n");
-        dumpIR(irModule);
-        fprintf(stderr, "###\n");
-#endif
-
-        validateIRModuleIfEnabled(compileRequest, irModule);
+            programLayout,
+            target,
+            targetRequest);
 
-        // If the user specified the flag that they want us to dump
-        // IR, then do it here, for the target-specific, but
-        // un-specialized IR.
-        if (translationUnit->compileRequest->shouldDumpIR)
+        // Emitting code may require more extensions (or a later version)
+        // on top of those that preparing the IR did.
+        auto preparedTracker = prepared->extensionUsageTracker;
+        if (entryPoint == entryPoints[0])
         {
-            dumpIR(irModule);
+            sharedContext.extensionUsageTracker.glslExtensionsRequired = preparedTracker->glslExtensionsRequired;
+            sharedContext.extensionUsageTracker.glslExtensionRequireLines << preparedTracker->glslExtensionRequireLines;
+            sharedContext.extensionUsageTracker.profileVersion = preparedTracker->profileVersion;
+        }
+        else
+        {
+            for (auto extensionName : preparedTracker->glslExtensionsRequired)
+                requireGLSLExtension(&sharedContext.extensionUsageTracker, extensionName);
+            requireGLSLVersionImpl(&sharedContext.extensionUsageTracker, preparedTracker->profileVersion);
         }
-
-        // Next, we need to ensure that the code we emit for
-        // the target doesn't contain any operations that would
-        // be illegal on the target platform. For example,
-        // none of our target supports generics, or interfaces,
-        // so we need to specialize those away.
-        //
-        specializeGenerics(irModule, sharedContext.target);
-
-        // Debugging code for IR transformations...
-#if 0
-        fprintf(stderr, "### SPECIALIZED:\n");
-        dumpIR(irModule);
-        fprintf(stderr, "###\n");
-#endif
-        validateIRModuleIfEnabled(compileRequest, irModule);
-
-        // After we've fully specialized all generics, and
-        // "devirtualized" all the calls through interfaces,
-        // we need to ensure that the code only uses types
-        // that are legal on the chosen target.
-        //
-        legalizeTypes(
-            &typeLegalizationContext,
-            irModule);
-
-        //  Debugging output of legalization
-#if 0
-        fprintf(stderr, "### LEGALIZED:\n");
-        dumpIR(irModule);
-        fprintf(stderr, "###\n");
-#endif
-        validateIRModuleIfEnabled(compileRequest, irModule);
-
-        // Once specialization and type legalization have been performed,
-        // we should perform some of our basic optimization steps again,
-        // to see if we can clean up any temporaries created by legalization.
-        // (e.g., things that used to be aggregated might now be split up,
-        // so that we can work with the individual fields).
-        constructSSA(irModule);
-
-#if 0
-        fprintf(stderr, "### AFTER SSA:\n");
-        dumpIR(irModule);
-        fprintf(stderr, "###\n");
-#endif
-        validateIRModuleIfEnabled(compileRequest, irModule);
 
         // After all of the required optimization and legalization
         // passes have been performed, we can emit target code from
@@ -6217,16 +6108,10 @@ String emitEntryPoint(
         //
         // TODO: do we want to emit directly from IR, or translate the
         // IR back into AST for emission?
-        visitor.emitIRModule(&context, irModule);
-
-        // retain the specialized ir module, because the current
-        // GlobalGenericParamSubstitution implementation may reference ir objects
-        targetRequest->compileRequest->compiledModules.Add(irModule);
+        visitor.emitIRModule(&context, prepared->irModule);
     }
-    destroyIRSpecializationState(irSpecializationState);
 
-    String code = sharedContext.sb.ProduceString();
-    sharedContext.sb.Clear();
+    String code = _Move(sharedContext.sb).ProduceString();
 
     // Now that we've emitted the code for all the declaratiosn in the file,
     // it is time to stich together the final output.
@@ -6236,7 +6121,7 @@ String emitEntryPoint(
 
     visitor.emitLayoutDirectives(targetRequest);
 
-    String prefix = sharedContext.sb.ProduceString();
+    String prefix = _Move(sharedContext.sb).ProduceString();
 
 
     StringBuilder finalResultBuilder;
@@ -6246,9 +6131,39 @@ String emitEntryPoint(
 
     finalResultBuilder << code;
 
-    String finalResult = finalResultBuilder.ProduceString();
+    String finalResult = _Move(finalResultBuilder).ProduceString();
 
     return finalResult;
 }
 
+IRStructuralHash getPreparedIRHashForEntryPoint(
+    EntryPointRequest*  entryPoint,
+    ProgramLayout*      programLayout,
+    CodeGenTarget       target,
+    TargetRequest*      targetRequest)
+{
+    return getPreparedIRForEntryPoint(entryPoint, programLayout, target, targetRequest)->structuralHash;
+}
+
+bool emitSPIRVForEntryPointDirectly(
+    EntryPointRequest*  entryPoint,
+    ProgramLayout*      programLayout,
+    TargetRequest*      targetRequest,
+    List<uint8_t>&      outCode,
+    String&             outFailure)
+{
+    // The IR is prepared exactly as it is for GLSL output, so that the
+    // entry point's parameters are replaced with the same global varyings
+    // (and `gl_*` system values) that the GLSL we would otherwise pass to
+    // glslang declares. This also means the IR is shared with GLSL targets,
+    // and with the GLSL we fall back to if this fails.
+    PreparedEntryPointIR* prepared = getPreparedIRForEntryPoint(
+        entryPoint,
+        programLayout,
+        CodeGenTarget::GLSL,
+        targetRequest);
+
+    return emitSPIRVForIRModule(prepared->irModule, outCode, outFailure);
+}
+
 } // namespace Slang
@@ -28,5 +28,46 @@ namespace Slang
 
         // The full target request
         TargetRequest*      targetRequest);
+
+    // Emit code for several entry points from the same translation
+    // unit as a single piece of code, where the declarations that they
+    // share (identified by their mangled names) are only emitted once.
+    String emitEntryPoints(
+        List<EntryPointRequest*> const& entryPoints,
+        ProgramLayout*                  programLayout,
+        CodeGenTarget                   target,
+        TargetRequest*                  targetRequest);
+
+    // Get the structural hash of the IR for `entryPoint`, once it has been
+    // prepared for emitting code in `target` (preparing it if need be). Code
+    // emitted from IR with the same hash, with the same options, is the same.
+    IRStructuralHash getPreparedIRHashForEntryPoint(
+        EntryPointRequest*  entryPoint,
+        ProgramLayout*      programLayout,
+        CodeGenTarget       target,
+        TargetRequest*      targetRequest);
+
+    // Emit SPIR-V for a single entry point directly from the IR, rather
+    // than by generating GLSL and compiling it with glslang.
+    //
+    // Only a subset of the language is supported so far. Returns `false`
+    // (without reporting an error) if the entry point uses anything outside
+    // of that subset, so that the caller can fall back to glslang; in that
+    // case `outFailure` names the first construct that wasn't supported.
+    bool emitSPIRVForEntryPointDirectly(
+        EntryPointRequest*  entryPoint,
+        ProgramLayout*      programLayout,
+        TargetRequest*      targetRequest,
+        List<uint8_t>&      outCode,
+        String&             outFailure);
+
+    // Emit a SPIR-V module for the entry point in `module`, which must have
+    // been prepared as for GLSL output (specialized, legalized and in SSA form).
+    // Implemented in `emit-spirv.cpp`.
+    struct IRModule;
+    bool emitSPIRVForIRModule(
+        IRModule*       module,
+        List<uint8_t>&  outCode,
+        String&         outFailure);
 }
 #endif
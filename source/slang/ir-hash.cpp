@@ -0,0 +1,456 @@
+// ir-hash.cpp
+#include "ir-hash.h"
+
+#include "ir.h"
+#include "ir-insts.h"
+#include "type-layout.h"
+
+namespace Slang
+{
+    // Tags that distinguish the different kinds of operand,
+    // so that (e.g.) the first local instruction in a function
+    // doesn't hash the same as a null operand.
+    enum IRHashTag : uint64_t
+    {
+        kIRHashTag_NullOperand = 1,
+        kIRHashTag_LocalOperand,
+        kIRHashTag_NamedGlobalOperand,
+        kIRHashTag_GlobalOperand,
+        kIRHashTag_CyclicOperand,
+        kIRHashTag_UnknownOperand,
+        kIRHashTag_Decoration,
+        kIRHashTag_Children,
+        kIRHashTag_VarLayout,
+        kIRHashTag_TypeLayout,
+        kIRHashTag_OtherLayout,
+    };
+
+    // The two halves of a hash are mixed differently, so that values
+    // that collide in one of them are unlikely to collide in the other
+    static uint64_t mixHash0(uint64_t hash, uint64_t value)
+    {
+        return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+    }
+
+    static uint64_t mixHash1(uint64_t hash, uint64_t value)
+    {
+        hash = (((hash << 27) | (hash >> 37)) ^ value) * 0xff51afd7ed558ccdull;
+        return hash ^ (hash >> 31);
+    }
+
+    static IRStructuralHash combineIRHash(IRStructuralHash hash, IRStructuralHash const& value)
+    {
+        hash.hashes[0] = mixHash0(hash.hashes[0], value.hashes[0]);
+        hash.hashes[1] = mixHash1(hash.hashes[1], value.hashes[1]);
+        return hash;
+    }
+
+    static IRStructuralHash combineIRHash(IRStructuralHash hash, uint64_t value)
+    {
+        return combineIRHash(hash, IRStructuralHash(value));
+    }
+
+    static IRStructuralHash combineTextHash(IRStructuralHash hash, UnownedStringSlice const& text)
+    {
+        // 64-bit FNV-1a over the characters, and a second hash that
+        // multiplies by the 64-bit golden ratio with a rotation between them
+        IRStructuralHash textHash;
+        textHash.hashes[0] = 14695981039346656037ull;
+        textHash.hashes[1] = 0x2545F4914F6CDD1Dull;
+        for (auto c : text)
+        {
+            textHash.hashes[0] = (textHash.hashes[0] ^ uint8_t(c)) * 1099511628211ull;
+            textHash.hashes[1] = (((textHash.hashes[1] << 5) | (textHash.hashes[1] >> 59)) ^ uint8_t(c)) * 0x9E3779B97F4A7C15ull;
+        }
+        return combineIRHash(combineIRHash(hash, text.size()), textHash);
+    }
+
+    static IRStructuralHash combineTextHash(IRStructuralHash hash, String const& text)
+    {
+        return combineTextHash(hash, text.getUnownedSlice());
+    }
+
+    static IRStructuralHash combinePointerHash(IRStructuralHash hash, void const* pointer)
+    {
+        return combineIRHash(hash, uint64_t(PtrInt(pointer)));
+    }
+
+    struct IRHashContext
+    {
+        // The hashes of the global instructions computed so far
+        Dictionary<IRInst*, IRStructuralHash> globalHashes;
+
+        // Global instructions whose hash is being computed, so that
+        // a cycle between them doesn't recurse forever
+        HashSet<IRInst*> globalsInProgress;
+
+        // The position of each local instruction in the global
+        // instruction that contains it
+        Dictionary<IRInst*, UInt> localIndices;
+
+        // Layouts are shared by many instructions, so they are
+        // only hashed once
+        Dictionary<Layout*, IRStructuralHash> layoutHashes;
+    };
+
+    static IRStructuralHash hashGlobalInst(IRHashContext* context, IRInst* inst);
+    static IRStructuralHash hashLayout(IRHashContext* context, Layout* layout);
+
+    static bool isGlobalInst(IRInst* inst)
+    {
+        return as<IRModuleInst>(inst->getParent()) != nullptr;
+    }
+
+    static IRStructuralHash hashOperand(IRHashContext* context, IRInst* operand)
+    {
+        if (!operand)
+            return kIRHashTag_NullOperand;
+
+        UInt localIndex = 0;
+        if (context->localIndices.TryGetValue(operand, localIndex))
+            return combineIRHash(IRStructuralHash(kIRHashTag_LocalOperand), localIndex);
+
+        if (isGlobalInst(operand))
+        {
+            auto globalValue = as<IRGlobalValue>(operand);
+            if (globalValue && globalValue->mangledName && getText(globalValue->mangledName).Length() != 0)
+            {
+                IRStructuralHash hash = combineIRHash(IRStructuralHash(kIRHashTag_NamedGlobalOperand), uint64_t(operand->op));
+                return combineTextHash(hash, getText(globalValue->mangledName));
+            }
+            return combineIRHash(IRStructuralHash(kIRHashTag_GlobalOperand), hashGlobalInst(context, operand));
+        }
+
+        // A local instruction from outside of the global instruction
+        // being hashed, which valid IR shouldn't have.
+        return kIRHashTag_UnknownOperand;
+    }
+
+    static IRStructuralHash hashVarLayoutFields(IRHashContext* context, VarLayout* varLayout)
+    {
+        IRStructuralHash hash = kIRHashTag_VarLayout;
+        hash = combinePointerHash(hash, varLayout->varDecl.getDecl());
+        hash = combineIRHash(hash, hashLayout(context, varLayout->typeLayout));
+        hash = combineIRHash(hash, varLayout->flags);
+        hash = combineTextHash(hash, varLayout->systemValueSemantic);
+        hash = combineIRHash(hash, uint64_t(varLayout->systemValueSemanticIndex));
+        hash = combineTextHash(hash, varLayout->semanticName);
+        hash = combineIRHash(hash, uint64_t(varLayout->semanticIndex));
+        hash = combineIRHash(hash, uint64_t(varLayout->stage));
+        for (auto& resourceInfo : varLayout->resourceInfos)
+        {
+            hash = combineIRHash(hash, uint64_t(resourceInfo.kind));
+            hash = combineIRHash(hash, resourceInfo.space);
+            hash = combineIRHash(hash, resourceInfo.index);
+        }
+        return hash;
+    }
+
+    static IRStructuralHash hashTypeLayoutFields(IRHashContext* context, TypeLayout* typeLayout)
+    {
+        IRStructuralHash hash = kIRHashTag_TypeLayout;
+
+        // The type itself is hashed by name, since types are created
+        // anew for each request (or specialization) that needs them.
+        hash = combineTextHash(hash, typeLayout->type ? typeLayout->type->ToString() : String());
+        hash = combinePointerHash(hash, typeLayout->rules);
+        hash = combineIRHash(hash, typeLayout->uniformAlignment);
+        for (auto& resourceInfo : typeLayout->resourceInfos)
+        {
+            hash = combineIRHash(hash, uint64_t(resourceInfo.kind));
+            hash = combineIRHash(hash, resourceInfo.count);
+        }
+
+        if (auto parameterGroupLayout = typeLayout->dynamicCast<ParameterGroupTypeLayout>())
+        {
+            hash = combineIRHash(hash, hashLayout(context, parameterGroupLayout->containerVarLayout));
+            hash = combineIRHash(hash, hashLayout(context, parameterGroupLayout->elementVarLayout));
+            hash = combineIRHash(hash, hashLayout(context, parameterGroupLayout->offsetElementTypeLayout));
+        }
+        else if (auto structuredBufferLayout = typeLayout->dynamicCast<StructuredBufferTypeLayout>())
+        {
+            hash = combineIRHash(hash, hashLayout(context, structuredBufferLayout->elementTypeLayout));
+        }
+        else if (auto arrayLayout = typeLayout->dynamicCast<ArrayTypeLayout>())
+        {
+            hash = combineIRHash(hash, hashLayout(context, arrayLayout->originalElementTypeLayout));
+            hash = combineIRHash(hash, hashLayout(context, arrayLayout->elementTypeLayout));
+            hash = combineIRHash(hash, arrayLayout->uniformStride);
+        }
+        else if (auto streamOutputLayout = typeLayout->dynamicCast<StreamOutputTypeLayout>())
+        {
+            hash = combineIRHash(hash, hashLayout(context, streamOutputLayout->elementTypeLayout));
+        }
+        else if (auto matrixLayout = typeLayout->dynamicCast<MatrixTypeLayout>())
+        {
+            hash = combineIRHash(hash, uint64_t(matrixLayout->mode));
+        }
+        else if (auto genericParamLayout = typeLayout->dynamicCast<GenericParamTypeLayout>())
+        {
+            hash = combineIRHash(hash, uint64_t(genericParamLayout->paramIndex));
+        }
+        else if (auto structLayout = typeLayout->dynamicCast<StructTypeLayout>())
+        {
+            for (auto field : structLayout->fields)
+            {
+                hash = combineIRHash(hash, hashLayout(context, field));
+            }
+
+            // The flags of an entry point layout are filled in while
+            // emitting code for it, rather than being an input to it.
+            if (auto entryPointLayout = typeLayout->dynamicCast<EntryPointLayout>())
+            {
+                hash = combinePointerHash(hash, entryPointLayout->entryPoint.Ptr());
+                hash = combineIRHash(hash, uint64_t(entryPointLayout->profile.raw));
+                hash = combineIRHash(hash, hashLayout(context, entryPointLayout->resultLayout));
+            }
+        }
+        return hash;
+    }
+
+    static IRStructuralHash hashLayout(IRHashContext* context, Layout* layout)
+    {
+        if (!layout)
+            return kIRHashTag_NullOperand;
+
+        IRStructuralHash hash = 0;
+        if (context->layoutHashes.TryGetValue(layout, hash))
+            return hash;
+
+        if (auto varLayout = layout->dynamicCast<VarLayout>())
+        {
+            hash = hashVarLayoutFields(context, varLayout);
+        }
+        else if (auto typeLayout = layout->dynamicCast<TypeLayout>())
+        {
+            hash = hashTypeLayoutFields(context, typeLayout);
+        }
+        else
+        {
+            hash = combinePointerHash(kIRHashTag_OtherLayout, layout);
+        }
+
+        context->layoutHashes[layout] = hash;
+        return hash;
+    }
+
+    static IRStructuralHash hashDecoration(IRHashContext* context, IRDecoration* decoration)
+    {
+        IRStructuralHash hash = combineIRHash(IRStructuralHash(kIRHashTag_Decoration), uint64_t(decoration->op));
+        switch (decoration->op)
+        {
+        case kIRDecorationOp_HighLevelDecl:
+            return combinePointerHash(hash, ((IRHighLevelDeclDecoration*)decoration)->decl);
+
+        case kIRDecorationOp_Layout:
+            return combineIRHash(hash, hashLayout(context, ((IRLayoutDecoration*)decoration)->layout));
+
+        case kIRDecorationOp_LoopControl:
+            return combineIRHash(hash, uint64_t(((IRLoopControlDecoration*)decoration)->mode));
+
+        case kIRDecorationOp_Target:
+            return combineTextHash(hash, StringRepresentation::asSlice(((IRTargetDecoration*)decoration)->targetName));
+
+        case kIRDecorationOp_TargetIntrinsic:
+            {
+                auto intrinsicDecoration = (IRTargetIntrinsicDecoration*)decoration;
+                hash = combineTextHash(hash, StringRepresentation::asSlice(intrinsicDecoration->targetName));
+                return combineTextHash(hash, StringRepresentation::asSlice(intrinsicDecoration->definition));
+            }
+
+        case kIRDecorationOp_GLSLOuterArray:
+            return combineTextHash(hash, UnownedStringSlice(((IRGLSLOuterArrayDecoration*)decoration)->outerArrayName));
+
+        case kIRDecorationOp_Semantic:
+            return combineTextHash(hash, getText(((IRSemanticDecoration*)decoration)->semanticName));
+
+        case kIRDecorationOp_InterpolationMode:
+            return combineIRHash(hash, uint64_t(((IRInterpolationModeDecoration*)decoration)->mode));
+
+        case kIRDecorationOp_NameHint:
+            return combineTextHash(hash, getText(((IRNameHintDecoration*)decoration)->name));
+
+        default:
+            return hash;
+        }
+    }
+
+    static IRStructuralHash hashConstantValue(IRConstant* constant)
+    {
+        switch (constant->op)
+        {
+        case kIROp_boolConst:
+        case kIROp_FloatLit:
+        case kIROp_IntLit:
+            // All 64 bits are hashed (`IRConstant::getHashCode` only
+            // keeps 32 of them), so that we can rely on the result.
+            return uint64_t(constant->value.intVal);
+
+        case kIROp_StringLit:
+            return combineTextHash(0, constant->getStringSlice());
+
+        default:
+            return 0;
+        }
+    }
+
+    static IRStructuralHash hashInst(IRHashContext* context, IRInst* inst)
+    {
+        IRStructuralHash hash = inst->op;
+        hash = combineIRHash(hash, hashOperand(context, inst->getFullType()));
+
+        UInt operandCount = inst->getOperandCount();
+        hash = combineIRHash(hash, operandCount);
+        for (UInt ii = 0; ii < operandCount; ++ii)
+        {
+            hash = combineIRHash(hash, hashOperand(context, inst->getOperand(ii)));
+        }
+
+        if (auto constant = as<IRConstant>(inst))
+        {
+            hash = combineIRHash(hash, hashConstantValue(constant));
+        }
+
+        if (auto globalValue = as<IRGlobalValue>(inst))
+        {
+            if (globalValue->mangledName)
+                hash = combineTextHash(hash, getText(globalValue->mangledName));
+        }
+
+        hash = combineIRHash(hash, inst->sourceLoc.getRaw());
+
+        for (auto decoration = inst->firstDecoration; decoration; decoration = decoration->next)
+        {
+            hash = combineIRHash(hash, hashDecoration(context, decoration));
+        }
+
+        if (auto parentInst = as<IRParentInst>(inst))
+        {
+            hash = combineIRHash(hash, kIRHashTag_Children);
+            for (auto child : parentInst->getChildren())
+            {
+                hash = combineIRHash(hash, hashInst(context, child));
+            }
+        }
+        return hash;
+    }
+
+    // Number the instructions nested in `parent`, in the order they
+    // are defined, so that references to them can be hashed.
+    static void numberLocalInsts(IRHashContext* context, IRParentInst* parent, UInt& ioIndex)
+    {
+        for (auto child : parent->getChildren())
+        {
+            context->localIndices[child] = ioIndex++;
+            if (auto parentChild = as<IRParentInst>(child))
+            {
+                numberLocalInsts(context, parentChild, ioIndex);
+            }
+        }
+    }
+
+    static IRStructuralHash hashGlobalInst(IRHashContext* context, IRInst* inst)
+    {
+        IRStructuralHash hash = 0;
+        if (context->globalHashes.TryGetValue(inst, hash))
+            return hash;
+
+        // Only global instructions without a mangled name are hashed by their
+        // structure when they are referenced, so a cycle here has to go through
+        // something like a recursive type, which can't be expressed yet.
+        if (context->globalsInProgress.Contains(inst))
+            return kIRHashTag_CyclicOperand;
+        context->globalsInProgress.Add(inst);
+
+        if (auto parentInst = as<IRParentInst>(inst))
+        {
+            UInt localIndex = 0;
+            numberLocalInsts(context, parentInst, localIndex);
+        }
+        hash = hashInst(context, inst);
+
+        context->globalsInProgress.Remove(inst);
+        context->globalHashes[inst] = hash;
+        return hash;
+    }
+
+    IRStructuralHash combineStructuralHash(IRStructuralHash hash, uint64_t value)
+    {
+        return combineIRHash(hash, value);
+    }
+
+    IRStructuralHash combineStructuralHashWithText(IRStructuralHash hash, UnownedStringSlice const& text)
+    {
+        return combineTextHash(hash, text);
+    }
+
+    IRStructuralHash getStructuralHash(IRModule* module)
+    {
+        IRHashContext context;
+
+        // The global instructions are combined in the order they appear in,
+        // since that is the order their code is emitted in.
+        IRStructuralHash hash = kIRHashTag_Children;
+        UInt globalCount = 0;
+        for (auto inst : module->getGlobalInsts())
+        {
+            hash = combineIRHash(hash, hashGlobalInst(&context, inst));
+            globalCount++;
+        }
+        return combineIRHash(hash, globalCount);
+    }
+
+    // Build a module with a function `f(a, b)` that returns `a + b`,
+    // or `b + a` if `swapOperands` is set, with the interpolation
+    // mode of `a` given by `interpolationMode` (if any).
+    static IRStructuralHash hashTestModule(
+        Session*                    session,
+        bool                        swapOperands,
+        IRInterpolationMode const*  interpolationMode)
+    {
+        SharedIRBuilder sharedBuilder;
+        sharedBuilder.module = nullptr;
+        sharedBuilder.session = session;
+
+        IRBuilder builder;
+        builder.sharedBuilder = &sharedBuilder;
+
+        RefPtr<IRModule> module = builder.createModule();
+        sharedBuilder.module = module;
+        builder.setInsertInto(module->getModuleInst());
+
+        auto intType = builder.getIntType();
+        IRType* paramTypes[] = { intType, intType };
+
+        IRFunc* func = builder.createFunc();
+        func->setFullType(builder.getFuncType(2, paramTypes, intType));
+
+        builder.setInsertInto(func);
+        builder.emitBlock();
+        IRInst* params[] = { builder.emitParam(intType), builder.emitParam(intType) };
+        if (interpolationMode)
+        {
+            builder.addDecoration<IRInterpolationModeDecoration>(params[0])->mode = *interpolationMode;
+        }
+        if (swapOperands)
+        {
+            Swap(params[0], params[1]);
+        }
+        builder.emitReturn(builder.emitIntrinsicInst(intType, kIROp_Add, 2, params));
+
+        return getStructuralHash(module);
+    }
+
+    bool checkStructuralHash(Session* session)
+    {
+        IRInterpolationMode linear = IRInterpolationMode::Linear;
+        IRInterpolationMode centroid = IRInterpolationMode::Centroid;
+
+        IRStructuralHash hash = hashTestModule(session, false, nullptr);
+        return hash == hashTestModule(session, false, nullptr)
+            && hash != hashTestModule(session, true, nullptr)
+            && hash != hashTestModule(session, false, &linear)
+            && hashTestModule(session, false, &linear) == hashTestModule(session, false, &linear)
+            && hashTestModule(session, false, &linear) != hashTestModule(session, false, &centroid);
+    }
+}
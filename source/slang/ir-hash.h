@@ -0,0 +1,78 @@
+// ir-hash.h
+#pragma once
+
+#include "../core/basic.h"
+
+namespace Slang
+{
+    class Session;
+    struct IRModule;
+
+    // A hash of the structure of an IR module, used to tell whether two
+    // modules will produce the same output code (e.g., as the key for
+    // a cache of generated code).
+    //
+    // Nothing checks that two modules with the same hash really are the
+    // same, so the hash is 128 bits wide (two 64-bit hashes, mixed
+    // differently), to make an accidental collision vanishingly unlikely.
+    struct IRStructuralHash
+    {
+        uint64_t hashes[2] = { 0, 0 };
+
+        IRStructuralHash() {}
+
+        // Start a hash from a single value
+        IRStructuralHash(uint64_t value)
+        {
+            hashes[0] = value;
+            hashes[1] = value;
+        }
+
+        int GetHashCode() const { return int(hashes[0] ^ (hashes[0] >> 32)); }
+        bool operator==(IRStructuralHash const& other) const
+        {
+            return hashes[0] == other.hashes[0] && hashes[1] == other.hashes[1];
+        }
+        bool operator!=(IRStructuralHash const& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    // Compute the structural hash of `module`.
+    //
+    // The hash covers the opcode, type, operands, decorations and children
+    // of every instruction, along with the values of constants and the
+    // mangled names of global values. The global instructions are hashed
+    // in the order they appear in the module, which is the order code is
+    // emitted in. The hash doesn't depend on where any instruction happens
+    // to have been allocated. Instead, operands are hashed by the shape of
+    // the operand graph:
+    //
+    // * A global value with a mangled name is hashed by that name.
+    //
+    // * Any other global instruction (e.g., a type or constant) is hashed
+    //   by its own structure.
+    //
+    // * A local instruction is hashed by where it is defined in the global
+    //   instruction that contains it.
+    //
+    // The layouts attached to instructions are hashed by their contents,
+    // but declarations referenced from the IR are hashed by identity, as
+    // are source locations (which end up in `#line` directives). Hashes
+    // can therefore only be compared between modules that were generated
+    // from the same checked syntax.
+    //
+    IRStructuralHash getStructuralHash(IRModule* module);
+
+    // Mix `value` (or `text`) into `hash`, e.g., to combine the structural
+    // hash of a module with the options that code is generated with.
+    IRStructuralHash combineStructuralHash(IRStructuralHash hash, uint64_t value);
+    IRStructuralHash combineStructuralHashWithText(IRStructuralHash hash, UnownedStringSlice const& text);
+
+    // Check that `getStructuralHash` tells apart small modules built
+    // by hand that differ only in the order of an instruction's operands
+    // or in a decoration, and gives identical modules the same hash.
+    // This is run by `slang-test`, which can't build IR itself.
+    bool checkStructuralHash(Session* session);
+}
@@ -830,7 +830,7 @@ struct IRBuilder
     }
     StringRepresentation* addStringToFree(const String& string)
     {
-        StringRepresentation* stringRep = string.getStringRepresentation();
+        StringRepresentation* stringRep = string.getOrCreateStringRepresentation();
         getModule()->addRefObjectToFree(stringRep);
         return stringRep;
     }
@@ -891,6 +891,7 @@ IRSpecializationState* createIRSpecializationState(
     TargetRequest*      targetReq);
 void destroyIRSpecializationState(IRSpecializationState* state);
 IRModule* getIRModule(IRSpecializationState* state);
+ProgramLayout* getSpecializedProgramLayout(IRSpecializationState* state);
 
 IRGlobalValue* getSpecializedGlobalValueForDeclRef(
     IRSpecializationState*  state,
@@ -819,6 +819,7 @@ namespace Slang
 
         SLANG_ASSERT(module);
         T* inst = (T*)module->memoryArena.allocateAndZero(size);
+        module->createdInstCount++;
 
         // TODO: Do we need to run ctor after zeroing?
         new(inst)T();
@@ -872,6 +873,7 @@ namespace Slang
     {
         auto module = builder->getModule();
         IRInst* inst = (IRInst*)module->memoryArena.allocate(sizeInBytes);
+        module->createdInstCount++;
         // Zero only the 'type'
         memset(inst, 0, sizeof(IRInst));
         // TODO: Do we need to run ctor after zeroing?
@@ -3341,6 +3343,10 @@ namespace Slang
     // and then destroy it (it had better have no uses!)
     void IRInst::removeAndDeallocate()
     {
+        // Note: we need to find the module before we are detached from it
+        if (auto module = getModule())
+            module->removedInstCount++;
+
         removeFromParent();
         removeArguments();
 
@@ -4881,12 +4887,6 @@ namespace Slang
         ProgramLayout*      programLayout,
         EntryPointRequest*  entryPointRequest);
 
-    struct IRSpecSymbol : RefObject
-    {
-        IRGlobalValue*          irGlobalValue;
-        RefPtr<IRSpecSymbol>    nextWithSameName;
-    };
-
     struct IRSpecEnv
     {
         IRSpecEnv*  parent = nullptr;
@@ -4910,9 +4910,14 @@ namespace Slang
         // A map from mangled symbol names to zero or
         // more global IR values that have that name,
         // in the *original* module.
-        typedef Dictionary<Name*, RefPtr<IRSpecSymbol>> SymbolDictionary;
+        typedef IRLinkage::SymbolDictionary SymbolDictionary;
         SymbolDictionary symbols;
 
+        // The symbols of the original module and the modules it imports,
+        // if they have been indexed ahead of time. The linkage is shared,
+        // so it isn't modified: any other symbols go in `symbols`.
+        RefPtr<IRLinkage> linkage;
+
         SharedIRBuilder sharedBuilderStorage;
         IRBuilder builderStorage;
 
@@ -4961,7 +4966,14 @@ namespace Slang
 
         IRModule* getOriginalModule() { return getShared()->originalModule; }
 
-        IRSharedSpecContext::SymbolDictionary& getSymbols() { return getShared()->symbols; }
+        // Find the global values with the given mangled name
+        bool findSymbol(Name* mangledName, RefPtr<IRSpecSymbol>& outSymbol)
+        {
+            auto sharedContext = getShared();
+            if (sharedContext->symbols.TryGetValue(mangledName, outSymbol))
+                return true;
+            return sharedContext->linkage && sharedContext->linkage->symbols.TryGetValue(mangledName, outSymbol);
+        }
 
         // The current specialization environment to use.
         IRSpecEnv* env = nullptr;
@@ -5567,7 +5579,7 @@ namespace Slang
         // Look up the IR symbol by name
         auto mangledName = context->getModule()->session->getNameObj(getMangledName(entryPointRequest->decl));
         RefPtr<IRSpecSymbol> sym;
-        if (!context->getSymbols().TryGetValue(mangledName, sym))
+        if (!context->findSymbol(mangledName, sym))
         {
             SLANG_UNEXPECTED("no matching IR symbol");
             return nullptr;
@@ -5929,7 +5941,7 @@ namespace Slang
         // to pick the "best" one for our target.
 
         RefPtr<IRSpecSymbol> sym;
-        if( !context->getSymbols().TryGetValue(mangledName, sym) )
+        if( !context->findSymbol(mangledName, sym) )
         {
             if(!originalVal)
                 return nullptr;
@@ -5989,9 +6001,23 @@ namespace Slang
     StructTypeLayout* getGlobalStructLayout(
         ProgramLayout*  programLayout);
 
+    // Copy a list of symbols with the same name
+    RefPtr<IRSpecSymbol> copySymbols(IRSpecSymbol* symbol)
+    {
+        RefPtr<IRSpecSymbol> copy = new IRSpecSymbol();
+        copy->irGlobalValue = symbol->irGlobalValue;
+        if (symbol->nextWithSameName)
+            copy->nextWithSameName = copySymbols(symbol->nextWithSameName);
+        return copy;
+    }
+
+    // Add `gv` to `symbols`. If there is a `linkage` that `symbols` adds
+    // to, then any values with the same name in the linkage are copied
+    // into `symbols` first, rather than modifying the linkage.
     void insertGlobalValueSymbol(
-        IRSharedSpecContext*    sharedContext,
-        IRGlobalValue*          gv)
+        IRLinkage::SymbolDictionary&    symbols,
+        IRLinkage*                      linkage,
+        IRGlobalValue*                  gv)
     {
         auto mangledName = gv->mangledName;
 
@@ -6005,20 +6031,29 @@ namespace Slang
         sym->irGlobalValue = gv;
 
         RefPtr<IRSpecSymbol> prev;
-        if (sharedContext->symbols.TryGetValue(mangledName, prev))
+        if (!symbols.TryGetValue(mangledName, prev)
+            && linkage
+            && linkage->symbols.TryGetValue(mangledName, prev))
+        {
+            prev = copySymbols(prev);
+            symbols.Add(mangledName, prev);
+        }
+
+        if (prev)
         {
             sym->nextWithSameName = prev->nextWithSameName;
             prev->nextWithSameName = sym;
         }
         else
         {
-            sharedContext->symbols.Add(mangledName, sym);
+            symbols.Add(mangledName, sym);
         }
     }
 
     void insertGlobalValueSymbols(
-        IRSharedSpecContext*    sharedContext,
-        IRModule*               originalModule)
+        IRLinkage::SymbolDictionary&    symbols,
+        IRLinkage*                      linkage,
+        IRModule*                       originalModule)
     {
         if (!originalModule)
             return;
@@ -6028,16 +6063,79 @@ namespace Slang
             auto gv = as<IRGlobalValue>(ii);
             if (!gv)
                 continue;
-            insertGlobalValueSymbol(sharedContext, gv);
+            insertGlobalValueSymbol(symbols, linkage, gv);
         }
     }
 
+    void insertGlobalValueSymbols(
+        IRSharedSpecContext*    sharedContext,
+        IRModule*               originalModule)
+    {
+        insertGlobalValueSymbols(sharedContext->symbols, sharedContext->linkage, originalModule);
+    }
+
+    // Is `linkage` for exactly the modules that `compileRequest` would link
+    // `originalModule` with now?
+    static bool isIRLinkageUpToDate(
+        IRLinkage*      linkage,
+        CompileRequest* compileRequest,
+        IRModule*       originalModule)
+    {
+        auto& loadedModules = compileRequest->loadedModulesList;
+        if (linkage->modules.Count() != loadedModules.Count() + 1
+            || linkage->modules[0].Ptr() != originalModule)
+        {
+            return false;
+        }
+        for (UInt ii = 0; ii < loadedModules.Count(); ++ii)
+        {
+            if (linkage->modules[ii + 1] != loadedModules[ii]->irModule)
+                return false;
+        }
+        return true;
+    }
+
+    // Get the linkage for the IR module of `translationUnit` and the
+    // modules it imports, building it if no entry point has needed it yet
+    // (or the modules have changed since it was built).
+    IRLinkage* getIRLinkage(
+        TranslationUnitRequest* translationUnit)
+    {
+        auto compileRequest = translationUnit->compileRequest;
+        auto originalModule = translationUnit->irModule.Ptr();
+        auto& linkages = compileRequest->getIRLinkages();
+
+        RefPtr<IRLinkage> linkage;
+        if (linkages.TryGetValue(originalModule, linkage)
+            && isIRLinkageUpToDate(linkage, compileRequest, originalModule))
+        {
+            return linkage;
+        }
+
+        linkage = new IRLinkage();
+        linkage->modules.Add(originalModule);
+        insertGlobalValueSymbols(linkage->symbols, nullptr, originalModule);
+        for (auto loadedModule : compileRequest->loadedModulesList)
+        {
+            linkage->modules.Add(loadedModule->irModule);
+            insertGlobalValueSymbols(linkage->symbols, nullptr, loadedModule->irModule);
+        }
+
+        linkages[originalModule] = linkage;
+        return linkage;
+    }
+
+    // Initialize `sharedContext` to clone code out of `originalModule`
+    // into `module` (or a new module, if `module` is null). If there is a
+    // `linkage` for `originalModule`, its symbols are used rather than
+    // indexing the module again.
     void initializeSharedSpecContext(
         IRSharedSpecContext*    sharedContext,
         Session*                session,
         IRModule*               module,
         IRModule*               originalModule,
-        CodeGenTarget           target)
+        CodeGenTarget           target,
+        IRLinkage*              linkage = nullptr)
     {
 
         SharedIRBuilder* sharedBuilder = &sharedContext->sharedBuilderStorage;
@@ -6056,10 +6154,12 @@ namespace Slang
         sharedContext->module = module;
         sharedContext->originalModule = originalModule;
         sharedContext->target = target;
+        sharedContext->linkage = linkage;
         // We will populate a map with all of the IR values
         // that use the same mangled name, to make lookup easier
         // in other steps.
-        insertGlobalValueSymbols(sharedContext, originalModule);
+        if (!linkage)
+            insertGlobalValueSymbols(sharedContext, originalModule);
     }
 
     // implementation provided in parameter-binding.cpp
@@ -6115,22 +6215,22 @@ namespace Slang
         auto translationUnit = entryPointRequest->getTranslationUnit();
         auto originalIRModule = translationUnit->irModule;
 
+        // The IR definitions for symbols from the translation unit and any
+        // loaded modules are indexed once, and shared by all entry points...
         auto sharedContext = state->getSharedContext();
         initializeSharedSpecContext(
             sharedContext,
             compileRequest->mSession,
             nullptr,
             originalIRModule,
-            target);
+            target,
+            getIRLinkage(translationUnit));
 
         state->irModule = sharedContext->module;
 
-        // We also need to attach the IR definitions for symbols from
-        // any loaded modules:
-        for (auto loadedModule : compileRequest->loadedModulesList)
-        {
-            insertGlobalValueSymbols(sharedContext, loadedModule->irModule);
-        }
+        // ... but we also need those for the generic arguments of the
+        // entry point, if they were lowered on their own.
+        insertGlobalValueSymbols(sharedContext, entryPointRequest->genericArgsIRModule);
 
         auto context = state->getContext();
         context->shared = sharedContext;
@@ -6164,12 +6264,10 @@ namespace Slang
             context->globalVarLayouts.AddIfNotExists(mangledName, globalVarLayout);
         }
 
-        // for now, clone all unreferenced witness tables
-        for (auto sym :context->getSymbols())
-        {
-            if (sym.Value->irGlobalValue->op == kIROp_WitnessTable)
-                cloneGlobalValue(context, (IRWitnessTable*)sym.Value->irGlobalValue);
-        }
+        // Nothing else is cloned up front: code (including witness tables,
+        // and the methods they refer to) is only cloned out of the original
+        // modules as it is referenced from the entry point, or from the
+        // bindings for its generic arguments.
         return state;
     }
 
@@ -6183,6 +6281,11 @@ namespace Slang
         return state->irModule;
     }
 
+    ProgramLayout* getSpecializedProgramLayout(IRSpecializationState* state)
+    {
+        return state->newProgramLayout;
+    }
+
     IRGlobalValue* getSpecializedGlobalValueForDeclRef(
         IRSpecializationState*  state,
         DeclRef<Decl> const&    declRef)
@@ -6240,17 +6343,20 @@ namespace Slang
         // it might reference.
         auto irEntryPoint = specializeIRForEntryPoint(context, entryPointRequest, entryPointLayout);
 
-        // HACK: right now the bindings for global generic parameters are coming in
-        // as part of the original IR module, and we need to make sure these get
-        // copied over, even if they aren't referenced.
+        // The bindings for global generic parameters are coming in as a module
+        // of their own for the entry point, and we need to make sure these get
+        // copied over, even though they aren't referenced.
         //
-        for(auto inst : originalIRModule->getGlobalInsts())
+        if (auto genericArgsIRModule = entryPointRequest->genericArgsIRModule)
         {
-            auto bindInst = as<IRBindGlobalGenericParam>(inst);
-            if(!bindInst)
-                continue;
+            for(auto inst : genericArgsIRModule->getGlobalInsts())
+            {
+                auto bindInst = as<IRBindGlobalGenericParam>(inst);
+                if(!bindInst)
+                    continue;
 
-            cloneValue(context, bindInst);
+                cloneValue(context, bindInst);
+            }
         }
 
 
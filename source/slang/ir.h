@@ -1082,6 +1082,11 @@ struct IRModule : RefObject
 
     MemoryArena memoryArena;
 
+    // Number of instructions created in, and removed from, this module
+    // (reported through `spGetCompileStats`)
+    UInt createdInstCount = 0;
+    UInt removedInstCount = 0;
+
     // The compilation session in use.
     Session*    session;
     IRModuleInst* moduleInst;
@@ -1090,6 +1095,37 @@ struct IRModule : RefObject
     List<RefObject*> m_refObjectsToFree;
 };
 
+// A global value in one of the modules being linked together, along with
+// any others that have the same mangled name (e.g., the declaration of a
+// function in one module and its definition in another, or definitions
+// of the same function that are specialized for different targets).
+struct IRSpecSymbol : RefObject
+{
+    IRGlobalValue*          irGlobalValue;
+    RefPtr<IRSpecSymbol>    nextWithSameName;
+};
+
+// The global values of a translation unit's IR module and of the modules
+// it imports, by mangled name, for linking the code that an entry point
+// needs out of those modules.
+//
+// The modules themselves are never modified by linking: code is only
+// cloned out of them into the module for an entry point as it is referenced.
+// So one linkage is built for a translation unit, and shared (unmodified)
+// by all of the entry points, targets and specializations that link it.
+struct IRLinkage : RefObject
+{
+    typedef Dictionary<Name*, RefPtr<IRSpecSymbol>> SymbolDictionary;
+    SymbolDictionary symbols;
+
+    // The modules whose global values are in `symbols`: the translation
+    // unit's, then those of the modules it imports, in order. These are
+    // kept alive by the linkage, which is out of date once the list of
+    // modules changes (including when the IR for an imported module has
+    // been generated again, after more of it was checked lazily).
+    List<RefPtr<IRModule>> modules;
+};
+
 void printSlangIRAssembly(StringBuilder& builder, IRModule* module);
 String getSlangIRAssembly(IRModule* module);
 
@@ -12,9 +12,10 @@
 
 namespace Slang
 {
-    static Token GetEndOfFileToken()
+    static Token const& GetEndOfFileToken()
     {
-        return Token(TokenType::EndOfFile, "", SourceLoc());
+        static const Token endOfFileToken(TokenType::EndOfFile, UnownedStringSlice(), SourceLoc());
+        return endOfFileToken;
     }
 
     Token* TokenList::begin() const
@@ -41,15 +42,13 @@ namespace Slang
     {}
 
 
-    Token TokenReader::PeekToken() const
+    Token const& TokenReader::PeekToken() const
     {
         if (!mCursor)
             return GetEndOfFileToken();
 
-        Token token = *mCursor;
-        if (mCursor == mEnd)
-            token.type = TokenType::EndOfFile;
-        return token;
+        SLANG_ASSERT(mCursor != mEnd || mEnd->type == TokenType::EndOfFile);
+        return *mCursor;
     }
 
     TokenType TokenReader::PeekTokenType() const
@@ -68,15 +67,14 @@ namespace Slang
         return mCursor->loc;
     }
 
-    Token TokenReader::AdvanceToken()
+    Token const& TokenReader::AdvanceToken()
     {
         if (!mCursor)
             return GetEndOfFileToken();
 
-        Token token = *mCursor;
-        if (mCursor == mEnd)
-            token.type = TokenType::EndOfFile;
-        else
+        SLANG_ASSERT(mCursor != mEnd || mEnd->type == TokenType::EndOfFile);
+        Token const& token = *mCursor;
+        if (mCursor != mEnd)
             mCursor++;
         return token;
     }
@@ -908,7 +906,7 @@ namespace Slang
 
         // Just trim off the first and last characters to remove the quotes
         // (whether they were `""` or `<>`.
-        return token.Content.SubString(1, token.Content.Length()-2);
+        return UnownedStringSlice(token.Content.begin() + 1, token.Content.end() - 1);
     }
 
 
@@ -1281,14 +1279,30 @@ namespace Slang
 
             char const* textEnd = cursor;
 
+            if ((flags & TokenFlag::ScrubbingNeeded) == 0)
+            {
+                // The common case: the token text is exactly the source text.
+                //
+                // An identifier shares the text of its `Name`, so that
+                // lexing a name we've seen before doesn't allocate.
+                UnownedStringSlice text(textBegin, textEnd);
+                if (tokenType == TokenType::Identifier)
+                {
+                    Name* name = this->namePool->getName(text);
+                    token.ptrValue = name;
+                    token.Content = name->text.getUnownedSlice();
+                }
+                else if (textEnd != textBegin)
+                {
+                    token.Content = text;
+                }
+            }
             // Note(tfoley): `StringBuilder::Append()` seems to crash when appending zero bytes
-            if(textEnd != textBegin)
+            else if(textEnd != textBegin)
             {
                 // HACK(tfoley): "scrubbing" token value here to remove escaped newlines...
                 //
-                // TODO: Only perform this work if we encountered an escaped newline
-                // while lexing this token (e.g., keep a flag on the lexer), or
-                // do it on-demand when the actual value of the token is needed.
+                // TODO: do this on-demand when the actual value of the token is needed.
 
                 StringBuilder valueBuilder;
                 auto tt = textBegin;
@@ -1317,18 +1331,21 @@ namespace Slang
                     }
                     valueBuilder.Append(c);
                 }
-                token.Content = valueBuilder.ProduceString();
+                // The scrubbed text isn't in the source file, so it is kept
+                // alive by interning it as a name.
+                Name* name = this->namePool->getName(valueBuilder.ProduceString());
+                token.Content = name->text.getUnownedSlice();
+
+                if (tokenType == TokenType::Identifier)
+                {
+                    token.ptrValue = name;
+                }
             }
 
             token.flags = flags;
 
             this->tokenFlags = 0;
 
-            if (tokenType == TokenType::Identifier)
-            {
-                token.ptrValue = this->namePool->getName(token.Content);
-            }
-
             return token;
         }
     }
@@ -48,12 +48,16 @@ namespace Slang
             , mEnd   (tokens.end  ())
         {}
 
+        // Tokens are returned by reference into the token list being read,
+        // so looking ahead doesn't copy them. The end of the list is always
+        // an end-of-file token, which is returned once the reader reaches it.
+
         bool IsAtEnd() const { return mCursor == mEnd; }
-        Token PeekToken() const;
+        Token const& PeekToken() const;
         TokenType PeekTokenType() const;
         SourceLoc PeekLoc() const;
 
-        Token AdvanceToken();
+        Token const& AdvanceToken();
 
         int GetCount() { return (int)(mEnd - mCursor); }
 
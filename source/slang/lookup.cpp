@@ -1,10 +1,12 @@
 // lookup.cpp
 #include "lookup.h"
+#include "compiler.h"
 #include "name.h"
 
 namespace Slang {
 
 void checkDecl(SemanticsVisitor* visitor, Decl* decl);
+CompileRequest* getCompileRequest(SemanticsVisitor* visitor);
 
 //
 
@@ -44,7 +46,7 @@ void buildMemberDictionary(ContainerDecl* decl)
     decl->transparentMembers.Clear();
 
     // are we a generic?
-    GenericDecl* genericDecl = dynamic_cast<GenericDecl*>(decl);
+    GenericDecl* genericDecl = decl->As<GenericDecl>();
 
     for (auto m : decl->Members)
     {
@@ -83,21 +85,21 @@ void buildMemberDictionary(ContainerDecl* decl)
 bool DeclPassesLookupMask(Decl* decl, LookupMask mask)
 {
     // type declarations
-    if(auto aggTypeDecl = dynamic_cast<AggTypeDecl*>(decl))
+    if(auto aggTypeDecl = decl->As<AggTypeDecl>())
     {
         return int(mask) & int(LookupMask::type);
     }
-    else if(auto simpleTypeDecl = dynamic_cast<SimpleTypeDecl*>(decl))
+    else if(auto simpleTypeDecl = decl->As<SimpleTypeDecl>())
     {
         return int(mask) & int(LookupMask::type);
     }
     // function declarations
-    else if(auto funcDecl = dynamic_cast<FunctionDeclBase*>(decl))
+    else if(auto funcDecl = decl->As<FunctionDeclBase>())
     {
         return (int(mask) & int(LookupMask::Function)) != 0;
     }
     // attribute declaration
-    else if( auto attrDecl = dynamic_cast<AttributeDecl*>(decl) )
+    else if( auto attrDecl = decl->As<AttributeDecl>() )
     {
         return (int(mask) & int(LookupMask::Attribute)) != 0;
     }
@@ -674,6 +676,335 @@ void lookUpMemberImpl(
     
 }
 
+bool MemberLookupCacheKey::operator==(MemberLookupCacheKey const& other) const
+{
+    return name == other.name
+        && mask == other.mask
+        && type->Equals(other.type);
+}
+
+int MemberLookupCacheKey::GetHashCode() const
+{
+    int hash = type->GetHashCode();
+    hash = combineHash(hash, Slang::GetHashCode(name));
+    hash = combineHash(hash, int(mask));
+    return hash;
+}
+
+// Collects the declarations that a cached lookup result depends on.
+//
+// Types, declaration references and substitutions only refer to
+// declarations by raw pointer, so a cache entry must go away before
+// any module it refers to does. We record the module of every
+// declaration we find; if we come across a value we don't know
+// how to walk, the result is not cached at all.
+struct MemberLookupDependencyCollector
+{
+    HashSet<Decl*>  dependencySet;
+    List<Decl*>     dependencies;
+
+    void addDependency(Decl* decl)
+    {
+        if (dependencySet.Contains(decl))
+            return;
+        dependencySet.Add(decl);
+        dependencies.Add(decl);
+    }
+
+    void addModuleOf(Decl* decl)
+    {
+        Decl* moduleDecl = decl;
+        while (moduleDecl->ParentDecl)
+            moduleDecl = moduleDecl->ParentDecl;
+        if (moduleDecl->As<ModuleDecl>())
+            addDependency(moduleDecl);
+    }
+
+    bool addDeclRef(DeclRefBase const& declRef)
+    {
+        if (!declRef.getDecl())
+            return true;
+        addModuleOf(declRef.getDecl());
+        return addSubstitutions(declRef.substitutions);
+    }
+
+    bool addSubstitutions(Substitutions* substitutions)
+    {
+        for (auto subst = substitutions; subst; subst = subst->outer)
+        {
+            if (auto genericSubst = dynamic_cast<GenericSubstitution*>(subst))
+            {
+                addModuleOf(genericSubst->genericDecl);
+                for (auto arg : genericSubst->args)
+                {
+                    if (!addVal(arg))
+                        return false;
+                }
+            }
+            else if (auto thisTypeSubst = dynamic_cast<ThisTypeSubstitution*>(subst))
+            {
+                if (thisTypeSubst->interfaceDecl)
+                    addModuleOf(thisTypeSubst->interfaceDecl);
+                if (!addVal(thisTypeSubst->witness))
+                    return false;
+            }
+            else if (auto globalParamSubst = dynamic_cast<GlobalGenericParamSubstitution*>(subst))
+            {
+                addModuleOf(globalParamSubst->paramDecl);
+                if (!addVal(globalParamSubst->actualType))
+                    return false;
+                for (auto& constraintArg : globalParamSubst->constraintArgs)
+                {
+                    addModuleOf(constraintArg.decl);
+                    if (!addVal(constraintArg.val))
+                        return false;
+                }
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool addVal(Val* val)
+    {
+        if (!val)
+            return true;
+
+        if (auto declRefType = val->dynamicCast<DeclRefType>())
+        {
+            return addDeclRef(declRefType->declRef);
+        }
+        else if (auto arrayType = val->dynamicCast<ArrayExpressionType>())
+        {
+            return addVal(arrayType->baseType) && addVal(arrayType->ArrayLength);
+        }
+        else if (val->dynamicCast<ConstantIntVal>())
+        {
+            return true;
+        }
+        else if (auto genericParamIntVal = val->dynamicCast<GenericParamIntVal>())
+        {
+            return addDeclRef(genericParamIntVal->declRef);
+        }
+        else if (auto subtypeWitness = val->dynamicCast<SubtypeWitness>())
+        {
+            if (!addVal(subtypeWitness->sub) || !addVal(subtypeWitness->sup))
+                return false;
+
+            if (val->dynamicCast<TypeEqualityWitness>())
+            {
+                return true;
+            }
+            else if (auto declaredWitness = val->dynamicCast<DeclaredSubtypeWitness>())
+            {
+                return addDeclRef(declaredWitness->declRef);
+            }
+            else if (auto transitiveWitness = val->dynamicCast<TransitiveSubtypeWitness>())
+            {
+                return addVal(transitiveWitness->subToMid)
+                    && addDeclRef(transitiveWitness->midToSup);
+            }
+        }
+        return false;
+    }
+
+    bool addLookupResultItem(LookupResultItem const& item)
+    {
+        if (!addDeclRef(item.declRef))
+            return false;
+        for (auto breadcrumb = item.breadcrumbs; breadcrumb; breadcrumb = breadcrumb->next)
+        {
+            if (!addDeclRef(breadcrumb->declRef))
+                return false;
+        }
+        return true;
+    }
+};
+
+MemberLookupCache::~MemberLookupCache()
+{
+    clear();
+}
+
+bool MemberLookupCache::tryGetResult(MemberLookupCacheKey const& key, LookupResult& outResult)
+{
+    Entry* entry = entries.TryGetValue(key);
+    if (!entry)
+        return false;
+    outResult = entry->result;
+    return true;
+}
+
+bool MemberLookupCache::addResult(MemberLookupCacheKey const& key, LookupResult const& result)
+{
+    MemberLookupDependencyCollector collector;
+
+    // A new extension for any of the containers that lookup passed
+    // through could change the result.
+    for (auto containerDeclRef : result.lookedupDecls)
+    {
+        collector.addDependency(containerDeclRef.getDecl());
+        if (!collector.addDeclRef(containerDeclRef))
+            return false;
+    }
+
+    if (!collector.addVal(key.type))
+        return false;
+
+    if (result.isOverloaded())
+    {
+        for (auto const& item : result.items)
+        {
+            if (!collector.addLookupResultItem(item))
+                return false;
+        }
+    }
+    else if (!collector.addLookupResultItem(result.item))
+    {
+        return false;
+    }
+
+    removeEntry(key);
+
+    Entry entry;
+    entry.result = result;
+    // The set of visited containers is only needed while performing
+    // lookup, so we don't keep it alive in the cache.
+    entry.result.lookedupDecls = HashSet<DeclRef<ContainerDecl>>();
+    entry.dependencies = collector.dependencies;
+
+    for (auto dependency : entry.dependencies)
+    {
+        if (auto moduleDecl = dependency->As<ModuleDecl>())
+        {
+            SLANG_ASSERT(!moduleDecl->memberLookupCache || moduleDecl->memberLookupCache == this);
+            moduleDecl->memberLookupCache = this;
+        }
+
+        HashSet<MemberLookupCacheKey>* keys = dependents.TryGetValue(dependency);
+        if (!keys)
+        {
+            dependents.Add(dependency, HashSet<MemberLookupCacheKey>());
+            keys = dependents.TryGetValue(dependency);
+        }
+        keys->Add(key);
+    }
+
+    entries.Add(key, entry);
+    return true;
+}
+
+void MemberLookupCache::removeEntry(MemberLookupCacheKey const& key)
+{
+    Entry* entry = entries.TryGetValue(key);
+    if (!entry)
+        return;
+
+    for (auto dependency : entry->dependencies)
+    {
+        if (auto keys = dependents.TryGetValue(dependency))
+        {
+            keys->Remove(key);
+            if (keys->Count() == 0)
+                dependents.Remove(dependency);
+        }
+    }
+    entries.Remove(key);
+}
+
+void MemberLookupCache::invalidateDependentsOf(Decl* decl)
+{
+    HashSet<MemberLookupCacheKey>* keys = dependents.TryGetValue(decl);
+    if (!keys)
+        return;
+
+    List<MemberLookupCacheKey> keysToRemove;
+    for (auto key : *keys)
+        keysToRemove.Add(key);
+
+    for (auto const& key : keysToRemove)
+        removeEntry(key);
+}
+
+void MemberLookupCache::clear()
+{
+    for (auto pair : dependents)
+    {
+        if (auto moduleDecl = pair.Key->As<ModuleDecl>())
+            moduleDecl->memberLookupCache = nullptr;
+    }
+    dependents = decltype(dependents)();
+    entries = decltype(entries)();
+}
+
+static ModuleDecl* getModuleDecl(Decl* decl)
+{
+    for (auto dd = decl; dd; dd = dd->ParentDecl)
+    {
+        if (auto moduleDecl = dynamic_cast<ModuleDecl*>(dd))
+            return moduleDecl;
+    }
+    return nullptr;
+}
+
+void registerExternalExtension(ExtensionDecl* extDecl, AggTypeDecl* targetDecl)
+{
+    auto extModuleDecl = getModuleDecl(extDecl);
+    auto targetModuleDecl = getModuleDecl(targetDecl);
+    if (!extModuleDecl || !targetModuleDecl || extModuleDecl == targetModuleDecl)
+        return;
+
+    extDecl->externalTargetDecl = targetDecl;
+    extModuleDecl->outgoingExtensions.Add(extDecl);
+    targetModuleDecl->incomingExtensions.Add(extDecl);
+}
+
+ModuleDecl::~ModuleDecl()
+{
+    for (auto extDecl : outgoingExtensions)
+    {
+        auto targetDecl = extDecl->externalTargetDecl;
+        if (!targetDecl)
+            continue;
+
+        for (auto link = &targetDecl->candidateExtensions; *link; link = &(*link)->nextCandidateExtension)
+        {
+            if (*link == extDecl)
+            {
+                *link = extDecl->nextCandidateExtension;
+                break;
+            }
+        }
+        getModuleDecl(targetDecl)->incomingExtensions.Remove(extDecl);
+    }
+    for (auto extDecl : incomingExtensions)
+    {
+        extDecl->externalTargetDecl = nullptr;
+    }
+
+    // Any cached lookup that found a member of one of our extensions
+    // depends on this module, and so is discarded here as well.
+    if (memberLookupCache)
+        memberLookupCache->invalidateDependentsOf(this);
+}
+
+// A lookup result may only be cached if every container that
+// lookup passed through had its header fully checked. Otherwise
+// we might be observing a partial view of a declaration that
+// is still in the middle of being checked.
+static bool isLookupResultCacheable(LookupResult const& result)
+{
+    for (auto containerDeclRef : result.lookedupDecls)
+    {
+        if (!containerDeclRef.getDecl()->IsChecked(DeclCheckState::CheckedHeader))
+            return false;
+    }
+    return true;
+}
+
 LookupResult lookUpMember(
     Session*            session,
     SemanticsVisitor*   semantics,
@@ -681,8 +1012,37 @@ LookupResult lookUpMember(
     Type*               type,
     LookupMask          mask)
 {
+    // Member lookup on a type walks its members, transparent members,
+    // extensions and inherited interfaces. The flattened result only
+    // depends on the type and name, so we cache it on the session, and
+    // repeated member accesses on the same type become a single hash lookup.
+    //
+    // We only use the cache during semantic checking, since that is
+    // where lookup through interfaces and extensions is enabled.
+    //
+    MemberLookupCacheKey cacheKey;
+    if (semantics)
+    {
+        cacheKey.type = type->GetCanonicalType();
+        cacheKey.name = name;
+        cacheKey.mask = mask;
+
+        LookupResult cachedResult;
+        if (session->memberLookupCache.tryGetResult(cacheKey, cachedResult))
+        {
+            if (auto request = getCompileRequest(semantics))
+                request->stats.memberLookupCacheHitCount++;
+            return cachedResult;
+        }
+    }
+
     LookupResult result;
     lookUpMemberImpl(session, semantics, name, type, result, nullptr, mask);
+
+    if (semantics && isLookupResultCacheable(result))
+    {
+        session->memberLookupCache.addResult(cacheKey, result);
+    }
     return result;
 }
 
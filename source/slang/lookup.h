@@ -33,6 +33,11 @@ LookupResult lookUpLocal(
     DeclRef<ContainerDecl>  containerDeclRef,
     LookupMask          mask = LookupMask::Default);
 
+// Record that `extDecl` has been attached to the candidate extensions of
+// `targetDecl`, so that it can be detached again if the module that declares
+// the extension is destroyed before the one that declares the type.
+void registerExternalExtension(ExtensionDecl* extDecl, AggTypeDecl* targetDecl);
+
 // Perform member lookup in the context of a type
 LookupResult lookUpMember(
     Session*            session,
@@ -382,6 +382,14 @@ void setValue(IRGenContext* context, Decl* decl, LoweredValInfo value)
     context->env->mapDeclToValue[decl] = value;
 }
 
+// Make sure a declaration that is only checked on demand has been checked
+// (defined in check.cpp)
+void ensureDeclIsChecked(CompileRequest* request, Decl* decl);
+
+// Is this a declaration that is checked on demand, and hasn't been checked yet?
+// (defined in check.cpp)
+bool isUncheckedLazyDecl(Decl* decl);
+
 // Ensure that a version of the given declaration has been emitted to the IR
 LoweredValInfo ensureDecl(
     IRGenContext*   context,
@@ -4366,16 +4374,6 @@ struct DeclLoweringVisitor : DeclVisitor<DeclLoweringVisitor, LoweredValInfo>
         return nullptr;
     }
 
-    bool isFromStdLib(Decl* decl)
-    {
-        for (auto dd = decl; dd; dd = dd->ParentDecl)
-        {
-            if (dd->HasModifier<FromStdLibModifier>())
-                return true;
-        }
-        return false;
-    }
-
     bool isImportedDecl(Decl* decl)
     {
         ModuleDecl* moduleDecl = findModuleDecl(decl);
@@ -5034,6 +5032,10 @@ LoweredValInfo ensureDecl(
 
     subContext.irBuilder = &subIRBuilder;
 
+    // Declarations from a lazily-checked module might not have
+    // been checked yet, if nothing the front-end saw referenced them.
+    ensureDeclIsChecked(shared->compileRequest, decl);
+
     result = lowerDecl(&subContext, decl);
 
     // By default assume that any value we are lowering represents
@@ -5220,24 +5222,12 @@ LoweredValInfo emitDeclRef(
         type);
 }
 
-static void lowerEntryPointToIR(
+// Emit instructions to bind the global generic parameters of the
+// program to the arguments given for an entry point.
+static void lowerGlobalGenericArgsToIR(
     IRGenContext*       context,
     EntryPointRequest*  entryPointRequest)
 {
-    // First, lower the entry point like an ordinary function
-    auto entryPointFuncDecl = entryPointRequest->decl;
-    if (!entryPointFuncDecl)
-    {
-        // Something must have gone wrong earlier, if we
-        // weren't able to associate a declaration with
-        // the entry point request.
-        return;
-    }
-    auto loweredEntryPointFunc = ensureDecl(context, entryPointFuncDecl);
-
-    // Now lower all the arguments supplied for global generic
-    // type parameters.
-    //
     auto builder = context->irBuilder;
     builder->setInsertInto(builder->getModule()->getModuleInst());
     for (RefPtr<Substitutions> subst = entryPointRequest->globalGenericSubst; subst; subst = subst->outer)
@@ -5263,6 +5253,66 @@ static void lowerEntryPointToIR(
     }
 }
 
+static void lowerEntryPointToIR(
+    IRGenContext*       context,
+    EntryPointRequest*  entryPointRequest)
+{
+    // First, lower the entry point like an ordinary function
+    auto entryPointFuncDecl = entryPointRequest->decl;
+    if (!entryPointFuncDecl)
+    {
+        // Something must have gone wrong earlier, if we
+        // weren't able to associate a declaration with
+        // the entry point request.
+        return;
+    }
+    auto loweredEntryPointFunc = ensureDecl(context, entryPointFuncDecl);
+
+    // Note: the arguments supplied for global generic type parameters
+    // are lowered separately for each entry point (see
+    // `generateIRForGlobalGenericArgs`), since they can be different
+    // for each of them.
+}
+
+IRModule* generateIRForGlobalGenericArgs(
+    EntryPointRequest*  entryPoint)
+{
+    auto compileRequest = entryPoint->compileRequest;
+
+    SharedIRGenContext sharedContextStorage;
+    SharedIRGenContext* sharedContext = &sharedContextStorage;
+
+    // There is no main module here, so that every declaration the
+    // arguments refer to is emitted as a declaration, and gets linked
+    // against its definition in the IR for the translation unit (or
+    // an imported module) during specialization.
+    sharedContext->compileRequest = compileRequest;
+    sharedContext->mainModuleDecl = nullptr;
+
+    IRGenContext contextStorage(sharedContext);
+    IRGenContext* context = &contextStorage;
+
+    SharedIRBuilder sharedBuilderStorage;
+    SharedIRBuilder* sharedBuilder = &sharedBuilderStorage;
+    sharedBuilder->module = nullptr;
+    sharedBuilder->session = compileRequest->mSession;
+
+    IRBuilder builderStorage;
+    IRBuilder* builder = &builderStorage;
+    builder->sharedBuilder = sharedBuilder;
+
+    IRModule* module = builder->createModule();
+    sharedBuilder->module = module;
+
+    context->irBuilder = builder;
+
+    lowerGlobalGenericArgsToIR(context, entryPoint);
+
+    validateIRModuleIfEnabled(compileRequest, module);
+
+    return module;
+}
+
 IRModule* generateIRForTranslationUnit(
     TranslationUnitRequest* translationUnit)
 {
@@ -5306,8 +5356,13 @@ IRModule* generateIRForTranslationUnit(
     //
     // Next, ensure that all other global declarations have
     // been emitted.
+    //
+    // (Functions in an imported module that is checked lazily
+    // are left out until something has used them.)
     for (auto decl : translationUnit->SyntaxNode->Members)
     {
+        if (isUncheckedLazyDecl(decl))
+            continue;
         ensureDecl(context, decl);
     }
 
@@ -22,5 +22,10 @@ namespace Slang
 
     IRModule* generateIRForTranslationUnit(
         TranslationUnitRequest* translationUnit);
+
+    // Generate IR that binds the global generic parameters to the
+    // arguments of `entryPoint` (see `EntryPointRequest::genericArgsIRModule`)
+    IRModule* generateIRForGlobalGenericArgs(
+        EntryPointRequest*      entryPoint);
 }
 #endif
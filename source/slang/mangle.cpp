@@ -476,7 +476,7 @@ namespace Slang
     {
         ManglingContext context;
         mangleName(&context, declRef);
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
     String getMangledName(DeclRefBase const & declRef)
@@ -497,7 +497,7 @@ namespace Slang
             emitIRVal(&context, specializeInst->getArg(aa));
         }
 
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
     String getMangledName(Decl* decl)
@@ -513,7 +513,7 @@ namespace Slang
         emitRaw(&context, "_SW");
         emitQualifiedName(&context, sub);
         emitQualifiedName(&context, sup);
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
     String getMangledNameForConformanceWitness(
@@ -529,7 +529,7 @@ namespace Slang
         emitRaw(&context, "_SW");
         emitQualifiedName(&context, sub);
         emitType(&context, sup);
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
     String getMangledNameForConformanceWitness(
@@ -545,14 +545,14 @@ namespace Slang
         emitRaw(&context, "_SW");
         emitType(&context, sub);
         emitType(&context, sup);
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
     String getMangledTypeName(Type* type)
     {
         ManglingContext context;
         emitType(&context, type);
-        return context.sb.ProduceString();
+        return _Move(context.sb).ProduceString();
     }
 
 
@@ -26,6 +26,275 @@ namespace Slang
         DeclRef<Decl> sub,
         Type* sup);
     String getMangledTypeName(Type* type);
+
+    // Reads back the pieces of a mangled name, such as the simple
+    // name of the declaration it refers to (e.g., `Sample` for
+    // `Texture2D<T>.Sample`).
+    class UnmangleContext
+    {
+    private:
+        char const* cursor_  = nullptr;
+        char const* begin_   = nullptr;
+        char const* end_     = nullptr;
+
+        bool isDigit(char c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        char peek()
+        {
+            return *cursor_;
+        }
+
+        char get()
+        {
+            return *cursor_++;
+        }
+
+        void expect(char c)
+        {
+            if(peek() == c)
+            {
+                get();
+            }
+            else
+            {
+                // ERROR!
+                SLANG_UNEXPECTED("mangled name error");
+            }
+        }
+
+        void expect(char const* str)
+        {
+            while(char c = *str++)
+                expect(c);
+        }
+
+    public:
+        UnmangleContext()
+        {}
+
+        UnmangleContext(String const& str)
+            : cursor_(str.begin())
+            , begin_(str.begin())
+            , end_(str.end())
+        {}
+
+        // Call at the beginning of a mangled name,
+        // to strip off the main prefix
+        void startUnmangling()
+        {
+            expect("_S");
+        }
+
+        UInt readCount()
+        {
+            int c = peek();
+            if(!isDigit((char)c))
+            {
+                SLANG_UNEXPECTED("bad name mangling");
+                UNREACHABLE_RETURN(0);
+            }
+            get();
+
+            if(c == '0')
+                return 0;
+
+            UInt count = 0;
+            for(;;)
+            {
+                count = count*10 + c - '0';
+                c = peek();
+                if(!isDigit((char)c))
+                    return count;
+
+                get();
+            }
+        }
+
+        void readGenericParam()
+        {
+            switch(peek())
+            {
+            case 'T':
+            case 'C':
+                get();
+                break;
+
+            case 'v':
+                get();
+                readType();
+                break;
+
+            default:
+                SLANG_UNEXPECTED("bad name mangling");
+                break;
+            }
+        }
+
+        void readGenericParams()
+        {
+            expect("g");
+            UInt paramCount = readCount();
+            for(UInt pp = 0; pp < paramCount; pp++)
+            {
+                readGenericParam();
+            }
+        }
+
+        void readSimpleIntVal()
+        {
+            int c = peek();
+            if(isDigit((char)c))
+            {
+                get();
+            }
+            else
+            {
+                readVal();
+            }
+        }
+
+
+        UnownedStringSlice readRawStringSegment()
+        {
+            // Read the length part
+            UInt count = readCount();
+            if(count > UInt(end_ - cursor_))
+            {
+                SLANG_UNEXPECTED("bad name mangling");
+                UNREACHABLE_RETURN(UnownedStringSlice());
+            }
+
+            auto result = UnownedStringSlice(cursor_, cursor_ + count);
+            cursor_ += count;
+            return result;
+        }
+
+        void readNamedType()
+        {
+            // TODO: handle types with more complicated names
+            readRawStringSegment();
+        }
+
+        void readType()
+        {
+            int c = peek();
+            switch(c)
+            {
+            case 'V':
+            case 'b':
+            case 'i':
+            case 'u':
+            case 'U':
+            case 'h':
+            case 'f':
+            case 'd':
+                get();
+                break;
+
+            case 'v':
+                get();
+                readSimpleIntVal();
+                readType();
+                break;
+
+            default:
+                readNamedType();
+                break;
+            }
+        }
+
+        void readVal()
+        {
+            switch(peek())
+            {
+            case 'k':
+                get();
+                readCount();
+                break;
+
+            case 'K':
+                get();
+                readRawStringSegment();
+                break;
+
+            default:
+                readType();
+                break;
+            }
+
+        }
+
+        void readGenericArg()
+        {
+            readVal();
+        }
+
+        void readGenericArgs()
+        {
+            expect("G");
+            UInt argCount = readCount();
+            for(UInt aa = 0; aa < argCount; aa++)
+            {
+                readGenericArg();
+            }
+        }
+
+        void readExtensionSpec()
+        {
+            expect("X");
+            readType();
+        }
+
+        UnownedStringSlice readSimpleName()
+        {
+            UnownedStringSlice result;
+            for(;;)
+            {
+                int c = peek();
+
+                if(c == 'g')
+                {
+                    readGenericParams();
+                    continue;
+                }
+                else if(c == 'G')
+                {
+                    readGenericArgs();
+                    continue;
+                }
+                else if(c == 'X')
+                {
+                    readExtensionSpec();
+                    continue;
+                }
+
+                if(!isDigit((char)c))
+                    return result;
+
+                // Read the length part
+                UInt count = readCount();
+                if(count > UInt(end_ - cursor_))
+                {
+                    SLANG_UNEXPECTED("bad name mangling");
+                    UNREACHABLE_RETURN(result);
+                }
+
+                result = UnownedStringSlice(cursor_, cursor_ + count);
+                cursor_ += count;
+            }
+        }
+
+        UInt readParamCount()
+        {
+            expect("p");
+            UInt count = readCount();
+            expect("p");
+            return count;
+        }
+    };
 }
 
 #endif
\ No newline at end of file
@@ -3,22 +3,47 @@
 
 namespace Slang {
 
-String getText(Name* name)
+String const& getText(Name* name)
 {
-    if (!name) return String();
+    static const String kEmptyText;
+    if (!name) return kEmptyText;
     return name->text;
 }
 
+RootNamePool::RootNamePool()
+    : nameArena(4096)
+{}
+
+RootNamePool::~RootNamePool()
+{
+    // The names are allocated from `nameArena`, so we just
+    // need to make sure their text gets released.
+    for (auto& pair : names)
+        pair.Value->~Name();
+}
+
+Name* RootNamePool::createName(String const& text)
+{
+    Name* name = new(nameArena.allocate(sizeof(Name))) Name();
+    name->text = text;
+    names.Add(text, name);
+    return name;
+}
+
 Name* NamePool::getName(String const& text)
 {
-    RefPtr<Name> name;
+    Name* name = nullptr;
     if (rootPool->names.TryGetValue(text, name))
         return name;
+    return rootPool->createName(text);
+}
 
-    name = new Name();
-    name->text = text;
-    rootPool->names.Add(text, name);
-    return name;
+Name* NamePool::getName(UnownedStringSlice const& text)
+{
+    Name* name = nullptr;
+    if (rootPool->names.TryGetValue(text, name))
+        return name;
+    return rootPool->createName(String(text));
 }
 
 } // namespace Slang
@@ -6,6 +6,7 @@
 // the name of types, variables, etc. in the AST.
 
 #include "../core/basic.h"
+#include "../core/slang-memory-arena.h"
 
 namespace Slang {
 
@@ -21,7 +22,7 @@ namespace Slang {
 // cleaned up when the pool is deleted), and which is responsible for
 // ensuring the uniqueness of name objects.
 //
-class Name : public RefObject
+class Name
 {
 public:
     // The raw text of the name.
@@ -34,7 +35,7 @@ public:
 
 // Get the textual string representation of a name
 // (e.g., so that it can be printed).
-String getText(Name* name);
+String const& getText(Name* name);
 
 // A `RootNamePool` is used to store and look up names.
 // If two systems need to work together with names, and be sure that they
@@ -43,8 +44,20 @@ String getText(Name* name);
 //
 struct RootNamePool
 {
+    RootNamePool();
+    ~RootNamePool();
+
+    // Create a new name, which must not already be in `names`.
+    Name* createName(String const& text);
+
     // The mapping from text strings to the corresponding name.
-    Dictionary<String, RefPtr<Name> > names;
+    //
+    // Each key shares its storage with the `Name::text` of its value,
+    // so the text of a name is only ever allocated once.
+    Dictionary<String, Name*> names;
+
+    // Storage for the `Name` objects, which live as long as the pool.
+    MemoryArena nameArena;
 };
 
 // A `NamePool` is effectively a way of storing a subset of the
@@ -64,6 +77,10 @@ struct NamePool
     // Find or create the `Name` that represents the given `text`.
     Name* getName(String const& text);
 
+    // Find or create the `Name` that represents the given `text`,
+    // only allocating if this is the first time the name is seen.
+    Name* getName(UnownedStringSlice const& text);
+
     // Set the parent name pool to use for lookup
     void setRootNamePool(RootNamePool* rootNamePool)
     {
@@ -314,6 +314,14 @@ struct OptionsParser
                 {
                     flags |= SLANG_COMPILE_FLAG_NO_CODEGEN;
                 }
+                else if (argStr == "-arena-ast")
+                {
+                    flags |= SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST;
+                }
+                else if (argStr == "-time-passes")
+                {
+                    requestImpl->shouldReportCompileStats = true;
+                }
                 else if(argStr == "-dump-ir" )
                 {
                     requestImpl->shouldDumpIR = true;
@@ -330,6 +338,21 @@ struct OptionsParser
                 {
                     targetFlags |= SLANG_TARGET_FLAG_PARAMETER_BLOCKS_USE_REGISTER_SPACES;
                 }
+                else if(argStr == "-emit-spirv-directly" )
+                {
+                    targetFlags |= SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY;
+                }
+                else if(argStr == "-library-output" )
+                {
+                    targetFlags |= SLANG_TARGET_FLAG_LIBRARY_OUTPUT;
+                }
+                else if (argStr == "-downstream-cache")
+                {
+                    String path;
+                    SLANG_RETURN_ON_FAIL(tryReadCommandLineArgument(sink, arg, &argCursor, argEnd, path));
+
+                    spSetDownstreamOutputCacheDirectory(session, path.Buffer());
+                }
                 else if (argStr == "-backend" || argStr == "-target")
                 {
                     String name;
@@ -296,9 +296,9 @@ static bool isDigit(char c)
 /// Given a string that specifies a name and index (e.g., `COLOR0`),
 /// split it into slices for the name part and the index part.
 static void splitNameAndIndex(
-    String const&       text,
-    UnownedStringSlice& outName,
-    UnownedStringSlice& outDigits)
+    UnownedStringSlice const&   text,
+    UnownedStringSlice&         outName,
+    UnownedStringSlice&         outDigits)
 {
     char const* nameBegin = text.begin();
     char const* digitsEnd = text.end();
@@ -323,8 +323,8 @@ LayoutSemanticInfo ExtractLayoutSemanticInfo(
     info.index = 0;
     info.kind = LayoutResourceKind::None;
 
-    String registerName = semantic->registerName.Content;
-    if (registerName.Length() == 0)
+    UnownedStringSlice registerName = semantic->registerName.Content;
+    if (registerName.size() == 0)
         return info;
 
     // The register name is expected to be in the form:
@@ -389,7 +389,7 @@ LayoutSemanticInfo ExtractLayoutSemanticInfo(
     if( auto registerSemantic = dynamic_cast<HLSLRegisterSemantic*>(semantic) )
     {
         auto const& spaceName = registerSemantic->spaceName.Content;
-        if(spaceName.Length() != 0)
+        if(spaceName.size() != 0)
         {
             UnownedStringSlice spaceSpelling;
             UnownedStringSlice spaceDigits;
@@ -415,7 +415,7 @@ LayoutSemanticInfo ExtractLayoutSemanticInfo(
     }
 
     // TODO: handle component mask part of things...
-    if( semantic->componentMask.Content.Length() != 0 )
+    if( semantic->componentMask.Content.size() != 0 )
     {
         getSink(context)->diagnose(semantic->componentMask, Diagnostics::componentMaskNotSupported);
     }
@@ -858,7 +858,7 @@ static bool findLayoutArg(
     {
         if( modifier )
         {
-            *outVal = (UInt) strtoull(modifier->valToken.Content.Buffer(), nullptr, 10);
+            *outVal = (UInt) strtoull(String(modifier->valToken.Content).Buffer(), nullptr, 10);
             return true;
         }
     }
@@ -1659,7 +1659,7 @@ struct SimpleSemanticInfo
 SimpleSemanticInfo decomposeSimpleSemantic(
     HLSLSimpleSemantic* semantic)
 {
-    auto composedName = semantic->name.Content;
+    String composedName = semantic->name.Content;
 
     // look for a trailing sequence of decimal digits
     // at the end of the composed name
@@ -10,6 +10,7 @@ namespace Slang
 {
     // Pre-declare
     static Name* getName(Parser* parser, String const& text);
+    static Name* getName(Parser* parser, UnownedStringSlice const& text);
 
     // Helper class useful to build a list of modifiers. 
     struct ModifierListBuilder
@@ -132,9 +133,9 @@ namespace Slang
 
         RefPtr<ModuleDecl> Parse();
 
-        Token ReadToken();
-        Token ReadToken(TokenType type);
-        Token ReadToken(const char * string);
+        Token const& ReadToken();
+        Token const& ReadToken(TokenType type);
+        Token const& ReadToken(const char * string);
         bool LookAheadToken(TokenType type, int offset = 0);
         bool LookAheadToken(const char * string, int offset = 0);
         void                                        parseSourceFile(ModuleDecl* program);
@@ -299,7 +300,7 @@ namespace Slang
 
 
     // Expect an identifier token with the given content, and consume it.
-    Token Parser::ReadToken(const char* expected)
+    Token const& Parser::ReadToken(const char* expected)
     {
         if (tokenReader.PeekTokenType() == TokenType::Identifier
                 && tokenReader.PeekToken().Content == expected)
@@ -340,7 +341,7 @@ namespace Slang
         }
     }
 
-    Token Parser::ReadToken()
+    Token const& Parser::ReadToken()
     {
         return tokenReader.AdvanceToken();
     }
@@ -483,7 +484,7 @@ namespace Slang
         return TryRecover(parser, recoverBefore, 1, recoverAfter, 1);
     }
 
-    Token Parser::ReadToken(TokenType expected)
+    Token const& Parser::ReadToken(TokenType expected)
     {
         if (tokenReader.PeekTokenType() == expected)
         {
@@ -683,9 +684,9 @@ namespace Slang
         }
 
         // Make a 'token'
-        const String scopedIdentifier(scopedIdentifierBuilder.ToString());
-        Token token(TokenType::Identifier, scopedIdentifier, scopedIdSourceLoc);
-        token.ptrValue = getName(parser, token.Content);
+        Name* scopedName = getName(parser, scopedIdentifierBuilder.ProduceString());
+        Token token(TokenType::Identifier, scopedName->text.getUnownedSlice(), scopedIdSourceLoc);
+        token.ptrValue = scopedName;
 
         return token;
     }
@@ -754,12 +755,12 @@ namespace Slang
         return parser->tokenReader.PeekTokenType();
     }
 
-    static Token advanceToken(Parser* parser)
+    static Token const& advanceToken(Parser* parser)
     {
         return parser->ReadToken();
     }
 
-    static Token peekToken(Parser* parser)
+    static Token const& peekToken(Parser* parser)
     {
         return parser->tokenReader.PeekToken();
     }
@@ -901,6 +902,11 @@ namespace Slang
         return parser->translationUnit->compileRequest->getNamePool()->getName(text);
     }
 
+    static Name* getName(Parser* parser, UnownedStringSlice const& text)
+    {
+        return parser->translationUnit->compileRequest->getNamePool()->getName(text);
+    }
+
     static NameLoc expectIdentifier(Parser* parser)
     {
         return NameLoc(parser->ReadToken(TokenType::Identifier));
@@ -983,7 +989,7 @@ namespace Slang
             case TokenType::QuestionMark:
                 if (AdvanceIf(parser, TokenType::Colon))
                 {
-                    nameToken.Content = nameToken.Content + ":";
+                    nameToken.Content = UnownedStringSlice::fromLiteral("?:");
                     break;
                 }
 
@@ -2203,8 +2209,8 @@ namespace Slang
         addModifier(bufferVarDecl, reflectionNameModifier);
 
         // Both the buffer variable and its type need to have names generated
-        bufferVarDecl->nameAndLoc.name = generateName(parser, "parameterGroup_" + reflectionNameToken.Content);
-        bufferDataTypeDecl->nameAndLoc.name = generateName(parser, "ParameterGroup_" + reflectionNameToken.Content);
+        bufferVarDecl->nameAndLoc.name = generateName(parser, String("parameterGroup_") + reflectionNameToken.Content);
+        bufferDataTypeDecl->nameAndLoc.name = generateName(parser, String("ParameterGroup_") + reflectionNameToken.Content);
 
         addModifier(bufferDataTypeDecl, new ImplicitParameterGroupElementTypeModifier());
         addModifier(bufferVarDecl, new ImplicitParameterGroupVariableModifier());
@@ -2372,7 +2378,7 @@ namespace Slang
         parser->FillPosition(blockVarDecl.Ptr());
 
         // Generate a unique name for the data type
-        blockDataTypeDecl->nameAndLoc.name = generateName(parser, "ParameterGroup_" + reflectionNameToken.Content);
+        blockDataTypeDecl->nameAndLoc.name = generateName(parser, String("ParameterGroup_") + reflectionNameToken.Content);
 
         // TODO(tfoley): We end up constructing unchecked syntax here that
         // is expected to type check into the right form, but it might be
@@ -2417,7 +2423,7 @@ namespace Slang
         else
         {
             // synthesize a dummy name
-            blockVarDecl->nameAndLoc.name = generateName(parser, "parameterGroup_" + reflectionNameToken.Content);
+            blockVarDecl->nameAndLoc.name = generateName(parser, String("parameterGroup_") + reflectionNameToken.Content);
 
             // Otherwise we have a transparent declaration, similar
             // to an HLSL `cbuffer`
@@ -2637,7 +2643,7 @@ namespace Slang
         return decl;
     }
 
-    static Token expect(Parser* parser, TokenType tokenType)
+    static Token const& expect(Parser* parser, TokenType tokenType)
     {
         return parser->ReadToken(tokenType);
     }
@@ -3709,7 +3715,7 @@ namespace Slang
         {
         case TokenType::QuestionMark:
             opToken = parser->ReadToken();
-            opToken.Content = "?:";
+            opToken.Content = UnownedStringSlice::fromLiteral("?:");
             break;
 
         default:
@@ -4415,7 +4421,7 @@ namespace Slang
             {
                 modifier->opToken = parser->ReadToken(TokenType::Identifier);
 
-                modifier->op = findIROp(modifier->opToken.Content.Buffer());
+                modifier->op = findIROp(String(modifier->opToken.Content).Buffer());
 
                 if (modifier->op == kIROp_Invalid)
                 {
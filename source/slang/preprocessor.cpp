@@ -201,6 +201,10 @@ struct Preprocessor
     // stop them from being included again.
     HashSet<String>                         pragmaOncePaths;
 
+    // If set, where to record the names of all the macros looked up
+    // (whether they were defined or not), including in included files
+    HashSet<Name*>*                         macroNamesLookedUp = nullptr;
+
 
     TranslationUnitRequest* getTranslationUnit()
     {
@@ -509,8 +513,17 @@ static PreprocessorEnvironment* GetCurrentEnvironment(Preprocessor* preprocessor
     }
 }
 
+// Record that the definition (or not) of the macro `name` affects the output,
+// if the caller wants to know
+static void NoteMacroLookup(Preprocessor* preprocessor, Name* name)
+{
+    if (preprocessor->macroNamesLookedUp)
+        preprocessor->macroNamesLookedUp->Add(name);
+}
+
 static PreprocessorMacro* LookupMacro(Preprocessor* preprocessor, Name* name)
 {
+    NoteMacroLookup(preprocessor, name);
     return LookupMacro(GetCurrentEnvironment(preprocessor), name);
 }
 
@@ -664,7 +677,7 @@ static void MaybeBeginMacroExpansion(
             }
 
             // Consume the opening `(`
-            Token leftParen = AdvanceRawToken(preprocessor);
+            AdvanceRawToken(preprocessor);
 
             FunctionLikeMacroExpansion* expansion = new FunctionLikeMacroExpansion();
             InitializeMacroExpansion(preprocessor, expansion, macro);
@@ -919,7 +932,7 @@ inline Token const& GetDirective(PreprocessorDirectiveContext* context)
 }
 
 // Get the name of the directive being parsed.
-inline String const& GetDirectiveName(PreprocessorDirectiveContext* context)
+inline UnownedStringSlice const& GetDirectiveName(PreprocessorDirectiveContext* context)
 {
     return context->directiveToken.Content;
 }
@@ -1641,6 +1654,7 @@ static void HandleDefineDirective(PreprocessorDirectiveContext* context)
     PreprocessorMacro* macro = CreateMacro(context->preprocessor);
     macro->nameAndLoc = NameLoc(nameToken);
 
+    NoteMacroLookup(context->preprocessor, name);
     PreprocessorMacro* oldMacro = LookupMacro(&context->preprocessor->globalEnv, name);
     if (oldMacro)
     {
@@ -1721,6 +1735,7 @@ static void HandleUndefDirective(PreprocessorDirectiveContext* context)
     Name* name = nameToken.getName();
 
     PreprocessorEnvironment* env = &context->preprocessor->globalEnv;
+    NoteMacroLookup(context->preprocessor, name);
     PreprocessorMacro* macro = LookupMacro(env, name);
     if (macro != NULL)
     {
@@ -2069,12 +2084,11 @@ static const PreprocessorDirective kInvalidDirective = {
 };
 
 // Look up the directive with the given name.
-static PreprocessorDirective const* FindDirective(String const& name)
+static PreprocessorDirective const* FindDirective(UnownedStringSlice const& name)
 {
-    char const* nameStr = name.Buffer();
     for (int ii = 0; kDirectives[ii].name; ++ii)
     {
-        if (strcmp(kDirectives[ii].name, nameStr) != 0)
+        if (name != UnownedTerminatedStringSlice(kDirectives[ii].name))
             continue;
 
         return &kDirectives[ii];
@@ -2279,11 +2293,13 @@ TokenList preprocessSource(
     DiagnosticSink*             sink,
     IncludeHandler*             includeHandler,
     Dictionary<String, String>  defines,
-    TranslationUnitRequest*     translationUnit)
+    TranslationUnitRequest*     translationUnit,
+    HashSet<Name*>*             outMacroNamesLookedUp)
 {
     Preprocessor preprocessor;
     InitializePreprocessor(&preprocessor, sink);
     preprocessor.translationUnit = translationUnit;
+    preprocessor.macroNamesLookedUp = outMacroNamesLookedUp;
 
     preprocessor.includeHandler = includeHandler;
     for (auto p : defines)
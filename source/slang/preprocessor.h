@@ -30,12 +30,18 @@ struct IncludeHandler
 };
 
 // Take a string of source code and preprocess it into a list of tokens.
+//
+// If `outMacroNamesLookedUp` is set, the names of all the macros that were
+// looked up (by expansion, `#if`, `#ifdef` and so on, whether they turned out
+// to be defined or not) are added to it. The output can only be different
+// for a change to the `defines` with those names.
 TokenList preprocessSource(
     SourceFile*                 file,
     DiagnosticSink*             sink,
     IncludeHandler*             includeHandler,
     Dictionary<String, String>  defines,
-    TranslationUnitRequest*     translationUnit);
+    TranslationUnitRequest*     translationUnit,
+    HashSet<Name*>*             outMacroNamesLookedUp = nullptr);
 
 } // namespace Slang
 
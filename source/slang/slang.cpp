@@ -3,6 +3,7 @@
 #include "../core/slang-io.h"
 #include "parameter-binding.h"
 #include "lower-to-ir.h"
+#include "ir-hash.h"
 #include "../slang/parser.h"
 #include "../slang/preprocessor.h"
 #include "../slang/reflection.h"
@@ -45,6 +46,11 @@ Session::Session()
     // Make sure our source manager is initialized
     builtinSourceManager.initialize(nullptr);
 
+    for (int ii = 0; ii < int(SLANG_COUNT_OF(downstreamCompilerPools)); ++ii)
+    {
+        downstreamCompilerPools[ii].kind = PassThroughMode(ii);
+    }
+
     // Initialize representations of some very basic types:
     initializeTypes();
 
@@ -193,6 +199,108 @@ CompileRequest::CompileRequest(Session* session)
     sourceManager->initialize(session->getBuiltinSourceManager());
 }
 
+CompileRequest::CompileRequest(CompileRequest* base)
+    : mSession(base->mSession)
+    , permutationBase(base)
+{
+    getNamePool()->setRootNamePool(mSession->getRootNamePool());
+
+    copyOptionsAndTargets(base);
+
+    // The source files are shared with the base request, which is
+    // why their locations need to be visible here.
+    for (auto baseTranslationUnit : base->translationUnits)
+    {
+        auto translationUnit = translationUnits[addTranslationUnit(baseTranslationUnit->sourceLanguage, String())];
+        translationUnit->sourceFiles = baseTranslationUnit->sourceFiles;
+        translationUnit->preprocessorDefinitions = baseTranslationUnit->preprocessorDefinitions;
+        translationUnit->compileFlags = baseTranslationUnit->compileFlags;
+    }
+
+    for (auto baseEntryPoint : base->entryPoints)
+    {
+        auto entryPoint = entryPoints[addEntryPoint(
+            baseEntryPoint->translationUnitIndex,
+            getText(baseEntryPoint->name),
+            baseEntryPoint->profile,
+            baseEntryPoint->genericParameterTypeNames)];
+        entryPoint->outputPath = baseEntryPoint->outputPath;
+    }
+}
+
+void CompileRequest::copyOptionsAndTargets(CompileRequest* base)
+{
+    // Source locations come from the base request, so that modules can
+    // be loaded into its source manager by any permutation, and then
+    // be found by all of them.
+    setSourceManager(&sourceManagerStorage);
+    sourceManager->initializeSharingLocations(base->getSourceManager());
+
+    containerFormat = base->containerFormat;
+    containerOutputPath = base->containerOutputPath;
+    searchDirectories = base->searchDirectories;
+    preprocessorDefinitions = base->preprocessorDefinitions;
+    profile = base->profile;
+    passThrough = base->passThrough;
+    compileFlags = base->compileFlags;
+    shouldDumpIntermediates = base->shouldDumpIntermediates;
+    shouldDumpIR = base->shouldDumpIR;
+    shouldValidateIR = base->shouldValidateIR;
+    shouldSkipCodegen = base->shouldSkipCodegen;
+    lineDirectiveMode = base->lineDirectiveMode;
+    standardOutputCallback = base->standardOutputCallback;
+    standardOutputUserData = base->standardOutputUserData;
+    shouldCheckModulesLazily = base->shouldCheckModulesLazily;
+    shouldReportCompileStats = base->shouldReportCompileStats;
+    fileSystem = base->fileSystem;
+    mSink.callback = base->mSink.callback;
+    mSink.callbackUserData = base->mSink.callbackUserData;
+    mDependencyFilePaths = base->mDependencyFilePaths;
+
+    for (auto baseTarget : base->targets)
+    {
+        auto targetReq = targets[addTarget(baseTarget->target)];
+        targetReq->targetFlags = baseTarget->targetFlags;
+        targetReq->targetProfile = baseTarget->targetProfile;
+        targetReq->defaultMatrixLayoutMode = baseTarget->defaultMatrixLayoutMode;
+    }
+}
+
+void CompileRequest::initializeSpecialization(CompileRequest* base)
+{
+    specializationBase = base;
+    copyOptionsAndTargets(base);
+
+    // A specialization is only useful for generating code, even when
+    // the base was only compiled to check it (and for reflection).
+    compileFlags &= ~SLANG_COMPILE_FLAG_NO_CODEGEN;
+
+    // The translation units use the syntax and IR of the base request,
+    // but have their own lists of entry points.
+    for (auto baseTranslationUnit : base->translationUnits)
+    {
+        // Lowering to IR is skipped when the base is compiled with
+        // `SLANG_COMPILE_FLAG_NO_CODEGEN`, so it is done here instead,
+        // once for the base request and all of its specializations.
+        if (!baseTranslationUnit->irModule)
+        {
+            CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_LOWER_TO_IR);
+            baseTranslationUnit->irModule = generateIRForTranslationUnit(baseTranslationUnit);
+        }
+
+        auto translationUnit = translationUnits[addTranslationUnit(baseTranslationUnit->sourceLanguage, String())];
+        translationUnit->sourceFiles = baseTranslationUnit->sourceFiles;
+        translationUnit->compileFlags = baseTranslationUnit->compileFlags & ~SLANG_COMPILE_FLAG_NO_CODEGEN;
+        translationUnit->SyntaxNode = baseTranslationUnit->SyntaxNode;
+        translationUnit->irModule = baseTranslationUnit->irModule;
+    }
+
+    astArenas.AddRange(base->astArenas);
+    loadedModulesList = base->loadedModulesList;
+    mapPathToLoadedModule = base->mapPathToLoadedModule;
+    mapNameToLoadedModules = base->mapNameToLoadedModules;
+}
+
 CompileRequest::~CompileRequest()
 {
     // delete things that may reference IR objects first
@@ -296,14 +404,15 @@ SlangResult CompileRequest::loadFile(String const& path, ISlangBlob** outBlob)
     // filesystem calls.
     //
 
-    if (!File::Exists(path))
+    String resolvedPath = resolvePath(path);
+    if (!File::Exists(resolvedPath))
     {
         return SLANG_FAIL;
     }
 
     try
     {
-        String sourceString = File::ReadAllText(path);
+        String sourceString = File::ReadAllText(resolvedPath);
         ComPtr<ISlangBlob> sourceBlob = createStringBlob(sourceString);
         *outBlob = sourceBlob.detach();
 
@@ -316,6 +425,13 @@ SlangResult CompileRequest::loadFile(String const& path, ISlangBlob** outBlob)
 
 }
 
+String CompileRequest::resolvePath(String const& path)
+{
+    if (workingDirectory.Length() == 0 || path.Length() == 0 || Path::IsAbsolute(path))
+        return path;
+    return Path::Combine(workingDirectory, path);
+}
+
 
 RefPtr<Expr> CompileRequest::parseTypeString(TranslationUnitRequest * translationUnit, String typeStr, RefPtr<Scope> scope)
 {
@@ -360,8 +476,20 @@ Type* CompileRequest::getTypeFromString(String typeStr)
     return type.Ptr();
 }
 
-void CompileRequest::parseTranslationUnit(
+Dictionary<String, String> CompileRequest::getCombinedPreprocessorDefinitions(
     TranslationUnitRequest* translationUnit)
+{
+    Dictionary<String, String> combinedPreprocessorDefinitions;
+    for(auto& def : preprocessorDefinitions)
+        combinedPreprocessorDefinitions.Add(def.Key, def.Value);
+    for(auto& def : translationUnit->preprocessorDefinitions)
+        combinedPreprocessorDefinitions.Add(def.Key, def.Value);
+    return combinedPreprocessorDefinitions;
+}
+
+void CompileRequest::parseTranslationUnit(
+    TranslationUnitRequest* translationUnit,
+    bool                    isRequestTranslationUnit)
 {
     IncludeHandlerImpl includeHandler;
     includeHandler.request = this;
@@ -379,24 +507,41 @@ void CompileRequest::parseTranslationUnit(
         break;
     }
 
-    Dictionary<String, String> combinedPreprocessorDefinitions;
-    for(auto& def : preprocessorDefinitions)
-        combinedPreprocessorDefinitions.Add(def.Key, def.Value);
-    for(auto& def : translationUnit->preprocessorDefinitions)
-        combinedPreprocessorDefinitions.Add(def.Key, def.Value);
+    Dictionary<String, String> combinedPreprocessorDefinitions = getCombinedPreprocessorDefinitions(translationUnit);
+
+    // If requested, the syntax for the module is allocated from an arena,
+    // which is kept alive by this request (and by whatever else uses the
+    // module, see `LoadedModule` and `ASTArena::importedArenas`). Only the parse uses
+    // it: nodes created by semantic checking can end up attached to the
+    // standard library (or to other modules), so they stay on the heap.
+    RefPtr<ASTArena> astArena;
+    if (compileFlags & SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST)
+    {
+        astArena = new ASTArena();
+        astArenas.Add(astArena);
+        translationUnit->astArena = astArena;
+    }
+    ASTArenaScope astArenaScope(astArena);
 
     RefPtr<ModuleDecl> translationUnitSyntax = new ModuleDecl();
+    translationUnitSyntax->isCheckedLazily = shouldCheckModulesLazily;
+    translationUnitSyntax->astArena = astArena;
     translationUnit->SyntaxNode = translationUnitSyntax;
 
     for (auto sourceFile : translationUnit->sourceFiles)
     {
-        auto tokens = preprocessSource(
-            sourceFile,
-            &mSink,
-            &includeHandler,
-            combinedPreprocessorDefinitions,
-            translationUnit);
+        TokenList tokens;
+        {
+            CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_PREPROCESS);
+            tokens = preprocessSourceFile(
+                translationUnit,
+                isRequestTranslationUnit,
+                sourceFile,
+                combinedPreprocessorDefinitions,
+                &includeHandler);
+        }
 
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_PARSE);
         parseSourceFile(
             translationUnit,
             tokens,
@@ -405,21 +550,151 @@ void CompileRequest::parseTranslationUnit(
     }
 }
 
+// Would preprocessing with `definitions` give the same result as with `sharedDefinitions`,
+// given the names of all the macros that were looked up when using the latter?
+static bool doDefinitionsMatch(
+    NamePool*                           namePool,
+    Dictionary<String, String> const&   definitions,
+    Dictionary<String, String> const&   sharedDefinitions,
+    HashSet<Name*> const&               macroNamesLookedUp)
+{
+    for (auto& definition : definitions)
+    {
+        String sharedValue;
+        if (sharedDefinitions.TryGetValue(definition.Key, sharedValue) && sharedValue == definition.Value)
+            continue;
+        if (macroNamesLookedUp.Contains(namePool->getName(definition.Key)))
+            return false;
+    }
+    for (auto& definition : sharedDefinitions)
+    {
+        if (definitions.ContainsKey(definition.Key))
+            continue;
+        if (macroNamesLookedUp.Contains(namePool->getName(definition.Key)))
+            return false;
+    }
+    return true;
+}
+
+TokenList CompileRequest::preprocessSourceFile(
+    TranslationUnitRequest*             translationUnit,
+    bool                                isRequestTranslationUnit,
+    SourceFile*                         sourceFile,
+    Dictionary<String, String> const&   definitions,
+    IncludeHandler*                     includeHandler)
+{
+    // Tokens are shared for the source files that the translation units of a
+    // permutation get from its base request. (Other permutations can't see the
+    // locations in our own files, and loaded modules are shared as a whole.)
+    const bool shouldShareTokens = isRequestTranslationUnit
+        && shouldShareWithPermutations()
+        && permutationBase->getSourceManager()->expandSourceLoc(sourceFile->sourceRange.begin).getSourceFile() == sourceFile;
+
+    List<RefPtr<SharedTokenList>>* sharedVersions = nullptr;
+    if (shouldShareTokens)
+    {
+        sharedVersions = permutationBase->sharedTokenLists.TryGetValue(sourceFile);
+        if (sharedVersions)
+        {
+            for (auto sharedTokens : *sharedVersions)
+            {
+                if (!doDefinitionsMatch(getNamePool(), definitions, sharedTokens->preprocessorDefinitions, sharedTokens->macroNamesLookedUp))
+                    continue;
+
+                if (translationUnit->shouldRecordMacroLookups)
+                {
+                    for (auto name : sharedTokens->macroNamesLookedUp)
+                        translationUnit->macroNamesLookedUp.Add(name);
+                }
+                for (auto& dependencyFilePath : sharedTokens->dependencyFilePaths)
+                    mDependencyFilePaths.Add(dependencyFilePath);
+                return sharedTokens->tokens;
+            }
+        }
+    }
+
+    // Any files that get included need to go into the source manager of the
+    // base request, if the tokens might be shared.
+    SourceManager* requestSourceManager = getSourceManager();
+    if (shouldShareTokens)
+        setSourceManager(permutationBase->getSourceManager());
+    int diagnosticCountBefore = mSink.getDiagnosticCount();
+    UInt dependencyFilePathStart = mDependencyFilePaths.Count();
+
+    HashSet<Name*> macroNamesLookedUp;
+    bool shouldRecordMacroLookups = shouldShareTokens || translationUnit->shouldRecordMacroLookups;
+    TokenList tokens = preprocessSource(
+        sourceFile,
+        &mSink,
+        includeHandler,
+        definitions,
+        translationUnit,
+        shouldRecordMacroLookups ? &macroNamesLookedUp : nullptr);
+    stats.tokenCount += tokens.mTokens.Count();
+
+    setSourceManager(requestSourceManager);
+
+    if (translationUnit->shouldRecordMacroLookups)
+    {
+        for (auto name : macroNamesLookedUp)
+            translationUnit->macroNamesLookedUp.Add(name);
+    }
+
+    // As for modules, we don't share tokens if there were any
+    // warnings, so that every permutation reports them.
+    if (shouldShareTokens && mSink.getDiagnosticCount() == diagnosticCountBefore)
+    {
+        RefPtr<SharedTokenList> sharedTokens = new SharedTokenList();
+        sharedTokens->preprocessorDefinitions = definitions;
+        sharedTokens->macroNamesLookedUp = _Move(macroNamesLookedUp);
+        sharedTokens->tokens = tokens;
+        for (UInt ii = dependencyFilePathStart; ii < mDependencyFilePaths.Count(); ++ii)
+            sharedTokens->dependencyFilePaths.Add(mDependencyFilePaths[ii]);
+
+        if (!sharedVersions)
+        {
+            permutationBase->sharedTokenLists.Add(sourceFile, List<RefPtr<SharedTokenList>>());
+            sharedVersions = permutationBase->sharedTokenLists.TryGetValue(sourceFile);
+        }
+        sharedVersions->Add(sharedTokens);
+    }
+
+    return tokens;
+}
+
 void validateEntryPoints(CompileRequest*);
 
 void CompileRequest::checkAllTranslationUnits()
 {
+    CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_CHECK);
+
     // Iterate over all translation units and
     // apply the semantic checking logic.
     for( auto& translationUnit : translationUnits )
     {
+        // A translation unit shared by another permutation has been checked already
+        if (translationUnit->sharedTranslationUnit)
+            continue;
+
+        int diagnosticCountBefore = mSink.getDiagnosticCount();
         checkTranslationUnit(translationUnit.Ptr());
+        if (mSink.getDiagnosticCount() != diagnosticCountBefore)
+            translationUnit->producedDiagnostics = true;
     }
 
     // Next, do follow-up validation on any entry points.
     validateEntryPoints(this);
 }
 
+void CompileRequest::checkSpecializedEntryPoints()
+{
+    CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_CHECK);
+
+    // The translation units (and the modules they import) have already
+    // been checked by the base request.
+    validateEntryPoints(this);
+}
+
 void CompileRequest::generateIR()
 {
     // Our task in this function is to generate IR code
@@ -431,9 +706,75 @@ void CompileRequest::generateIR()
     // replicate the GLSL linkage model), and so
     // we will generate IR for each (if needed)
     // in isolation.
+    CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_LOWER_TO_IR);
     for( auto& translationUnit : translationUnits )
     {
+        // The IR of a translation unit shared by another permutation is used as is,
+        // unless functions in it have been checked lazily since it was generated.
+        auto sharedTranslationUnit = translationUnit->sharedTranslationUnit;
+        auto translationUnitSyntax = translationUnit->SyntaxNode;
+        if (sharedTranslationUnit && translationUnit->irModule && !translationUnitSyntax->isIROutOfDate)
+            continue;
+
+        int diagnosticCountBefore = mSink.getDiagnosticCount();
+        translationUnitSyntax->isIROutOfDate = false;
         translationUnit->irModule = generateIRForTranslationUnit(translationUnit);
+        if (mSink.getDiagnosticCount() != diagnosticCountBefore)
+            translationUnit->producedDiagnostics = true;
+
+        // As for modules, the IR is generated again from scratch, since
+        // other permutations may be using the old version.
+        if (sharedTranslationUnit)
+            sharedTranslationUnit->irModule = translationUnit->irModule;
+    }
+
+    generateGenericArgsIR();
+    generateIRForLoadedModules();
+}
+
+void CompileRequest::generateIRForLoadedModules()
+{
+    // Functions in an imported module that is checked lazily are only
+    // lowered to IR once they have been checked, which can happen during
+    // checking or lowering of any code that uses them. Lowering a module
+    // can reach functions in the modules it imports, so we keep going
+    // until every module is up to date.
+    CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_LOWER_TO_IR);
+    for (;;)
+    {
+        bool didGenerateIR = false;
+        for (auto& loadedModule : loadedModulesList)
+        {
+            auto moduleDecl = loadedModule->moduleDecl;
+            if (!moduleDecl || !moduleDecl->isIROutOfDate)
+                continue;
+            moduleDecl->isIROutOfDate = false;
+
+            // The IR is generated again from scratch, rather than added to,
+            // since other requests sharing the module may be using it.
+            RefPtr<TranslationUnitRequest> translationUnit = new TranslationUnitRequest();
+            translationUnit->compileRequest = this;
+            translationUnit->sourceLanguage = SourceLanguage::Slang;
+            translationUnit->SyntaxNode = moduleDecl;
+            loadedModule->irModule = generateIRForTranslationUnit(translationUnit);
+            didGenerateIR = true;
+        }
+        if (!didGenerateIR)
+            break;
+    }
+}
+
+void CompileRequest::generateGenericArgsIR()
+{
+    // The arguments can be different for each entry point, while
+    // the IR for a translation unit is shared by all of its entry
+    // points (and by specializations of this request), so each
+    // entry point gets a module of its own for them.
+    CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_LOWER_TO_IR);
+    for (auto& entryPoint : entryPoints)
+    {
+        if (entryPoint->globalGenericSubst)
+            entryPoint->genericArgsIRModule = generateIRForGlobalGenericArgs(entryPoint);
     }
 }
 
@@ -496,7 +837,28 @@ SlangResult CompileRequest::executeActionsInner()
     // a pass-through compilation.
     //
     // Note that we *do* perform output generation as normal in pass-through mode.
-    if (passThrough == PassThroughMode::None)
+    if (passThrough == PassThroughMode::None && specializationBase)
+    {
+        // The base request has already parsed, checked and lowered the
+        // source, so only the entry points need to be checked here.
+        checkSpecializedEntryPoints();
+        if (mSink.GetErrorCount() != 0)
+            return SLANG_FAIL;
+
+        generateGenericArgsIR();
+        generateIRForLoadedModules();
+        if (mSink.GetErrorCount() != 0)
+            return SLANG_FAIL;
+
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_PARAMETER_BINDING);
+        for (auto targetReq : targets)
+        {
+            generateParameterBindings(targetReq);
+            if (mSink.GetErrorCount() != 0)
+                return SLANG_FAIL;
+        }
+    }
+    else if (passThrough == PassThroughMode::None)
     {
         // We currently allow GlSL files on the command line so that we can
         // drive our "pass-through" mode, but we really want to issue an error
@@ -515,10 +877,29 @@ SlangResult CompileRequest::executeActionsInner()
         }
 
 
-        // Parse everything from the input files requested
-        for (auto& translationUnit : translationUnits)
+        // Parse everything from the input files requested, except for
+        // translation units that another permutation has compiled in
+        // a way that we can use.
+        bool shouldShareTranslationUnits = shouldShareWithPermutations();
+        for (UInt ii = 0; ii < translationUnits.Count(); ++ii)
         {
-            parseTranslationUnit(translationUnit.Ptr());
+            if (tryUseSharedTranslationUnit(ii))
+                continue;
+
+            auto translationUnit = translationUnits[ii];
+            translationUnit->shouldRecordMacroLookups = shouldShareTranslationUnits;
+            int diagnosticCountBefore = mSink.getDiagnosticCount();
+            UInt dependencyFilePathStart = mDependencyFilePaths.Count();
+
+            parseTranslationUnit(translationUnit.Ptr(), true);
+
+            if (mSink.getDiagnosticCount() != diagnosticCountBefore)
+                translationUnit->producedDiagnostics = true;
+            if (shouldShareTranslationUnits)
+            {
+                for (UInt jj = dependencyFilePathStart; jj < mDependencyFilePaths.Count(); ++jj)
+                    translationUnit->dependencyFilePaths.Add(mDependencyFilePaths[jj]);
+            }
         }
         if (mSink.GetErrorCount() != 0)
             return SLANG_FAIL;
@@ -538,11 +919,14 @@ SlangResult CompileRequest::executeActionsInner()
         if (mSink.GetErrorCount() != 0)
             return SLANG_FAIL;
 
+        addSharedTranslationUnits();
+
         // For each code generation target generate
         // parameter binding information.
         // This step is done globally, because all translation
         // units and entry points need to agree on where
         // parameters are allocated.
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_PARAMETER_BINDING);
         for (auto targetReq : targets)
         {
             generateParameterBindings(targetReq);
@@ -558,19 +942,132 @@ SlangResult CompileRequest::executeActionsInner()
         return SLANG_OK;
 
     // Generate output code, in whatever format was requested
-    generateOutput(this);
+    {
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_EMIT);
+        generateOutput(this);
+    }
     if (mSink.GetErrorCount() != 0)
         return SLANG_FAIL;
 
     return SLANG_OK;
 }
 
+void CompileRequest::switchCompilePhase(int phase)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (currentCompilePhase >= 0)
+    {
+        std::chrono::duration<double> elapsed = now - compilePhaseStartTime;
+        stats.phaseSeconds[currentCompilePhase] += elapsed.count();
+    }
+    currentCompilePhase = phase;
+    compilePhaseStartTime = now;
+}
+
+static void addIRModuleStats(SlangCompileStats* stats, IRModule* irModule)
+{
+    if (!irModule)
+        return;
+    stats->irInstCreatedCount += irModule->createdInstCount;
+    stats->irInstRemovedCount += irModule->removedInstCount;
+    stats->irMemoryUsedBytes += irModule->memoryArena.calcTotalMemoryUsed();
+    stats->irMemoryAllocatedBytes += irModule->memoryArena.calcTotalMemoryAllocated();
+    stats->irMemoryAllocationCount += irModule->memoryArena.getAllocationCount();
+}
+
+void CompileRequest::getCompileStats(SlangCompileStats* outStats)
+{
+    *outStats = stats;
+    outStats->structSize = sizeof(SlangCompileStats);
+
+    // The IR counters are tracked on the modules themselves, so
+    // we gather them up from every module this request produced.
+    for (auto& translationUnit : translationUnits)
+        addIRModuleStats(outStats, translationUnit->irModule);
+    for (auto& loadedModule : loadedModulesList)
+        addIRModuleStats(outStats, loadedModule->irModule);
+    for (auto& irModule : compiledModules)
+        addIRModuleStats(outStats, irModule);
+}
+
+static void reportCompileStats(CompileRequest* request)
+{
+    SlangCompileStats stats;
+    request->getCompileStats(&stats);
+
+    StringBuilder sb;
+    sb << "compile statistics:\n";
+    for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+    {
+        char buffer[128];
+        sprintf_s(buffer, sizeof(buffer), "  %-20s %10.3fms\n",
+            spGetCompilePhaseName(SlangCompilePhase(ii)),
+            stats.phaseSeconds[ii] * 1000.0);
+        sb << buffer;
+    }
+    {
+        char buffer[128];
+        sprintf_s(buffer, sizeof(buffer), "  %-20s %10.3fms\n", "total", stats.totalSeconds * 1000.0);
+        sb << buffer;
+    }
+    sb << "  tokens lexed: " << UInt(stats.tokenCount) << "\n";
+    sb << "  decls checked: " << UInt(stats.declCheckCount) << "\n";
+    sb << "  overload cache hits: " << UInt(stats.overloadCacheHitCount) << "\n";
+    sb << "  member lookup cache hits: " << UInt(stats.memberLookupCacheHitCount) << "\n";
+    sb << "  IR instructions created: " << UInt(stats.irInstCreatedCount) << "\n";
+    sb << "  IR instructions removed: " << UInt(stats.irInstRemovedCount) << "\n";
+    sb << "  IR memory used: " << UInt(stats.irMemoryUsedBytes)
+        << " bytes (" << UInt(stats.irMemoryAllocatedBytes) << " allocated)"
+        << " in " << UInt(stats.irMemoryAllocationCount) << " allocations\n";
+    sb << "  output cache hits: " << UInt(stats.outputCacheHitCount) << "\n";
+    sb << "  downstream cache hits: " << UInt(stats.downstreamCacheHitCount) << "\n";
+
+    request->mSink.diagnoseRaw(Severity::Note, sb.ProduceString().Buffer());
+}
+
 // Act as expected of the API-based compiler
 SlangResult CompileRequest::executeActions()
 {
+    stats = SlangCompileStats();
+    auto startTime = std::chrono::steady_clock::now();
+
     SlangResult res = executeActionsInner();
+
+    // Anything not covered by a more specific phase (e.g., setup
+    // code in `executeActionsInner`) only shows up in the total.
+    switchCompilePhase(-1);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    stats.totalSeconds = elapsed.count();
+
+    // The output of a request in a batch is finished once the downstream
+    // compiler jobs of the whole batch have been run (see `spCompileBatch`)
+    if (hasPendingOutput)
+        return res;
+
+    return finishActions(res);
+}
+
+SlangResult CompileRequest::finishPendingOutput()
+{
+    auto startTime = std::chrono::steady_clock::now();
+    hasPendingOutput = false;
+    {
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_EMIT);
+        finishOutput(this);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    stats.totalSeconds += elapsed.count();
+
+    return finishActions(mSink.GetErrorCount() != 0 ? SLANG_FAIL : SLANG_OK);
+}
+
+SlangResult CompileRequest::finishActions(SlangResult result)
+{
+    if (shouldReportCompileStats)
+        reportCompileStats(this);
+
     mDiagnosticOutput = mSink.outputBuffer.ProduceString();
-    return res;
+    return result;
 }
 
 int CompileRequest::addTranslationUnit(SourceLanguage language, String const&)
@@ -691,21 +1188,33 @@ void CompileRequest::loadParsedModule(
     mapNameToLoadedModules.Add(name, loadedModule);
 
     int errorCountBefore = mSink.GetErrorCount();
-    checkTranslationUnit(translationUnit.Ptr());
+    {
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_CHECK);
+        checkTranslationUnit(translationUnit.Ptr());
+    }
     int errorCountAfter = mSink.GetErrorCount();
 
     RefPtr<ModuleDecl> moduleDecl = translationUnit->SyntaxNode;
     loadedModule->moduleDecl = moduleDecl;
+    loadedModule->astArena = translationUnit->astArena;
 
     if (errorCountAfter != errorCountBefore)
     {
         // There must have been an error in the loaded module.
     }
+    else if (moduleDecl->isCheckedLazily)
+    {
+        // The functions that the importing code uses haven't been
+        // checked yet, so IR for the module is generated once they
+        // have been (see `generateIRForLoadedModules`).
+        moduleDecl->isIROutOfDate = true;
+    }
     else
     {
         // If we didn't run into any errors, then try to generate
         // IR code for the imported module.
         SLANG_ASSERT(errorCountAfter == 0);
+        CompilePhaseScope phaseScope(this, SLANG_COMPILE_PHASE_LOWER_TO_IR);
         loadedModule->irModule = generateIRForTranslationUnit(translationUnit);
     }
     loadedModulesList.Add(loadedModule);
@@ -727,28 +1236,42 @@ RefPtr<ModuleDecl> CompileRequest::loadModule(
     // TODO: decide which options, if any, should be inherited.
     translationUnit->compileFlags = 0;
 
+    // A module that might be shared with other permutations is loaded into
+    // the source manager of the base request, where they can all see it,
+    // and we need to know which macros it depends on.
+    bool shouldShareModule = shouldShareWithPermutations();
+    SourceManager* requestSourceManager = getSourceManager();
+    if (shouldShareModule)
+    {
+        setSourceManager(permutationBase->getSourceManager());
+        translationUnit->shouldRecordMacroLookups = true;
+    }
+    UInt dependencyFilePathStart = mDependencyFilePaths.Count();
+    int diagnosticCountBefore = mSink.getDiagnosticCount();
+
     RefPtr<SourceFile> sourceFile = getSourceManager()->allocateSourceFile(path, sourceBlob);
 
     translationUnit->sourceFiles.Add(sourceFile);
 
 
     int errorCountBefore = mSink.GetErrorCount();
-    parseTranslationUnit(translationUnit.Ptr());
+    parseTranslationUnit(translationUnit.Ptr(), false);
     int errorCountAfter = mSink.GetErrorCount();
 
-    if( errorCountAfter != errorCountBefore )
+    if( errorCountAfter == errorCountBefore )
     {
-        mSink.diagnose(srcLoc, Diagnostics::errorInImportedModule);
-        // Something went wrong during the parsing, so we should bail out.
-        return nullptr;
-    }
+        if (mSession->lazyCheckingFlags & SLANG_LAZY_CHECKING_IMPORTED_MODULES)
+            translationUnit->SyntaxNode->isCheckedLazily = true;
 
-    loadParsedModule(
-        translationUnit,
-        name,
-        path);
+        loadParsedModule(
+            translationUnit,
+            name,
+            path);
+
+        errorCountAfter = mSink.GetErrorCount();
+    }
 
-    errorCountAfter = mSink.GetErrorCount();
+    setSourceManager(requestSourceManager);
 
     if (errorCountAfter != errorCountBefore)
     {
@@ -757,9 +1280,237 @@ RefPtr<ModuleDecl> CompileRequest::loadModule(
         return nullptr;
     }
 
+    // If loading the module produced any warnings, then we don't share it,
+    // so that every permutation that uses it reports them.
+    if (shouldShareModule && mSink.getDiagnosticCount() == diagnosticCountBefore)
+    {
+        addSharedModule(name, path, translationUnit, dependencyFilePathStart);
+    }
+
     return translationUnit->SyntaxNode;
 }
 
+bool CompileRequest::shouldShareWithPermutations()
+{
+    if (!permutationBase)
+        return false;
+
+    // Modules are looked up (and load their own imports and includes)
+    // through the search directories and file system, so we only share
+    // modules between permutations that keep the ones from the base.
+    if (fileSystem != permutationBase->fileSystem)
+        return false;
+    auto& baseSearchDirectories = permutationBase->searchDirectories;
+    if (searchDirectories.Count() != baseSearchDirectories.Count())
+        return false;
+    for (UInt ii = 0; ii < searchDirectories.Count(); ++ii)
+    {
+        if (searchDirectories[ii].path != baseSearchDirectories[ii].path)
+            return false;
+    }
+    return true;
+}
+
+bool CompileRequest::canUseSharedModule(SharedLoadedModule* sharedModule)
+{
+    // If we already have a module at the same path, it has to be this one,
+    // otherwise the shared module would refer to declarations we don't use.
+    RefPtr<LoadedModule> loadedModule;
+    if (mapPathToLoadedModule.TryGetValue(sharedModule->path, loadedModule))
+        return loadedModule == sharedModule->loadedModule;
+
+    // A preprocessor definition that is different from the request that loaded
+    // the module only matters if the module looked up a macro of that name.
+    if (!doDefinitionsMatch(getNamePool(), preprocessorDefinitions, sharedModule->preprocessorDefinitions, sharedModule->macroNamesLookedUp))
+        return false;
+
+    for (auto importedModule : sharedModule->importedModules)
+    {
+        if (!canUseSharedModule(importedModule))
+            return false;
+    }
+    return true;
+}
+
+void CompileRequest::useSharedModule(SharedLoadedModule* sharedModule)
+{
+    if (mapPathToLoadedModule.ContainsKey(sharedModule->path))
+        return;
+
+    // Imported modules go first, as that is the order they would have
+    // finished loading in if we had loaded them ourselves.
+    for (auto importedModule : sharedModule->importedModules)
+    {
+        useSharedModule(importedModule);
+    }
+
+    auto loadedModule = sharedModule->loadedModule;
+    if (loadedModule->astArena)
+        astArenas.Add(loadedModule->astArena);
+    mapPathToLoadedModule.Add(sharedModule->path, loadedModule);
+    mapNameToLoadedModules.AddIfNotExists(sharedModule->name, loadedModule);
+    loadedModulesList.Add(loadedModule);
+
+    for (auto& dependencyFilePath : sharedModule->dependencyFilePaths)
+        mDependencyFilePaths.Add(dependencyFilePath);
+
+    sharedModulesInUse.Add(sharedModule);
+}
+
+void CompileRequest::addSharedModule(
+    Name*                   name,
+    String const&           path,
+    TranslationUnitRequest* translationUnit,
+    UInt                    dependencyFilePathStart)
+{
+    RefPtr<SharedLoadedModule> sharedModule = new SharedLoadedModule();
+    sharedModule->name = name;
+    sharedModule->path = path;
+    sharedModule->loadedModule = mapPathToLoadedModule[path].GetValue();
+    sharedModule->preprocessorDefinitions = preprocessorDefinitions;
+    sharedModule->macroNamesLookedUp = _Move(translationUnit->macroNamesLookedUp);
+
+    // A module can only be shared if the modules it imports are too
+    if (!findSharedModulesImportedBy(translationUnit->SyntaxNode, sharedModule->importedModules))
+        return;
+
+    for (UInt ii = dependencyFilePathStart; ii < mDependencyFilePaths.Count(); ++ii)
+        sharedModule->dependencyFilePaths.Add(mDependencyFilePaths[ii]);
+
+    auto sharedVersions = permutationBase->sharedLoadedModules.TryGetValue(path);
+    if (!sharedVersions)
+    {
+        permutationBase->sharedLoadedModules.Add(path, List<RefPtr<SharedLoadedModule>>());
+        sharedVersions = permutationBase->sharedLoadedModules.TryGetValue(path);
+    }
+    sharedVersions->Add(sharedModule);
+
+    sharedModulesInUse.Add(sharedModule);
+}
+
+bool CompileRequest::findSharedModulesImportedBy(
+    ModuleDecl*                         moduleDecl,
+    List<RefPtr<SharedLoadedModule>>&   outImportedModules)
+{
+    for (auto importDecl : moduleDecl->getMembersOfType<ImportDecl>())
+    {
+        SharedLoadedModule* importedModule = nullptr;
+        for (auto moduleInUse : sharedModulesInUse)
+        {
+            if (moduleInUse->loadedModule->moduleDecl == importDecl->importedModuleDecl)
+            {
+                importedModule = moduleInUse;
+                break;
+            }
+        }
+        if (!importedModule)
+            return false;
+        outImportedModules.Add(importedModule);
+    }
+    return true;
+}
+
+// Does `translationUnit` of a permutation consist of the same source files as the
+// one of its base request? Only those can be shared (see `preprocessSourceFile`).
+static bool hasSameSourceFiles(
+    TranslationUnitRequest* translationUnit,
+    TranslationUnitRequest* baseTranslationUnit)
+{
+    auto& sourceFiles = translationUnit->sourceFiles;
+    auto& baseSourceFiles = baseTranslationUnit->sourceFiles;
+    if (sourceFiles.Count() != baseSourceFiles.Count())
+        return false;
+    for (UInt ii = 0; ii < sourceFiles.Count(); ++ii)
+    {
+        if (sourceFiles[ii] != baseSourceFiles[ii])
+            return false;
+    }
+    return true;
+}
+
+bool CompileRequest::tryUseSharedTranslationUnit(UInt translationUnitIndex)
+{
+    if (!shouldShareWithPermutations())
+        return false;
+    auto& sharedVersionsForIndex = permutationBase->sharedTranslationUnits;
+    if (translationUnitIndex >= sharedVersionsForIndex.Count())
+        return false;
+
+    auto translationUnit = translationUnits[translationUnitIndex];
+    if (!hasSameSourceFiles(translationUnit, permutationBase->translationUnits[translationUnitIndex]))
+        return false;
+
+    auto definitions = getCombinedPreprocessorDefinitions(translationUnit);
+    for (auto sharedTranslationUnit : sharedVersionsForIndex[translationUnitIndex])
+    {
+        if (sharedTranslationUnit->compileFlags != translationUnit->compileFlags)
+            continue;
+        if (!doDefinitionsMatch(getNamePool(), definitions, sharedTranslationUnit->preprocessorDefinitions, sharedTranslationUnit->macroNamesLookedUp))
+            continue;
+
+        bool canUseImportedModules = true;
+        for (auto importedModule : sharedTranslationUnit->importedModules)
+        {
+            if (!canUseSharedModule(importedModule))
+            {
+                canUseImportedModules = false;
+                break;
+            }
+        }
+        if (!canUseImportedModules)
+            continue;
+
+        for (auto importedModule : sharedTranslationUnit->importedModules)
+            useSharedModule(importedModule);
+        for (auto& dependencyFilePath : sharedTranslationUnit->dependencyFilePaths)
+            mDependencyFilePaths.Add(dependencyFilePath);
+
+        if (sharedTranslationUnit->astArena)
+            astArenas.Add(sharedTranslationUnit->astArena);
+        translationUnit->astArena = sharedTranslationUnit->astArena;
+        translationUnit->SyntaxNode = sharedTranslationUnit->syntax;
+        translationUnit->irModule = sharedTranslationUnit->irModule;
+        translationUnit->sharedTranslationUnit = sharedTranslationUnit;
+        return true;
+    }
+    return false;
+}
+
+void CompileRequest::addSharedTranslationUnits()
+{
+    if (!shouldShareWithPermutations())
+        return;
+
+    auto& baseTranslationUnits = permutationBase->translationUnits;
+    for (UInt ii = 0; ii < translationUnits.Count() && ii < baseTranslationUnits.Count(); ++ii)
+    {
+        // As with modules and tokens, we don't share a translation unit
+        // if there were any warnings, so that every permutation reports them.
+        auto translationUnit = translationUnits[ii];
+        if (translationUnit->sharedTranslationUnit || translationUnit->producedDiagnostics)
+            continue;
+        if (!hasSameSourceFiles(translationUnit, baseTranslationUnits[ii]))
+            continue;
+
+        RefPtr<SharedTranslationUnit> sharedTranslationUnit = new SharedTranslationUnit();
+        if (!findSharedModulesImportedBy(translationUnit->SyntaxNode, sharedTranslationUnit->importedModules))
+            continue;
+
+        sharedTranslationUnit->astArena = translationUnit->astArena;
+        sharedTranslationUnit->syntax = translationUnit->SyntaxNode;
+        sharedTranslationUnit->irModule = translationUnit->irModule;
+        sharedTranslationUnit->compileFlags = translationUnit->compileFlags;
+        sharedTranslationUnit->preprocessorDefinitions = getCombinedPreprocessorDefinitions(translationUnit);
+        sharedTranslationUnit->macroNamesLookedUp = _Move(translationUnit->macroNamesLookedUp);
+        sharedTranslationUnit->dependencyFilePaths = _Move(translationUnit->dependencyFilePaths);
+
+        auto& sharedVersionsForIndex = permutationBase->sharedTranslationUnits;
+        while (sharedVersionsForIndex.Count() <= ii)
+            sharedVersionsForIndex.Add(List<RefPtr<SharedTranslationUnit>>());
+        sharedVersionsForIndex[ii].Add(sharedTranslationUnit);
+    }
+}
+
 RefPtr<ModuleDecl> CompileRequest::findOrImportModule(
     Name*               name,
     SourceLoc const&    loc)
@@ -833,6 +1584,24 @@ RefPtr<ModuleDecl> CompileRequest::findOrImportModule(
     if (mapPathToLoadedModule.TryGetValue(foundPath, loadedModule))
         return loadedModule->moduleDecl;
 
+    // Maybe another permutation of the same base request has loaded
+    // a version of the module that we can use?
+    if (shouldShareWithPermutations())
+    {
+        if (auto sharedVersions = permutationBase->sharedLoadedModules.TryGetValue(foundPath))
+        {
+            for (auto sharedModule : *sharedVersions)
+            {
+                if (!canUseSharedModule(sharedModule))
+                    continue;
+
+                useSharedModule(sharedModule);
+                mapNameToLoadedModules[name] = sharedModule->loadedModule;
+                return sharedModule->loadedModule->moduleDecl;
+            }
+        }
+    }
+
 
     // We've found a file that we can load for the given module, so
     // go ahead and perform the module-load action
@@ -892,6 +1661,19 @@ void Session::addBuiltinSource(
     RefPtr<CompileRequest> compileRequest = new CompileRequest(this);
     compileRequest->setSourceManager(getBuiltinSourceManager());
 
+    // A typical shader only uses a small fraction of the functions in
+    // the standard library, so we only check them on first use.
+    compileRequest->shouldCheckModulesLazily = (lazyCheckingFlags & SLANG_LAZY_CHECKING_STDLIB) != 0;
+
+    // The IR for a standard library function gets generated into each
+    // module that uses it, so there is no reason to lower the standard
+    // library on its own.
+    compileRequest->compileFlags |= SLANG_COMPILE_FLAG_NO_CODEGEN;
+
+    // The standard library lives as long as the session, so there is
+    // no reason to allocate (or free) its AST one node at a time.
+    compileRequest->compileFlags |= SLANG_COMPILE_FLAG_ARENA_ALLOCATE_AST;
+
     auto translationUnitIndex = compileRequest->addTranslationUnit(SourceLanguage::Slang, path);
 
     RefPtr<SourceFile> sourceFile = builtinSourceManager.allocateSourceFile(path, source);
@@ -944,6 +1726,22 @@ void Session::addBuiltinSource(
     // We need to retain this AST so that we can use it in other code
     // (Note that the `Scope` type does not retain the AST it points to)
     loadedModuleCode.Add(syntax);
+    builtinASTArenas.AddRange(compileRequest->astArenas);
+}
+
+void Session::setLazyCheckingFlags(SlangLazyCheckingFlags flags)
+{
+    lazyCheckingFlags = flags;
+    if (flags & SLANG_LAZY_CHECKING_STDLIB)
+        return;
+
+    // Check every standard library function that hasn't been used yet
+    RefPtr<CompileRequest> compileRequest = new CompileRequest(this);
+    compileRequest->setSourceManager(getBuiltinSourceManager());
+    for (auto moduleDecl : loadedModuleCode)
+    {
+        checkAllLazyDecls(compileRequest, moduleDecl);
+    }
 }
 
 Session::~Session()
@@ -956,6 +1754,7 @@ Session::~Session()
     constExprRate = nullptr;
 
     destroyTypeCheckingCache();
+    memberLookupCache.clear();
 
     builtinTypes = decltype(builtinTypes)();
     // destroy modules next
@@ -996,12 +1795,94 @@ SLANG_API void spAddBuiltins(
         sourceString);
 }
 
+SLANG_API void spSetDownstreamCompilerFactory(
+    SlangSession*                       session,
+    SlangPassThrough                    passThrough,
+    SlangCreateDownstreamCompilerFunc   createFunc,
+    void*                               userData,
+    char const*                         identity)
+{
+    if (passThrough <= SLANG_PASS_THROUGH_NONE || passThrough > SLANG_PASS_THROUGH_GLSLANG)
+        return;
+
+    auto s = SESSION(session);
+    s->getDownstreamCompilerPool(Slang::PassThroughMode(passThrough))->setFactory(createFunc, userData, identity);
+
+    // A different compiler may produce different output for the same code
+    s->downstreamOutputCache.clearMemory();
+}
+
+SLANG_API void spSetDownstreamCompilerThreadCount(
+    SlangSession*   session,
+    int             threadCount)
+{
+    auto s = SESSION(session);
+    s->downstreamCompilerThreadCount = threadCount;
+}
+
+SLANG_API void spSetDownstreamOutputCacheDirectory(
+    SlangSession*   session,
+    char const*     path)
+{
+    auto s = SESSION(session);
+    s->downstreamOutputCache.setDirectory(path ? path : "");
+}
+
+SLANG_API void spSetDownstreamOutputCacheMemoryLimit(
+    SlangSession*   session,
+    size_t          limit)
+{
+    auto s = SESSION(session);
+    s->downstreamOutputCache.setMemoryLimit(limit);
+}
+
+SLANG_API void spSetLazyCheckingFlags(
+    SlangSession*           session,
+    SlangLazyCheckingFlags  flags)
+{
+    auto s = SESSION(session);
+    s->setLazyCheckingFlags(flags);
+}
+
 
 SLANG_API SlangCompileRequest* spCreateCompileRequest(
     SlangSession* session)
 {
     auto s = SESSION(session);
     auto req = new Slang::CompileRequest(s);
+
+    // Requests are reference counted, because permutations
+    // (see `spCreatePermutationRequest`) keep their base alive.
+    req->addReference();
+    return reinterpret_cast<SlangCompileRequest*>(req);
+}
+
+SLANG_API SlangCompileRequest* spCreatePermutationRequest(
+    SlangCompileRequest*    baseRequest)
+{
+    if(!baseRequest) return nullptr;
+    auto base = REQ(baseRequest);
+    auto req = new Slang::CompileRequest(base);
+    req->addReference();
+    return reinterpret_cast<SlangCompileRequest*>(req);
+}
+
+SLANG_API SlangCompileRequest* spCreateSpecializationRequest(
+    SlangCompileRequest*    compiledRequest)
+{
+    if(!compiledRequest) return nullptr;
+    auto base = REQ(compiledRequest);
+
+    // The base must have been checked without any errors.
+    if(base->mSink.GetErrorCount() != 0) return nullptr;
+    for(auto& translationUnit : base->translationUnits)
+    {
+        if(!translationUnit->SyntaxNode) return nullptr;
+    }
+
+    auto req = new Slang::CompileRequest(base->mSession);
+    req->addReference();
+    req->initializeSpecialization(base);
     return reinterpret_cast<SlangCompileRequest*>(req);
 }
 
@@ -1013,7 +1894,7 @@ SLANG_API void spDestroyCompileRequest(
 {
     if(!request) return;
     auto req = REQ(request);
-    delete req;
+    req->releaseReference();
 }
 
 SLANG_API void spSetFileSystem(
@@ -1056,6 +1937,13 @@ SLANG_API void spSetCommandLineCompilerMode(
 
 }
 
+SLANG_API void spSetWorkingDirectory(
+    SlangCompileRequest*    request,
+    char const*             path)
+{
+    REQ(request)->workingDirectory = path ? path : "";
+}
+
 SLANG_API void spSetCodeGenTarget(
         SlangCompileRequest*    request,
         SlangCompileTarget target)
@@ -1129,6 +2017,18 @@ SLANG_API void spSetDiagnosticCallback(
     req->mSink.callbackUserData = (void*) userData;
 }
 
+SLANG_API void spSetStandardOutputCallback(
+    SlangCompileRequest*    request,
+    SlangOutputCallback     callback,
+    void const*             userData)
+{
+    if(!request) return;
+    auto req = REQ(request);
+
+    req->standardOutputCallback = callback;
+    req->standardOutputUserData = (void*) userData;
+}
+
 SLANG_API void spAddSearchPath(
         SlangCompileRequest*    request,
         const char*             path)
@@ -1325,11 +2225,11 @@ SLANG_API int spAddEntryPointEx(
 
 
 // Compile in a context that already has its translation units specified
-SLANG_API SlangResult spCompile(
-    SlangCompileRequest*    request)
+// Do the work of compiling `req` (or part of it) with `action`
+static SlangResult executeCompileAction(
+    Slang::CompileRequest*  req,
+    SlangResult             (Slang::CompileRequest::*action)())
 {
-    auto req = REQ(request);
-
 #if !defined(SLANG_DEBUG_INTERNAL_ERROR)
     // By default we'd like to catch as many internal errors as possible,
     // and report them to the user nicely (rather than just crash their
@@ -1343,7 +2243,7 @@ SLANG_API SlangResult spCompile(
     SlangResult res = SLANG_FAIL; 
     try
     {
-        res = req->executeActions();
+        res = (req->*action)();
     }
     catch (Slang::AbortCompilationException&)
     {
@@ -1373,11 +2273,50 @@ SLANG_API SlangResult spCompile(
     // When debugging, we probably don't want to filter out any errors, since
     // we are probably trying to root-cause and *fix* those errors.
     {
-        return req->executeActions();
+        return (req->*action)();
     }
 #endif
 }
 
+SLANG_API SlangResult spCompile(
+    SlangCompileRequest*    request)
+{
+    return executeCompileAction(REQ(request), &Slang::CompileRequest::executeActions);
+}
+
+SLANG_API SlangResult spCompileBatch(
+    SlangCompileRequest* const* requests,
+    int                         requestCount)
+{
+    // Our front end and code generation aren't thread-safe, so each request
+    // is checked and has its code generated in turn, leaving the downstream
+    // compiler jobs for its output to be run along with those of the others.
+    SlangResult result = SLANG_OK;
+    Slang::List<Slang::CompileRequest*> requestsWithPendingOutput;
+    for (int ii = 0; ii < requestCount; ++ii)
+    {
+        auto req = REQ(requests[ii]);
+        req->isInBatch = true;
+        SlangResult requestResult = executeCompileAction(req, &Slang::CompileRequest::executeActions);
+        req->isInBatch = false;
+
+        if (req->hasPendingOutput)
+            requestsWithPendingOutput.Add(req);
+        else if (SLANG_FAILED(requestResult))
+            result = requestResult;
+    }
+
+    Slang::runDownstreamJobsForBatch(requestsWithPendingOutput);
+
+    for (auto req : requestsWithPendingOutput)
+    {
+        SlangResult requestResult = executeCompileAction(req, &Slang::CompileRequest::finishPendingOutput);
+        if (SLANG_FAILED(requestResult))
+            result = requestResult;
+    }
+    return result;
+}
+
 SLANG_API int
 spGetDependencyFileCount(
     SlangCompileRequest*    request)
@@ -1505,6 +2444,61 @@ SLANG_API void const* spGetCompileRequestCode(
     return data;
 }
 
+SLANG_API char const* spGetCompilePhaseName(
+    SlangCompilePhase       phase)
+{
+    switch (phase)
+    {
+    case SLANG_COMPILE_PHASE_PREPROCESS:        return "preprocess";
+    case SLANG_COMPILE_PHASE_PARSE:             return "parse";
+    case SLANG_COMPILE_PHASE_CHECK:             return "check";
+    case SLANG_COMPILE_PHASE_LOWER_TO_IR:       return "lower-to-ir";
+    case SLANG_COMPILE_PHASE_PARAMETER_BINDING: return "parameter-binding";
+    case SLANG_COMPILE_PHASE_SPECIALIZE:        return "specialize";
+    case SLANG_COMPILE_PHASE_LEGALIZE:          return "legalize";
+    case SLANG_COMPILE_PHASE_SSA:               return "ssa";
+    case SLANG_COMPILE_PHASE_EMIT:              return "emit";
+    case SLANG_COMPILE_PHASE_DOWNSTREAM:        return "downstream";
+    default:
+        return nullptr;
+    }
+}
+
+SLANG_API SlangResult spGetCompileStats(
+    SlangCompileRequest*    request,
+    SlangCompileStats*      outStats)
+{
+    if(!request) return SLANG_ERROR_INVALID_PARAMETER;
+    if(!outStats) return SLANG_ERROR_INVALID_PARAMETER;
+
+    // The caller may have been built against an older (smaller) version
+    // of the structure, so we only write the fields it knows about.
+    size_t structSize = outStats->structSize;
+    if(structSize < sizeof(outStats->structSize)) return SLANG_ERROR_INVALID_PARAMETER;
+    if(structSize > sizeof(SlangCompileStats))
+        structSize = sizeof(SlangCompileStats);
+
+    auto req = REQ(request);
+    SlangCompileStats stats;
+    req->getCompileStats(&stats);
+    stats.structSize = structSize;
+    memcpy(outStats, &stats, structSize);
+    return SLANG_OK;
+}
+
+SLANG_API SlangResult spRunInternalCheck(
+    SlangSession*   session,
+    char const*     name)
+{
+    if(!session) return SLANG_ERROR_INVALID_PARAMETER;
+    if(!name) return SLANG_ERROR_INVALID_PARAMETER;
+
+    auto s = SESSION(session);
+    if(strcmp(name, "IRStructuralHash") == 0)
+        return Slang::checkStructuralHash(s) ? SLANG_OK : SLANG_FAIL;
+    return SLANG_E_NOT_FOUND;
+}
+
 // Reflection API
 
 SLANG_API SlangReflection* spGetReflection(
@@ -53,10 +53,34 @@ void SourceManager::initialize(
     nextLoc = startLoc;
 }
 
+void SourceManager::initializeSharingLocations(
+    SourceManager*  p)
+{
+    SLANG_ASSERT(p);
+    initialize(p);
+    sharesLocationsWithParent = true;
+}
+
+SourceManager* SourceManager::getLocationAllocator()
+{
+    SourceManager* sourceManager = this;
+    while (sourceManager->sharesLocationsWithParent)
+        sourceManager = sourceManager->parent;
+    return sourceManager;
+}
+
 SourceRange SourceManager::allocateSourceRange(UInt size)
 {
     // TODO: consider using atomics here
 
+    // Locations shared with a parent are handed out by the parent, so
+    // that the ranges used by both never overlap.
+    if (sharesLocationsWithParent)
+    {
+        SourceRange range = getLocationAllocator()->allocateSourceRange(size);
+        nextLoc = range.end + 1;
+        return range;
+    }
 
     SourceLoc beginLoc  = nextLoc;
     SourceLoc endLoc    = beginLoc + size;
@@ -159,42 +183,67 @@ static ExpandedSourceLoc expandSourceLoc(
         return expanded;
 
     // Past the end of what we can handle? -> invalid
-    if(rawValue >= sourceManager->nextLoc.getRaw())
+    if(rawValue >= sourceManager->getLocationAllocator()->nextLoc.getRaw())
         return expanded;
 
-    // Maybe the location came from a parent source manager
-    while( rawValue < sourceManager->startLoc.getRaw()
-        && sourceManager->parent)
+    UInt entryIndex = 0;
+    for(;;)
     {
-        sourceManager = sourceManager->parent;
-    }
-
-    SLANG_ASSERT(sourceManager->sourceFiles.Count() > 0);
+        // Maybe the location came from a parent source manager
+        while( rawValue < sourceManager->startLoc.getRaw()
+            && sourceManager->parent)
+        {
+            sourceManager = sourceManager->parent;
+        }
 
-    UInt lo = 0;
-    UInt hi = sourceManager->sourceFiles.Count();
+        UInt lo = 0;
+        UInt hi = sourceManager->sourceFiles.Count();
 
-    while( lo+1 < hi )
-    {
-        UInt mid = lo + (hi - lo) / 2;
+        while( lo+1 < hi )
+        {
+            UInt mid = lo + (hi - lo) / 2;
 
-        SourceManager::Entry const& midEntry = sourceManager->sourceFiles[mid];
-        SourceLoc::RawValue midValue = midEntry.startLoc.getRaw();
+            SourceManager::Entry const& midEntry = sourceManager->sourceFiles[mid];
+            SourceLoc::RawValue midValue = midEntry.startLoc.getRaw();
 
-        if( midValue <= rawValue )
-        {
-            // The location we seek is at or after this entry
-            lo = mid;
+            if( midValue <= rawValue )
+            {
+                // The location we seek is at or after this entry
+                lo = mid;
+            }
+            else
+            {
+                // The location we seek is before this entry
+                hi = mid;
+            }
         }
-        else
+
+        // `lo` should now point at the entry we want
+        entryIndex = lo;
+
+        // A manager that shares locations with its parent doesn't own
+        // all of the locations after its `startLoc`, so if the entry
+        // doesn't actually cover the location, it belongs to the parent.
+        if (sourceManager->sharesLocationsWithParent)
         {
-            // The location we seek is before this entry
-            hi = mid;
+            bool isInEntry = false;
+            if (lo < sourceManager->sourceFiles.Count())
+            {
+                auto const& entry = sourceManager->sourceFiles[lo];
+                auto entrySize = entry.sourceFile->sourceRange.end.getRaw() - entry.sourceFile->sourceRange.begin.getRaw();
+                isInEntry = rawValue >= entry.startLoc.getRaw()
+                    && rawValue <= entry.startLoc.getRaw() + entrySize;
+            }
+            if (!isInEntry)
+            {
+                sourceManager = sourceManager->parent;
+                continue;
+            }
         }
+        break;
     }
 
-    // `lo` should now point at the entry we want
-    UInt entryIndex = lo;
+    SLANG_ASSERT(sourceManager->sourceFiles.Count() > 0);
 
     expanded.setRaw(loc.getRaw());
     expanded.sourceManager = sourceManager;
@@ -331,8 +380,8 @@ SourceLoc SourceManager::getSpellingLoc(ExpandedSourceLoc const& loc)
         return loc;
 
     // If we mapped to a source file, then the location must represent
-    // some offset from an entry in our array.
-    auto& entry = sourceFiles[loc.entryIndex];
+    // some offset from an entry in the array of the manager that owns it.
+    auto& entry = loc.sourceManager->sourceFiles[loc.entryIndex];
 
     // We extract the offset of the location from the start of the entry
     SourceLoc::RawValue offsetFromStart = loc.getRaw() - entry.startLoc.getRaw();
@@ -136,6 +136,12 @@ struct SourceManager
     void initialize(
         SourceManager*  parent);
 
+    // Initialize a source manager that allocates its locations from `parent`,
+    // so that the parent can go on loading files after this one has been
+    // created (and this one can still find the locations in them).
+    void initializeSharingLocations(
+        SourceManager*  parent);
+
     SourceRange allocateSourceRange(UInt size);
 
     SourceFile* allocateSourceFile(
@@ -173,6 +179,12 @@ struct SourceManager
     // The location to be used by the next source file to be loaded
     SourceLoc nextLoc;
 
+    // Are locations allocated from `parent` (see `initializeSharingLocations`)?
+    bool sharesLocationsWithParent = false;
+
+    // Get the manager that this one allocates its locations from
+    SourceManager* getLocationAllocator();
+
     // Each entry represents some contiguous span of locations that
     // all map to the same logical file.
     struct Entry
@@ -8,6 +8,23 @@ ABSTRACT_SYNTAX_CLASS(NodeBase, RefObject)
     // A helper to access the corresponding class on a concrete instance
     RAW(
     virtual SyntaxClass<NodeBase> getClass() = 0;
+
+    // Tag-based replacement for `dynamic_cast`, which only needs
+    // to compare the class ID of this node against the range
+    // of IDs covered by `T`.
+    //
+    // Note: this hides `RefObject::dynamicCast`, so that `RefPtr::As`
+    // also benefits when applied to syntax nodes.
+    template<typename T>
+    T* dynamicCast()
+    {
+        return syntaxClassCast<T>(this);
+    }
+    template<typename T>
+    const T* dynamicCast() const
+    {
+        return syntaxClassCast<T>(const_cast<NodeBase*>(this));
+    }
     )
 END_SYNTAX_CLASS()
 
@@ -18,11 +35,20 @@ ABSTRACT_SYNTAX_CLASS(SyntaxNodeBase, NodeBase)
     FIELD(SourceLoc, loc)
 
     RAW(
+    // Nodes are allocated from the current `ASTArena` when one
+    // is active (see `ASTArenaScope`), and from the heap otherwise.
+    // The constructors hand nodes allocated from an arena over to it.
+    SyntaxNodeBase();
+    SyntaxNodeBase(SyntaxNodeBase const& other);
+
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
     // Allow dynamic casting with a convenient syntax
     template<typename T>
     T* As()
     {
-        return dynamic_cast<T*>(this);
+        return dynamicCast<T>();
     }
     )
 
@@ -90,7 +116,7 @@ public:
     template<typename T>
     T* As()
     {
-        return dynamic_cast<T*>(GetCanonicalType());
+        return GetCanonicalType()->template dynamicCast<T>();
     }
 
     // Convenience/legacy wrappers for `As<>`
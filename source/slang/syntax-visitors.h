@@ -17,6 +17,12 @@ namespace Slang
     void checkTranslationUnit(
         TranslationUnitRequest* translationUnit);
 
+    // Check every global function in a module that is checked
+    // lazily, and stop checking it lazily.
+    void checkAllLazyDecls(
+        CompileRequest* request,
+        ModuleDecl*     moduleDecl);
+
     // Look for a module that matches the given name:
     // either one we've loaded already, or one we
     // can find vai the search paths available to us.
@@ -3,6 +3,8 @@
 #include "compiler.h"
 #include "visitor.h"
 
+#include <cstddef>
+#include <new>
 #include <typeinfo>
 #include <assert.h>
 
@@ -57,10 +59,10 @@ ABSTRACT_SYNTAX_CLASS(Decl, DeclBase);
 ABSTRACT_SYNTAX_CLASS(Stmt, ModifiableSyntaxNode);
 ABSTRACT_SYNTAX_CLASS(Val, NodeBase);
 ABSTRACT_SYNTAX_CLASS(Type, Val);
-ABSTRACT_SYNTAX_CLASS(Modifier, SyntaxNodeBase);
+ABSTRACT_SYNTAX_CLASS(Modifier, SyntaxNode);
 ABSTRACT_SYNTAX_CLASS(Expr, SyntaxNode);
 
-ABSTRACT_SYNTAX_CLASS(Substitutions, SyntaxNode);
+ABSTRACT_SYNTAX_CLASS(Substitutions, RefObject);
 ABSTRACT_SYNTAX_CLASS(GenericSubstitution, Substitutions);
 ABSTRACT_SYNTAX_CLASS(ThisTypeSubstitution, Substitutions);
 ABSTRACT_SYNTAX_CLASS(GlobalGenericParamSubstitution, Substitutions);
@@ -73,18 +75,147 @@ ABSTRACT_SYNTAX_CLASS(GlobalGenericParamSubstitution, Substitutions);
 #include "val-defs.h"
 #include "object-meta-end.h"
 
-bool SyntaxClassBase::isSubClassOfImpl(SyntaxClassBase const& super) const
+// Collect all of the syntax classes, so that we can assign class IDs
+static void getAllSyntaxClasses(List<SyntaxClassBase::ClassInfo const*>& outClasses)
 {
-    SyntaxClassBase::ClassInfo const* info = classInfo;
-    while (info)
+    outClasses.Add(&SyntaxClassBase::Impl<RefObject>::kClassInfo);
+
+    outClasses.Add(&SyntaxClassBase::Impl<NodeBase>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<SyntaxNodeBase>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<SyntaxNode>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<ModifiableSyntaxNode>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<DeclBase>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Decl>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Stmt>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Val>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Type>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Modifier>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<Expr>::kClassInfo);
+
+    outClasses.Add(&SyntaxClassBase::Impl<Substitutions>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<GenericSubstitution>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<ThisTypeSubstitution>::kClassInfo);
+    outClasses.Add(&SyntaxClassBase::Impl<GlobalGenericParamSubstitution>::kClassInfo);
+
+#define SYNTAX_CLASS(NAME, BASE) outClasses.Add(&SyntaxClassBase::Impl<NAME>::kClassInfo);
+#include "object-meta-begin.h"
+#include "expr-defs.h"
+#include "decl-defs.h"
+#include "modifier-defs.h"
+#include "stmt-defs.h"
+#include "type-defs.h"
+#include "val-defs.h"
+#include "object-meta-end.h"
+}
+
+// Assign class IDs to `info` and all of its descendants in pre-order,
+// so that the IDs for any subtree of the hierarchy form a contiguous range.
+static void assignSyntaxClassIds(
+    List<SyntaxClassBase::ClassInfo const*> const&  allClasses,
+    SyntaxClassBase::ClassInfo const*               info,
+    uint32_t&                                       ioNextId)
+{
+    info->classId = ioNextId++;
+    for (auto child : allClasses)
     {
-        if (info == super.classInfo)
-            return true;
+        if (child->baseClass == info)
+            assignSyntaxClassIds(allClasses, child, ioNextId);
+    }
+    info->lastDescendantClassId = ioNextId - 1;
+}
+
+// The class IDs must be assigned before any syntax node is cast, so we
+// do it during static initialization. This relies on the `kClassInfo`
+// objects themselves being constant-initialized.
+static struct SyntaxClassIdInitializer
+{
+    SyntaxClassIdInitializer()
+    {
+        List<SyntaxClassBase::ClassInfo const*> allClasses;
+        getAllSyntaxClasses(allClasses);
+
+        uint32_t nextId = 0;
+        assignSyntaxClassIds(allClasses, &SyntaxClassBase::Impl<RefObject>::kClassInfo, nextId);
+    }
+} gSyntaxClassIdInitializer;
+
+// ASTArena
+
+// The arena that new syntax nodes on this thread should be allocated from, if any
+static thread_local ASTArena* gCurrentASTArena = nullptr;
+
+// The node that was most recently allocated from `gCurrentASTArena`, and
+// hasn't been handed over to it yet (because it is still being constructed)
+static thread_local void* gPendingASTArenaNode = nullptr;
+
+ASTArena::ASTArena()
+    : memoryArena(64 * 1024)
+{}
+
+ASTArena::~ASTArena()
+{
+    for (auto node : nodes)
+        node->~SyntaxNodeBase();
+    // The memory for all of the nodes is freed by `memoryArena`
+}
+
+void ASTArena::adoptNode(SyntaxNodeBase* node)
+{
+    node->addReference();
+    nodes.Add(node);
+}
+
+ASTArenaScope::ASTArenaScope(ASTArena* arena)
+    : savedArena(gCurrentASTArena)
+{
+    gCurrentASTArena = arena;
+}
+
+ASTArenaScope::~ASTArenaScope()
+{
+    gCurrentASTArena = savedArena;
+}
+
+// SyntaxNodeBase
 
-        info = info->baseClass;
+SyntaxNodeBase::SyntaxNodeBase()
+{
+    if (this == gPendingASTArenaNode)
+    {
+        gPendingASTArenaNode = nullptr;
+        gCurrentASTArena->adoptNode(this);
     }
+}
 
-    return false;
+SyntaxNodeBase::SyntaxNodeBase(SyntaxNodeBase const& other)
+    : NodeBase(other)
+    , loc(other.loc)
+{
+    if (this == gPendingASTArenaNode)
+    {
+        gPendingASTArenaNode = nullptr;
+        gCurrentASTArena->adoptNode(this);
+    }
+}
+
+void* SyntaxNodeBase::operator new(size_t size)
+{
+    auto arena = gCurrentASTArena;
+    if (!arena)
+        return ::operator new(size);
+
+    void* node = arena->memoryArena.allocateAligned(size, alignof(std::max_align_t));
+    if (!node)
+        throw std::bad_alloc();
+    gPendingASTArenaNode = node;
+    return node;
+}
+
+void SyntaxNodeBase::operator delete(void* ptr)
+{
+    // Nodes allocated from an arena are never deleted individually,
+    // since the arena holds a reference to each of them.
+    ::operator delete(ptr);
 }
 
 void Type::accept(IValVisitor* visitor, void* extra)
@@ -1211,6 +1342,16 @@ void Type::accept(IValVisitor* visitor, void* extra)
         return nullptr;
     }
 
+    bool isFromStdLib(Decl* decl)
+    {
+        for (auto dd = decl; dd; dd = dd->ParentDecl)
+        {
+            if (dd->HasModifier<FromStdLibModifier>())
+                return true;
+        }
+        return false;
+    }
+
     // MatrixExpressionType
 
     String MatrixExpressionType::ToString()
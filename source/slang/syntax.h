@@ -2,6 +2,7 @@
 #define RASTER_RENDERER_SYNTAX_H
 
 #include "../core/basic.h"
+#include "../core/slang-memory-arena.h"
 #include "ir.h"
 #include "lexer.h"
 #include "profile.h"
@@ -28,6 +29,54 @@ namespace Slang
 
     class Parser;
     class SyntaxNode;
+    class SyntaxNodeBase;
+
+    // An arena that the syntax nodes for a module (its declarations,
+    // statements, expressions and modifiers) can be allocated from, so
+    // that they don't each need a heap allocation, and are all freed
+    // together once the module is no longer needed.
+    //
+    // The arena holds a reference to every node allocated from it, so a
+    // node's reference count never drops to zero while the arena is alive,
+    // and nodes are never deleted one at a time. When the arena itself is
+    // destroyed, it runs the destructors of its nodes in the order they
+    // were allocated (so the `ModuleDecl` goes first), and then frees their
+    // memory in bulk. Because no node's storage is freed until all of them
+    // have been destroyed, references between nodes can be released in any
+    // order during teardown.
+    //
+    // Whoever owns the arena must make sure that it outlives everything
+    // else that refers to its nodes.
+    class ASTArena : public RefObject
+    {
+    public:
+        ASTArena();
+        ~ASTArena();
+
+        // Called when a node allocated from this arena has been constructed
+        void adoptNode(SyntaxNodeBase* node);
+
+        MemoryArena memoryArena;
+
+        // The nodes allocated from this arena, in allocation order
+        List<SyntaxNodeBase*> nodes;
+
+        // The arenas of modules imported by the module allocated from
+        // this arena. Its nodes may refer to theirs, so they are kept
+        // alive until this arena's nodes have been destroyed.
+        List<RefPtr<ASTArena>> importedArenas;
+    };
+
+    // While an `ASTArenaScope` is live, syntax nodes created on the
+    // current thread are allocated from the given arena (or from the
+    // heap, if it is null).
+    struct ASTArenaScope
+    {
+        ASTArenaScope(ASTArena* arena);
+        ~ASTArenaScope();
+
+        ASTArena* savedArena;
+    };
 
     typedef RefPtr<RefObject> (*SyntaxParseCallback)(Parser* parser, void* userData);
 
@@ -325,6 +374,13 @@ namespace Slang
 
             // Callback to use when creating instances
             CreateFunc createFunc;
+
+            // Range of class IDs covered by this class and all of its
+            // descendants. IDs are assigned by a pre-order walk of the
+            // class hierarchy when the library is loaded (see `syntax.cpp`),
+            // so that a subclass test is just a range comparison.
+            mutable uint32_t classId;
+            mutable uint32_t lastDescendantClassId;
         };
 
         SyntaxClassBase()
@@ -345,7 +401,12 @@ namespace Slang
             return cf();
         }
 
-        bool isSubClassOfImpl(SyntaxClassBase const& super) const;
+        bool isSubClassOfImpl(SyntaxClassBase const& super) const
+        {
+            auto id = classInfo->classId;
+            return (id >= super.classInfo->classId)
+                && (id <= super.classInfo->lastDescendantClassId);
+        }
 
         ClassInfo const* classInfo = nullptr;
 
@@ -401,6 +462,25 @@ namespace Slang
         return SyntaxClass<T>::getClass();
     }
 
+    // Cast a syntax node to `T`, returning null if the node isn't
+    // an instance of `T` (or a subclass).
+    //
+    // Unlike `dynamic_cast`, this only needs to look up the class
+    // of `node` and compare its class ID against the ID range of `T`.
+    //
+    // Note: a lot of existing code invokes `As<T>()` through a null
+    // pointer and expects a null result, as `dynamic_cast` would give,
+    // so we handle that case explicitly.
+    template<typename T, typename N>
+    T* syntaxClassCast(N* node)
+    {
+        if (!node)
+            return nullptr;
+        if (!node->getClass().template isSubClassOf<T>())
+            return nullptr;
+        return static_cast<T*>(node);
+    }
+
     struct SubstitutionSet
     {
         RefPtr<Substitutions> substitutions;
@@ -501,13 +581,7 @@ namespace Slang
 
         // "dynamic cast" to a more specific declaration reference type
         template<typename U>
-        DeclRef<U> As() const
-        {
-            DeclRef<U> result;
-            result.decl = dynamic_cast<U*>(decl);
-            result.substitutions = substitutions;
-            return result;
-        }
+        DeclRef<U> As() const;
 
         T* getDecl() const
         {
@@ -1000,6 +1074,72 @@ namespace Slang
         LookupMask          mask        = LookupMask::Default;
     };
 
+    // Key used to cache the result of member lookup on a type.
+    //
+    // The `type` should be a canonical type, so that we can
+    // compare and hash it structurally.
+    struct MemberLookupCacheKey
+    {
+        RefPtr<Type>    type;
+        Name*           name = nullptr;
+        LookupMask      mask = LookupMask::Default;
+
+        bool operator==(MemberLookupCacheKey const& other) const;
+        int GetHashCode() const;
+    };
+
+    // Diagnostics produced when checking a declaration on demand
+    // (see `ModuleDecl::lazyDeclDiagnostics`).
+    struct LazyDeclDiagnostics
+    {
+        String  output;
+        bool    hasErrors = false;
+    };
+
+    // Cache of member lookup results, keyed on the (canonical) type
+    // being looked into. Each entry holds the flattened result of looking
+    // through the type's own members, its transparent members, its
+    // extensions, and any inherited interfaces or constraints.
+    //
+    // Every entry records the declarations it depends on: the containers
+    // that lookup visited, and the modules of every declaration that the
+    // key or result refers to. An entry is only discarded when one of those
+    // changes: a new `extension` is registered for a visited container, or
+    // one of the modules is destroyed. Implemented in lookup.cpp.
+    class MemberLookupCache
+    {
+    public:
+        ~MemberLookupCache();
+
+        bool tryGetResult(MemberLookupCacheKey const& key, LookupResult& outResult);
+
+        // Add a result to the cache. Returns false (and caches nothing)
+        // if the result refers to something we can't track the lifetime of.
+        bool addResult(MemberLookupCacheKey const& key, LookupResult const& result);
+
+        // Discard every entry that depends on `decl`.
+        void invalidateDependentsOf(Decl* decl);
+
+        // Discard all entries.
+        void clear();
+
+        UInt getEntryCount() { return entries.Count(); }
+
+    private:
+        struct Entry
+        {
+            LookupResult    result;
+            List<Decl*>     dependencies;
+        };
+
+        void removeEntry(MemberLookupCacheKey const& key);
+
+        Dictionary<MemberLookupCacheKey, Entry> entries;
+
+        // For each declaration, the keys of the entries that depend on it.
+        Dictionary<Decl*, HashSet<MemberLookupCacheKey>> dependents;
+    };
+
     struct WitnessTable;
 
     // A value that witnesses the satisfaction of an interface
@@ -1270,10 +1410,20 @@ namespace Slang
         for (;;)
         {
             if (!m) return m;
-            if (dynamic_cast<T*>(m)) return m;
+            if (m->template dynamicCast<T>()) return m;
             m = m->next.Ptr();
         }        
     }
+    //
+    template<typename T>
+    template<typename U>
+    DeclRef<U> DeclRef<T>::As() const
+    {
+        DeclRef<U> result;
+        result.decl = decl ? decl->template dynamicCast<U>() : nullptr;
+        result.substitutions = substitutions;
+        return result;
+    }
 
     // TODO: where should this live?
     SubstitutionSet createDefaultSubstitutions(
@@ -1295,6 +1445,9 @@ namespace Slang
         RefPtr<Substitutions>   outerSubst);
 
     RefPtr<GenericSubstitution> findInnerMostGenericSubstitution(Substitutions* subst);
+
+    // Is `decl` (or one of its parents) part of the standard library?
+    bool isFromStdLib(Decl* decl);
 } // namespace Slang
 
 #endif
\ No newline at end of file
@@ -36,13 +36,17 @@ public:
     SourceLoc   loc;
     void*       ptrValue;
 
-    String Content;
+    // The text of the token. This is not owned by the token, so that tokens
+    // can be copied freely: it points into the source file the token was lexed
+    // from (or, for text the lexer or parser has to build, into the `Name` it is
+    // interned as), which both live at least as long as the tokens do.
+    UnownedStringSlice Content;
 
     Token() = default;
 
     Token(
         TokenType typeIn,
-        const String & contentIn,
+        const UnownedStringSlice & contentIn,
         SourceLoc locIn,
         TokenFlags flagsIn = 0)
         : flags(flagsIn)
@@ -775,6 +775,20 @@ static bool isVulkanTarget(TargetRequest* targetReq)
     return true;
 }
 
+bool isLayoutSameForTargets(
+    TargetRequest* left,
+    TargetRequest* right)
+{
+    // These are all of the properties of a target that the
+    // layout logic in this file (and in `parameter-binding.cpp`)
+    // depends on.
+    return getDefaultLayoutRulesFamilyForTarget(left) == getDefaultLayoutRulesFamilyForTarget(right)
+        && left->getDefaultMatrixLayoutMode() == right->getDefaultMatrixLayoutMode()
+        && isSM5OrEarlier(left) == isSM5OrEarlier(right)
+        && (left->targetFlags & SLANG_TARGET_FLAG_PARAMETER_BLOCKS_USE_REGISTER_SPACES)
+            == (right->targetFlags & SLANG_TARGET_FLAG_PARAMETER_BLOCKS_USE_REGISTER_SPACES);
+}
+
 static bool shouldAllocateRegisterSpaceForParameterBlock(
     TypeLayoutContext const&  context)
 {
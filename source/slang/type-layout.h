@@ -635,6 +635,12 @@ struct TypeLayoutContext
 TypeLayoutContext getInitialLayoutContextForTarget(
     TargetRequest* targetReq);
 
+// Will type layout and parameter binding give the same
+// results for both of the given targets?
+bool isLayoutSameForTargets(
+    TargetRequest* left,
+    TargetRequest* right);
+
 // Get the "simple" layout for a type accordinging to a given set of layout
 // rules. Note that a "simple" layout can only consume one `LayoutResourceKind`,
 // and so this operation may not correctly capture the full resource usage
@@ -2,13 +2,18 @@
 
 #include "../../slang.h"
 
-SLANG_API void spSetCommandLineCompilerMode(SlangCompileRequest* request);
-
 #include "../core/slang-io.h"
+#include "../slangd/slangd-protocol.h"
+#include "slangc-driver.h"
 
 using namespace Slang;
 
 #include <assert.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 // Try to read an argument for a command-line option.
 
@@ -26,76 +31,85 @@ static void diagnosticCallback(
 #define MAIN main
 #endif
 
-// Used to identify that compilation was the failure - with a unique 'internal' code
-#define SLANG_E_INTERNAL_COMPILE_FAILED SLANG_MAKE_ERROR(SLANG_FACILITY_INTERNAL, 0x7fab)
-
-static SlangResult innerMain(int argc, char** argv)
+// If the `SLANGD_SOCKET` environment variable is set, try to have the `slangd`
+// server listening on that socket run the compile, and write its output as if
+// the compile had run here.
+//
+// Returns false if the compile should be run in-process instead (because no
+// server is running, or the options can't be forwarded).
+static bool tryCompileOnServer(int argc, char** argv, SlangResult& outResult)
 {
-    // Parse any command-line options
+    const char* socketPath = getenv(SLANGD_SOCKET_ENV);
+    if (!socketPath || !*socketPath || !isSlangdSupported())
+        return false;
 
-    SlangSession* session = spCreateSession(nullptr);
-    SlangCompileRequest* compileRequest = spCreateCompileRequest(session);
+#ifdef _WIN32
+    return false;
+#else
+    char workingDirectory[4096];
+    if (!getcwd(workingDirectory, sizeof(workingDirectory)))
+        return false;
+
+    List<String> request;
+    request.Add(SLANGD_COMPILE_REQUEST);
+    request.Add(workingDirectory);
+    for (int ii = 1; ii < argc; ++ii)
+    {
+        // Some options make the compiler write straight to `stderr`,
+        // which would end up in the server's output rather than ours.
+        if (strcmp(argv[ii], "-dump-ir") == 0 || strcmp(argv[ii], "-dump-intermediates") == 0)
+            return false;
 
-    spSetDiagnosticCallback(
-        compileRequest,
-        &diagnosticCallback,
-        nullptr);
+        request.Add(argv[ii]);
+    }
 
-    spSetCommandLineCompilerMode(compileRequest);
+    // If the server can't be reached, or goes away before replying, nothing
+    // has been written yet, and so the compile can still be run here.
+    SlangdConnection connection;
+    List<String> response;
+    if (!connection.connect(socketPath) ||
+        !connection.writeMessage(request) ||
+        !connection.readMessage(response) ||
+        response.Count() != 3)
+    {
+        return false;
+    }
 
-    char const* appName = "slangc";
-    if (argc > 0) appName = argv[0];
+    fwrite(response[1].Buffer(), 1, response[1].Length(), stdout);
+    fflush(stdout);
+    fputs(response[2].Buffer(), stderr);
+    fflush(stderr);
 
+    outResult = SlangResult(StringToInt(response[0]));
+    return true;
+#endif
+}
+
+static SlangResult innerMain(int argc, char** argv)
+{
     {
-        const SlangResult res = spProcessCommandLineArguments(compileRequest, &argv[1], argc - 1);
-        if (SLANG_FAILED(res))
-        {
-            // TODO: print usage message
+        SlangResult res;
+        if (tryCompileOnServer(argc, argv, res))
             return res;
-        }
     }
 
-#ifndef _DEBUG
-    try
-#endif
-    {
-        // Run the compiler (this will produce any diagnostics through
-        // our callback above).
-        if (SLANG_FAILED(spCompile(compileRequest)))
-        {
-            // If the compilation failed, then get out of here...
-            // Turn into an internal Result -> such that return code can be used to vary result to match previous behavior
-            return SLANG_E_INTERNAL_COMPILE_FAILED;
-        }
+    SlangSession* session = spCreateSession(nullptr);
+    SlangCompileRequest* compileRequest = spCreateCompileRequest(session);
 
-        // Now that we are done, clean up after ourselves
+    // Parse any command-line options, and run the compiler (this will
+    // produce any diagnostics through our callback above).
+    SlangResult res = runSlangcCompile(compileRequest, &argv[1], argc - 1, &diagnosticCallback, nullptr);
 
-        spDestroyCompileRequest(compileRequest);
-        spDestroySession(session);
-    }
-#ifndef _DEBUG
-    catch (Exception & e)
-    {
-        printf("internal compiler error: %S\n", e.Message.ToWString().begin());
-        return SLANG_FAIL;
-    }
-#endif
-    return SLANG_OK;    
+    // Now that we are done, clean up after ourselves
+
+    spDestroyCompileRequest(compileRequest);
+    spDestroySession(session);
+    return res;
 }
 
 int MAIN(int argc, char** argv)
 {
-    SlangResult res =  innerMain(argc, argv);
-
-    if (SLANG_SUCCEEDED(res))
-    {
-        return 0;
-    }
-    else if (res == SLANG_E_INTERNAL_COMPILE_FAILED)
-    {
-        return -1;
-    }
-    return 1;
+    return getSlangcExitCode(innerMain(argc, argv));
 }
 
 #ifdef _WIN32
@@ -0,0 +1,60 @@
+// slangc-driver.cpp
+#include "slangc-driver.h"
+
+#include "../../slang-com-helper.h"
+
+#include "../core/exception.h"
+#include "../core/slang-string.h"
+
+// Not part of the public API, but used by `slangc`
+SLANG_API void spSetCommandLineCompilerMode(SlangCompileRequest* request);
+
+namespace Slang
+{
+
+SlangResult runSlangcCompile(
+    SlangCompileRequest*    request,
+    char const* const*      args,
+    int                     argCount,
+    SlangDiagnosticCallback diagnosticCallback,
+    void*                   diagnosticUserData)
+{
+    spSetDiagnosticCallback(request, diagnosticCallback, diagnosticUserData);
+    spSetCommandLineCompilerMode(request);
+
+    try
+    {
+        SLANG_RETURN_ON_FAIL(spProcessCommandLineArguments(request, args, argCount));
+
+        // Run the compiler (this will produce any diagnostics through
+        // the callbacks set on the request).
+        if (SLANG_FAILED(spCompile(request)))
+        {
+            // Turn into an internal Result -> such that return code can be used to vary result to match previous behavior
+            return SLANG_E_INTERNAL_COMPILE_FAILED;
+        }
+    }
+    catch (Exception& e)
+    {
+        StringBuilder sb;
+        sb << "internal compiler error: " << e.Message << "\n";
+        diagnosticCallback(sb.Buffer(), diagnosticUserData);
+        return SLANG_FAIL;
+    }
+    return SLANG_OK;
+}
+
+int getSlangcExitCode(SlangResult res)
+{
+    if (SLANG_SUCCEEDED(res))
+    {
+        return 0;
+    }
+    else if (res == SLANG_E_INTERNAL_COMPILE_FAILED)
+    {
+        return -1;
+    }
+    return 1;
+}
+
+}
@@ -0,0 +1,35 @@
+// slangc-driver.h
+#ifndef SLANGC_DRIVER_H_INCLUDED
+#define SLANGC_DRIVER_H_INCLUDED
+
+#include "../../slang.h"
+
+// The part of `slangc` that runs a compile from its command line. It is shared
+// with the tools that run `slangc` compiles themselves: `slangd` (which runs
+// them for clients) and `slang-test` (which runs them in-process).
+
+namespace Slang
+{
+
+// Used to identify that compilation was the failure - with a unique 'internal' code
+#define SLANG_E_INTERNAL_COMPILE_FAILED SLANG_MAKE_ERROR(SLANG_FACILITY_INTERNAL, 0x7fab)
+
+// Compile `request` as `slangc` would for the command-line arguments `args`
+// (not including the application name). Diagnostics, including any internal
+// compiler error, go to `diagnosticCallback`; other output goes to the
+// callbacks set on the request.
+//
+// Returns `SLANG_E_INTERNAL_COMPILE_FAILED` if the compile itself failed.
+SlangResult runSlangcCompile(
+    SlangCompileRequest*    request,
+    char const* const*      args,
+    int                     argCount,
+    SlangDiagnosticCallback diagnosticCallback,
+    void*                   diagnosticUserData);
+
+// The exit code `slangc` returns for the result of `runSlangcCompile`
+int getSlangcExitCode(SlangResult res);
+
+}
+
+#endif
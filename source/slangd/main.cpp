@@ -0,0 +1,231 @@
+// main.cpp
+
+// `slangd` is a compile server. It keeps a single Slang session alive (with the
+// standard library loaded and checked) and runs compiles that clients such as
+// `slangc` send it over a local socket, so that each compile doesn't pay for
+// starting a process and setting up a session.
+
+#include "../../slang.h"
+
+#include "../core/slang-io.h"
+#include "../slangc/slangc-driver.h"
+#include "slangd-protocol.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Not part of the public API, but used by `slangd`
+SLANG_API void spSetWorkingDirectory(SlangCompileRequest* request, char const* path);
+
+using namespace Slang;
+
+static void diagnosticCallback(
+    char const* message,
+    void*       userData)
+{
+    ((StringBuilder*)userData)->Append(message);
+}
+
+static void standardOutputCallback(
+    void const* data,
+    size_t      size,
+    void*       userData)
+{
+    ((StringBuilder*)userData)->append((const char*)data, (const char*)data + size);
+}
+
+static SlangResult compile(
+    SlangSession*       session,
+    String const&       workingDirectory,
+    List<String> const& args,
+    StringBuilder&      standardOutput,
+    StringBuilder&      diagnosticOutput)
+{
+    SlangCompileRequest* compileRequest = spCreateCompileRequest(session);
+
+    // Paths in the arguments are relative to the client's working directory.
+    // It is set on the request, rather than the server changing directory, so
+    // that nothing about one compile carries over to the next.
+    spSetWorkingDirectory(compileRequest, workingDirectory.Buffer());
+    spSetStandardOutputCallback(compileRequest, &standardOutputCallback, &standardOutput);
+
+    List<char const*> argBuffers;
+    for (auto const& arg : args)
+    {
+        argBuffers.Add(arg.Buffer());
+    }
+
+    SlangResult res = runSlangcCompile(
+        compileRequest,
+        argBuffers.Buffer(),
+        int(argBuffers.Count()),
+        &diagnosticCallback,
+        &diagnosticOutput);
+
+    spDestroyCompileRequest(compileRequest);
+    return res;
+}
+
+// Run the compile requested by `request`, and produce the response to send back
+static void handleCompileRequest(
+    SlangSession*       session,
+    List<String> const& request,
+    List<String>&       outResponse)
+{
+    StringBuilder standardOutput;
+    StringBuilder diagnosticOutput;
+    SlangResult res = SLANG_FAIL;
+
+    if (request.Count() < 2 || !Path::IsAbsolute(request[1]))
+    {
+        diagnosticOutput.Append("slangd: malformed compile request\n");
+    }
+    else
+    {
+        List<String> args;
+        args.AddRange(request.Buffer() + 2, request.Count() - 2);
+        res = compile(session, request[1], args, standardOutput, diagnosticOutput);
+    }
+
+    String resultText;
+    resultText.append(int32_t(res));
+
+    outResponse.Clear();
+    outResponse.Add(resultText);
+    outResponse.Add(standardOutput.ProduceString());
+    outResponse.Add(diagnosticOutput.ProduceString());
+}
+
+static void printUsage()
+{
+    fprintf(stderr,
+        "usage: slangd [-socket path] [-stop]\n"
+        "\n"
+        "Runs a server that compiles for slangc. slangc forwards its compiles to the\n"
+        "server when the " SLANGD_SOCKET_ENV " environment variable holds the path of\n"
+        "the socket the server is listening on (by default " SLANGD_SOCKET_ENV ", or\n"
+        "slangd.sock in $XDG_RUNTIME_DIR, or in a private directory in /tmp).\n"
+        "Only compiles from the user running the server are accepted.\n"
+        "\n"
+        "  -socket path   Listen on the socket at 'path'\n"
+        "  -stop          Stop the server listening on the socket\n");
+}
+
+static int innerMain(int argc, char** argv)
+{
+    if (!isSlangdSupported())
+    {
+        fprintf(stderr, "slangd: not supported on this platform\n");
+        return 1;
+    }
+
+    String socketPath = getDefaultSlangdSocketPath();
+    bool stop = false;
+
+    for (int ii = 1; ii < argc; ++ii)
+    {
+        const char* arg = argv[ii];
+        if (strcmp(arg, "-socket") == 0 && ii + 1 < argc)
+        {
+            socketPath = argv[++ii];
+        }
+        else if (strcmp(arg, "-stop") == 0)
+        {
+            stop = true;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    if (socketPath.Length() == 0)
+    {
+        fprintf(stderr, "slangd: no socket path was given, and the default directory can't be used\n");
+        return 1;
+    }
+
+    if (stop)
+    {
+        SlangdConnection connection;
+        List<String> request;
+        request.Add(SLANGD_STOP_REQUEST);
+
+        List<String> response;
+        if (!connection.connect(socketPath) ||
+            !connection.writeMessage(request) ||
+            !connection.readMessage(response))
+        {
+            fprintf(stderr, "slangd: no server is listening on '%s'\n", socketPath.Buffer());
+            return 1;
+        }
+        return 0;
+    }
+
+    SlangdListener listener;
+    if (!listener.listen(socketPath))
+    {
+        fprintf(stderr, "slangd: cannot listen on '%s' (is a server already running?)\n", socketPath.Buffer());
+        return 1;
+    }
+
+    // The session is created once, and shared by all of the compiles, so that
+    // the standard library (and the lookup and overload caches for it) stays
+    // loaded between them.
+    //
+    // Note: Loaded modules are not kept between compiles, as there is nothing
+    // to tell the server that the files they were loaded from have changed.
+    SlangSession* session = spCreateSession(nullptr);
+
+    fprintf(stderr, "slangd: listening on '%s'\n", socketPath.Buffer());
+    fflush(stderr);
+
+    for (;;)
+    {
+        SlangdConnection connection;
+        if (!listener.accept(connection))
+        {
+            fprintf(stderr, "slangd: failed to accept a connection\n");
+            break;
+        }
+
+        // Compiles are run one at a time, so a client that connects and then
+        // stops sending (or reading) would hold up every other client. It gets
+        // a limited time for each read and write instead, and is then dropped.
+        if (!connection.setTimeout(kSlangdClientTimeoutSeconds))
+            continue;
+
+        List<String> request;
+        if (!connection.readMessage(request) || request.Count() == 0)
+            continue;
+
+        List<String> response;
+        if (request[0] == SLANGD_COMPILE_REQUEST)
+        {
+            handleCompileRequest(session, request, response);
+        }
+        else if (request[0] == SLANGD_STOP_REQUEST)
+        {
+            connection.writeMessage(response);
+            break;
+        }
+        else
+        {
+            // Any other request (for example from a newer client) gets an
+            // empty response, which the client can treat as a failure.
+        }
+
+        // If the client has gone away there is no one to report to
+        connection.writeMessage(response);
+    }
+
+    listener.close();
+    spDestroySession(session);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    return innerMain(argc, argv);
+}
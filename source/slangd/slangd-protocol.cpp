@@ -0,0 +1,323 @@
+// slangd-protocol.cpp
+#include "slangd-protocol.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Not every platform has `MSG_NOSIGNAL` (which stops a write to a closed socket
+// raising `SIGPIPE`), and it is only an extra safeguard.
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+namespace Slang
+{
+
+#ifdef _WIN32
+
+// TODO: Use a named pipe on Windows. Until then `slangd` isn't built for Windows,
+// and `slangc` always compiles in-process.
+
+bool isSlangdSupported() { return false; }
+
+String getDefaultSlangdSocketPath() { return String(); }
+
+bool SlangdConnection::connect(const String& /*path*/) { return false; }
+bool SlangdConnection::writeMessage(const List<String>& /*message*/) { return false; }
+bool SlangdConnection::readMessage(List<String>& /*outMessage*/) { return false; }
+bool SlangdConnection::setTimeout(int /*seconds*/) { return false; }
+void SlangdConnection::close() {}
+
+bool SlangdListener::listen(const String& /*path*/) { return false; }
+bool SlangdListener::accept(SlangdConnection& /*outConnection*/) { return false; }
+void SlangdListener::close() {}
+
+#else
+
+bool isSlangdSupported() { return true; }
+
+// Make sure `path` is a directory that only the current user can use,
+// creating it if it doesn't exist
+static bool ensurePrivateDirectory(const String& path)
+{
+    if (::mkdir(path.Buffer(), 0700) != 0 && errno != EEXIST)
+        return false;
+
+    // Another user may have created the directory (or a link to one)
+    // first, in which case it must not be used.
+    struct stat info;
+    if (::lstat(path.Buffer(), &info) != 0)
+        return false;
+    return S_ISDIR(info.st_mode) && info.st_uid == ::geteuid() && (info.st_mode & 077) == 0;
+}
+
+String getDefaultSlangdSocketPath()
+{
+    if (const char* path = getenv(SLANGD_SOCKET_ENV))
+    {
+        if (*path)
+            return path;
+    }
+
+    // The per-user runtime directory is private to the user already
+    if (const char* runtimeDirectory = getenv("XDG_RUNTIME_DIR"))
+    {
+        if (*runtimeDirectory)
+            return String(runtimeDirectory) + "/slangd.sock";
+    }
+
+    String directory("/tmp/slangd-");
+    directory.append(uint32_t(::geteuid()));
+    if (!ensurePrivateDirectory(directory))
+        return String();
+    return directory + "/slangd.sock";
+}
+
+// Is the process at the other end of `socket` running as the current user?
+//
+// The server only runs compiles for its own user (a compile can read any file
+// the server can), and a client only trusts output from a server run by its
+// own user, whatever the permissions of the socket's directory.
+static bool isPeerCurrentUser(int socket)
+{
+#ifdef SO_PEERCRED
+    struct ucred credentials;
+    socklen_t size = sizeof(credentials);
+    if (::getsockopt(socket, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+        return false;
+    return credentials.uid == ::geteuid();
+#else
+    uid_t uid;
+    gid_t gid;
+    if (::getpeereid(socket, &uid, &gid) != 0)
+        return false;
+    return uid == ::geteuid();
+#endif
+}
+
+static bool initSocketAddress(const String& path, sockaddr_un& outAddress)
+{
+    memset(&outAddress, 0, sizeof(outAddress));
+    outAddress.sun_family = AF_UNIX;
+
+    // The path has to fit (with its terminator) in `sun_path`
+    if (path.Length() == 0 || path.Length() >= sizeof(outAddress.sun_path))
+        return false;
+
+    memcpy(outAddress.sun_path, path.Buffer(), path.Length());
+    return true;
+}
+
+static bool writeAll(int socket, const void* data, size_t size)
+{
+    const char* cursor = (const char*)data;
+    while (size)
+    {
+        ssize_t count = ::send(socket, cursor, size, MSG_NOSIGNAL);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        cursor += count;
+        size -= size_t(count);
+    }
+    return true;
+}
+
+static bool readAll(int socket, void* data, size_t size)
+{
+    char* cursor = (char*)data;
+    while (size)
+    {
+        ssize_t count = ::recv(socket, cursor, size, 0);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (count == 0)
+        {
+            // The other end closed the connection part way through a message
+            return false;
+        }
+        cursor += count;
+        size -= size_t(count);
+    }
+    return true;
+}
+
+bool SlangdConnection::connect(const String& path)
+{
+    close();
+
+    sockaddr_un address;
+    if (!initSocketAddress(path, address))
+        return false;
+
+    m_socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_socket < 0)
+        return false;
+
+    if (::connect(m_socket, (const sockaddr*)&address, sizeof(address)) != 0 ||
+        !isPeerCurrentUser(m_socket))
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool SlangdConnection::writeMessage(const List<String>& message)
+{
+    // Build the whole message first, so it is sent with as few calls as possible
+    List<char> buffer;
+
+    const uint32_t count = uint32_t(message.Count());
+    buffer.AddRange((const char*)&count, sizeof(count));
+    for (const auto& string : message)
+    {
+        const uint32_t length = uint32_t(string.Length());
+        buffer.AddRange((const char*)&length, sizeof(length));
+        buffer.AddRange(string.Buffer(), length);
+    }
+
+    return writeAll(m_socket, buffer.Buffer(), buffer.Count());
+}
+
+bool SlangdConnection::readMessage(List<String>& outMessage)
+{
+    outMessage.Clear();
+
+    uint32_t count;
+    if (!readAll(m_socket, &count, sizeof(count)))
+        return false;
+    if (count > kSlangdMaxMessageStringCount)
+        return false;
+
+    List<char> buffer;
+    size_t totalLength = 0;
+    for (uint32_t ii = 0; ii < count; ++ii)
+    {
+        uint32_t length;
+        if (!readAll(m_socket, &length, sizeof(length)))
+            return false;
+
+        totalLength += length;
+        if (totalLength > kSlangdMaxMessageSize)
+            return false;
+
+        buffer.SetSize(length);
+        if (!readAll(m_socket, buffer.Buffer(), length))
+            return false;
+
+        String string;
+        string.append(buffer.Buffer(), buffer.Buffer() + length);
+        outMessage.Add(string);
+    }
+    return true;
+}
+
+bool SlangdConnection::setTimeout(int seconds)
+{
+    struct timeval timeout;
+    timeout.tv_sec = seconds;
+    timeout.tv_usec = 0;
+    return ::setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0
+        && ::setsockopt(m_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) == 0;
+}
+
+void SlangdConnection::close()
+{
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+        m_socket = -1;
+    }
+}
+
+bool SlangdListener::listen(const String& path)
+{
+    close();
+
+    sockaddr_un address;
+    if (!initSocketAddress(path, address))
+        return false;
+
+    // If a server is already listening on the path we must not take it over,
+    // but a socket file left behind by a server that exited can be replaced.
+    {
+        SlangdConnection connection;
+        if (connection.connect(path))
+            return false;
+    }
+    ::unlink(path.Buffer());
+
+    m_socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_socket < 0)
+        return false;
+
+    // Only the current user may connect. (Clients of other users are also
+    // turned away by `accept`, on systems that don't check the permissions.)
+    const mode_t oldMask = ::umask(077);
+    const bool isBound = ::bind(m_socket, (const sockaddr*)&address, sizeof(address)) == 0;
+    ::umask(oldMask);
+
+    if (!isBound || ::listen(m_socket, SOMAXCONN) != 0)
+    {
+        close();
+        return false;
+    }
+
+    m_path = path;
+    return true;
+}
+
+bool SlangdListener::accept(SlangdConnection& outConnection)
+{
+    outConnection.close();
+    for (;;)
+    {
+        int socket = ::accept(m_socket, nullptr, nullptr);
+        if (socket >= 0)
+        {
+            if (!isPeerCurrentUser(socket))
+            {
+                ::close(socket);
+                continue;
+            }
+            outConnection.m_socket = socket;
+            return true;
+        }
+        if (errno != EINTR)
+            return false;
+    }
+}
+
+void SlangdListener::close()
+{
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+        m_socket = -1;
+
+        ::unlink(m_path.Buffer());
+        m_path = String();
+    }
+}
+
+#endif
+
+}
@@ -0,0 +1,109 @@
+// slangd-protocol.h
+#ifndef SLANGD_PROTOCOL_H_INCLUDED
+#define SLANGD_PROTOCOL_H_INCLUDED
+
+#include "../core/list.h"
+#include "../core/slang-string.h"
+
+// The protocol used between `slangd` and its clients (such as `slangc`).
+//
+// A client connects to the local socket `slangd` is listening on, sends a single
+// request message, and reads back a single response message. Each message is
+// a list of strings, written as a 32-bit count followed by each string as a
+// 32-bit length and its bytes (the strings may hold binary data). As both ends
+// are on the same machine, integers are in the machine's byte order.
+//
+// A compile request is:
+//
+//      "compile", <working directory>, <arguments>...
+//
+// where the arguments are those that `spProcessCommandLineArguments` accepts,
+// relative paths in them are taken relative to the (absolute) working directory,
+// and the response is:
+//
+//      <SlangResult, in decimal>, <stdout output>, <diagnostic output>
+//
+// A "stop" request asks the server to exit, and gets an empty response.
+//
+// Each end checks that the process at the other end is run by the same user,
+// and drops the connection otherwise.
+
+namespace Slang
+{
+
+#define SLANGD_COMPILE_REQUEST "compile"
+#define SLANGD_STOP_REQUEST "stop"
+
+// The environment variable that holds the path of the socket. `slangc` only
+// forwards compiles to `slangd` when this is set.
+#define SLANGD_SOCKET_ENV "SLANGD_SOCKET"
+
+// Returns true if `slangd` can be used on this platform
+bool isSlangdSupported();
+
+// The path `slangd` listens on when none is given: `SLANGD_SOCKET` if it is set,
+// otherwise `slangd.sock` in `XDG_RUNTIME_DIR`, and otherwise `slangd.sock` in a
+// directory under `/tmp` that only the current user can access (which is
+// created if needed). Returns an empty string if there is no usable path.
+String getDefaultSlangdSocketPath();
+
+// Limits on a message that is read, so that a bad message can't make the
+// reader allocate without bound. Responses hold all the output of a compile,
+// so the size limit is generous.
+static const uint32_t kSlangdMaxMessageStringCount = 64 * 1024;
+static const size_t kSlangdMaxMessageSize = size_t(1024) * 1024 * 1024;
+
+// How long the server waits for a client to send (or take) any part of a message
+static const int kSlangdClientTimeoutSeconds = 10;
+
+// One end of a connection to `slangd`
+class SlangdConnection
+{
+public:
+    // Connect to a server listening on `path`
+    bool connect(const String& path);
+
+    bool writeMessage(const List<String>& message);
+    bool readMessage(List<String>& outMessage);
+
+    // Make a read or write that waits more than `seconds` for the other end fail
+    bool setTimeout(int seconds);
+
+    void close();
+
+    SlangdConnection() {}
+    ~SlangdConnection() { close(); }
+
+    int m_socket = -1;
+
+private:
+    SlangdConnection(const SlangdConnection&) = delete;
+    void operator=(const SlangdConnection&) = delete;
+};
+
+// The socket `slangd` accepts connections on
+class SlangdListener
+{
+public:
+    // Start listening on `path`, replacing any stale socket file there
+    bool listen(const String& path);
+
+    // Wait for the next client to connect
+    bool accept(SlangdConnection& outConnection);
+
+    void close();
+
+    SlangdListener() {}
+    ~SlangdListener() { close(); }
+
+    int m_socket = -1;
+    String m_path;
+
+private:
+    SlangdListener(const SlangdListener&) = delete;
+    void operator=(const SlangdListener&) = delete;
+};
+
+}
+
+#endif
@@ -0,0 +1,1373 @@
+// main.cpp
+
+// `slang-bench` measures compile throughput. It compiles each of the shaders
+// in `benchmarks/`, and those it generates itself, a number of times on a
+// single session, and reports the
+// distribution of compile times, the time spent in each phase of the compiler
+// (see `SlangCompileStats`) and the number of allocations made. The core
+// containers the compiler is built on are measured the same way.
+//
+// Results can be written as JSON, and compared against a baseline written the
+// same way, so that a change that makes the compiler slower is caught before
+// it is merged.
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <unordered_map>
+
+#include "../../slang.h"
+#include "../../slang-com-helper.h"
+
+#include "../../source/core/dictionary.h"
+#include "../../source/core/platform.h"
+#include "../../source/core/slang-io.h"
+#include "../../source/core/slang-random-generator.h"
+#include "../../source/core/token-reader.h"
+
+#include "../slang-test/os.h"
+
+using namespace Slang;
+
+// Allocation counting
+//
+// Every call to `operator new` is counted. On platforms where the compiler
+// library is bound to the `operator new` of the executable (as on Linux) this
+// includes the allocations made by the compiler. Elsewhere nothing inside of
+// `spCompile` is counted, and counts are reported as unavailable.
+
+static std::atomic<uint64_t> g_allocationCount(0);
+
+void* operator new(size_t size)
+{
+    g_allocationCount++;
+    if (void* ptr = malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+// Options
+
+struct Options
+{
+    char const* appName = "slang-bench";
+
+    // Directory holding the benchmark shaders
+    char const* benchmarkDir = "benchmarks/";
+
+    // Directory the generated benchmarks are written to before they are
+    // run (by default, `benchmarks/` next to the slang-bench executable)
+    char const* generatedDir = nullptr;
+
+    // Only run benchmarks with names that have this prefix
+    char const* benchmarkPrefix = nullptr;
+
+    // Number of timed compiles of each benchmark, and of untimed
+    // compiles done before them
+    int iterationCount = 10;
+    int warmupCount = 1;
+
+    // Write the results as JSON to this path
+    char const* outputPath = nullptr;
+
+    // Compare the results against the JSON at this path
+    char const* baselinePath = nullptr;
+
+    // How much slower (as a fraction) a time can be than the baseline
+    // before it is reported as a regression
+    double timeTolerance = 0.1;
+
+    // Only write the generated benchmarks to `generatedDir`, rather than running
+    bool shouldGenerate = false;
+
+    // Report the time of every phase, not just of the whole compile
+    bool shouldBeVerbose = false;
+};
+
+static Options g_options;
+
+static SlangResult parseOptions(int argc, char** argv)
+{
+    char const* const* argCursor = argv;
+    char const* const* argEnd = argv + argc;
+
+    if (argCursor != argEnd)
+    {
+        g_options.appName = *argCursor++;
+    }
+
+    while (argCursor != argEnd)
+    {
+        char const* arg = *argCursor++;
+        if (arg[0] != '-')
+        {
+            if (g_options.benchmarkPrefix)
+            {
+                fprintf(stderr, "error: unexpected argument '%s'\n", arg);
+                return SLANG_FAIL;
+            }
+            g_options.benchmarkPrefix = arg;
+            continue;
+        }
+
+        if (strcmp(arg, "-generate") == 0)
+        {
+            g_options.shouldGenerate = true;
+            continue;
+        }
+        else if (strcmp(arg, "-v") == 0)
+        {
+            g_options.shouldBeVerbose = true;
+            continue;
+        }
+
+        // All remaining options take an operand
+        if (argCursor == argEnd)
+        {
+            fprintf(stderr, "error: expected operand for '%s'\n", arg);
+            return SLANG_FAIL;
+        }
+        char const* operand = *argCursor++;
+
+        if (strcmp(arg, "-dir") == 0)
+        {
+            g_options.benchmarkDir = operand;
+        }
+        else if (strcmp(arg, "-generated-dir") == 0)
+        {
+            g_options.generatedDir = operand;
+        }
+        else if (strcmp(arg, "-iterations") == 0)
+        {
+            g_options.iterationCount = atoi(operand);
+            if (g_options.iterationCount <= 0)
+            {
+                fprintf(stderr, "error: expected a positive count for '%s', got '%s'\n", arg, operand);
+                return SLANG_FAIL;
+            }
+        }
+        else if (strcmp(arg, "-warmup") == 0)
+        {
+            g_options.warmupCount = atoi(operand);
+        }
+        else if (strcmp(arg, "-output") == 0)
+        {
+            g_options.outputPath = operand;
+        }
+        else if (strcmp(arg, "-baseline") == 0)
+        {
+            g_options.baselinePath = operand;
+        }
+        else if (strcmp(arg, "-tolerance") == 0)
+        {
+            g_options.timeTolerance = atof(operand);
+        }
+        else
+        {
+            fprintf(stderr, "unknown option '%s'\n", arg);
+            return SLANG_FAIL;
+        }
+    }
+    return SLANG_OK;
+}
+
+// Benchmarks
+//
+// A benchmark is a shader whose first line is a `//BENCH:` comment giving
+// the options to compile it with, e.g.:
+//
+//      //BENCH: -profile cs_5_0 -entry main -target hlsl
+//
+// A benchmark that is known to be slow (to keep track of a case the compiler
+// handles badly) uses `//BENCH_SLOW:` instead, and is only compiled once.
+//
+// Other files (such as headers the benchmarks include) are ignored.
+
+static const char kBenchPrefix[] = "//BENCH:";
+static const char kSlowBenchPrefix[] = "//BENCH_SLOW:";
+
+struct Benchmark
+{
+    String          name;       ///< Path relative to the benchmark directory
+    String          filePath;
+    List<String>    args;       ///< Arguments for `spProcessCommandLineArguments`, including the file
+    bool            isSlow = false;
+};
+
+static bool readBenchmark(String const& filePath, String const& name, Benchmark& outBenchmark)
+{
+    String text;
+    try
+    {
+        text = File::ReadAllText(filePath);
+    }
+    catch (const IOException&)
+    {
+        return false;
+    }
+
+    char const* prefix = nullptr;
+    if (text.StartsWith(kBenchPrefix))
+        prefix = kBenchPrefix;
+    else if (text.StartsWith(kSlowBenchPrefix))
+        prefix = kSlowBenchPrefix;
+    else
+        return false;
+
+    outBenchmark.name = name;
+    outBenchmark.filePath = filePath;
+    outBenchmark.isSlow = (prefix == kSlowBenchPrefix);
+    outBenchmark.args.Clear();
+    outBenchmark.args.Add(filePath);
+
+    char const* cursor = text.Buffer() + strlen(prefix);
+    for (;;)
+    {
+        while (*cursor == ' ' || *cursor == '\t')
+            cursor++;
+        if (*cursor == 0 || *cursor == '\r' || *cursor == '\n')
+            break;
+
+        char const* argBegin = cursor;
+        while (*cursor && *cursor != ' ' && *cursor != '\t' && *cursor != '\r' && *cursor != '\n')
+            cursor++;
+        outBenchmark.args.Add(String(argBegin, cursor));
+    }
+    return true;
+}
+
+static void gatherBenchmarks(String const& directoryPath, String const& namePrefix, List<Benchmark>& outBenchmarks)
+{
+    for (auto file : osFindFilesInDirectory(directoryPath))
+    {
+        String name = namePrefix + Path::GetFileName(file);
+        if (g_options.benchmarkPrefix && !name.StartsWith(g_options.benchmarkPrefix))
+            continue;
+
+        Benchmark benchmark;
+        if (readBenchmark(file, name, benchmark))
+        {
+            outBenchmarks.Add(benchmark);
+        }
+    }
+    for (auto subdir : osFindChildDirectories(directoryPath))
+    {
+        gatherBenchmarks(subdir, namePrefix + Path::GetFileName(subdir) + "/", outBenchmarks);
+    }
+}
+
+// Measurements
+
+typedef std::chrono::steady_clock Clock;
+
+static double getSecondsSince(Clock::time_point start)
+{
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    return elapsed.count();
+}
+
+// The spread of a set of measurements
+struct Distribution
+{
+    double median = 0;
+    double p10 = 0;
+    double p90 = 0;
+};
+
+static double getPercentile(List<double> const& sortedValues, double percentile)
+{
+    // Nearest rank
+    const int count = int(sortedValues.Count());
+    int rank = int(percentile / 100.0 * count + 0.5);
+    rank = (rank < 1) ? 1 : ((rank > count) ? count : rank);
+    return sortedValues[rank - 1];
+}
+
+static Distribution getDistribution(List<double> values)
+{
+    Distribution distribution;
+    if (values.Count() == 0)
+        return distribution;
+
+    values.Sort();
+    distribution.median = getPercentile(values, 50);
+    distribution.p10 = getPercentile(values, 10);
+    distribution.p90 = getPercentile(values, 90);
+    return distribution;
+}
+
+struct BenchmarkResult
+{
+    String          name;
+    bool            succeeded = false;
+
+    // Whether this is a compile, with per-phase times
+    bool            hasCompileStats = false;
+
+    // Times are in milliseconds
+    Distribution    totalMs;
+    double          phaseMs[SLANG_COMPILE_PHASE_COUNT_OF] = {};     ///< Median of each phase
+
+    bool            hasAllocationCount = false;
+    double          allocationCount = 0;                            ///< Median
+    double          irMemoryUsedBytes = 0;
+    double          tokenCount = 0;
+};
+
+static void diagnosticCallback(char const* message, void* userData)
+{
+    ((StringBuilder*)userData)->Append(message);
+}
+
+static BenchmarkResult runBenchmark(SlangSession* session, Benchmark const& benchmark)
+{
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.hasCompileStats = true;
+
+    List<char const*> argv;
+    for (auto const& arg : benchmark.args)
+    {
+        argv.Add(arg.Buffer());
+    }
+
+    List<double> totalMs;
+    List<double> phaseMs[SLANG_COMPILE_PHASE_COUNT_OF];
+    List<double> allocationCounts;
+
+    // A slow benchmark takes long enough that a single compile is representative
+    const int warmupCount = benchmark.isSlow ? 0 : g_options.warmupCount;
+    const int iterationCount = benchmark.isSlow ? 1 : g_options.iterationCount;
+
+    const int runCount = warmupCount + iterationCount;
+    for (int run = 0; run < runCount; ++run)
+    {
+        StringBuilder diagnostics;
+        SlangCompileRequest* request = spCreateCompileRequest(session);
+        spSetDiagnosticCallback(request, &diagnosticCallback, &diagnostics);
+
+        SlangResult res = spProcessCommandLineArguments(request, argv.Buffer(), int(argv.Count()));
+
+        const uint64_t startAllocationCount = g_allocationCount;
+        const Clock::time_point startTime = Clock::now();
+        if (SLANG_SUCCEEDED(res))
+        {
+            res = spCompile(request);
+        }
+        const double seconds = getSecondsSince(startTime);
+        const uint64_t allocationCount = g_allocationCount - startAllocationCount;
+
+        SlangCompileStats stats;
+        stats.structSize = sizeof(stats);
+        spGetCompileStats(request, &stats);
+        spDestroyCompileRequest(request);
+
+        if (SLANG_FAILED(res))
+        {
+            fprintf(stderr, "error: failed to compile benchmark '%s'\n%s", benchmark.name.Buffer(), diagnostics.Buffer());
+            return result;
+        }
+
+        if (run < warmupCount)
+            continue;
+
+        totalMs.Add(seconds * 1000.0);
+        for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+        {
+            phaseMs[ii].Add(stats.phaseSeconds[ii] * 1000.0);
+        }
+        allocationCounts.Add(double(allocationCount));
+        result.irMemoryUsedBytes = double(stats.irMemoryUsedBytes);
+        result.tokenCount = double(stats.tokenCount);
+    }
+
+    result.succeeded = true;
+    result.totalMs = getDistribution(totalMs);
+    for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+    {
+        result.phaseMs[ii] = getDistribution(phaseMs[ii]).median;
+    }
+    result.allocationCount = getDistribution(allocationCounts).median;
+    result.hasAllocationCount = result.allocationCount > 0;
+    return result;
+}
+
+// Creating a session (which loads the standard library) is measured as if
+// it was a benchmark of its own
+static BenchmarkResult runSessionBenchmark()
+{
+    BenchmarkResult result;
+    result.name = "(session)";
+
+    List<double> totalMs;
+    List<double> allocationCounts;
+
+    const int runCount = g_options.warmupCount + g_options.iterationCount;
+    for (int run = 0; run < runCount; ++run)
+    {
+        const uint64_t startAllocationCount = g_allocationCount;
+        const Clock::time_point startTime = Clock::now();
+
+        SlangSession* session = spCreateSession(nullptr);
+
+        const double seconds = getSecondsSince(startTime);
+        const uint64_t allocationCount = g_allocationCount - startAllocationCount;
+
+        spDestroySession(session);
+
+        if (run < g_options.warmupCount)
+            continue;
+
+        totalMs.Add(seconds * 1000.0);
+        allocationCounts.Add(double(allocationCount));
+    }
+
+    result.succeeded = true;
+    result.totalMs = getDistribution(totalMs);
+    result.allocationCount = getDistribution(allocationCounts).median;
+    result.hasAllocationCount = result.allocationCount > 0;
+    return result;
+}
+
+// Core benchmarks
+//
+// Benchmarks of the containers in `source/core` (with the standard library
+// as a point of reference), on inputs shaped like those the compiler uses
+// them for. Each returns false if its results are wrong.
+
+struct CoreBenchmark
+{
+    char const* name;
+    bool (*run)();
+};
+
+enum { kCoreKeyCount = 100000 };
+
+// Distinct even keys, so that odd keys always miss
+static List<int> g_intKeys;
+
+// Identifier-like keys
+static List<String> g_stringKeys;
+
+// Names as the mangler would produce them
+static List<String> g_mangledNames;
+
+static const char* const kCoreNames[] = { "x", "main", "float4", "position", "SV_Target", "computeLighting" };
+
+// Made (like a mangled name) from short length-prefixed fragments
+static String mangleName(int index)
+{
+    StringBuilder sb;
+    sb << "_S";
+    for (int j = 0; j < 2; j++)
+    {
+        const char* name = kCoreNames[(index + j) % SLANG_COUNT_OF(kCoreNames)];
+        sb << UInt32(strlen(name)) << name;
+    }
+    sb << "G" << index;
+    return sb.ProduceString();
+}
+
+static void initCoreBenchmarkKeys()
+{
+    if (g_intKeys.Count())
+        return;
+
+    DefaultRandomGenerator randGen(0x2310);
+
+    HashSet<int> seen;
+    while (int(g_intKeys.Count()) < kCoreKeyCount)
+    {
+        const int key = randGen.nextPositiveInt32() & ~1;
+        if (seen.Add(key))
+            g_intKeys.Add(key);
+    }
+
+    for (int i = 0; i < kCoreKeyCount / 4; i++)
+    {
+        StringBuilder sb;
+        sb << "identifier_" << i << "_" << randGen.nextInt32UpTo(1000);
+        g_stringKeys.Add(sb.ProduceString());
+    }
+
+    for (int i = 0; i < kCoreKeyCount; i++)
+    {
+        g_mangledNames.Add(mangleName(i));
+    }
+}
+
+// Adapts `Dictionary` to the subset of the `std::unordered_map` interface used below
+struct DictionaryAdapter
+{
+    struct Entry { int second; };
+
+    int& operator[](int key)
+    {
+        if (auto value = dict.TryGetValue(key))
+            return *value;
+        dict.Add(key, 0);
+        return *dict.TryGetValue(key);
+    }
+
+    Entry* find(int key)
+    {
+        if (auto value = dict.TryGetValue(key))
+        {
+            entry.second = *value;
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    Entry* end() { return nullptr; }
+
+    Dictionary<int, int> dict;
+    Entry entry;
+};
+
+// Inserts every key, then looks each of them up, then looks up a missing key for each
+template <typename MapType>
+static bool runIntKeyBenchmark()
+{
+    MapType map;
+    const int count = int(g_intKeys.Count());
+    for (int i = 0; i < count; i++)
+    {
+        map[g_intKeys[i]] = i;
+    }
+
+    int64_t sum = 0;
+    for (int i = 0; i < count; i++)
+    {
+        sum += map.find(g_intKeys[i])->second;
+    }
+
+    int missCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        missCount += (map.find(g_intKeys[i] + 1) == map.end()) ? 1 : 0;
+    }
+    return sum == int64_t(count) * (count - 1) / 2 && missCount == count;
+}
+
+// Inserts every key, then looks each of them up by slice (as the lexer does)
+static bool runStringKeyBenchmark()
+{
+    Dictionary<String, int> dict;
+    const int count = int(g_stringKeys.Count());
+    for (int i = 0; i < count; i++)
+    {
+        dict.Add(g_stringKeys[i], i);
+    }
+
+    int64_t sum = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int value = 0;
+        dict.TryGetValue(g_stringKeys[i].getUnownedSlice(), value);
+        sum += value;
+    }
+    return sum == int64_t(count) * (count - 1) / 2;
+}
+
+// A builder for each of many names, as when mangling
+static bool runStringMangleBenchmark()
+{
+    List<String> names;
+    for (int i = 0; i < kCoreKeyCount; i++)
+    {
+        names.Add(mangleName(i));
+    }
+    return names[kCoreKeyCount - 1] == g_mangledNames[kCoreKeyCount - 1];
+}
+
+// Many short tokens appended to one large builder, along with short-lived
+// strings for the names being emitted, as when emitting source
+static bool runStringEmitBenchmark()
+{
+    StringBuilder code;
+    for (int i = 0; i < kCoreKeyCount; i++)
+    {
+        String name = kCoreNames[i % SLANG_COUNT_OF(kCoreNames)];
+        String uniqueName = name + "_" + String(i);
+        code << "    " << uniqueName << " = " << String(g_mangledNames[i].SubString(0, 6)) << "(" << i << ");\n";
+    }
+    return code.Length() > UInt(kCoreKeyCount);
+}
+
+static const CoreBenchmark kCoreBenchmarks[] =
+{
+    { "(core) dictionary-int-keys",         &runIntKeyBenchmark<DictionaryAdapter> },
+    { "(core) unordered-map-int-keys",      &runIntKeyBenchmark<std::unordered_map<int, int>> },
+    { "(core) dictionary-string-keys",      &runStringKeyBenchmark },
+    { "(core) string-mangle",               &runStringMangleBenchmark },
+    { "(core) string-emit",                 &runStringEmitBenchmark },
+};
+
+static BenchmarkResult runCoreBenchmark(CoreBenchmark const& benchmark)
+{
+    BenchmarkResult result;
+    result.name = benchmark.name;
+
+    initCoreBenchmarkKeys();
+
+    List<double> totalMs;
+    List<double> allocationCounts;
+
+    const int runCount = g_options.warmupCount + g_options.iterationCount;
+    for (int run = 0; run < runCount; ++run)
+    {
+        const uint64_t startAllocationCount = g_allocationCount;
+        const Clock::time_point startTime = Clock::now();
+
+        const bool succeeded = benchmark.run();
+
+        const double seconds = getSecondsSince(startTime);
+        const uint64_t allocationCount = g_allocationCount - startAllocationCount;
+
+        if (!succeeded)
+        {
+            fprintf(stderr, "error: benchmark '%s' produced incorrect results\n", benchmark.name);
+            return result;
+        }
+
+        if (run < g_options.warmupCount)
+            continue;
+
+        totalMs.Add(seconds * 1000.0);
+        allocationCounts.Add(double(allocationCount));
+    }
+
+    result.succeeded = true;
+    result.totalMs = getDistribution(totalMs);
+    result.allocationCount = getDistribution(allocationCounts).median;
+    result.hasAllocationCount = true;
+    return result;
+}
+
+// Reporting
+
+static void printResults(List<BenchmarkResult> const& results)
+{
+    printf("%-40s %10s %10s %10s %12s\n", "benchmark", "median", "p10", "p90", "allocations");
+    for (auto const& result : results)
+    {
+        if (!result.succeeded)
+        {
+            printf("%-40s %10s\n", result.name.Buffer(), "failed");
+            continue;
+        }
+
+        char allocationText[32] = "-";
+        if (result.hasAllocationCount)
+        {
+            sprintf(allocationText, "%.0f", result.allocationCount);
+        }
+
+        printf("%-40s %8.2fms %8.2fms %8.2fms %12s\n",
+            result.name.Buffer(),
+            result.totalMs.median,
+            result.totalMs.p10,
+            result.totalMs.p90,
+            allocationText);
+
+        if (g_options.shouldBeVerbose && result.hasCompileStats)
+        {
+            for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+            {
+                printf("    %-36s %8.2fms\n", spGetCompilePhaseName(SlangCompilePhase(ii)), result.phaseMs[ii]);
+            }
+
+            // Parsing throughput, as the number of tokens parsed each millisecond
+            const double parseMs = result.phaseMs[SLANG_COMPILE_PHASE_PARSE];
+            if (parseMs > 0)
+            {
+                printf("    %-36s %8.0f tokens/ms\n", "parse throughput", result.tokenCount / parseMs);
+            }
+        }
+    }
+}
+
+static void writeResultsJSON(List<BenchmarkResult> const& results, StringBuilder& sb)
+{
+    char buffer[64];
+
+    sb << "{\n";
+    bool isFirst = true;
+    for (auto const& result : results)
+    {
+        if (!result.succeeded)
+            continue;
+
+        if (!isFirst) sb << ",\n";
+        isFirst = false;
+
+        sb << "    \"" << result.name << "\": {\n";
+
+        sprintf(buffer, "{ \"median\": %.4f, \"p10\": %.4f, \"p90\": %.4f }",
+            result.totalMs.median, result.totalMs.p10, result.totalMs.p90);
+        sb << "        \"totalMs\": " << buffer;
+
+        if (result.hasCompileStats)
+        {
+            sb << ",\n        \"phaseMs\": {";
+            for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+            {
+                sprintf(buffer, "%s\n            \"%s\": %.4f", (ii ? "," : ""),
+                    spGetCompilePhaseName(SlangCompilePhase(ii)), result.phaseMs[ii]);
+                sb << buffer;
+            }
+            sb << "\n        }";
+
+            sprintf(buffer, "%.0f", result.irMemoryUsedBytes);
+            sb << ",\n        \"irMemoryUsedBytes\": " << buffer;
+        }
+
+        if (result.hasAllocationCount)
+        {
+            sprintf(buffer, "%.0f", result.allocationCount);
+            sb << ",\n        \"allocations\": " << buffer;
+        }
+        sb << "\n    }";
+    }
+    sb << "\n}\n";
+}
+
+// Baselines
+//
+// A baseline is the JSON written by `-output`. For comparison it is read
+// back as a flat set of numbers, keyed by their path through the JSON
+// objects, e.g. `large-module.slang/totalMs/median`.
+
+static void readJSONValue(TokenReader& reader, String const& key, Dictionary<String, double>& outValues)
+{
+    Token token = reader.ReadToken();
+    switch (token.Type)
+    {
+        case TokenType::LBrace:
+        {
+            if (reader.LookAhead("}"))
+            {
+                reader.ReadToken();
+                return;
+            }
+            for (;;)
+            {
+                String name = reader.ReadStringLiteral();
+                reader.Read(":");
+                readJSONValue(reader, key.Length() ? (key + "/" + name) : name, outValues);
+
+                if (!reader.LookAhead(","))
+                    break;
+                reader.ReadToken();
+            }
+            reader.Read("}");
+            return;
+        }
+        case TokenType::LBracket:
+        {
+            if (reader.LookAhead("]"))
+            {
+                reader.ReadToken();
+                return;
+            }
+            for (int index = 0; ; ++index)
+            {
+                readJSONValue(reader, key + "/" + String(index), outValues);
+
+                if (!reader.LookAhead(","))
+                    break;
+                reader.ReadToken();
+            }
+            reader.Read("]");
+            return;
+        }
+        case TokenType::IntLiteral:
+        case TokenType::DoubleLiteral:
+            outValues[key] = StringToDouble(token.Content);
+            return;
+        case TokenType::OpSub:
+            outValues[key] = -StringToDouble(reader.ReadToken().Content);
+            return;
+        case TokenType::StringLiteral:
+        case TokenType::Identifier:
+            // Strings, `true`, `false` and `null` are not compared
+            return;
+        default:
+            throw TextFormatException("unexpected '" + token.Content + "' in JSON");
+    }
+}
+
+static SlangResult readBaseline(char const* path, Dictionary<String, double>& outValues)
+{
+    try
+    {
+        TokenReader reader(File::ReadAllText(path));
+        readJSONValue(reader, "", outValues);
+    }
+    catch (Exception& e)
+    {
+        fprintf(stderr, "error: unable to read baseline '%s': %s\n", path, e.Message.Buffer());
+        return SLANG_FAIL;
+    }
+    return SLANG_OK;
+}
+
+// Time differences smaller than this are never reported, as they are
+// within the noise of a single measurement
+static const double kMinTimeDifferenceMs = 0.5;
+
+// How much (as a fraction) a count can increase before it is reported.
+// Counts are mostly deterministic, so this is kept small.
+static const double kCountTolerance = 0.01;
+
+static int g_regressionCount = 0;
+
+static void compareToBaseline(
+    Dictionary<String, double> const&   baseline,
+    String const&                       key,
+    double                              value,
+    bool                                isTime)
+{
+    double baselineValue = 0;
+    if (!baseline.TryGetValue(key, baselineValue))
+        return;
+
+    const double tolerance = isTime ? g_options.timeTolerance : kCountTolerance;
+    const double minDifference = isTime ? kMinTimeDifferenceMs : 0.0;
+    const double difference = value - baselineValue;
+
+    if (difference > minDifference && value > baselineValue * (1.0 + tolerance))
+    {
+        g_regressionCount++;
+        printf("regression: %s: %.2f -> %.2f (+%.1f%%)\n", key.Buffer(), baselineValue, value,
+            baselineValue > 0 ? 100.0 * difference / baselineValue : 100.0);
+    }
+    else if (-difference > minDifference && value < baselineValue * (1.0 - tolerance))
+    {
+        printf("improvement: %s: %.2f -> %.2f (%.1f%%)\n", key.Buffer(), baselineValue, value,
+            100.0 * difference / baselineValue);
+    }
+}
+
+static void compareToBaseline(Dictionary<String, double> const& baseline, List<BenchmarkResult> const& results)
+{
+    for (auto const& result : results)
+    {
+        if (!result.succeeded)
+            continue;
+
+        compareToBaseline(baseline, result.name + "/totalMs/median", result.totalMs.median, true);
+        if (result.hasCompileStats)
+        {
+            for (int ii = 0; ii < SLANG_COMPILE_PHASE_COUNT_OF; ++ii)
+            {
+                String key = result.name + "/phaseMs/" + spGetCompilePhaseName(SlangCompilePhase(ii));
+                compareToBaseline(baseline, key, result.phaseMs[ii], true);
+            }
+        }
+        if (result.hasAllocationCount)
+        {
+            compareToBaseline(baseline, result.name + "/allocations", result.allocationCount, false);
+        }
+    }
+}
+
+// Generated benchmarks
+//
+// The benchmarks that need large inputs are generated by this tool, so that
+// they can be resized or extended in one place. They are written out anew at
+// the start of each run (rather than being kept with the other benchmarks),
+// so they always match the version of slang-bench that runs them.
+
+static void writeGeneratedFile(String const& path, StringBuilder const& sb)
+{
+    File::WriteAllText(path, sb);
+    if (g_options.shouldGenerate)
+        printf("wrote %s\n", path.Buffer());
+}
+
+static void writeGeneratedHeader(StringBuilder& sb, char const* benchOptions, char const* description, bool isSlow = false)
+{
+    sb << (isSlow ? kSlowBenchPrefix : kBenchPrefix) << " " << benchOptions << "\n";
+    sb << "\n";
+    sb << "// Generated by `slang-bench -generate`: " << description << "\n";
+    sb << "\n";
+}
+
+// A single large module: many structs and functions, all reachable from the entry point
+static void generateLargeModule(String const& dir)
+{
+    enum { kFuncCount = 300 };
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, "-profile cs_5_0 -entry main -target hlsl", "a single module with many types and functions.");
+
+    for (int ii = 0; ii < kFuncCount; ++ii)
+    {
+        sb << "struct Data" << ii << "\n{\n";
+        sb << "    float4 scale;\n";
+        sb << "    float4 bias;\n";
+        sb << "    int count;\n";
+        sb << "};\n\n";
+
+        sb << "float4 func" << ii << "(Data" << ii << " data, float4 x)\n{\n";
+        sb << "    float4 result = data.scale * x + data.bias;\n";
+        sb << "    for (int i = 0; i < data.count; i++)\n";
+        sb << "    {\n";
+        sb << "        result = result * 0.5 + x.yzwx;\n";
+        sb << "    }\n";
+        if (ii > 0)
+        {
+            sb << "    Data" << (ii - 1) << " next;\n";
+            sb << "    next.scale = data.bias.wzyx;\n";
+            sb << "    next.bias = result;\n";
+            sb << "    next.count = data.count + " << (ii % 7) << ";\n";
+            sb << "    return func" << (ii - 1) << "(next, result);\n";
+        }
+        else
+        {
+            sb << "    return result;\n";
+        }
+        sb << "}\n\n";
+    }
+
+    sb << "RWStructuredBuffer<float4> output;\n\n";
+    sb << "[numthreads(64, 1, 1)]\n";
+    sb << "void main(uint3 tid : SV_DispatchThreadID)\n{\n";
+    sb << "    Data" << (kFuncCount - 1) << " data;\n";
+    sb << "    data.scale = float4(tid, 1.0);\n";
+    sb << "    data.bias = float4(1.0, 2.0, 3.0, 4.0);\n";
+    sb << "    data.count = int(tid.x & 3);\n";
+    sb << "    output[tid.x] = func" << (kFuncCount - 1) << "(data, output[tid.x]);\n";
+    sb << "}\n";
+
+    writeGeneratedFile(Path::Combine(dir, "large-module.slang"), sb);
+}
+
+// Generic types nested to increasing depth, each used through a generic function
+static void generateGenericChain(String const& dir, char const* fileName, bool isSlow, int maxDepth)
+{
+    enum { kWrapperKinds = 4 };
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, "-profile cs_5_0 -entry main -target hlsl", "deep chains of generic specialization.", isSlow);
+
+    sb << "interface IValue\n{\n    float4 getValue(float4 x);\n};\n\n";
+    sb << "struct Leaf : IValue\n{\n    float4 value;\n    float4 getValue(float4 x) { return value * x; }\n};\n\n";
+
+    for (int kind = 0; kind < kWrapperKinds; ++kind)
+    {
+        sb << "struct Wrap" << kind << "<T : IValue> : IValue\n{\n";
+        sb << "    T inner;\n";
+        sb << "    float4 scale;\n";
+        sb << "    float4 getValue(float4 x) { return inner.getValue(x * scale) + float4(" << kind << ".0); }\n";
+        sb << "};\n\n";
+    }
+
+    sb << "float4 evaluate<T : IValue>(T value, float4 x)\n{\n    return value.getValue(x);\n}\n\n";
+
+    sb << "RWStructuredBuffer<float4> output;\n\n";
+    sb << "[numthreads(64, 1, 1)]\n";
+    sb << "void main(uint3 tid : SV_DispatchThreadID)\n{\n";
+    sb << "    float4 x = output[tid.x];\n";
+    sb << "    float4 result = float4(0.0);\n";
+    for (int depth = 1; depth <= maxDepth; ++depth)
+    {
+        // e.g., `Wrap2<Wrap1<Wrap0<Leaf> > >`
+        StringBuilder type;
+        for (int ii = depth - 1; ii >= 0; --ii)
+        {
+            type << "Wrap" << (ii % kWrapperKinds) << "<";
+        }
+        type << "Leaf";
+        for (int ii = 0; ii < depth; ++ii)
+        {
+            type << " >";
+        }
+
+        sb << "    " << type << " value" << depth << ";\n";
+        sb << "    result += evaluate<" << type << " >(value" << depth << ", x);\n";
+    }
+    sb << "    output[tid.x] = result;\n";
+    sb << "}\n";
+
+    writeGeneratedFile(Path::Combine(dir, fileName), sb);
+}
+
+// HLSL that includes many headers, each of which includes others behind include guards
+static void generateIncludeHeavy(String const& dir)
+{
+    enum { kHeaderCount = 48 };
+
+    String headerDir = Path::Combine(dir, "include-heavy");
+    Path::CreateDir(headerDir);
+
+    for (int ii = 0; ii < kHeaderCount; ++ii)
+    {
+        StringBuilder sb;
+        sb << "// Generated by `slang-bench -generate`: a header for `include-heavy.hlsl`.\n\n";
+        sb << "#ifndef COMMON_" << ii << "_H\n";
+        sb << "#define COMMON_" << ii << "_H\n\n";
+        for (int dep = ii - 2; dep < ii; ++dep)
+        {
+            if (dep >= 0)
+                sb << "#include \"common-" << dep << ".h\"\n";
+        }
+        sb << "\n";
+        sb << "#define SCALE_" << ii << "(x) ((x) * " << (ii + 1) << ".0 + BIAS_" << ii << ")\n";
+        sb << "#define BIAS_" << ii << " " << ii << ".5\n\n";
+        sb << "#if defined(USE_FAST_PATH) && " << ii << " % 2 == 0\n";
+        sb << "float4 common" << ii << "(float4 x) { return SCALE_" << ii << "(x); }\n";
+        sb << "#else\n";
+        sb << "float4 common" << ii << "(float4 x)\n{\n";
+        sb << "    float4 y = SCALE_" << ii << "(x);\n";
+        if (ii > 0)
+            sb << "    y += common" << (ii - 1) << "(x.yzwx);\n";
+        sb << "    return y;\n";
+        sb << "}\n";
+        sb << "#endif\n\n";
+        sb << "#endif\n";
+
+        StringBuilder name;
+        name << "common-" << ii << ".h";
+        writeGeneratedFile(Path::Combine(headerDir, name), sb);
+    }
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, "-profile ps_5_0 -entry main -target hlsl", "HLSL that includes many headers.");
+    for (int ii = 0; ii < kHeaderCount; ++ii)
+    {
+        sb << "#include \"include-heavy/common-" << ii << ".h\"\n";
+    }
+    sb << "\n";
+    sb << "float4 main(float4 position : SV_Position) : SV_Target\n{\n";
+    sb << "    return common" << (kHeaderCount - 1) << "(position);\n";
+    sb << "}\n";
+
+    writeGeneratedFile(Path::Combine(dir, "include-heavy.hlsl"), sb);
+}
+
+// A library with many entry points that share helper functions and resources
+static void generateManyEntryPoints(String const& dir)
+{
+    enum { kEntryPointCount = 32, kHelperCount = 8 };
+
+    StringBuilder options;
+    options << "-target hlsl";
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        options << " -profile cs_5_0 -entry kernel" << ii;
+    }
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, options.Buffer(), "many entry points sharing code and resources.");
+
+    sb << "RWStructuredBuffer<float4> output;\n";
+    sb << "StructuredBuffer<float4> input;\n";
+    sb << "Texture2D<float4> lookup;\n";
+    sb << "SamplerState lookupSampler;\n\n";
+
+    for (int ii = 0; ii < kHelperCount; ++ii)
+    {
+        sb << "float4 helper" << ii << "(float4 x, uint index)\n{\n";
+        sb << "    float4 y = x * " << (ii + 1) << ".0 + input[index];\n";
+        if (ii > 0)
+            sb << "    y += helper" << (ii - 1) << "(y.wzyx, index + 1);\n";
+        sb << "    return y;\n";
+        sb << "}\n\n";
+    }
+
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        sb << "[numthreads(" << ((ii % 4) + 1) * 16 << ", 1, 1)]\n";
+        sb << "void kernel" << ii << "(uint3 tid : SV_DispatchThreadID)\n{\n";
+        sb << "    float4 x = lookup.SampleLevel(lookupSampler, float2(tid.xy) / " << (ii + 1) << ".0, 0.0);\n";
+        sb << "    output[tid.x] = helper" << (ii % kHelperCount) << "(x, tid.x);\n";
+        sb << "}\n\n";
+    }
+
+    writeGeneratedFile(Path::Combine(dir, "many-entry-points.slang"), sb);
+}
+
+// A large amount of HLSL for the parser: many functions made of dense
+// statements and expressions (casts, calls, swizzles, and constructs the
+// parser has to look ahead to disambiguate), of which only a few are used
+static void generateParseHeavy(String const& dir)
+{
+    enum { kFuncCount = 200 };
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, "-profile cs_5_0 -entry main -target hlsl", "a large amount of HLSL to parse.");
+
+    sb << "cbuffer Constants\n{\n";
+    sb << "    float4x4 transform;\n";
+    sb << "    float4 tint;\n";
+    sb << "    uint count;\n";
+    sb << "};\n\n";
+    sb << "RWStructuredBuffer<float4> output;\n";
+    sb << "Texture2D<float4> source;\n";
+    sb << "SamplerState sourceSampler;\n\n";
+
+    for (int ii = 0; ii < kFuncCount; ++ii)
+    {
+        sb << "struct Params" << ii << "\n{\n";
+        sb << "    float4 a;\n";
+        sb << "    float3 b[4];\n";
+        sb << "    int2 c;\n";
+        sb << "};\n\n";
+
+        sb << "float4 process" << ii << "(in Params" << ii << " p, float2 uv, inout float weight)\n{\n";
+        sb << "    float4 result = (float4) 0;\n";
+        sb << "    const float scale = (float)(p.c.x + " << ii << ") * 0.5f;\n";
+        sb << "    [unroll] for (int i = 0; i < 4; ++i)\n";
+        sb << "    {\n";
+        sb << "        float3 v = p.b[i] * scale + float3(uv.xy, (float) i);\n";
+        sb << "        result.xyz += (v.x < v.y) ? v.zyx : -v.xzy;\n";
+        sb << "        result.w = max(result.w, dot(v, v) / (1.0f + weight));\n";
+        sb << "    }\n";
+        sb << "    if (p.c.y > 0 && !(p.a.x >= p.a.y || p.a.z != p.a.w))\n";
+        sb << "    {\n";
+        sb << "        result = mul(transform, result) * tint + source.SampleLevel(sourceSampler, uv * (float) p.c.y, 0.0);\n";
+        sb << "    }\n";
+        sb << "    else\n";
+        sb << "    {\n";
+        sb << "        result.xy = (float2) ((int2) result.xy & p.c) << 1;\n";
+        sb << "    }\n";
+        sb << "    weight += (result.x + result.y) * " << (ii + 1) << ".0 / (float) count;\n";
+        sb << "    return result;\n";
+        sb << "}\n\n";
+    }
+
+    sb << "[numthreads(64, 1, 1)]\n";
+    sb << "void main(uint3 tid : SV_DispatchThreadID)\n{\n";
+    sb << "    Params0 p;\n";
+    sb << "    p.a = output[tid.x];\n";
+    sb << "    p.b[0] = p.b[1] = p.b[2] = p.b[3] = p.a.xyz;\n";
+    sb << "    p.c = int2(tid.xy);\n";
+    sb << "    float weight = 1.0;\n";
+    sb << "    output[tid.x] = process0(p, float2(tid.xy) / 64.0, weight) * weight;\n";
+    sb << "}\n";
+
+    writeGeneratedFile(Path::Combine(dir, "parse-heavy.hlsl"), sb);
+}
+
+// A shader that uses a large number of shader parameters of many kinds
+static void generateBindingHeavy(String const& dir)
+{
+    enum { kConstantBufferCount = 32, kTextureCount = 64, kBufferCount = 32, kMaterialCount = 16 };
+
+    StringBuilder sb;
+    writeGeneratedHeader(sb, "-profile ps_5_0 -entry main -target hlsl", "a shader with many parameters to bind.");
+
+    sb << "struct Material\n{\n";
+    sb << "    Texture2D albedo;\n";
+    sb << "    Texture2D normal;\n";
+    sb << "    SamplerState sampler;\n";
+    sb << "    float4 tint;\n";
+    sb << "};\n\n";
+
+    for (int ii = 0; ii < kConstantBufferCount; ++ii)
+    {
+        sb << "cbuffer Constants" << ii << "\n{\n";
+        sb << "    float4x4 transform" << ii << ";\n";
+        sb << "    float4 color" << ii << ";\n";
+        sb << "};\n\n";
+    }
+    for (int ii = 0; ii < kTextureCount; ++ii)
+    {
+        sb << "Texture2D texture" << ii << ";\n";
+    }
+    sb << "\n";
+    for (int ii = 0; ii < kBufferCount; ++ii)
+    {
+        sb << "StructuredBuffer<float4> buffer" << ii << ";\n";
+    }
+    sb << "\n";
+    for (int ii = 0; ii < kMaterialCount; ++ii)
+    {
+        sb << "ParameterBlock<Material> material" << ii << ";\n";
+    }
+    sb << "\nSamplerState defaultSampler;\n\n";
+
+    sb << "float4 main(float4 position : SV_Position, float2 uv : UV) : SV_Target\n{\n";
+    sb << "    float4 result = float4(0.0);\n";
+    for (int ii = 0; ii < kConstantBufferCount; ++ii)
+    {
+        sb << "    result += mul(transform" << ii << ", position) * color" << ii << ";\n";
+    }
+    for (int ii = 0; ii < kTextureCount; ++ii)
+    {
+        sb << "    result += texture" << ii << ".Sample(defaultSampler, uv);\n";
+    }
+    for (int ii = 0; ii < kBufferCount; ++ii)
+    {
+        sb << "    result += buffer" << ii << "[" << ii << "];\n";
+    }
+    for (int ii = 0; ii < kMaterialCount; ++ii)
+    {
+        sb << "    result += material" << ii << ".albedo.Sample(material" << ii << ".sampler, uv) * material" << ii << ".tint;\n";
+    }
+    sb << "    return result;\n";
+    sb << "}\n";
+
+    writeGeneratedFile(Path::Combine(dir, "binding-heavy.slang"), sb);
+}
+
+static SlangResult generateBenchmarks(String const& dir)
+{
+    try
+    {
+        Path::CreateDir(dir);
+
+        generateLargeModule(dir);
+        generateGenericChain(dir, "generic-chain.slang", false, 10);
+        generateGenericChain(dir, "generic-chain-deep.slang", true, 14);
+        generateIncludeHeavy(dir);
+        generateManyEntryPoints(dir);
+        generateBindingHeavy(dir);
+        generateParseHeavy(dir);
+    }
+    catch (Exception& e)
+    {
+        fprintf(stderr, "error: unable to generate benchmarks: %s\n", e.Message.Buffer());
+        return SLANG_FAIL;
+    }
+    return SLANG_OK;
+}
+
+static SlangResult getGeneratedDir(String& outDir)
+{
+    if (g_options.generatedDir)
+    {
+        outDir = g_options.generatedDir;
+    }
+    else
+    {
+        String exePath = SharedLibrary::getPathContaining((void const*)&getGeneratedDir);
+        if (exePath.Length() == 0)
+        {
+            fprintf(stderr, "error: unable to find the directory of '%s', use -generated-dir\n", g_options.appName);
+            return SLANG_FAIL;
+        }
+        outDir = Path::Combine(Path::GetDirectoryName(exePath), "benchmarks");
+    }
+
+    // Files found in a directory are named by appending to its path
+    if (!outDir.EndsWith("/") && !outDir.EndsWith("\\"))
+        outDir = outDir + "/";
+    return SLANG_OK;
+}
+
+//
+
+static SlangResult innerMain(int argc, char** argv)
+{
+    SLANG_RETURN_ON_FAIL(parseOptions(argc, argv));
+
+    String generatedDir;
+    SLANG_RETURN_ON_FAIL(getGeneratedDir(generatedDir));
+    SLANG_RETURN_ON_FAIL(generateBenchmarks(generatedDir));
+    if (g_options.shouldGenerate)
+    {
+        return SLANG_OK;
+    }
+
+    Dictionary<String, double> baseline;
+    if (g_options.baselinePath)
+    {
+        SLANG_RETURN_ON_FAIL(readBaseline(g_options.baselinePath, baseline));
+    }
+
+    List<Benchmark> benchmarks;
+    gatherBenchmarks(g_options.benchmarkDir, "", benchmarks);
+    gatherBenchmarks(generatedDir, "", benchmarks);
+    benchmarks.Sort([](Benchmark const& a, Benchmark const& b) { return a.name < b.name; });
+
+    List<BenchmarkResult> results;
+    if (!g_options.benchmarkPrefix)
+    {
+        results.Add(runSessionBenchmark());
+    }
+
+    bool allSucceeded = true;
+    for (auto const& benchmark : kCoreBenchmarks)
+    {
+        if (g_options.benchmarkPrefix && !String(benchmark.name).StartsWith(g_options.benchmarkPrefix))
+            continue;
+
+        BenchmarkResult result = runCoreBenchmark(benchmark);
+        allSucceeded = allSucceeded && result.succeeded;
+        results.Add(result);
+    }
+
+    if (benchmarks.Count() == 0 && results.Count() == 0)
+    {
+        fprintf(stderr, "error: no benchmarks found in '%s' or '%s'\n", g_options.benchmarkDir, generatedDir.Buffer());
+        return SLANG_FAIL;
+    }
+
+    SlangSession* session = spCreateSession(nullptr);
+    for (auto const& benchmark : benchmarks)
+    {
+        BenchmarkResult result = runBenchmark(session, benchmark);
+        allSucceeded = allSucceeded && result.succeeded;
+        results.Add(result);
+    }
+    spDestroySession(session);
+
+    printResults(results);
+
+    if (g_options.outputPath)
+    {
+        StringBuilder sb;
+        writeResultsJSON(results, sb);
+        try
+        {
+            File::WriteAllText(g_options.outputPath, sb);
+        }
+        catch (const IOException&)
+        {
+            fprintf(stderr, "error: unable to write '%s'\n", g_options.outputPath);
+            return SLANG_FAIL;
+        }
+    }
+
+    if (g_options.baselinePath)
+    {
+        compareToBaseline(baseline, results);
+        if (g_regressionCount)
+        {
+            printf("%d regression(s) against '%s'\n", g_regressionCount, g_options.baselinePath);
+            return SLANG_FAIL;
+        }
+    }
+
+    return allSucceeded ? SLANG_OK : SLANG_FAIL;
+}
+
+int main(int argc, char** argv)
+{
+    SlangResult res = innerMain(argc, argv);
+    return SLANG_FAILED(res) ? 1 : 0;
+}
@@ -0,0 +1,19 @@
+// slang-reflection-json.h
+#ifndef SLANG_REFLECTION_JSON_H
+#define SLANG_REFLECTION_JSON_H
+
+#include <slang.h>
+
+// Writing of the reflection information for a compile request as JSON. This
+// is the output of `slang-reflection-test`, and is shared with `slang-test`
+// so that it can run reflection tests without spawning a process.
+
+typedef void (*ReflectionJSONWriteCallback)(char const* begin, char const* end, void* userData);
+
+// Write the JSON for `reflection`, passing it to `writeCallback` in pieces
+void emitReflectionJSON(
+    SlangReflection*            reflection,
+    ReflectionJSONWriteCallback writeCallback,
+    void*                       userData);
+
+#endif
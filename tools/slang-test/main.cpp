@@ -11,8 +11,12 @@ using namespace Slang;
 
 #include "os.h"
 #include "render-api-util.h"
+#include "spirv-disassembler.h"
 #include "test-context.h"
 
+#include "../slang-reflection-test/slang-reflection-json.h"
+#include "../../source/slangc/slangc-driver.h"
+
 #define STB_IMAGE_IMPLEMENTATION
 #include "external/stb/stb_image.h"
 
@@ -28,6 +32,11 @@ using namespace Slang;
 #include <stdlib.h>
 #include <stdarg.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 // A category that a test can be tagged with
 struct TestCategory
 {
@@ -101,6 +110,14 @@ struct Options
     // kind of output to generate
     TestOutputMode outputMode = TestOutputMode::Default;
 
+    // Number of threads to run test files on. Results are
+    // still reported in the same order as for a single thread.
+    int workerCount = 1;
+
+    // Run `slangc` and `slang-reflection-test` as separate processes,
+    // rather than running the compiler in-process on a shared session
+    bool shouldSpawnTools = false;
+
     // Only run tests that match one of the given categories
     Dictionary<TestCategory*, TestCategory*> includeCategories;
 
@@ -175,6 +192,25 @@ Result parseOptions(int* argc, char** argv)
         {
             g_options.shouldBeVerbose = true;
         }
+        else if( strcmp(arg, "-j") == 0 )
+        {
+            if( argCursor == argEnd )
+            {
+                fprintf(stderr, "error: expected operand for '%s'\n", arg);
+                return SLANG_FAIL;
+            }
+            const char* countText = *argCursor++;
+            g_options.workerCount = atoi(countText);
+            if( g_options.workerCount <= 0 )
+            {
+                fprintf(stderr, "error: expected a positive worker count for '%s', got '%s'\n", arg, countText);
+                return SLANG_FAIL;
+            }
+        }
+        else if( strcmp(arg, "-spawn") == 0 )
+        {
+            g_options.shouldSpawnTools = true;
+        }
         else if( strcmp(arg, "-generate-hlsl-baselines") == 0 )
         {
             g_options.generateHLSLBaselines = true;
@@ -647,13 +683,11 @@ OSError spawnAndWait(TestContext* context, const String& testPath, OSProcessSpaw
     return err;
 }
 
-String getOutput(OSProcessSpawner& spawner)
+String getOutput(
+    OSProcessSpawner::ResultCode    resultCode,
+    String const&                   standardOuptut,
+    String const&                   standardError)
 {
-    OSProcessSpawner::ResultCode resultCode = spawner.getResultCode();
-
-    String standardOuptut = spawner.getStandardOutput();
-    String standardError = spawner.getStandardError();
-
     // We construct a single output string that captures the results
     StringBuilder actualOutputBuilder;
     actualOutputBuilder.Append("result code = ");
@@ -667,6 +701,167 @@ String getOutput(OSProcessSpawner& spawner)
     return actualOutputBuilder.ProduceString();
 }
 
+String getOutput(OSProcessSpawner& spawner)
+{
+    return getOutput(spawner.getResultCode(), spawner.getStandardOutput(), spawner.getStandardError());
+}
+
+// The tools that tests can run either in a separate process, or in-process
+// on the session of the `TestContext` (when it has one).
+enum class TestTool
+{
+    Slangc,
+    ReflectionTest,
+};
+
+static char const* getTestToolName(TestTool tool)
+{
+    switch (tool)
+    {
+        case TestTool::Slangc:          return "slangc";
+        case TestTool::ReflectionTest:  return "slang-reflection-test";
+    }
+    return "";
+}
+
+static void appendDiagnostic(char const* message, void* userData)
+{
+    ((StringBuilder*)userData)->Append(message);
+}
+
+static void appendStandardOutput(void const* data, size_t size, void* userData)
+{
+    ((StringBuilder*)userData)->Append((char const*)data, UInt(size));
+}
+
+static void appendReflectionJSON(char const* begin, char const* end, void* userData)
+{
+    ((StringBuilder*)userData)->append(begin, end);
+}
+
+// Does the same as the `main` of `slangc`, capturing its output
+static SlangResult runSlangcInProcess(
+    SlangCompileRequest*    request,
+    List<char const*>&      argv,
+    StringBuilder&          standardOutput,
+    StringBuilder&          standardError)
+{
+    spSetStandardOutputCallback(request, &appendStandardOutput, &standardOutput);
+    return runSlangcCompile(request, argv.Buffer(), int(argv.Count()), &appendDiagnostic, &standardError);
+}
+
+// Does the same as the `main` of `slang-reflection-test`, capturing its output
+static SlangResult runReflectionTestInProcess(
+    SlangCompileRequest*    request,
+    List<char const*>&      argv,
+    StringBuilder&          standardOutput,
+    StringBuilder&          standardError)
+{
+    SlangResult res = spProcessCommandLineArguments(request, argv.Buffer(), int(argv.Count()));
+    if (SLANG_SUCCEEDED(res))
+    {
+        res = spCompile(request);
+    }
+    if (SLANG_FAILED(res))
+    {
+        if (const char* diagnostic = spGetDiagnosticOutput(request))
+        {
+            standardError << diagnostic;
+        }
+        return res;
+    }
+
+    emitReflectionJSON(spGetReflection(request), &appendReflectionJSON, &standardOutput);
+    return SLANG_OK;
+}
+
+// Some options make the compiler write straight to `stderr`, which we
+// can only capture from a separate process.
+static bool canRunInProcess(List<String> const& args)
+{
+    for (auto const& arg : args)
+    {
+        if (arg == "-dump-ir" || arg == "-dump-intermediates")
+            return false;
+    }
+    return true;
+}
+
+// Run `tool` with `args`, and produce its result code and output in the
+// form used for `.expected` files in `outOutput`.
+//
+// If `context` has a session the tool is run in-process, which saves starting
+// a process and loading the standard library for each run.
+SlangResult runTestTool(
+    TestContext*            context,
+    const String&           testPath,
+    TestTool                tool,
+    List<String> const&     args,
+    String&                 outOutput)
+{
+    const String executablePath = String(g_options.binDir) + getTestToolName(tool) + osGetExecutableSuffix();
+
+    if (!context->m_session || !canRunInProcess(args))
+    {
+        OSProcessSpawner spawner;
+        spawner.pushExecutablePath(executablePath);
+        for (auto const& arg : args)
+        {
+            spawner.pushArgument(arg);
+        }
+
+        if (spawnAndWait(context, testPath, spawner) != kOSError_None)
+        {
+            return SLANG_FAIL;
+        }
+        outOutput = getOutput(spawner);
+        return SLANG_OK;
+    }
+
+    if (context->m_isVerbose)
+    {
+        StringBuilder commandLine;
+        commandLine << executablePath;
+        for (auto const& arg : args)
+        {
+            commandLine << " " << arg;
+        }
+        context->messageFormat(TestMessageType::Info, "%s\n", commandLine.Buffer());
+    }
+
+    List<char const*> argv;
+    for (auto const& arg : args)
+    {
+        argv.Add(arg.Buffer());
+    }
+
+    StringBuilder standardOutput;
+    StringBuilder standardError;
+
+    SlangCompileRequest* request = spCreateCompileRequest(context->m_session);
+    SlangResult res = SLANG_OK;
+    switch (tool)
+    {
+        case TestTool::Slangc:
+            res = runSlangcInProcess(request, argv, standardOutput, standardError);
+            break;
+        case TestTool::ReflectionTest:
+            res = runReflectionTestInProcess(request, argv, standardOutput, standardError);
+            break;
+    }
+    spDestroyCompileRequest(request);
+
+    // Map the result to the exit code the tool would have returned
+    OSProcessSpawner::ResultCode resultCode = 0;
+    if (SLANG_FAILED(res))
+    {
+        resultCode = (tool == TestTool::Slangc) ? getSlangcExitCode(res) : 1;
+    }
+
+    outOutput = getOutput(resultCode, standardOutput, standardError);
+    return SLANG_OK;
+}
+
 // Finds the specialized or default path for expected data for a test. 
 // If neither are found, will return an empty string
 String findExpectedPath(const TestInput& input, const char* postFix)
@@ -712,23 +907,20 @@ TestResult runSimpleTest(TestContext* context, TestInput& input)
     auto filePath999 = input.filePath;
     auto outputStem = input.outputStem;
 
-    OSProcessSpawner spawner;
-
-    spawner.pushExecutablePath(String(g_options.binDir) + "slangc" + osGetExecutableSuffix());
-    spawner.pushArgument(filePath999);
+    List<String> args;
+    args.Add(filePath999);
 
     for( auto arg : input.testOptions->args )
     {
-        spawner.pushArgument(arg);
+        args.Add(arg);
     }
 
-    if (spawnAndWait(context, outputStem, spawner) != kOSError_None)
+    String actualOutput;
+    if (SLANG_FAILED(runTestTool(context, outputStem, TestTool::Slangc, args, actualOutput)))
     {
         return TestResult::Fail;
     }
 
-    String actualOutput = getOutput(spawner);
-
     String expectedOutputPath = outputStem + ".expected";
     String expectedOutput;
     try
@@ -774,23 +966,20 @@ TestResult runReflectionTest(TestContext* context, TestInput& input)
     auto filePath = input.filePath;
     auto outputStem = input.outputStem;
 
-    OSProcessSpawner spawner;
-
-    spawner.pushExecutablePath(String(g_options.binDir) + "slang-reflection-test" + osGetExecutableSuffix());
-    spawner.pushArgument(filePath);
+    List<String> args;
+    args.Add(filePath);
 
     for( auto arg : input.testOptions->args )
     {
-        spawner.pushArgument(arg);
+        args.Add(arg);
     }
 
-    if (spawnAndWait(context, outputStem, spawner) != kOSError_None)
+    String actualOutput;
+    if (SLANG_FAILED(runTestTool(context, outputStem, TestTool::ReflectionTest, args, actualOutput)))
     {
         return TestResult::Fail;
     }
 
-    String actualOutput = getOutput(spawner);
-
     String expectedOutputPath = outputStem + ".expected";
     String expectedOutput;
     try
@@ -899,6 +1088,75 @@ TestResult runEvalTest(TestContext* context, TestInput& input)
     return result;
 }
 
+TestResult runDirectSPIRVTest(TestContext* context, TestInput& input)
+{
+    // Compile with Slang's own SPIR-V emitter, and compare the compiler's
+    // output followed by a disassembly of the SPIR-V to what we expect
+
+    auto filePath = input.filePath;
+    auto outputStem = input.outputStem;
+    auto spirvPath = outputStem + ".actual.spv";
+
+    List<String> args;
+    args.Add(filePath);
+
+    for( auto arg : input.testOptions->args )
+    {
+        args.Add(arg);
+    }
+
+    args.Add("-target");
+    args.Add("spirv");
+    args.Add("-emit-spirv-directly");
+    args.Add("-o");
+    args.Add(spirvPath);
+
+    // Clear any stale output first, so that a compile that writes nothing can't pass
+    File::WriteAllText(spirvPath, "");
+
+    String compileOutput;
+    if (SLANG_FAILED(runTestTool(context, outputStem, TestTool::Slangc, args, compileOutput)))
+    {
+        return TestResult::Fail;
+    }
+
+    List<unsigned char> spirv;
+    try
+    {
+        spirv = File::ReadAllBytes(spirvPath);
+    }
+    catch (const IOException&)
+    {
+    }
+
+    StringBuilder actualOutputBuilder;
+    actualOutputBuilder << compileOutput;
+    actualOutputBuilder << disassembleSPIRV((const uint32_t*)spirv.Buffer(), spirv.Count() / sizeof(uint32_t));
+    String actualOutput = actualOutputBuilder.ProduceString();
+
+    String expectedOutput = getExpectedOutput(outputStem);
+
+    TestResult result = TestResult::Pass;
+
+    // Otherwise we compare to the expected output
+    if (actualOutput != expectedOutput)
+    {
+        result = TestResult::Fail;
+    }
+
+    // If the test failed, then we write the actual output to a file
+    // so that we can easily diff it from the command line and
+    // diagnose the problem.
+    if (result == TestResult::Fail)
+    {
+        String actualOutputPath = outputStem + ".actual";
+        Slang::File::WriteAllText(actualOutputPath, actualOutput);
+
+        context->dumpOutputDifference(expectedOutput, actualOutput);
+    }
+
+    return result;
+}
 
 TestResult runCrossCompilerTest(TestContext* context, TestInput& input)
 {
@@ -908,29 +1166,26 @@ TestResult runCrossCompilerTest(TestContext* context, TestInput& input)
     auto filePath = input.filePath;
     auto outputStem = input.outputStem;
 
-    OSProcessSpawner actualSpawner;
-    OSProcessSpawner expectedSpawner;
+    List<String> actualArgs;
+    List<String> expectedArgs;
 
-    actualSpawner.pushExecutablePath(String(g_options.binDir) + "slangc" + osGetExecutableSuffix());
-    expectedSpawner.pushExecutablePath(String(g_options.binDir) + "slangc" + osGetExecutableSuffix());
-
-    actualSpawner.pushArgument(filePath);
-    expectedSpawner.pushArgument(filePath + ".glsl");
-    expectedSpawner.pushArgument("-pass-through");
-    expectedSpawner.pushArgument("glslang");
+    actualArgs.Add(filePath);
+    expectedArgs.Add(filePath + ".glsl");
+    expectedArgs.Add("-pass-through");
+    expectedArgs.Add("glslang");
 
     for( auto arg : input.testOptions->args )
     {
-        actualSpawner.pushArgument(arg);
-        expectedSpawner.pushArgument(arg);
+        actualArgs.Add(arg);
+        expectedArgs.Add(arg);
     }
 
-    if (spawnAndWait(context, outputStem, expectedSpawner) != kOSError_None)
+    String expectedOutput;
+    if (SLANG_FAILED(runTestTool(context, outputStem, TestTool::Slangc, expectedArgs, expectedOutput)))
     {
         return TestResult::Fail;
     }
 
-    String expectedOutput = getOutput(expectedSpawner);
     String expectedOutputPath = outputStem + ".expected";
     try
     {
@@ -941,11 +1196,11 @@ TestResult runCrossCompilerTest(TestContext* context, TestInput& input)
         return TestResult::Fail;
     }
 
-    if (spawnAndWait(context, outputStem, actualSpawner) != kOSError_None)
+    String actualOutput;
+    if (SLANG_FAILED(runTestTool(context, outputStem, TestTool::Slangc, actualArgs, actualOutput)))
     {
         return TestResult::Fail;
     }
-    String actualOutput = getOutput(actualSpawner);
 
     TestResult result = TestResult::Pass;
 
@@ -1640,6 +1895,7 @@ TestResult runTest(
         { "COMPARE_GLSL", &runGLSLComparisonTest },
         { "CROSS_COMPILE", &runCrossCompilerTest },
         { "EVAL", &runEvalTest },
+        { "SPIRV_DIRECT", &runDirectSPIRVTest },
         { nullptr, nullptr },
     };
 
@@ -1868,21 +2124,123 @@ static bool shouldRunTest(
     return true;
 }
 
-void runTestsInDirectory(
+// Find the files to run tests on, in the order that their results are reported
+void gatherTestFilesInDirectory(
     TestContext*		context,
-    String				directoryPath)
+    String				directoryPath,
+    List<String>&       outFiles)
 {
     for (auto file : osFindFilesInDirectory(directoryPath))
     {
         if( shouldRunTest(context, file) )
         {
 //            fprintf(stderr, "slang-test: found '%s'\n", file.Buffer());
-            runTestsOnFile(context, file);
+            outFiles.Add(file);
         }
     }
     for (auto subdir : osFindChildDirectories(directoryPath))
     {
-        runTestsInDirectory(context, subdir);
+        gatherTestFilesInDirectory(context, subdir, outFiles);
+    }
+}
+
+// Run the tests in `files` across `workerCount` threads.
+//
+// The unit of work is a whole file, so that everything a file's tests share
+// (which includes reference-counted strings) stays on one thread. Each file
+// runs on its own buffered `TestContext`, and these are added to `context`
+// in file order as they complete, so the output and accounting match running
+// the files one at a time.
+void runTestsOnFilesInParallel(
+    TestContext*        context,
+    List<String> const& files,
+    int                 workerCount)
+{
+    const int fileCount = int(files.Count());
+
+    List<TestContext*> fileContexts;
+    List<bool> isFileDone;
+    for (int i = 0; i < fileCount; ++i)
+    {
+        TestContext* fileContext = new TestContext(context->m_outputMode);
+        fileContext->initBuffered(*context);
+        fileContexts.Add(fileContext);
+        isFileDone.Add(false);
+    }
+
+    std::atomic<int> nextFileIndex(0);
+    std::mutex fileDoneMutex;
+    std::condition_variable fileDoneCondition;
+
+    auto runWorker = [&]()
+    {
+        // A session can only be used by one thread at a time, so each
+        // worker that runs tools in-process needs its own
+        SlangSession* session = context->m_session ? spCreateSession(nullptr) : nullptr;
+
+        for (;;)
+        {
+            const int fileIndex = nextFileIndex++;
+            if (fileIndex >= fileCount)
+                break;
+
+            fileContexts[fileIndex]->m_session = session;
+            runTestsOnFile(fileContexts[fileIndex], files[fileIndex]);
+            fileContexts[fileIndex]->m_session = nullptr;
+
+            {
+                std::lock_guard<std::mutex> lock(fileDoneMutex);
+                isFileDone[fileIndex] = true;
+            }
+            fileDoneCondition.notify_all();
+        }
+
+        if (session)
+        {
+            spDestroySession(session);
+        }
+    };
+
+    List<std::thread> workers;
+    workers.SetSize(workerCount);
+    for (auto& worker : workers)
+    {
+        worker = std::thread(runWorker);
+    }
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        {
+            std::unique_lock<std::mutex> lock(fileDoneMutex);
+            fileDoneCondition.wait(lock, [&]() { return isFileDone[i]; });
+        }
+
+        context->addBufferedResults(*fileContexts[i]);
+        delete fileContexts[i];
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void runTestsInDirectory(
+    TestContext*		context,
+    String				directoryPath)
+{
+    List<String> files;
+    gatherTestFilesInDirectory(context, directoryPath, files);
+
+    if (g_options.workerCount > 1)
+    {
+        runTestsOnFilesInParallel(context, files, g_options.workerCount);
+        return;
+    }
+
+    for (auto const& file : files)
+    {
+        runTestsOnFile(context, file);
     }
 }
 
@@ -1939,6 +2297,11 @@ int main(
    
     context.m_dumpOutputOnFailure = g_options.dumpOutputOnFailure;
     context.m_isVerbose = g_options.shouldBeVerbose;
+
+    if (!g_options.shouldSpawnTools)
+    {
+        context.m_session = spCreateSession(nullptr);
+    }
  
     // Enumerate test files according to policy
     // TODO: add more directories to this list
@@ -1984,6 +2347,12 @@ int main(
     }
         
 
+    if (context.m_session)
+    {
+        spDestroySession(context.m_session);
+        context.m_session = nullptr;
+    }
+
     context.outputSummary();
 
     return context.didAllSucceed() ? 0 : 1; 
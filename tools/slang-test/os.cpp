@@ -5,8 +5,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <mutex>
+
 using namespace Slang;
 
+// Held from creating the pipes for a child process until the parent has closed
+// its copies of the child's ends. Tests may be spawned from several threads
+// at once (see `-j` in main.cpp), and without this a child could inherit the
+// write end of another child's output pipe, so the reader of that pipe would
+// not see end-of-file until both had exited.
+static std::mutex s_spawnMutex;
+
 // Platform-specific code follows
 
 #ifdef _WIN32
@@ -236,6 +245,8 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
     securityAttributes.lpSecurityDescriptor = nullptr;
     securityAttributes.bInheritHandle = true;
 
+    std::unique_lock<std::mutex> spawnLock(s_spawnMutex);
+
     // create stdout pipe for child process
     HANDLE childStdOutReadTmp = nullptr;
     HANDLE childStdOutWrite = nullptr;
@@ -340,6 +351,8 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
     CloseHandle(childStdErrWrite);
     CloseHandle(childStdInRead);
 
+    spawnLock.unlock();
+
     // Create a thread to read from the child's stdout.
     OSProcessSpawner_ReaderThreadInfo stdOutThreadInfo;
     stdOutThreadInfo.file = childStdOutRead;
@@ -515,7 +528,7 @@ Slang::String OSProcessSpawner::getCommandLine()
 OSError OSProcessSpawner::spawnAndWaitForCompletion()
 {
     List<char const*> argPtrs;
-    for(auto arg : arguments_)
+    for(auto const& arg : arguments_)
     {
         argPtrs.Add(arg.Buffer());
     }
@@ -524,6 +537,8 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
     int stdoutPipe[2];
     int stderrPipe[2];
 
+    std::unique_lock<std::mutex> spawnLock(s_spawnMutex);
+
     if(pipe(stdoutPipe) == -1)
         return kOSError_OperationFailed;
 
@@ -562,6 +577,8 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
         close(stdoutPipe[1]);
         close(stderrPipe[1]);
 
+        spawnLock.unlock();
+
         int stdoutFD = stdoutPipe[0];
         int stderrFD = stderrPipe[0];
 
@@ -587,9 +604,10 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
                 return kOSError_OperationFailed;
             }
 
-            // Set a timeout of ten seconds;
-            // we really shouldn't wait too long...
-            int pollTimeout = 10000;
+            // Set a timeout of a minute; we really shouldn't wait
+            // too long, but processes take longer to produce output
+            // when many tests are running at once (see `-j`)...
+            int pollTimeout = 60000;
             int pollResult = poll(pollInfos, pollInfoCount, pollTimeout);
             if (pollResult <= 0)
             {
@@ -615,9 +633,11 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
                     pollInfos[0].fd = -1;
                     remainingCount--;
                 }
-
-                standardOutput_.append(
-                    buffer, buffer + count);
+                else
+                {
+                    standardOutput_.append(
+                        buffer, buffer + count);
+                }
             }
 
             if(pollInfos[1].revents)
@@ -630,9 +650,11 @@ OSError OSProcessSpawner::spawnAndWaitForCompletion()
                     pollInfos[1].fd = -1;
                     remainingCount--;
                 }
-
-                standardError_.append(
-                    buffer, buffer + count);
+                else
+                {
+                    standardError_.append(
+                        buffer, buffer + count);
+                }
             }
         }
 
@@ -0,0 +1,588 @@
+// spirv-disassembler.cpp
+#include "spirv-disassembler.h"
+
+#include "../../source/core/list.h"
+
+#include <string.h>
+
+using namespace Slang;
+
+// How the operands of each instruction are written out. Each character of
+// an instruction's format stands for one operand:
+//
+//      t       result type id
+//      r       result id
+//      i       id
+//      n       literal number (written as a float for the value of a
+//              32-bit float constant)
+//      s       literal string
+//      p       literal number and label id pair (the targets of `OpSwitch`)
+//      x       `GLSL.std.450` instruction
+//      C, A, m, M, E, S, D
+//              capability, addressing model, memory model, execution model,
+//              execution mode, storage class and decoration enumerants
+//      *       any number of the operand before it
+//
+// Words left over once the format is used up (such as optional operands,
+// and the extra operands of decorations and execution modes) are written
+// as literal numbers.
+struct SpvOpInfo
+{
+    uint32_t    op;
+    char const* name;
+    char const* format;
+};
+
+static const SpvOpInfo kSpvOpInfos[] =
+{
+    { 1,    "OpUndef",                  "tr" },
+    { 5,    "OpName",                   "is" },
+    { 11,   "OpExtInstImport",          "rs" },
+    { 12,   "OpExtInst",                "trixi*" },
+    { 14,   "OpMemoryModel",            "Am" },
+    { 15,   "OpEntryPoint",             "Misi*" },
+    { 16,   "OpExecutionMode",          "iE" },
+    { 17,   "OpCapability",             "C" },
+    { 19,   "OpTypeVoid",               "r" },
+    { 20,   "OpTypeBool",               "r" },
+    { 21,   "OpTypeInt",                "rnn" },
+    { 22,   "OpTypeFloat",              "rn" },
+    { 23,   "OpTypeVector",             "rin" },
+    { 28,   "OpTypeArray",              "rii" },
+    { 29,   "OpTypeRuntimeArray",       "ri" },
+    { 30,   "OpTypeStruct",             "ri*" },
+    { 32,   "OpTypePointer",            "rSi" },
+    { 33,   "OpTypeFunction",           "rii*" },
+    { 41,   "OpConstantTrue",           "tr" },
+    { 42,   "OpConstantFalse",          "tr" },
+    { 43,   "OpConstant",               "trn*" },
+    { 44,   "OpConstantComposite",      "tri*" },
+    { 46,   "OpConstantNull",           "tr" },
+    { 54,   "OpFunction",               "trni" },
+    { 55,   "OpFunctionParameter",      "tr" },
+    { 56,   "OpFunctionEnd",            "" },
+    { 57,   "OpFunctionCall",           "trii*" },
+    { 59,   "OpVariable",               "trSi" },
+    { 61,   "OpLoad",                   "tri" },
+    { 62,   "OpStore",                  "ii" },
+    { 65,   "OpAccessChain",            "trii*" },
+    { 68,   "OpArrayLength",            "trin" },
+    { 71,   "OpDecorate",               "iD" },
+    { 72,   "OpMemberDecorate",         "inD" },
+    { 77,   "OpVectorExtractDynamic",   "trii" },
+    { 79,   "OpVectorShuffle",          "triin*" },
+    { 80,   "OpCompositeConstruct",     "tri*" },
+    { 81,   "OpCompositeExtract",       "trin*" },
+    { 82,   "OpCompositeInsert",        "triin*" },
+    { 83,   "OpCopyObject",             "tri" },
+    { 109,  "OpConvertFToU",            "tri" },
+    { 110,  "OpConvertFToS",            "tri" },
+    { 111,  "OpConvertSToF",            "tri" },
+    { 112,  "OpConvertUToF",            "tri" },
+    { 124,  "OpBitcast",                "tri" },
+    { 126,  "OpSNegate",                "tri" },
+    { 127,  "OpFNegate",                "tri" },
+    { 128,  "OpIAdd",                   "trii" },
+    { 129,  "OpFAdd",                   "trii" },
+    { 130,  "OpISub",                   "trii" },
+    { 131,  "OpFSub",                   "trii" },
+    { 132,  "OpIMul",                   "trii" },
+    { 133,  "OpFMul",                   "trii" },
+    { 134,  "OpUDiv",                   "trii" },
+    { 135,  "OpSDiv",                   "trii" },
+    { 136,  "OpFDiv",                   "trii" },
+    { 137,  "OpUMod",                   "trii" },
+    { 138,  "OpSRem",                   "trii" },
+    { 140,  "OpFRem",                   "trii" },
+    { 148,  "OpDot",                    "trii" },
+    { 154,  "OpAny",                    "tri" },
+    { 155,  "OpAll",                    "tri" },
+    { 156,  "OpIsNan",                  "tri" },
+    { 157,  "OpIsInf",                  "tri" },
+    { 164,  "OpLogicalEqual",           "trii" },
+    { 165,  "OpLogicalNotEqual",        "trii" },
+    { 166,  "OpLogicalOr",              "trii" },
+    { 167,  "OpLogicalAnd",             "trii" },
+    { 168,  "OpLogicalNot",             "tri" },
+    { 169,  "OpSelect",                 "triii" },
+    { 170,  "OpIEqual",                 "trii" },
+    { 171,  "OpINotEqual",              "trii" },
+    { 172,  "OpUGreaterThan",           "trii" },
+    { 173,  "OpSGreaterThan",           "trii" },
+    { 174,  "OpUGreaterThanEqual",      "trii" },
+    { 175,  "OpSGreaterThanEqual",      "trii" },
+    { 176,  "OpULessThan",              "trii" },
+    { 177,  "OpSLessThan",              "trii" },
+    { 178,  "OpULessThanEqual",         "trii" },
+    { 179,  "OpSLessThanEqual",         "trii" },
+    { 180,  "OpFOrdEqual",              "trii" },
+    { 183,  "OpFUnordNotEqual",         "trii" },
+    { 184,  "OpFOrdLessThan",           "trii" },
+    { 186,  "OpFOrdGreaterThan",        "trii" },
+    { 188,  "OpFOrdLessThanEqual",      "trii" },
+    { 190,  "OpFOrdGreaterThanEqual",   "trii" },
+    { 194,  "OpShiftRightLogical",      "trii" },
+    { 195,  "OpShiftRightArithmetic",   "trii" },
+    { 196,  "OpShiftLeftLogical",       "trii" },
+    { 197,  "OpBitwiseOr",              "trii" },
+    { 198,  "OpBitwiseXor",             "trii" },
+    { 199,  "OpBitwiseAnd",             "trii" },
+    { 200,  "OpNot",                    "tri" },
+    { 224,  "OpControlBarrier",         "iii" },
+    { 225,  "OpMemoryBarrier",          "ii" },
+    { 229,  "OpAtomicExchange",         "triiii" },
+    { 230,  "OpAtomicCompareExchange",  "triiiiii" },
+    { 234,  "OpAtomicIAdd",             "triiii" },
+    { 236,  "OpAtomicSMin",             "triiii" },
+    { 237,  "OpAtomicUMin",             "triiii" },
+    { 238,  "OpAtomicSMax",             "triiii" },
+    { 239,  "OpAtomicUMax",             "triiii" },
+    { 240,  "OpAtomicAnd",              "triiii" },
+    { 241,  "OpAtomicOr",               "triiii" },
+    { 242,  "OpAtomicXor",              "triiii" },
+    { 245,  "OpPhi",                    "tri*" },
+    { 246,  "OpLoopMerge",              "iin" },
+    { 247,  "OpSelectionMerge",         "in" },
+    { 248,  "OpLabel",                  "r" },
+    { 249,  "OpBranch",                 "i" },
+    { 250,  "OpBranchConditional",      "iii" },
+    { 251,  "OpSwitch",                 "iip*" },
+    { 252,  "OpKill",                   "" },
+    { 253,  "OpReturn",                 "" },
+    { 254,  "OpReturnValue",            "i" },
+    { 255,  "OpUnreachable",            "" },
+};
+
+struct SpvEnumerantInfo
+{
+    uint32_t    value;
+    char const* name;
+};
+
+static const SpvEnumerantInfo kSpvCapabilities[] =
+{
+    { 1,    "Shader" },
+};
+
+static const SpvEnumerantInfo kSpvAddressingModels[] =
+{
+    { 0,    "Logical" },
+};
+
+static const SpvEnumerantInfo kSpvMemoryModels[] =
+{
+    { 1,    "GLSL450" },
+};
+
+static const SpvEnumerantInfo kSpvExecutionModels[] =
+{
+    { 0,    "Vertex" },
+    { 4,    "Fragment" },
+    { 5,    "GLCompute" },
+};
+
+static const SpvEnumerantInfo kSpvExecutionModes[] =
+{
+    { 7,    "OriginUpperLeft" },
+    { 12,   "DepthReplacing" },
+    { 17,   "LocalSize" },
+};
+
+static const SpvEnumerantInfo kSpvStorageClasses[] =
+{
+    { 1,    "Input" },
+    { 2,    "Uniform" },
+    { 3,    "Output" },
+    { 4,    "Workgroup" },
+    { 6,    "Private" },
+    { 7,    "Function" },
+    { 9,    "PushConstant" },
+};
+
+static const SpvEnumerantInfo kSpvDecorations[] =
+{
+    { 2,    "Block" },
+    { 3,    "BufferBlock" },
+    { 6,    "ArrayStride" },
+    { 11,   "BuiltIn" },
+    { 13,   "NoPerspective" },
+    { 14,   "Flat" },
+    { 16,   "Centroid" },
+    { 24,   "NonWritable" },
+    { 30,   "Location" },
+    { 33,   "Binding" },
+    { 34,   "DescriptorSet" },
+    { 35,   "Offset" },
+};
+
+static const SpvEnumerantInfo kSpvBuiltIns[] =
+{
+    { 0,    "Position" },
+    { 15,   "FragCoord" },
+    { 17,   "FrontFacing" },
+    { 22,   "FragDepth" },
+    { 26,   "WorkgroupId" },
+    { 27,   "LocalInvocationId" },
+    { 28,   "GlobalInvocationId" },
+    { 29,   "LocalInvocationIndex" },
+    { 42,   "VertexIndex" },
+    { 43,   "InstanceIndex" },
+};
+
+static const SpvEnumerantInfo kGLSLstd450Instructions[] =
+{
+    { 1,    "Round" },
+    { 3,    "Trunc" },
+    { 4,    "FAbs" },
+    { 5,    "SAbs" },
+    { 8,    "Floor" },
+    { 9,    "Ceil" },
+    { 10,   "Fract" },
+    { 11,   "Radians" },
+    { 12,   "Degrees" },
+    { 13,   "Sin" },
+    { 14,   "Cos" },
+    { 15,   "Tan" },
+    { 16,   "Asin" },
+    { 17,   "Acos" },
+    { 18,   "Atan" },
+    { 19,   "Sinh" },
+    { 20,   "Cosh" },
+    { 21,   "Tanh" },
+    { 25,   "Atan2" },
+    { 26,   "Pow" },
+    { 27,   "Exp" },
+    { 28,   "Log" },
+    { 29,   "Exp2" },
+    { 30,   "Log2" },
+    { 31,   "Sqrt" },
+    { 32,   "InverseSqrt" },
+    { 37,   "FMin" },
+    { 38,   "UMin" },
+    { 39,   "SMin" },
+    { 40,   "FMax" },
+    { 41,   "UMax" },
+    { 42,   "SMax" },
+    { 43,   "FClamp" },
+    { 44,   "UClamp" },
+    { 45,   "SClamp" },
+    { 46,   "FMix" },
+    { 48,   "Step" },
+    { 49,   "SmoothStep" },
+    { 50,   "Fma" },
+    { 66,   "Length" },
+    { 67,   "Distance" },
+    { 68,   "Cross" },
+    { 69,   "Normalize" },
+    { 71,   "Reflect" },
+};
+
+enum
+{
+    kSpvMagicNumber = 0x07230203,
+    kSpvHeaderWordCount = 5,
+
+    kSpvOpTypeFloat = 22,
+    kSpvOpConstant = 43,
+    kSpvOpFunction = 54,
+    kSpvOpFunctionEnd = 56,
+    kSpvOpLabel = 248,
+    kSpvOpBranch = 249,
+    kSpvOpUnreachable = 255,
+
+    kSpvDecorationBuiltIn = 11,
+};
+
+static const SpvOpInfo* findOpInfo(uint32_t op)
+{
+    for (auto const& info : kSpvOpInfos)
+    {
+        if (info.op == op)
+            return &info;
+    }
+    return nullptr;
+}
+
+template<size_t N>
+static void appendEnumerant(StringBuilder& sb, const SpvEnumerantInfo (&infos)[N], uint32_t value)
+{
+    for (auto const& info : infos)
+    {
+        if (info.value == value)
+        {
+            sb << info.name;
+            return;
+        }
+    }
+    sb << UInt32(value);
+}
+
+static bool isTerminator(uint32_t op)
+{
+    // `OpBranch` up to `OpUnreachable` are all the block terminators
+    return op >= kSpvOpBranch && op <= kSpvOpUnreachable;
+}
+
+namespace
+{
+// Checks that the ids in a module are used consistently
+struct IdChecker
+{
+    List<uint8_t>   defined;
+    List<uint32_t>  used;
+    uint32_t        bound = 0;
+
+    void init(uint32_t inBound)
+    {
+        bound = inBound;
+        defined.SetSize(bound);
+        for (UInt ii = 0; ii < defined.Count(); ++ii)
+            defined[ii] = 0;
+    }
+
+    bool isInBounds(uint32_t id) const { return id != 0 && id < bound; }
+
+    void define(StringBuilder& errors, uint32_t id)
+    {
+        if (!isInBounds(id))
+        {
+            errors << "; error: result id %" << UInt32(id) << " is out of bounds\n";
+            return;
+        }
+        if (defined[id])
+            errors << "; error: id %" << UInt32(id) << " is defined more than once\n";
+        defined[id] = 1;
+    }
+
+    void use(StringBuilder& errors, uint32_t id)
+    {
+        if (!isInBounds(id))
+        {
+            errors << "; error: id %" << UInt32(id) << " is out of bounds\n";
+            return;
+        }
+        // Ids can be used before they are defined (by branches, phis and
+        // decorations), so whether they are defined is checked at the end.
+        used.Add(id);
+    }
+
+    void checkUsesAreDefined(StringBuilder& errors)
+    {
+        for (auto id : used)
+        {
+            if (defined[id] == 0)
+            {
+                errors << "; error: id %" << UInt32(id) << " is used but never defined\n";
+                // Only report each id once
+                defined[id] = 2;
+            }
+        }
+    }
+};
+}
+
+// Writes the operands of an instruction, from `words[cursor]` up to
+// `words[end]`, other than its result id, which is returned instead
+// (or 0 if there isn't one).
+static uint32_t appendOperands(
+    StringBuilder&      sb,
+    StringBuilder&      errors,
+    IdChecker&          ids,
+    const SpvOpInfo&    info,
+    const uint32_t*     words,
+    size_t              cursor,
+    size_t              end,
+    bool                isFloatConstant)
+{
+    uint32_t resultId = 0;
+    uint32_t decoration = 0;
+    char const* format = info.format;
+    char kind = 0;
+    while (cursor < end)
+    {
+        // Pick the kind of the next operand, repeating the one before a `*`
+        if (*format && *format != '*')
+            kind = *format++;
+        else if (!*format)
+            kind = 'n';
+
+        uint32_t word = words[cursor++];
+        if (kind == 'r')
+        {
+            resultId = word;
+            ids.define(errors, word);
+            continue;
+        }
+
+        sb << " ";
+        switch (kind)
+        {
+        case 't':
+        case 'i':
+            ids.use(errors, word);
+            sb << "%" << UInt32(word);
+            break;
+
+        case 'p':
+            sb << UInt32(word);
+            if (cursor < end)
+            {
+                word = words[cursor++];
+                ids.use(errors, word);
+                sb << " %" << UInt32(word);
+            }
+            break;
+
+        case 's':
+            {
+                // The string is nul-terminated, and padded to a whole number of words
+                const char* text = (const char*)(words + cursor - 1);
+                const char* textEnd = (const char*)(words + end);
+                const char* nul = text;
+                while (nul < textEnd && *nul)
+                    ++nul;
+                if (nul == textEnd)
+                    errors << "; error: string operand of " << info.name << " isn't terminated\n";
+                sb << "\"";
+                sb.Append(text, UInt(nul - text));
+                sb << "\"";
+                cursor += size_t(nul - text) / sizeof(uint32_t);
+            }
+            break;
+
+        case 'x': appendEnumerant(sb, kGLSLstd450Instructions, word); break;
+        case 'C': appendEnumerant(sb, kSpvCapabilities, word); break;
+        case 'A': appendEnumerant(sb, kSpvAddressingModels, word); break;
+        case 'm': appendEnumerant(sb, kSpvMemoryModels, word); break;
+        case 'M': appendEnumerant(sb, kSpvExecutionModels, word); break;
+        case 'E': appendEnumerant(sb, kSpvExecutionModes, word); break;
+        case 'S': appendEnumerant(sb, kSpvStorageClasses, word); break;
+
+        case 'D':
+            decoration = word;
+            appendEnumerant(sb, kSpvDecorations, word);
+            break;
+
+        default:
+            // A `BuiltIn` decoration names the built-in variable
+            if (decoration == kSpvDecorationBuiltIn)
+            {
+                appendEnumerant(sb, kSpvBuiltIns, word);
+                decoration = 0;
+                break;
+            }
+            if (isFloatConstant)
+            {
+                float value;
+                memcpy(&value, &word, sizeof(value));
+                sb << value;
+                break;
+            }
+            sb << UInt32(word);
+            break;
+        }
+    }
+    return resultId;
+}
+
+Slang::String disassembleSPIRV(const uint32_t* words, size_t wordCount)
+{
+    StringBuilder sb;
+    StringBuilder errors;
+
+    if (wordCount < kSpvHeaderWordCount || words[0] != kSpvMagicNumber)
+    {
+        sb << "; error: not a SPIR-V module\n";
+        return sb.ProduceString();
+    }
+
+    const uint32_t version = words[1];
+    const uint32_t bound = words[3];
+    sb << "; SPIR-V\n";
+    sb << "; Version: " << UInt32((version >> 16) & 0xff) << "." << UInt32((version >> 8) & 0xff) << "\n";
+    sb << "; Bound: " << UInt32(bound) << "\n";
+    if (words[4] != 0)
+        errors << "; error: reserved header word is " << UInt32(words[4]) << "\n";
+
+    IdChecker ids;
+    ids.init(bound);
+
+    // The ids of the 32-bit float types, so that constants of them can be written as floats
+    List<uint32_t> floatTypes;
+
+    bool isInFunction = false;
+    bool isInBlock = false;
+    size_t cursor = kSpvHeaderWordCount;
+    while (cursor < wordCount)
+    {
+        const uint32_t instWordCount = words[cursor] >> 16;
+        const uint32_t op = words[cursor] & 0xffff;
+        if (instWordCount == 0 || cursor + instWordCount > wordCount)
+        {
+            errors << "; error: instruction at word " << UInt32(uint32_t(cursor)) << " doesn't fit in the module\n";
+            break;
+        }
+
+        // Every instruction in a function body (other than the end of the
+        // function) has to be inside a block, and every block has to be ended
+        // by a terminator before the next one starts.
+        if (op == kSpvOpFunction)
+        {
+            if (isInFunction)
+                errors << "; error: function started inside another function\n";
+            isInFunction = true;
+        }
+        else if (op == kSpvOpLabel)
+        {
+            if (isInBlock)
+                errors << "; error: block started before the one before it was terminated\n";
+            isInBlock = true;
+        }
+        else if (op == kSpvOpFunctionEnd)
+        {
+            if (isInBlock)
+                errors << "; error: function ended inside a block\n";
+            isInFunction = false;
+            isInBlock = false;
+        }
+        else if (isTerminator(op))
+        {
+            if (!isInBlock)
+                errors << "; error: terminator outside of a block\n";
+            isInBlock = false;
+        }
+
+        if (op == kSpvOpTypeFloat && instWordCount == 3 && words[cursor + 2] == 32)
+            floatTypes.Add(words[cursor + 1]);
+        const bool isFloatConstant = op == kSpvOpConstant && instWordCount == 4
+            && floatTypes.IndexOf(words[cursor + 1]) != UInt(-1);
+
+        StringBuilder line;
+        uint32_t resultId = 0;
+        if (const SpvOpInfo* info = findOpInfo(op))
+        {
+            line << info->name;
+            resultId = appendOperands(line, errors, ids, *info, words, cursor + 1, cursor + instWordCount, isFloatConstant);
+        }
+        else
+        {
+            line << "Op" << UInt32(op);
+            for (uint32_t ii = 1; ii < instWordCount; ++ii)
+                line << " " << UInt32(words[cursor + ii]);
+        }
+
+        // Results are written as `%result = OpName %type operands...`
+        if (resultId)
+            sb << "%" << UInt32(resultId) << " = ";
+        sb << line << "\n";
+
+        cursor += instWordCount;
+    }
+
+    if (isInFunction)
+        errors << "; error: module ends inside a function\n";
+    ids.checkUsesAreDefined(errors);
+
+    sb << errors;
+    return sb.ProduceString();
+}
@@ -0,0 +1,23 @@
+#ifndef SLANG_TEST_SPIRV_DISASSEMBLER_H
+#define SLANG_TEST_SPIRV_DISASSEMBLER_H
+
+#include "../../source/core/slang-string.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Disassembles a SPIR-V module into text that tests can compare against
+// expected output, one instruction per line, in the style of `spirv-dis`.
+//
+// Only the instructions (and enumerants) that Slang's direct SPIR-V emitter
+// produces are known by name; anything else is written as its opcode number
+// and operand words.
+//
+// The module is also checked for the kind of structural mistakes that would
+// make a driver reject it: instructions that don't fit the module, ids that
+// are out of bounds, defined twice or never defined, and blocks that don't
+// end in a branch or return. Each problem found is written as an `; error:`
+// line, so that it shows up in the output.
+Slang::String disassembleSPIRV(const uint32_t* words, size_t wordCount);
+
+#endif
@@ -13,6 +13,50 @@ using namespace Slang;
 /* static */TestContext* TestContext::s_context = nullptr;
 /* static */TestRegister* TestRegister::s_first;
 
+const char kGenericShaderSource[] =
+    "interface IBase { float compute(); };\n"
+    "struct One : IBase { float compute() { return 1.0; } };\n"
+    "struct Two : IBase { float compute() { return 2.0; } };\n"
+    "struct Twice<T : IBase> : IBase { T inner; float compute() { return inner.compute() * 2.0; } };\n"
+    "struct NotBase { float value; };\n"
+    "__generic_param TImpl : IBase;\n"
+    "RWStructuredBuffer<float> gOutput;\n"
+    "TImpl gImpl;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = gImpl.compute();\n"
+    "}\n";
+
+String getEntryPointCode(SlangCompileRequest* request, int entryPointIndex, int targetIndex)
+{
+    ISlangBlob* blob = nullptr;
+    if (SLANG_FAILED(spGetEntryPointCodeBlob(request, entryPointIndex, targetIndex, &blob)) || !blob)
+        return String();
+    String code(UnownedStringSlice((const char*)blob->getBufferPointer(), blob->getBufferSize()));
+    blob->release();
+    return code;
+}
+
+SlangCompileStats getCompileStats(SlangCompileRequest* request)
+{
+    SlangCompileStats stats;
+    stats.structSize = sizeof(stats);
+    spGetCompileStats(request, &stats);
+    return stats;
+}
+
+SlangCompileRequest* compileComputeShader(SlangSession* session, const char* path, const char* source, SlangResult* outResult)
+{
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, path, source);
+    spAddEntryPoint(request, translationUnitIndex, "main", spFindProfile(session, "cs_5_0"));
+    *outResult = spCompile(request);
+    return request;
+}
+
 static void appendXmlEncode(char c, StringBuilder& out)
 {
     switch (c)
@@ -82,6 +126,41 @@ TestContext::TestContext(TestOutputMode outputMode) :
     m_inTest = false;
     m_dumpOutputOnFailure = false;
     m_isVerbose = false;
+    m_isBuffered = false;
+}
+
+void TestContext::initBuffered(const TestContext& parent)
+{
+    m_outputMode = parent.m_outputMode;
+    m_maxFailTestResults = parent.m_maxFailTestResults;
+    m_dumpOutputOnFailure = parent.m_dumpOutputOnFailure;
+    m_isVerbose = parent.m_isVerbose;
+    m_isBuffered = true;
+}
+
+void TestContext::addBufferedResults(const TestContext& buffered)
+{
+    assert(buffered.m_isBuffered && !m_inTest);
+
+    const UInt resultCount = buffered.m_testInfos.Count();
+    for (UInt i = 0; i < resultCount; ++i)
+    {
+        _writeStdError(buffered.m_bufferedStdErrorBeforeResult[i].Buffer());
+        _addResult(buffered.m_testInfos[i]);
+    }
+    _writeStdError(buffered.m_bufferedStdError.Buffer());
+}
+
+void TestContext::_writeStdError(const char* text)
+{
+    if (m_isBuffered)
+    {
+        m_bufferedStdError << text;
+    }
+    else
+    {
+        fputs(text, stderr);
+    }
 }
 
 bool TestContext::canWriteStdError() const
@@ -188,8 +267,7 @@ void TestContext::dumpOutputDifference(const String& expectedOutput, const Strin
 
     if (m_dumpOutputOnFailure && canWriteStdError())
     {
-        fprintf(stderr, "%s", builder.Buffer());
-        fflush(stderr);
+        _writeStdError(builder.Buffer());
     }
 
     // Add to the m_currentInfo
@@ -221,6 +299,13 @@ void TestContext::_addResult(const TestInfo& info)
 
     m_testInfos.Add(info);
 
+    if (m_isBuffered)
+    {
+        // The result is reported when it is added to the parent context
+        m_bufferedStdErrorBeforeResult.Add(_Move(m_bufferedStdError).ProduceString());
+        return;
+    }
+
     //    printf("OUTPUT_MODE: %d\n", options.outputMode);
     switch (m_outputMode)
     {
@@ -306,7 +391,7 @@ void TestContext::message(TestMessageType type, const String& message)
     {
         if (m_isVerbose && canWriteStdError())
         {
-            fputs(message.Buffer(), stderr);
+            _writeStdError(message.Buffer());
         }
 
         // Just dump out if can dump out
@@ -317,13 +402,13 @@ void TestContext::message(TestMessageType type, const String& message)
     {
         if (type == TestMessageType::RunError || type == TestMessageType::TestFailure)
         {
-            fprintf(stderr, "error: ");
-            fputs(message.Buffer(), stderr);
-            fprintf(stderr, "\n");
+            _writeStdError("error: ");
+            _writeStdError(message.Buffer());
+            _writeStdError("\n");
         }
         else
         {
-            fputs(message.Buffer(), stderr);
+            _writeStdError(message.Buffer());
         }
     }
 
@@ -2,6 +2,8 @@
 
 #include "../../source/core/slang-string-util.h"
 
+#include "../../slang.h"
+
 #define SLANG_CHECK(x) TestContext::get()->addResultWithLocation((x), #x, __FILE__, __LINE__); 
 
 struct TestRegister
@@ -23,7 +25,7 @@ struct TestRegister
     static TestRegister* s_first;
 };
 
-#define SLANG_UNIT_TEST(name, func) static TestRegister s_unitTest##__LINE__(name, func)
+#define SLANG_UNIT_TEST(name, func) static TestRegister SLANG_CONCAT(s_unitTest, __LINE__)(name, func)
 
 enum class TestOutputMode
 {
@@ -99,6 +101,12 @@ class TestContext
         /// True if can write output directly to stderr
     bool canWriteStdError() const;
 
+        /// Make this context hold on to its output and results instead of reporting them, taking
+        /// the remaining settings from `parent`. Used to run tests on a worker thread (see `-j`).
+    void initBuffered(const TestContext& parent);
+        /// Report the output and results held by the buffered context `buffered`, as if its tests had been run on this context
+    void addBufferedResults(const TestContext& buffered);
+
         /// Call at end of tests 
     void outputSummary();
 
@@ -126,8 +134,11 @@ class TestContext
     bool m_dumpOutputOnFailure;
     bool m_isVerbose;
 
+    SlangSession* m_session = nullptr;          ///< If set, session to run the compiler on in-process, instead of spawning tools
+
 protected:
     void _addResult(const TestInfo& info);
+    void _writeStdError(const char* text);
 
     Slang::StringBuilder m_currentMessage;
     TestInfo m_currentInfo;
@@ -135,8 +146,29 @@ protected:
     int m_numFailResults;
 
     bool m_inTest;
+
+    bool m_isBuffered;                              ///< If set, output and results are held to be added to another context
+    Slang::StringBuilder m_bufferedStdError;        ///< Error output held since the last result was added
+    Slang::List<Slang::String> m_bufferedStdErrorBeforeResult;  ///< Error output held before each of m_testInfos
     
     static TestContext* s_context;
 };
 
+// Helpers for the unit tests that compile code through the API
+
+    /// Get the code generated for an entry point and target of `request` as text,
+    /// or an empty string if there isn't any
+Slang::String getEntryPointCode(SlangCompileRequest* request, int entryPointIndex, int targetIndex);
+
+    /// Get the stats for the work `request` has done
+SlangCompileStats getCompileStats(SlangCompileRequest* request);
+
+    /// Compile `source` (as the file `path`) to HLSL, for its compute shader entry point `main`.
+    /// The result of compiling is written to `outResult`, and the caller destroys the request.
+SlangCompileRequest* compileComputeShader(SlangSession* session, const char* path, const char* source, SlangResult* outResult);
+
+    /// A compute shader whose entry point `main` has a global generic parameter `TImpl : IBase`.
+    /// `One`, `Two` and `Twice<T>` conform to `IBase`, and `NotBase` doesn't.
+extern const char kGenericShaderSource[];
+
 
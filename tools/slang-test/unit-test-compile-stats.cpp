@@ -0,0 +1,57 @@
+// unit-test-compile-stats.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include <stddef.h>
+
+static const char kShaderSource[] =
+    "RWStructuredBuffer<int> gOutput;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = int(tid.x);\n"
+    "}\n";
+
+static void compileStatsUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, "compile-stats.slang", kShaderSource);
+    spAddEntryPoint(request, translationUnitIndex, "main", spFindProfile(session, "cs_5_0"));
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+
+    SlangCompileStats stats;
+    stats.structSize = sizeof(stats);
+    SLANG_CHECK(SLANG_SUCCEEDED(spGetCompileStats(request, &stats)));
+    SLANG_CHECK(stats.structSize == sizeof(stats));
+    SLANG_CHECK(stats.tokenCount != 0);
+    SLANG_CHECK(stats.declCheckCount != 0);
+    SLANG_CHECK(stats.irMemoryAllocationCount != 0);
+    SLANG_CHECK(stats.phaseSeconds[SLANG_COMPILE_PHASE_MAX_COUNT - 1] == 0);
+
+    // A caller built against an older version of the structure only gets
+    // the fields that existed in that version
+    const uint64_t kUntouched = 0xdeadbeef;
+    SlangCompileStats oldStats;
+    oldStats.structSize = offsetof(SlangCompileStats, declCheckCount);
+    oldStats.declCheckCount = kUntouched;
+    oldStats.downstreamCacheHitCount = kUntouched;
+    SLANG_CHECK(SLANG_SUCCEEDED(spGetCompileStats(request, &oldStats)));
+    SLANG_CHECK(oldStats.structSize == offsetof(SlangCompileStats, declCheckCount));
+    SLANG_CHECK(oldStats.tokenCount == stats.tokenCount);
+    SLANG_CHECK(oldStats.declCheckCount == kUntouched);
+    SLANG_CHECK(oldStats.downstreamCacheHitCount == kUntouched);
+
+    SlangCompileStats invalidStats;
+    invalidStats.structSize = 0;
+    SLANG_CHECK(SLANG_FAILED(spGetCompileStats(request, &invalidStats)));
+
+    spDestroyCompileRequest(request);
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("CompileStats", compileStatsUnitTest);
@@ -0,0 +1,134 @@
+// unit-test-dictionary.cpp
+
+#include "../../source/core/dictionary.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test-context.h"
+
+#include "../../source/core/slang-random-generator.h"
+#include "../../source/core/list.h"
+
+using namespace Slang;
+
+static void dictionaryUnitTest()
+{
+    // Apply a random sequence of operations, and compare against
+    // a direct-mapped reference table.
+    {
+        enum { kKeyCount = 2000 };
+
+        Dictionary<int, int> dict;
+        List<int> refValues;
+        List<bool> refPresent;
+        for (int i = 0; i < kKeyCount; i++)
+        {
+            refValues.Add(0);
+            refPresent.Add(false);
+        }
+        int refCount = 0;
+
+        DefaultRandomGenerator randGen(0x5712);
+
+        for (int i = 0; i < 50000; i++)
+        {
+            const int key = randGen.nextInt32UpTo(kKeyCount);
+            switch (randGen.nextInt32UpTo(4))
+            {
+                case 0:
+                {
+                    const bool added = dict.AddIfNotExists(key, i);
+                    SLANG_CHECK(added == !refPresent[key]);
+                    if (added)
+                    {
+                        refValues[key] = i;
+                        refPresent[key] = true;
+                        refCount++;
+                    }
+                    break;
+                }
+                case 1:
+                {
+                    dict[key] = i;
+                    if (!refPresent[key])
+                    {
+                        refPresent[key] = true;
+                        refCount++;
+                    }
+                    refValues[key] = i;
+                    break;
+                }
+                case 2:
+                {
+                    dict.Remove(key);
+                    if (refPresent[key])
+                    {
+                        refPresent[key] = false;
+                        refCount--;
+                    }
+                    break;
+                }
+                default:
+                {
+                    int value = -1;
+                    const bool found = dict.TryGetValue(key, value);
+                    SLANG_CHECK(found == refPresent[key]);
+                    SLANG_CHECK(!found || value == refValues[key]);
+                    break;
+                }
+            }
+        }
+
+        SLANG_CHECK(dict.Count() == refCount);
+
+        int iteratedCount = 0;
+        for (auto& pair : dict)
+        {
+            SLANG_CHECK(refPresent[pair.Key] && refValues[pair.Key] == pair.Value);
+            iteratedCount++;
+        }
+        SLANG_CHECK(iteratedCount == refCount);
+
+        // Copies should be independent of the original
+        Dictionary<int, int> copy = dict;
+        copy.Clear();
+        SLANG_CHECK(copy.Count() == 0);
+        SLANG_CHECK(dict.Count() == refCount);
+        SLANG_CHECK(copy.begin() == copy.end());
+        copy.Add(1, 2);
+        SLANG_CHECK(copy.Count() == 1 && copy[1].GetValue() == 2);
+
+        Dictionary<int, int> moved = _Move(dict);
+        SLANG_CHECK(moved.Count() == refCount);
+        SLANG_CHECK(dict.Count() == 0 && !dict.ContainsKey(0));
+    }
+
+    // Lookup of `String` keys using `UnownedStringSlice` (no temporary `String`)
+    {
+        Dictionary<String, int> dict;
+        dict.Add("float", 1);
+        dict.Add("float4", 4);
+        dict.Add("float4x4", 16);
+
+        const char text[] = "float4x4";
+        int value = 0;
+        SLANG_CHECK(dict.TryGetValue(UnownedStringSlice(text, 6), value) && value == 4);
+        SLANG_CHECK(dict.TryGetValue(UnownedStringSlice(text, 8), value) && value == 16);
+        SLANG_CHECK(dict.ContainsKey(UnownedStringSlice(text, 5)));
+        SLANG_CHECK(!dict.ContainsKey(UnownedStringSlice(text, 7)));
+    }
+
+    // Removing an entry should release what it was holding
+    {
+        RefPtr<RefObject> obj = new RefObject();
+        Dictionary<int, RefPtr<RefObject>> dict;
+        dict.Add(0, obj);
+        SLANG_CHECK(obj->debugGetReferenceCount() == 2);
+        dict.Remove(0);
+        SLANG_CHECK(obj->debugGetReferenceCount() == 1);
+    }
+}
+
+SLANG_UNIT_TEST("Dictionary", dictionaryUnitTest);
@@ -0,0 +1,489 @@
+// unit-test-downstream-compiler.cpp
+
+#include "../../slang.h"
+#include "../../slang-com-helper.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+#include "os.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Slang;
+
+static const Guid IID_ISlangUnknown             = SLANG_UUID_ISlangUnknown;
+static const Guid IID_ISlangBlob                = SLANG_UUID_ISlangBlob;
+static const Guid IID_ISlangDownstreamCompiler  = SLANG_UUID_ISlangDownstreamCompiler;
+
+enum { kEntryPointCount = 8, kThreadCount = 4 };
+
+namespace // anonymous
+{
+
+// What the stand-in compiler has seen, shared by all of its instances
+struct StandInState
+{
+    std::mutex              mutex;
+    std::condition_variable condition;
+
+    int instanceCount = 0;
+    int destroyedInstanceCount = 0;
+    int compileCount = 0;
+    int activeCompileCount = 0;
+    int maxActiveCompileCount = 0;
+    bool wasInstanceUsedConcurrently = false;
+    std::atomic<bool> wasRefCountChangedConcurrently;
+
+    StandInState() : wasRefCountChangedConcurrently(false) {}
+};
+
+class StandInBlob : public ISlangBlob
+{
+public:
+    uint32_t m_refCount = 0;
+
+    // ISlangUnknown
+    SLANG_IUNKNOWN_ALL
+
+    // ISlangBlob
+    SLANG_NO_THROW void const* SLANG_MCALL getBufferPointer() SLANG_OVERRIDE { return m_string.Buffer(); }
+    SLANG_NO_THROW size_t SLANG_MCALL getBufferSize() SLANG_OVERRIDE { return m_string.Length(); }
+
+    static ISlangBlob* create(String const& string)
+    {
+        StandInBlob* blob = new StandInBlob();
+        blob->m_string = string;
+        blob->addRef();
+        return blob;
+    }
+
+    virtual ~StandInBlob() {}
+
+protected:
+    ISlangUnknown* getInterface(const Guid& guid)
+    {
+        return (guid == IID_ISlangUnknown || guid == IID_ISlangBlob) ? static_cast<ISlangBlob*>(this) : nullptr;
+    }
+
+    String m_string;
+};
+
+// A stand-in for `fxc`, so that the pooling and parallel invocation of downstream
+// compilers can be tested anywhere. The "code" it produces is the profile and
+// entry point it was asked for, followed by the HLSL it was given.
+class StandInCompiler : public ISlangDownstreamCompiler
+{
+public:
+    uint32_t m_refCount = 0;
+
+    // ISlangUnknown
+    SLANG_IUNKNOWN_QUERY_INTERFACE
+
+    // The reference count isn't atomic, just like that of the compilers built
+    // into Slang, so changes to it must never overlap. Yielding in the middle
+    // of a change gives overlapping changes a chance to be caught.
+    SLANG_NO_THROW uint32_t SLANG_MCALL addRef() SLANG_OVERRIDE
+    {
+        beginRefCountChange();
+        uint32_t refCount = ++m_refCount;
+        endRefCountChange();
+        return refCount;
+    }
+
+    SLANG_NO_THROW uint32_t SLANG_MCALL release() SLANG_OVERRIDE
+    {
+        beginRefCountChange();
+        uint32_t refCount = --m_refCount;
+        endRefCountChange();
+        if (refCount == 0)
+            delete this;
+        return refCount;
+    }
+
+    // ISlangDownstreamCompiler
+    SLANG_NO_THROW SlangResult SLANG_MCALL compile(
+        SlangDownstreamCompileDesc const*   desc,
+        ISlangBlob**                        outCode,
+        ISlangBlob**                        outDiagnostics) SLANG_OVERRIDE
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_state->mutex);
+            m_state->compileCount++;
+            if (m_isInUse)
+                m_state->wasInstanceUsedConcurrently = true;
+            m_isInUse = true;
+
+            m_state->activeCompileCount++;
+            if (m_state->activeCompileCount > m_state->maxActiveCompileCount)
+                m_state->maxActiveCompileCount = m_state->activeCompileCount;
+            m_state->condition.notify_all();
+
+            // Give another compile a chance to start before this one finishes,
+            // so that we can tell whether compiles run at the same time
+            m_state->condition.wait_for(lock, std::chrono::seconds(2),
+                [&]() { return m_state->maxActiveCompileCount > 1; });
+
+            m_state->activeCompileCount--;
+            m_isInUse = false;
+        }
+
+        if (strcmp(desc->entryPointName, "broken") == 0)
+        {
+            *outDiagnostics = StandInBlob::create("stand-in error: can't compile 'broken'\n");
+            return SLANG_FAIL;
+        }
+
+        StringBuilder code;
+        code << "fxc " << desc->profileName << " " << desc->entryPointName << "\n";
+        code.append((char const*)desc->source, (char const*)desc->source + desc->sourceSize);
+        *outCode = StandInBlob::create(code.ProduceString());
+        return SLANG_OK;
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL disassemble(
+        SlangCompileTarget,
+        void const*         code,
+        size_t              codeSize,
+        ISlangBlob**        outAssembly) SLANG_OVERRIDE
+    {
+        StringBuilder assembly;
+        assembly << "disassembly of ";
+        assembly.append((char const*)code, (char const*)code + codeSize);
+        *outAssembly = StandInBlob::create(assembly.ProduceString());
+        return SLANG_OK;
+    }
+
+    StandInCompiler(StandInState* state)
+        : m_state(state)
+        , m_refCountChangeCount(0)
+    {}
+
+    virtual ~StandInCompiler()
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->destroyedInstanceCount++;
+    }
+
+protected:
+    ISlangUnknown* getInterface(const Guid& guid)
+    {
+        return (guid == IID_ISlangUnknown || guid == IID_ISlangDownstreamCompiler) ? static_cast<ISlangDownstreamCompiler*>(this) : nullptr;
+    }
+
+    void beginRefCountChange()
+    {
+        if (m_refCountChangeCount++ != 0)
+            m_state->wasRefCountChangedConcurrently = true;
+        std::this_thread::yield();
+    }
+
+    void endRefCountChange()
+    {
+        m_refCountChangeCount--;
+    }
+
+    StandInState*       m_state;
+    bool                m_isInUse = false;
+    std::atomic<int>    m_refCountChangeCount;
+};
+
+} // anonymous
+
+static SlangResult createStandInCompiler(
+    SlangPassThrough            passThrough,
+    void*                       userData,
+    ISlangDownstreamCompiler**  outCompiler)
+{
+    // This is called from the threads invoking the compiler, so
+    // nothing can be checked here
+    if (passThrough != SLANG_PASS_THROUGH_FXC
+        && passThrough != SLANG_PASS_THROUGH_DXC
+        && passThrough != SLANG_PASS_THROUGH_GLSLANG)
+    {
+        return SLANG_FAIL;
+    }
+
+    auto state = (StandInState*)userData;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->instanceCount++;
+    }
+
+    StandInCompiler* compiler = new StandInCompiler(state);
+    compiler->addRef();
+    *outCompiler = compiler;
+    return SLANG_OK;
+}
+
+static String getEntryPointName(int index)
+{
+    StringBuilder name;
+    name << "main" << index;
+    return name.ProduceString();
+}
+
+static SlangCompileRequest* createRequest(SlangSession* session)
+{
+    StringBuilder source;
+    source << "RWStructuredBuffer<float> gOutput;\n";
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        source << "[numthreads(4, 1, 1)]\n";
+        source << "void " << getEntryPointName(ii) << "(uint3 tid : SV_DispatchThreadID)\n";
+        source << "{\n";
+        source << "    gOutput[tid.x] = " << ii << ";\n";
+        source << "}\n";
+    }
+    source << "[numthreads(4, 1, 1)]\n";
+    source << "void broken(uint3 tid : SV_DispatchThreadID) {}\n";
+
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    spAddCodeGenTarget(request, SLANG_DXBC);
+    spAddCodeGenTarget(request, SLANG_DXBC_ASM);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, "downstream-compiler.slang", source.ProduceString().Buffer());
+    return request;
+}
+
+static void downstreamCompilerUnitTest()
+{
+    StandInState state;
+
+    SlangSession* session = spCreateSession(nullptr);
+    spSetDownstreamCompilerFactory(session, SLANG_PASS_THROUGH_FXC, &createStandInCompiler, &state);
+    spSetDownstreamCompilerThreadCount(session, kThreadCount);
+
+    // Every compile below should invoke the compiler, rather than reuse the output of an earlier one
+    spSetDownstreamOutputCacheMemoryLimit(session, 0);
+
+    // Each entry point is compiled by the stand-in, for both of the targets that need it
+    SlangCompileRequest* request = createRequest(session);
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        spAddEntryPoint(request, 0, getEntryPointName(ii).Buffer(), spFindProfile(session, "cs_5_0"));
+    }
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        String hlsl = getEntryPointCode(request, ii, 0);
+        String expectedCode = String("fxc cs_5_0 ") + getEntryPointName(ii) + "\n" + hlsl;
+        SLANG_CHECK(hlsl.Length() != 0);
+        SLANG_CHECK(getEntryPointCode(request, ii, 1) == expectedCode);
+        SLANG_CHECK(getEntryPointCode(request, ii, 2) == String("disassembly of ") + expectedCode);
+    }
+    spDestroyCompileRequest(request);
+
+    // The compiles ran on several threads at once, with each instance only used by one at a time
+    SLANG_CHECK(state.maxActiveCompileCount > 1);
+    SLANG_CHECK(!state.wasInstanceUsedConcurrently);
+    SLANG_CHECK(!state.wasRefCountChangedConcurrently);
+    SLANG_CHECK(state.instanceCount > 1 && state.instanceCount <= kThreadCount);
+
+    // The instances are pooled, and reused by later requests
+    int instanceCount = state.instanceCount;
+    request = createRequest(session);
+    spAddEntryPoint(request, 0, getEntryPointName(0).Buffer(), spFindProfile(session, "cs_5_0"));
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    spDestroyCompileRequest(request);
+    SLANG_CHECK(state.instanceCount == instanceCount);
+
+    // Errors from the downstream compiler are reported
+    request = createRequest(session);
+    spAddEntryPoint(request, 0, getEntryPointName(0).Buffer(), spFindProfile(session, "cs_5_0"));
+    spAddEntryPoint(request, 0, "broken", spFindProfile(session, "cs_5_0"));
+    SLANG_CHECK(SLANG_FAILED(spCompile(request)));
+    String diagnostics = spGetDiagnosticOutput(request);
+    SLANG_CHECK(diagnostics.IndexOf("stand-in error: can't compile 'broken'") != UInt(-1));
+    spDestroyCompileRequest(request);
+
+    // The downstream compiles of requests compiled together run at the same time,
+    // even though each request here only has one, and the results and diagnostics
+    // go to the request they belong to
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.maxActiveCompileCount = 0;
+    }
+    SlangCompileRequest* batch[kThreadCount];
+    for (int ii = 0; ii < kThreadCount; ++ii)
+    {
+        batch[ii] = spCreateCompileRequest(session);
+        spAddCodeGenTarget(batch[ii], SLANG_DXBC);
+        spAddTranslationUnit(batch[ii], SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+        spAddTranslationUnitSourceString(batch[ii], 0, "downstream-compiler-batch.slang",
+            "[numthreads(4, 1, 1)] void main(uint3 tid : SV_DispatchThreadID) {}\n"
+            "[numthreads(4, 1, 1)] void broken(uint3 tid : SV_DispatchThreadID) {}\n");
+        spAddEntryPoint(batch[ii], 0, ii == 0 ? "broken" : "main", spFindProfile(session, "cs_5_0"));
+    }
+    SLANG_CHECK(SLANG_FAILED(spCompileBatch(batch, kThreadCount)));
+    SLANG_CHECK(state.maxActiveCompileCount > 1);
+    SLANG_CHECK(String(spGetDiagnosticOutput(batch[0])).IndexOf("stand-in error: can't compile 'broken'") != UInt(-1));
+    for (int ii = 1; ii < kThreadCount; ++ii)
+    {
+        SLANG_CHECK(getEntryPointCode(batch[ii], 0, 0).StartsWith("fxc cs_5_0 main\n"));
+        SLANG_CHECK(String(spGetDiagnosticOutput(batch[ii])).Length() == 0);
+    }
+    for (int ii = 0; ii < kThreadCount; ++ii)
+    {
+        spDestroyCompileRequest(batch[ii]);
+    }
+
+    // With library output, the entry points that dxc compiles with a `lib`
+    // profile are compiled together, once, while the others are compiled
+    // one at a time
+    spSetDownstreamCompilerFactory(session, SLANG_PASS_THROUGH_DXC, &createStandInCompiler, &state);
+    request = spCreateCompileRequest(session);
+    int targetIndex = spAddCodeGenTarget(request, SLANG_DXIL);
+    spSetTargetProfile(request, targetIndex, spFindProfile(session, "lib_6_3"));
+    spSetTargetFlags(request, targetIndex, SLANG_TARGET_FLAG_LIBRARY_OUTPUT);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, "downstream-compiler.slang",
+        "RWStructuredBuffer<float> gOutput;\n"
+        "[shader(\"raygeneration\")] void rayGenA() { gOutput[DispatchRaysIndex().x] = 1; }\n"
+        "[shader(\"compute\")] [numthreads(4, 1, 1)] void computeMain(uint3 tid : SV_DispatchThreadID) {}\n"
+        "[shader(\"raygeneration\")] void rayGenB() { gOutput[DispatchRaysIndex().x] = 2; }\n");
+    int compileCount = state.compileCount;
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    SLANG_CHECK(state.compileCount == compileCount + 2);
+
+    String libraryCode = getEntryPointCode(request, 0, 0);
+    SLANG_CHECK(libraryCode.StartsWith("fxc lib_6_3 "));
+    SLANG_CHECK(libraryCode.IndexOf("void rayGenA") != UInt(-1) && libraryCode.IndexOf("void rayGenB") != UInt(-1));
+    SLANG_CHECK(libraryCode.IndexOf("[shader(\"raygeneration\")]") != UInt(-1));
+    SLANG_CHECK(libraryCode.IndexOf("computeMain") == UInt(-1));
+    SLANG_CHECK(getEntryPointCode(request, 2, 0) == libraryCode);
+    SLANG_CHECK(getEntryPointCode(request, 1, 0).StartsWith("fxc cs_6_3 computeMain\n"));
+    spDestroyCompileRequest(request);
+
+    // The session releases the instances it pooled
+    spDestroySession(session);
+    SLANG_CHECK(state.destroyedInstanceCount == state.instanceCount);
+}
+
+static const char kCacheDirectory[] = "downstream-output-cache-test";
+
+// The cache directory only holds files that the cache wrote
+static void removeCacheFiles()
+{
+    for (auto path : osFindFilesInDirectory(String(kCacheDirectory) + "/"))
+    {
+        remove(path.Buffer());
+    }
+}
+
+static int countCacheFiles()
+{
+    int count = 0;
+    for (auto path : osFindFilesInDirectory(String(kCacheDirectory) + "/"))
+    {
+        count++;
+    }
+    return count;
+}
+
+static SlangSession* createCachingSession(StandInState* state, char const* identity)
+{
+    SlangSession* session = spCreateSession(nullptr);
+    spSetDownstreamCompilerFactory(session, SLANG_PASS_THROUGH_FXC, &createStandInCompiler, state, identity);
+    spSetDownstreamCompilerThreadCount(session, kThreadCount);
+    spSetDownstreamOutputCacheDirectory(session, kCacheDirectory);
+    return session;
+}
+
+static SlangCompileRequest* compileAllEntryPoints(SlangSession* session)
+{
+    SlangCompileRequest* request = createRequest(session);
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        spAddEntryPoint(request, 0, getEntryPointName(ii).Buffer(), spFindProfile(session, "cs_5_0"));
+    }
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    return request;
+}
+
+static void downstreamOutputCacheUnitTest()
+{
+    StandInState state;
+    removeCacheFiles();
+
+    // The first compile invokes the compiler for each entry point and binary target
+    SlangSession* session = createCachingSession(&state, "stand-in 1");
+    SlangCompileRequest* request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == 0);
+    SLANG_CHECK(state.compileCount == kEntryPointCount * 2);
+
+    List<String> expectedCode;
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        expectedCode.Add(getEntryPointCode(request, ii, 1));
+        expectedCode.Add(getEntryPointCode(request, ii, 2));
+    }
+    spDestroyCompileRequest(request);
+
+    // Compiling the same code again reuses the output kept in memory
+    request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == kEntryPointCount * 2);
+    SLANG_CHECK(state.compileCount == kEntryPointCount * 2);
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        SLANG_CHECK(getEntryPointCode(request, ii, 1) == expectedCode[ii * 2]);
+        SLANG_CHECK(getEntryPointCode(request, ii, 2) == expectedCode[ii * 2 + 1]);
+    }
+    spDestroyCompileRequest(request);
+
+    // Failures aren't kept, so the compiler is invoked again each time
+    for (int ii = 0; ii < 2; ++ii)
+    {
+        request = createRequest(session);
+        spAddEntryPoint(request, 0, "broken", spFindProfile(session, "cs_5_0"));
+        SLANG_CHECK(SLANG_FAILED(spCompile(request)));
+        spDestroyCompileRequest(request);
+    }
+    SLANG_CHECK(state.compileCount == kEntryPointCount * 2 + 4);
+    spDestroySession(session);
+
+    // Another session reuses the output kept on disk
+    session = createCachingSession(&state, "stand-in 1");
+    request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == kEntryPointCount * 2);
+    SLANG_CHECK(state.compileCount == kEntryPointCount * 2 + 4);
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        SLANG_CHECK(getEntryPointCode(request, ii, 1) == expectedCode[ii * 2]);
+        SLANG_CHECK(getEntryPointCode(request, ii, 2) == expectedCode[ii * 2 + 1]);
+    }
+    spDestroyCompileRequest(request);
+    spDestroySession(session);
+
+    // ...but not the output of another version of the compiler
+    session = createCachingSession(&state, "stand-in 2");
+    request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == 0);
+    SLANG_CHECK(state.compileCount == kEntryPointCount * 4 + 4);
+    spDestroyCompileRequest(request);
+    spDestroySession(session);
+
+    // A compiler that can't be identified has its output kept in memory only
+    removeCacheFiles();
+    session = createCachingSession(&state, nullptr);
+    request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == 0);
+    spDestroyCompileRequest(request);
+    request = compileAllEntryPoints(session);
+    SLANG_CHECK(getCompileStats(request).downstreamCacheHitCount == kEntryPointCount * 2);
+    spDestroyCompileRequest(request);
+    spDestroySession(session);
+    SLANG_CHECK(countCacheFiles() == 0);
+
+    removeCacheFiles();
+    remove(kCacheDirectory);
+}
+
+SLANG_UNIT_TEST("DownstreamCompiler", downstreamCompilerUnitTest);
+SLANG_UNIT_TEST("DownstreamOutputCache", downstreamOutputCacheUnitTest);
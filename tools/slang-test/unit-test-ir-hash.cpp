@@ -0,0 +1,73 @@
+// unit-test-ir-hash.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+static const char kShaderPath[] = "ir-hash-test.slang";
+static SlangCompileRequest* compileSpecialization(SlangCompileRequest* baseRequest, const char* typeName)
+{
+    SlangCompileRequest* request = spCreateSpecializationRequest(baseRequest);
+    spAddEntryPointEx(request, 0, "main", SLANG_STAGE_COMPUTE, 1, &typeName);
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    return request;
+}
+
+static void irHashUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    SlangCompileRequest* baseRequest = spCreateCompileRequest(session);
+    spAddCodeGenTarget(baseRequest, SLANG_HLSL);
+    spAddCodeGenTarget(baseRequest, SLANG_GLSL);
+    int translationUnitIndex = spAddTranslationUnit(baseRequest, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(baseRequest, translationUnitIndex, kShaderPath, kGenericShaderSource);
+    spSetCompileFlags(baseRequest, SLANG_COMPILE_FLAG_NO_CODEGEN);
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(baseRequest)));
+
+    // The first specialization generates code for each target
+    SlangCompileRequest* first = compileSpecialization(baseRequest, "One");
+    SLANG_CHECK(getCompileStats(first).outputCacheHitCount == 0);
+
+    // Specializing with the same type argument again gives the same IR,
+    // so the output generated for the first one is used for every target
+    SlangCompileRequest* second = compileSpecialization(baseRequest, "One");
+    SLANG_CHECK(getCompileStats(second).outputCacheHitCount == 2);
+    for (int ii = 0; ii < 2; ++ii)
+    {
+        String output = getEntryPointCode(first, 0, ii);
+        SLANG_CHECK(output.Length() != 0 && getEntryPointCode(second, 0, ii) == output);
+    }
+
+    // A different type argument gives different IR, and so different output
+    SlangCompileRequest* third = compileSpecialization(baseRequest, "Two");
+    SLANG_CHECK(getCompileStats(third).outputCacheHitCount == 0);
+    String thirdOutput = getEntryPointCode(third, 0, 0);
+    SLANG_CHECK(thirdOutput.Length() != 0 && thirdOutput != getEntryPointCode(first, 0, 0));
+
+    spDestroyCompileRequest(third);
+    spDestroyCompileRequest(second);
+    spDestroyCompileRequest(first);
+    spDestroyCompileRequest(baseRequest);
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("IRHash", irHashUnitTest);
+
+static void irHashStructureUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    // Modules that only differ in a decoration, or in which local
+    // instruction is used as an operand, have to hash differently
+    SLANG_CHECK(spRunInternalCheck(session, "IRStructuralHash") == SLANG_OK);
+    SLANG_CHECK(spRunInternalCheck(session, "NoSuchCheck") == SlangResult(SLANG_E_NOT_FOUND));
+
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("IRHashStructure", irHashStructureUnitTest);
@@ -0,0 +1,94 @@
+// unit-test-lazy-checking.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+// Imports are found relative to the path, in `tests/front-end`
+static const char kShaderPath[] = "tests/front-end/lazy-checking.slang";
+
+// `determinant` isn't used by anything else in the standard library
+static const char kDeterminantSource[] =
+    "RWStructuredBuffer<float> gOutput;\n"
+    "cbuffer C { float3x3 gMatrix; };\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = determinant(gMatrix);\n"
+    "}\n";
+
+// `lazy-checking-module.slang` contains `unusedHelper`, which has an error in its body
+static const char kUsedHelperSource[] =
+    "import lazy_checking_module;\n"
+    "RWStructuredBuffer<float> gOutput;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = usedHelper(1.0);\n"
+    "}\n";
+
+static const char kUnusedHelperSource[] =
+    "import lazy_checking_module;\n"
+    "RWStructuredBuffer<float> gOutput;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = unusedHelper(1.0);\n"
+    "}\n";
+
+static bool compileSucceeds(SlangSession* session, const char* source)
+{
+    SlangResult result;
+    SlangCompileRequest* request = compileComputeShader(session, kShaderPath, source, &result);
+    spDestroyCompileRequest(request);
+    return SLANG_SUCCEEDED(result);
+}
+
+static void lazyCheckingUnitTest()
+{
+    SlangResult result;
+
+    // With the default flags, a standard library function is only checked by the
+    // first request that uses it
+    SlangSession* lazySession = spCreateSession(nullptr);
+
+    SlangCompileRequest* request = compileComputeShader(lazySession, kShaderPath, kDeterminantSource, &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    uint64_t firstLazyCheckCount = getCompileStats(request).declCheckCount;
+    spDestroyCompileRequest(request);
+
+    request = compileComputeShader(lazySession, kShaderPath, kDeterminantSource, &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    uint64_t secondLazyCheckCount = getCompileStats(request).declCheckCount;
+    spDestroyCompileRequest(request);
+
+    SLANG_CHECK(firstLazyCheckCount > secondLazyCheckCount);
+
+    // A session that checks the whole standard library up front has nothing
+    // left to check, so `determinant` was never checked before it was used
+    SlangSession* eagerSession = spCreateSession(nullptr);
+    spSetLazyCheckingFlags(eagerSession, 0);
+
+    request = compileComputeShader(eagerSession, kShaderPath, kDeterminantSource, &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    SLANG_CHECK(getCompileStats(request).declCheckCount == secondLazyCheckCount);
+    spDestroyCompileRequest(request);
+
+    // Imported modules are checked eagerly by default, so the error in
+    // `unusedHelper` is reported even though nothing calls it
+    SLANG_CHECK(!compileSucceeds(lazySession, kUsedHelperSource));
+
+    // ...unless lazy checking is enabled for them too
+    spSetLazyCheckingFlags(lazySession, SLANG_LAZY_CHECKING_STDLIB | SLANG_LAZY_CHECKING_IMPORTED_MODULES);
+    SLANG_CHECK(compileSucceeds(lazySession, kUsedHelperSource));
+    SLANG_CHECK(!compileSucceeds(lazySession, kUnusedHelperSource));
+
+    spDestroySession(eagerSession);
+    spDestroySession(lazySession);
+}
+
+SLANG_UNIT_TEST("LazyChecking", lazyCheckingUnitTest);
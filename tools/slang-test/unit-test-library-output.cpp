@@ -0,0 +1,76 @@
+// unit-test-library-output.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+enum { kEntryPointCount = 4 };
+
+// Every entry point uses the same helper function, type and parameters
+static const char kShaderSource[] =
+    "struct Accumulator { float sum; };\n"
+    "RWStructuredBuffer<float> gOutput;\n"
+    "cbuffer Params { float gScale; uint gCount; };\n"
+    "float accumulate(uint count)\n"
+    "{\n"
+    "    Accumulator acc;\n"
+    "    acc.sum = 0;\n"
+    "    for (uint ii = 0; ii < count; ++ii)\n"
+    "        acc.sum += sqrt(float(ii)) * gScale;\n"
+    "    return acc.sum;\n"
+    "}\n"
+    "[numthreads(8, 1, 1)] void main0(uint3 tid : SV_DispatchThreadID) { gOutput[tid.x] = accumulate(gCount); }\n"
+    "[numthreads(8, 1, 1)] void main1(uint3 tid : SV_DispatchThreadID) { gOutput[tid.x] = accumulate(gCount + 1); }\n"
+    "[numthreads(8, 1, 1)] void main2(uint3 tid : SV_DispatchThreadID) { gOutput[tid.x] = accumulate(gCount * 2); }\n"
+    "[numthreads(8, 1, 1)] void main3(uint3 tid : SV_DispatchThreadID) { gOutput[tid.x] = accumulate(tid.x); }\n";
+
+static SlangCompileRequest* compile(SlangSession* session, SlangTargetFlags targetFlags)
+{
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    spSetTargetFlags(request, 0, targetFlags);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, "library-output.slang", kShaderSource);
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        StringBuilder name;
+        name << "main" << ii;
+        spAddEntryPoint(request, translationUnitIndex, name.ProduceString().Buffer(), spFindProfile(session, "cs_5_0"));
+    }
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    return request;
+}
+
+static void libraryOutputUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    // By default, each entry point gets its own copy of everything it uses
+    SlangCompileRequest* request = compile(session, 0);
+    UInt separateSize = 0;
+    for (int ii = 0; ii < kEntryPointCount; ++ii)
+    {
+        separateSize += getEntryPointCode(request, ii, 0).Length();
+    }
+    spDestroyCompileRequest(request);
+
+    // As a library, the entry points share one copy of their code
+    // (`tests/hlsl/library-output.slang` checks what that code is)
+    request = compile(session, SLANG_TARGET_FLAG_LIBRARY_OUTPUT);
+    String library = getEntryPointCode(request, 0, 0);
+    for (int ii = 1; ii < kEntryPointCount; ++ii)
+    {
+        SLANG_CHECK(getEntryPointCode(request, ii, 0) == library);
+    }
+    spDestroyCompileRequest(request);
+
+    SLANG_CHECK(library.Length() * 2 < separateSize);
+
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("LibraryOutput", libraryOutputUnitTest);
@@ -0,0 +1,73 @@
+// unit-test-member-lookup-cache.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+static const char kShaderPath[] = "member-lookup-cache.slang";
+
+// Only looks up members of standard library types
+static const char kSampleSource[] =
+    "Texture2D gTexture;\n"
+    "SamplerState gSampler;\n"
+    "RWStructuredBuffer<float4> gOutput;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = gTexture.SampleLevel(gSampler, float2(0, 0), 0);\n"
+    "}\n";
+
+static const char kCallSource[] =
+    "RWStructuredBuffer<float> gOutput;\n"
+    "SamplerState gSampler;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = gSampler.getScale();\n"
+    "}\n";
+
+static const char kExtensionSource[] =
+    "extension SamplerState { float getScale() { return 2.0; } }\n";
+
+static void memberLookupCacheUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+    SlangResult result;
+
+    // Lookups into standard library types are still cached after
+    // the request that performed them has been destroyed
+    SlangCompileRequest* request = compileComputeShader(session, kShaderPath, kSampleSource, &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    uint64_t firstHitCount = getCompileStats(request).memberLookupCacheHitCount;
+    spDestroyCompileRequest(request);
+
+    request = compileComputeShader(session, kShaderPath, kSampleSource, &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    SLANG_CHECK(getCompileStats(request).memberLookupCacheHitCount > firstHitCount);
+    spDestroyCompileRequest(request);
+
+    // A failed lookup is cached too...
+    request = compileComputeShader(session, kShaderPath, kCallSource, &result);
+    SLANG_CHECK(SLANG_FAILED(result));
+    spDestroyCompileRequest(request);
+
+    // ...but registering an extension for the type discards it
+    String extendedSource = String(kExtensionSource) + kCallSource;
+    request = compileComputeShader(session, kShaderPath, extendedSource.Buffer(), &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    spDestroyCompileRequest(request);
+
+    // The extension belonged to the module of that request, so later
+    // requests on the session don't see it
+    request = compileComputeShader(session, kShaderPath, kCallSource, &result);
+    SLANG_CHECK(SLANG_FAILED(result));
+    spDestroyCompileRequest(request);
+
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("MemberLookupCache", memberLookupCacheUnitTest);
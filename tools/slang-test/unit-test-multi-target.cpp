@@ -0,0 +1,96 @@
+// unit-test-multi-target.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+// Only uses features the direct SPIR-V path supports, so that it compiles without glslang
+// (when the SPIR-V target asks for direct emission)
+static const char kShaderSource[] =
+    "RWStructuredBuffer<float> gOutput;\n"
+    "cbuffer Params { float gScale; uint gCount; };\n"
+    "[numthreads(8, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    float sum = 0;\n"
+    "    for (uint ii = 0; ii < gCount; ++ii)\n"
+    "        sum += sqrt(float(ii)) * gScale;\n"
+    "    gOutput[tid.x] = sum;\n"
+    "}\n";
+
+namespace // anonymous
+{
+
+struct TargetInfo
+{
+    SlangCompileTarget target;
+    SlangMatrixLayoutMode matrixLayoutMode;
+    SlangTargetFlags flags;
+};
+
+} // anonymous
+
+static SlangCompileRequest* compileForTargets(SlangSession* session, const TargetInfo* targets, int targetCount)
+{
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    for (int ii = 0; ii < targetCount; ++ii)
+    {
+        int targetIndex = spAddCodeGenTarget(request, targets[ii].target);
+        spSetTargetMatrixLayoutMode(request, targetIndex, targets[ii].matrixLayoutMode);
+        spSetTargetFlags(request, targetIndex, targets[ii].flags);
+    }
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, "multi-target.slang", kShaderSource);
+    spAddEntryPoint(request, translationUnitIndex, "main", spFindProfile(session, "cs_5_0"));
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(request)));
+    return request;
+}
+
+static void multiTargetUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    const TargetInfo targets[] =
+    {
+        { SLANG_HLSL,   SLANG_MATRIX_LAYOUT_COLUMN_MAJOR, 0 },
+        { SLANG_GLSL,   SLANG_MATRIX_LAYOUT_COLUMN_MAJOR, 0 },
+        { SLANG_SPIRV,  SLANG_MATRIX_LAYOUT_COLUMN_MAJOR, SLANG_TARGET_FLAG_GENERATE_SPIRV_DIRECTLY },
+        { SLANG_HLSL,   SLANG_MATRIX_LAYOUT_ROW_MAJOR,    0 },
+        { SLANG_HLSL,   SLANG_MATRIX_LAYOUT_COLUMN_MAJOR, 0 },
+    };
+    enum { kTargetCount = SLANG_COUNT_OF(targets) };
+
+    // Each target produces the same code as when it is compiled on its own
+    SlangCompileRequest* request = compileForTargets(session, targets, kTargetCount);
+    uint64_t aloneInstCounts[kTargetCount];
+    for (int ii = 0; ii < kTargetCount; ++ii)
+    {
+        SlangCompileRequest* aloneRequest = compileForTargets(session, &targets[ii], 1);
+        String code = getEntryPointCode(request, 0, ii);
+        SLANG_CHECK(code.Length() != 0 && code == getEntryPointCode(aloneRequest, 0, 0));
+        aloneInstCounts[ii] = getCompileStats(aloneRequest).irInstCreatedCount;
+        spDestroyCompileRequest(aloneRequest);
+    }
+
+    // The IR is only prepared once for HLSL (column major), HLSL (row major) and GLSL,
+    // and shared by the other targets, so no more IR is created than for those three on their own.
+    // (The front-end IR is counted in each of them, so it is subtracted out.)
+    SlangCompileRequest* frontEndRequest = compileForTargets(session, nullptr, 0);
+    uint64_t frontEndInstCount = getCompileStats(frontEndRequest).irInstCreatedCount;
+    spDestroyCompileRequest(frontEndRequest);
+
+    uint64_t expectedInstCount = frontEndInstCount
+        + (aloneInstCounts[0] - frontEndInstCount)
+        + (aloneInstCounts[1] - frontEndInstCount)
+        + (aloneInstCounts[3] - frontEndInstCount);
+    SLANG_CHECK(getCompileStats(request).irInstCreatedCount == expectedInstCount);
+
+    spDestroyCompileRequest(request);
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("MultiTarget", multiTargetUnitTest);
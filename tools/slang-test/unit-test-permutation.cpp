@@ -0,0 +1,148 @@
+// unit-test-permutation.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+// The shader imports `permutation-module-a.slang`, which depends on `USE_DOUBLE_A`,
+// and `permutation-module-b.slang` (also imported by the first), which doesn't depend on anything.
+static const char kShaderPath[] = "tests/front-end/permutation-test.slang";
+static const char kShaderSource[] =
+    "import permutation_module_a;\n"
+    "import permutation_module_b;\n"
+    "RWStructuredBuffer<int> gOutput;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = helperA(tid.x) + helperB(MAIN_VALUE);\n"
+    "}\n";
+
+namespace // anonymous
+{
+
+struct Definition
+{
+    const char* key;
+    const char* value;
+};
+
+} // anonymous
+
+static void addDefinitions(SlangCompileRequest* request, const Definition* definitions, int definitionCount)
+{
+    for (int ii = 0; ii < definitionCount; ++ii)
+    {
+        spAddPreprocessorDefine(request, definitions[ii].key, definitions[ii].value);
+    }
+}
+
+static void setUpRequest(SlangCompileRequest* request)
+{
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, kShaderPath, kShaderSource);
+    spAddEntryPoint(request, translationUnitIndex, "main", spFindProfile(nullptr, "cs_5_0"));
+}
+
+// Compile the shader on its own, to compare the output of a permutation against
+static String compileAlone(SlangSession* session, const Definition* definitions, int definitionCount)
+{
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    setUpRequest(request);
+    addDefinitions(request, definitions, definitionCount);
+
+    String output;
+    if (SLANG_SUCCEEDED(spCompile(request)))
+    {
+        output = spGetEntryPointSource(request, 0);
+    }
+    spDestroyCompileRequest(request);
+    return output;
+}
+
+static void permutationUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    SlangCompileRequest* baseRequest = spCreateCompileRequest(session);
+    setUpRequest(baseRequest);
+
+    const Definition definitions0[] = { { "MAIN_VALUE", "1" } };
+    const Definition definitions1[] = { { "MAIN_VALUE", "2" } };
+    const Definition definitions2[] = { { "MAIN_VALUE", "1" }, { "USE_DOUBLE_A", "1" } };
+    const Definition definitions3[] = { { "MAIN_VALUE", "1" }, { "UNUSED_VALUE", "1" } };
+    const Definition definitions4[] = { { "MAIN_VALUE", "" } };
+
+    struct PermutationInfo
+    {
+        const Definition* definitions;
+        int definitionCount;
+    };
+    const PermutationInfo infos[] =
+    {
+        { definitions0, SLANG_COUNT_OF(definitions0) },
+        { definitions1, SLANG_COUNT_OF(definitions1) },
+        { definitions2, SLANG_COUNT_OF(definitions2) },
+        { definitions3, SLANG_COUNT_OF(definitions3) },
+        { definitions4, SLANG_COUNT_OF(definitions4) },
+    };
+    enum { kPermutationCount = SLANG_COUNT_OF(infos) };
+
+    SlangCompileRequest* permutations[kPermutationCount];
+    for (int ii = 0; ii < kPermutationCount; ++ii)
+    {
+        permutations[ii] = spCreatePermutationRequest(baseRequest);
+        addDefinitions(permutations[ii], infos[ii].definitions, infos[ii].definitionCount);
+    }
+
+    // The base request is kept alive by its permutations
+    spDestroyCompileRequest(baseRequest);
+
+    // Only the last permutation fails (`helperB` is called with no arguments)
+    SLANG_CHECK(SLANG_FAILED(spCompileBatch(permutations, kPermutationCount)));
+
+    // Each permutation that succeeded produces the same code as compiling it on its own
+    for (int ii = 0; ii < kPermutationCount - 1; ++ii)
+    {
+        const char* output = spGetEntryPointSource(permutations[ii], 0);
+        SLANG_CHECK(output && compileAlone(session, infos[ii].definitions, infos[ii].definitionCount) == output);
+    }
+
+    // The first permutation preprocesses everything. The second only needs to preprocess
+    // the shader (which uses `MAIN_VALUE`), and the third only the module that uses
+    // `USE_DOUBLE_A`. Nothing uses `UNUSED_VALUE`, so the fourth shares all of the tokens.
+    uint64_t tokenCounts[kPermutationCount];
+    for (int ii = 0; ii < kPermutationCount; ++ii)
+    {
+        tokenCounts[ii] = getCompileStats(permutations[ii]).tokenCount;
+    }
+    SLANG_CHECK(tokenCounts[1] > 0 && tokenCounts[1] < tokenCounts[0]);
+    SLANG_CHECK(tokenCounts[2] > 0 && tokenCounts[2] < tokenCounts[0]);
+    SLANG_CHECK(tokenCounts[3] == 0);
+
+    // The fourth permutation also shares the translation unit, so it doesn't check anything.
+    // The second and third can't, since the shader and a module it imports are different for them.
+    uint64_t declCheckCounts[kPermutationCount];
+    for (int ii = 0; ii < kPermutationCount; ++ii)
+    {
+        declCheckCounts[ii] = getCompileStats(permutations[ii]).declCheckCount;
+    }
+    SLANG_CHECK(declCheckCounts[1] > 0 && declCheckCounts[2] > 0);
+    SLANG_CHECK(declCheckCounts[3] == 0);
+
+    // Diagnostics can refer to locations in shared modules (here, the overloads of `helperB`)
+    String diagnostics = spGetDiagnosticOutput(permutations[kPermutationCount - 1]);
+    SLANG_CHECK(diagnostics.IndexOf("permutation-module-b.slang") != UInt(-1));
+
+    for (int ii = 0; ii < kPermutationCount; ++ii)
+    {
+        spDestroyCompileRequest(permutations[ii]);
+    }
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("Permutations", permutationUnitTest);
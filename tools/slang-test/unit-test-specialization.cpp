@@ -0,0 +1,169 @@
+// unit-test-specialization.cpp
+
+#include "../../slang.h"
+
+#include "test-context.h"
+
+#include "../../source/core/slang-string.h"
+
+using namespace Slang;
+
+static const char kShaderPath[] = "specialization-test.slang";
+static void addSource(SlangCompileRequest* request)
+{
+    spAddCodeGenTarget(request, SLANG_HLSL);
+    int translationUnitIndex = spAddTranslationUnit(request, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(request, translationUnitIndex, kShaderPath, kGenericShaderSource);
+}
+
+static void addEntryPoint(SlangCompileRequest* request, const char* typeName)
+{
+    spAddEntryPointEx(request, 0, "main", SLANG_STAGE_COMPUTE, 1, &typeName);
+}
+
+// Compile the shader from scratch, to compare the output of a specialization against
+static String compileAlone(SlangSession* session, const char* typeName)
+{
+    SlangCompileRequest* request = spCreateCompileRequest(session);
+    addSource(request);
+    addEntryPoint(request, typeName);
+
+    String output;
+    if (SLANG_SUCCEEDED(spCompile(request)))
+    {
+        output = spGetEntryPointSource(request, 0);
+    }
+    spDestroyCompileRequest(request);
+    return output;
+}
+
+static void specializationUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+
+    // A request that hasn't been compiled can't be specialized
+    SlangCompileRequest* baseRequest = spCreateCompileRequest(session);
+    addSource(baseRequest);
+    SLANG_CHECK(spCreateSpecializationRequest(baseRequest) == nullptr);
+
+    // The base is only checked, not lowered or compiled for any entry point
+    spSetCompileFlags(baseRequest, SLANG_COMPILE_FLAG_NO_CODEGEN);
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(baseRequest)));
+
+    const char* typeNames[] = { "One", "Two", "Twice<Two>", "Twice<Twice<One> >", "NotBase" };
+    enum { kSpecializationCount = SLANG_COUNT_OF(typeNames) };
+
+    SlangCompileRequest* specializations[kSpecializationCount];
+    for (int ii = 0; ii < kSpecializationCount; ++ii)
+    {
+        specializations[ii] = spCreateSpecializationRequest(baseRequest);
+        SLANG_CHECK(specializations[ii] != nullptr);
+        addEntryPoint(specializations[ii], typeNames[ii]);
+    }
+
+    // The base request is kept alive by its specializations
+    spDestroyCompileRequest(baseRequest);
+
+    // Only the last specialization fails (`NotBase` doesn't conform to `IBase`)
+    for (int ii = 0; ii < kSpecializationCount; ++ii)
+    {
+        const SlangResult result = spCompile(specializations[ii]);
+        SLANG_CHECK(SLANG_SUCCEEDED(result) == (ii != kSpecializationCount - 1));
+    }
+
+    // Each specialization that succeeded produces the same code as compiling from scratch,
+    // without preprocessing (or parsing) the source again
+    for (int ii = 0; ii < kSpecializationCount - 1; ++ii)
+    {
+        const char* output = spGetEntryPointSource(specializations[ii], 0);
+        SLANG_CHECK(output && compileAlone(session, typeNames[ii]) == output);
+        SLANG_CHECK(getCompileStats(specializations[ii]).tokenCount == 0);
+    }
+
+    String diagnostics = spGetDiagnosticOutput(specializations[kSpecializationCount - 1]);
+    SLANG_CHECK(diagnostics.IndexOf("NotBase") != UInt(-1));
+
+    for (int ii = 0; ii < kSpecializationCount; ++ii)
+    {
+        spDestroyCompileRequest(specializations[ii]);
+    }
+
+    // A request that has been compiled for an entry point can also be specialized
+    // with other generic arguments
+    baseRequest = spCreateCompileRequest(session);
+    addSource(baseRequest);
+    addEntryPoint(baseRequest, "One");
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(baseRequest)));
+
+    SlangCompileRequest* specialization = spCreateSpecializationRequest(baseRequest);
+    addEntryPoint(specialization, "Twice<One>");
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(specialization)));
+    const char* output = spGetEntryPointSource(specialization, 0);
+    SLANG_CHECK(output && compileAlone(session, "Twice<One>") == output);
+
+    spDestroyCompileRequest(specialization);
+    spDestroyCompileRequest(baseRequest);
+    spDestroySession(session);
+}
+
+static const char kLinkageShaderPath[] = "tests/front-end/specialization-linkage.slang";
+static const char kLinkageShaderSource[] =
+    "import specialization_module;\n"
+    "interface IBase { float compute(); };\n"
+    "struct Scaled : IBase { float compute() { return scale(1.0); } };\n"
+    "struct Fixed<let N : int> : IBase { float compute() { return float(N); } };\n"
+    "__generic_param TImpl : IBase;\n"
+    "RWStructuredBuffer<float> gOutput;\n"
+    "TImpl gImpl;\n"
+    "[numthreads(4, 1, 1)]\n"
+    "void main(uint3 tid : SV_DispatchThreadID)\n"
+    "{\n"
+    "    gOutput[tid.x] = gImpl.compute();\n"
+    "}\n";
+
+static SlangCompileRequest* compileLinkageSpecialization(SlangCompileRequest* baseRequest, const char* typeName, SlangResult* outResult)
+{
+    SlangCompileRequest* request = spCreateSpecializationRequest(baseRequest);
+    addEntryPoint(request, typeName);
+    *outResult = spCompile(request);
+    return request;
+}
+
+static void specializationLinkageUnitTest()
+{
+    SlangSession* session = spCreateSession(nullptr);
+    spSetLazyCheckingFlags(session, SLANG_LAZY_CHECKING_STDLIB | SLANG_LAZY_CHECKING_IMPORTED_MODULES);
+
+    SlangCompileRequest* baseRequest = spCreateCompileRequest(session);
+    spAddCodeGenTarget(baseRequest, SLANG_HLSL);
+    int translationUnitIndex = spAddTranslationUnit(baseRequest, SLANG_SOURCE_LANGUAGE_SLANG, nullptr);
+    spAddTranslationUnitSourceString(baseRequest, translationUnitIndex, kLinkageShaderPath, kLinkageShaderSource);
+    spSetCompileFlags(baseRequest, SLANG_COMPILE_FLAG_NO_CODEGEN);
+    SLANG_CHECK(SLANG_SUCCEEDED(spCompile(baseRequest)));
+
+    SlangResult result;
+    SlangCompileRequest* first = compileLinkageSpecialization(baseRequest, "Scaled", &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    String firstOutput = getEntryPointCode(first, 0, 0);
+    SLANG_CHECK(firstOutput.IndexOf("scale_0(float") != UInt(-1));
+
+    // Checking this type argument checks `count` in the imported module (before
+    // failing, since it isn't a constant), so the module's IR is generated again
+    // by the next specialization...
+    SlangCompileRequest* failed = compileLinkageSpecialization(baseRequest, "Fixed<count()>", &result);
+    SLANG_CHECK(SLANG_FAILED(result));
+
+    // ...which mustn't link against the symbols of the module's old IR
+    SlangCompileRequest* second = compileLinkageSpecialization(baseRequest, "Scaled", &result);
+    SLANG_CHECK(SLANG_SUCCEEDED(result));
+    SLANG_CHECK(getEntryPointCode(second, 0, 0) == firstOutput);
+
+    spDestroyCompileRequest(second);
+    spDestroyCompileRequest(failed);
+    spDestroyCompileRequest(first);
+    spDestroyCompileRequest(baseRequest);
+    spDestroySession(session);
+}
+
+SLANG_UNIT_TEST("Specialization", specializationUnitTest);
+SLANG_UNIT_TEST("SpecializationLinkage", specializationLinkageUnitTest);
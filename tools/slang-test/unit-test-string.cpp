@@ -0,0 +1,94 @@
+// unit-test-string.cpp
+
+#include "../../source/core/slang-string.h"
+
+#include "test-context.h"
+
+using namespace Slang;
+
+static void stringUnitTest()
+{
+    // Lengths either side of the inline capacity
+    {
+        StringBuilder expected;
+        for (int length = 0; length < 80; length++)
+        {
+            String str(expected.Buffer(), expected.Buffer() + length);
+            SLANG_CHECK(str.Length() == UInt(length));
+            SLANG_CHECK(strlen(str.Buffer()) == UInt(length));
+
+            String copy = str;
+            copy.append('x');
+            SLANG_CHECK(str.Length() == UInt(length));
+            SLANG_CHECK(copy.Length() == UInt(length + 1) && copy.EndsWith("x"));
+
+            String moved = _Move(copy);
+            SLANG_CHECK(moved.Length() == UInt(length + 1) && copy.Length() == 0 && copy == "");
+
+            expected.append(char('a' + length % 26));
+        }
+    }
+
+    // Copies share storage, and are unaffected by changes to each other
+    {
+        String a = "a string too long to be stored inline";
+        String b = a;
+        SLANG_CHECK(a.Buffer() == b.Buffer());
+        b.append("!");
+        SLANG_CHECK(a == "a string too long to be stored inline");
+        SLANG_CHECK(b == "a string too long to be stored inline!");
+    }
+
+    // Appending a string to itself, across the switch to heap storage
+    {
+        String str = "0123456789";
+        str.append(str);
+        SLANG_CHECK(str == "01234567890123456789");
+        str.append(str);
+        SLANG_CHECK(str == "0123456789012345678901234567890123456789");
+        str.append(str.getUnownedSlice());
+        SLANG_CHECK(str.Length() == 80 && str.StartsWith("0123") && str.EndsWith("6789"));
+    }
+
+    // Numbers
+    {
+        SLANG_CHECK(String(-123) == "-123");
+        SLANG_CHECK(String(uint64_t(0xFFFFFFFFFFFFFFFFull), 16) == "FFFFFFFFFFFFFFFF");
+        SLANG_CHECK(String(0.5f) == "0.5");
+        StringBuilder sb;
+        sb << "v" << 1 << "_" << 2.5;
+        SLANG_CHECK(sb == "v1_2.5");
+    }
+
+    // Slices of inline and heap strings
+    {
+        String shortStr = "  abc  ";
+        SLANG_CHECK(String(shortStr.Trim()) == "abc");
+        SLANG_CHECK(String(shortStr.SubString(2, 2)) == "ab");
+
+        String longStr = "   a string too long to be stored inline";
+        SLANG_CHECK(String(longStr.TrimStart()) == "a string too long to be stored inline");
+    }
+
+    // Producing strings from a builder
+    {
+        StringBuilder sb;
+        sb << "a builder with a result too long to be inline";
+        String shared = sb.ProduceString();
+        sb << "...";
+        SLANG_CHECK(shared == "a builder with a result too long to be inline");
+        SLANG_CHECK(sb == "a builder with a result too long to be inline...");
+
+        const char* data = sb.Buffer();
+        String handedOff = _Move(sb).ProduceString();
+        SLANG_CHECK(handedOff.Buffer() == data);
+        SLANG_CHECK(sb.Length() == 0);
+
+        sb << "reused";
+        SLANG_CHECK(sb == "reused");
+        sb.Clear();
+        SLANG_CHECK(sb.Length() == 0 && sb == "");
+    }
+}
+
+SLANG_UNIT_TEST("String", stringUnitTest);